@@ -1,44 +1,230 @@
+#include <stdatomic.h>
 #include <string.h>
 
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
 #include "cosmos_devices.h"
 
-// Handle for cosmos_devices_btn_begin
-static bool s_button_begin_handle = false;
+#define TRANSPORT_STACK_SIZE 3072
+#define TRANSPORT_PRIORITY   4
+
+#define BUTTON_STACK_SIZE 3072
+#define BUTTON_PRIORITY   5
+#define BUTTON_RING_MASK  (COSMOS_DEVICES_BUTTON_RING_QTY - 1)
+
+_Static_assert((COSMOS_DEVICES_BUTTON_RING_QTY & BUTTON_RING_MASK) == 0, "COSMOS_DEVICES_BUTTON_RING_QTY must be a power of two");
+
+// Transport task, drains the state change queue
+static TaskHandle_t s_transport_task = NULL;
+static cosmos_devices_publish_cb_t s_publish_cb = NULL;
+static void *s_publish_user_data = NULL;
+
+// Raw edge timestamped by the button ISR
+typedef struct {
+    uint32_t time_ms;
+    uint8_t idx;
+    uint8_t pressed;
+} cosmos_devices_edge_t;
+
+/*
+ * Edge ring, the GPIO ISR service is the only producer and the button
+ * task the only consumer
+ */
+static cosmos_devices_edge_t s_edge[COSMOS_DEVICES_BUTTON_RING_QTY];
+static atomic_uint s_edge_head; // Next edge to write, owned by the ISR
+static atomic_uint s_edge_tail; // Next edge to read, owned by the task
+static atomic_bool s_edge_lost; // The ring was full, the task resyncs from the pins
+
+// Button engine
+static TaskHandle_t s_button_task = NULL;
+static int s_button_pin[COSMOS_DEVICES_BUTTON_MAX];
+static cosmos_devices_button_t s_button[COSMOS_DEVICES_BUTTON_MAX];
+static size_t s_button_qty = 0;
+static cosmos_devices_button_cb_t s_button_cb = NULL;
+static void *s_button_user_data = NULL;
+
+/**
+ * @brief Installs the GPIO ISR service once. Projects that already
+ * installed it themselves keep their flags.
+ *
+ * @return esp_err_t ESP_OK if the service is installed
+ */
+static esp_err_t cosmos_devices_isr_service_begin(void)
+{
+    esp_err_t err = gpio_install_isr_service(ESP_INTR_FLAG_LEVEL3);
+
+    return err == ESP_ERR_INVALID_STATE ? ESP_OK : err;
+}
 
 /**
- * @brief Button ISR setup function
+ * @brief Button ISR, only timestamps the edge. Bounces cost one ring
+ * slot each and wake the task once per burst.
  *
- * @param pButton Pins in which the buttons are be connected
- * @param btn_qty Quantity of buttons used in the ISR
- * @param button_isr_handler ISR handler function
- * @param pDevices Pointer to strutct that contains the
- * devices to be handled
+ * @param pArg Index of the button
  */
-static void cosmos_devices_button_begin(int *pButton, size_t btn_qty, gpio_isr_t button_isr_handler, cosmos_devices_t *pDevices)
+static void IRAM_ATTR cosmos_devices_button_isr(void *pArg)
 {
-    int btn_idx;
+    size_t idx = (size_t)pArg;
+    unsigned head = atomic_load(&s_edge_head);
+    unsigned tail = atomic_load(&s_edge_tail);
+    BaseType_t woken = pdFALSE;
 
-    // Configure the GPIO for each button
-    for (btn_idx = 0; btn_idx < btn_qty; btn_idx++) {
-        // gpio_pad_select_gpio(pButton[btn_idx]);
-        gpio_set_direction(pButton[btn_idx], GPIO_MODE_INPUT);
-        gpio_set_pull_mode(pButton[btn_idx], GPIO_PULLUP_ONLY);
-        gpio_intr_enable(pButton[btn_idx]);
-        gpio_set_intr_type(pButton[btn_idx], GPIO_INTR_POSEDGE);
+    if (head - tail == COSMOS_DEVICES_BUTTON_RING_QTY) {
+        atomic_store(&s_edge_lost, true);
+        return;
+    }
 
-        // Install the ISR service
-        gpio_install_isr_service(ESP_INTR_FLAG_LEVEL3);
+    cosmos_devices_edge_t *pEdge = &s_edge[head & BUTTON_RING_MASK];
+    pEdge->time_ms = (uint32_t)(esp_timer_get_time() / 1000);
+    pEdge->idx = idx;
+    pEdge->pressed = gpio_get_level(s_button_pin[idx]) == 0;
+    atomic_store(&s_edge_head, head + 1);
 
-        // Register the ISR
-        gpio_isr_handler_add(pButton[btn_idx], button_isr_handler, (void *)pDevices[btn_idx].sn);
+    // A non-empty ring means the task is already awake or notified
+    if (head == tail) {
+        vTaskNotifyGiveFromISR(s_button_task, &woken);
+        portYIELD_FROM_ISR(woken);
     }
+}
+
+/**
+ * @brief Button task, feeds the edges to the press machines and sleeps
+ * until the next edge or the next debounce/press timeout
+ *
+ * @param pArg Unused
+ */
+static void cosmos_devices_button_task(void *pArg)
+{
+    TickType_t wait = portMAX_DELAY;
+    cosmos_devices_button_event_e event;
+    unsigned tail = 0;
+    uint32_t now_ms;
+    int32_t next_ms;
+    int32_t btn_ms;
+    size_t idx;
+
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, wait);
 
-    s_button_begin_handle = true;
+        while (tail != atomic_load(&s_edge_head)) {
+            const cosmos_devices_edge_t *pEdge = &s_edge[tail & BUTTON_RING_MASK];
+
+            // Settle what was due before this edge, a late task keeps the exact timing
+            while ((event = cosmos_devices_button_poll(&s_button[pEdge->idx], pEdge->time_ms)) != BUTTON_EVENT_NONE)
+                s_button_cb(pEdge->idx, event, s_button_user_data);
+            cosmos_devices_button_edge(&s_button[pEdge->idx], pEdge->pressed, pEdge->time_ms);
+            atomic_store(&s_edge_tail, ++tail);
+        }
+
+        now_ms = (uint32_t)(esp_timer_get_time() / 1000);
+
+        // Edges were dropped, the pins tell where they ended
+        if (atomic_exchange(&s_edge_lost, false))
+            for (idx = 0; idx < s_button_qty; idx++)
+                if (s_button[idx].raw != (gpio_get_level(s_button_pin[idx]) == 0))
+                    cosmos_devices_button_edge(&s_button[idx], !s_button[idx].raw, now_ms);
+
+        next_ms = -1;
+        for (idx = 0; idx < s_button_qty; idx++) {
+            while ((event = cosmos_devices_button_poll(&s_button[idx], now_ms)) != BUTTON_EVENT_NONE)
+                s_button_cb(idx, event, s_button_user_data);
+
+            btn_ms = cosmos_devices_button_wait_ms(&s_button[idx], now_ms);
+            if (btn_ms >= 0 && (next_ms < 0 || btn_ms < next_ms))
+                next_ms = btn_ms;
+        }
+
+        wait = next_ms < 0 ? portMAX_DELAY : pdMS_TO_TICKS(next_ms) + 1;
+    }
 }
 
-void cosmos_devices_button_monitor(int *pButton, size_t qty, gpio_isr_t button_isr_handler, cosmos_devices_t *pDevices)
+esp_err_t cosmos_devices_button_engine_begin(const int *pButton, size_t qty, cosmos_devices_button_cb_t cb, void *user_data)
 {
-    // Check if button monitor is configured
-    if (s_button_begin_handle == false)
-        cosmos_devices_button_begin(pButton, qty, button_isr_handler, pDevices);
+    gpio_config_t io_conf = {
+        .mode = GPIO_MODE_INPUT,
+        .pull_up_en = GPIO_PULLUP_ENABLE,
+        .pull_down_en = GPIO_PULLDOWN_DISABLE,
+        .intr_type = GPIO_INTR_ANYEDGE,
+    };
+    esp_err_t err;
+    size_t idx;
+
+    if (pButton == NULL || cb == NULL || qty == 0 || qty > COSMOS_DEVICES_BUTTON_MAX)
+        return ESP_ERR_INVALID_ARG;
+    if (s_button_task)
+        return ESP_ERR_INVALID_STATE;
+
+    for (idx = 0; idx < qty; idx++) {
+        s_button_pin[idx] = pButton[idx];
+        io_conf.pin_bit_mask |= BIT64(pButton[idx]);
+    }
+
+    s_button_qty = qty;
+    s_button_cb = cb;
+    s_button_user_data = user_data;
+
+    if ((err = gpio_config(&io_conf)) != ESP_OK)
+        return err;
+
+    // Start from the current levels, a button held at boot does not click
+    for (idx = 0; idx < qty; idx++) {
+        s_button[idx].raw = gpio_get_level(pButton[idx]) == 0;
+        s_button[idx].pressed = s_button[idx].raw;
+    }
+
+    // The task must exist before the first edge notifies it
+    if (xTaskCreate(cosmos_devices_button_task, "cosmos_button", BUTTON_STACK_SIZE, NULL, BUTTON_PRIORITY, &s_button_task) != pdPASS)
+        return ESP_ERR_NO_MEM;
+
+    if ((err = cosmos_devices_isr_service_begin()) != ESP_OK)
+        return err;
+
+    for (idx = 0; idx < qty; idx++)
+        if ((err = gpio_isr_handler_add(pButton[idx], cosmos_devices_button_isr, (void *)idx)) != ESP_OK)
+            return err;
+
+    return ESP_OK;
+}
+
+esp_err_t cosmos_devices_button_monitor(const int *pButton, size_t qty, cosmos_devices_button_cb_t cb, cosmos_devices_t *pDevices)
+{
+    return cosmos_devices_button_engine_begin(pButton, qty, cb, pDevices);
+}
+
+/**
+ * @brief Transport task, hands the coalesced state changes to the
+ * publish callback once per COSMOS_DEVICES_QUEUE_FLUSH_MS
+ *
+ * @param pArg Unused
+ */
+static void cosmos_devices_transport_task(void *pArg)
+{
+    static cosmos_devices_state_t batch[COSMOS_DEVICES_QUEUE_QTY];
+    TickType_t last_wake = xTaskGetTickCount();
+    size_t qty;
+
+    for (;;) {
+        vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(COSMOS_DEVICES_QUEUE_FLUSH_MS));
+
+        while ((qty = cosmos_devices_queue_drain(batch, COSMOS_DEVICES_QUEUE_QTY)) > 0)
+            s_publish_cb(batch, qty, s_publish_user_data);
+    }
+}
+
+esp_err_t cosmos_devices_transport_begin(cosmos_devices_publish_cb_t publish_cb, void *user_data)
+{
+    if (publish_cb == NULL)
+        return ESP_ERR_INVALID_ARG;
+    if (s_transport_task)
+        return ESP_ERR_INVALID_STATE;
+
+    s_publish_cb = publish_cb;
+    s_publish_user_data = user_data;
+
+    if (xTaskCreate(cosmos_devices_transport_task, "cosmos_transport", TRANSPORT_STACK_SIZE, NULL, TRANSPORT_PRIORITY, &s_transport_task) != pdPASS)
+        return ESP_ERR_NO_MEM;
+
+    return ESP_OK;
 }
\ No newline at end of file
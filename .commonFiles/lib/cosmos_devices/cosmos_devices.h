@@ -2,9 +2,16 @@
 #define MAIN_COSMOS_DEVICES_H_
 
 #include <driver/gpio.h>
+#include <esp_err.h>
 
-#define RX_CONTROL "/rx_control"
-#define RX_STATE   "/rx_state"
+#include "cosmos_devices_button.h"
+#include "cosmos_devices_index.h"
+#include "cosmos_devices_queue.h"
+#include "cosmos_devices_router.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
 
 #define COSMOS_MAP(x, in_min, in_max, out_min, out_max) ((x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min) /*!< Arduino style map function */
 
@@ -30,18 +37,139 @@ typedef enum {
     DEVICE_TYPE_SNR,     /*!< Sensor */
     DEVICE_TYPE_CAM,     /*!< Camera */
     DEVICE_TYPE_MOT,     /*!< DC Motor */
+    DEVICE_TYPE_PMP,     /*!< Pump */
+    DEVICE_TYPE_QTY,
 } cosmos_devices_type_e;
 
+typedef struct cosmos_devices_group cosmos_devices_group_t;
+
+/**
+ * @brief Entry points of a device type, each cosmos_* module exports one
+ *
+ */
+typedef struct {
+    esp_err_t (*begin)(const cosmos_devices_group_t *pGroup);                                     /*!< Sets up every device of the group, NULL if there is nothing to set up */
+    esp_err_t (*control)(const cosmos_devices_group_t *pGroup, size_t idx, const char *pPayload); /*!< Applies a command to the device at idx */
+} cosmos_devices_handler_t;
+
+/**
+ * @brief Devices of one type, as given to their module. Declare the
+ * groups of a project in a constexpr table, e.g.
+ *
+ * static constexpr cosmos_devices_group_t registry[] = {
+ *     {DEVICE_TYPE_PWR, &cosmos_power_handler, power, QTY(power), NULL},
+ *     {DEVICE_TYPE_LSC, &cosmos_light_handler, light, QTY(light), NULL},
+ * };
+ */
+struct cosmos_devices_group {
+    cosmos_devices_type_e type;               /*!< Type of every device in the group, one group per type */
+    const cosmos_devices_handler_t *pHandler; /*!< Handler of the type */
+    void *pDevices;                           /*!< Device array of the module, e.g. cosmos_devices_t or cosmos_light_info_t */
+    size_t qty;                               /*!< Quantity of devices */
+    void *pArg;                               /*!< Extra argument of the handler, see its module */
+};
+
+/**
+ * @brief Sets up every device of the registry at boot, so the first
+ * command doesn't pay for the hardware setup. Then it compiles a
+ * "<sn>/rx_control" route into the topic router for every device
+ * of the registry. Call it after cosmos_state_begin.
+ *
+ * @param pGroup Groups, one per type. This should last for the lifetime of the program
+ * @param qty Quantity of groups
+ * @return esp_err_t - ESP_OK on success,
+ *                     ESP_ERR_INVALID_ARG if a group has no handler, a bad type or repeats a type
+ *                     ESP_ERR_NO_MEM if the router is full, see COSMOS_DEVICES_ROUTER_ROUTES
+ *                     appropriate error code of the handler otherwise
+ */
+esp_err_t cosmos_devices_registry_begin(const cosmos_devices_group_t *pGroup, size_t qty);
+
+/**
+ * @brief Routes a command to its handler in a single pass over the topic,
+ * however many devices the node hosts. Devices of the registry are routed
+ * to the handler of their type, other patterns can be added with
+ * cosmos_devices_router_add.
+ *
+ * @param pTopic Topic, e.g. "<sn>/rx_control"
+ * @param pPayload Command, its format depends on the handler
+ * @return esp_err_t - ESP_OK on success,
+ *                     ESP_ERR_NOT_FOUND if no route matches the topic
+ *                     appropriate error code of the handler otherwise
+ */
+esp_err_t cosmos_devices_dispatch(const char *pTopic, const char *pPayload);
+
+/**
+ * @brief Delivers a batch of coalesced state changes, e.g. publishes
+ * "<value>" on "<sn>/rx_state" for each record
+ *
+ * @param pState State changes, one per device
+ * @param qty Quantity of records
+ * @param user_data User data given to cosmos_devices_transport_begin
+ */
+typedef void (*cosmos_devices_publish_cb_t)(const cosmos_devices_state_t *pState, size_t qty, void *user_data);
+
+/**
+ * @brief Starts the transport task. Every COSMOS_DEVICES_QUEUE_FLUSH_MS it
+ * drains the state changes queued by the cosmos_* modules and hands them
+ * to the callback in batches, one record per device however many times
+ * it toggled in between.
+ *
+ * @param publish_cb Called from the transport task with each batch
+ * @param user_data User data passed to the callback
+ * @return esp_err_t - ESP_OK on success,
+ *                     ESP_ERR_INVALID_ARG if publish_cb is NULL
+ *                     ESP_ERR_INVALID_STATE if the task is already running
+ *                     ESP_ERR_NO_MEM if the task can't be created
+ */
+esp_err_t cosmos_devices_transport_begin(cosmos_devices_publish_cb_t publish_cb, void *user_data);
+
+/**
+ * @brief Delivers a button event
+ *
+ * @param btn_idx Index of the button in the array given to cosmos_devices_button_engine_begin
+ * @param event Click, double click, long press, hold repeat or long release
+ * @param user_data User data given to cosmos_devices_button_engine_begin
+ */
+typedef void (*cosmos_devices_button_cb_t)(size_t btn_idx, cosmos_devices_button_event_e event, void *user_data);
+
+/**
+ * @brief Starts the button engine. Buttons are active low with the internal
+ * pull-up. The ISR only timestamps edges, one task debounces them and turns
+ * them into high-level events, so a bouncing contact costs nothing past the ISR.
+ *
+ * @param pButton Pins in which the buttons are connected, copied
+ * @param qty Quantity of buttons, up to COSMOS_DEVICES_BUTTON_MAX
+ * @param cb Called from the button task with each event
+ * @param user_data User data passed to the callback
+ * @return esp_err_t - ESP_OK on success,
+ *                     ESP_ERR_INVALID_ARG if an argument is NULL or qty is out of range
+ *                     ESP_ERR_INVALID_STATE if the engine is already running
+ *                     ESP_ERR_NO_MEM if the task can't be created
+ *                     appropriate error code otherwise
+ */
+esp_err_t cosmos_devices_button_engine_begin(const int *pButton, size_t qty, cosmos_devices_button_cb_t cb, void *user_data);
+
 /**
  * @brief Call this function whenever you need to
- * use buttons to locally control any device.
+ * use buttons to locally control any device. The
+ * buttons run on the button engine, which only
+ * takes one set of buttons: call it once, with
+ * every button of the project.
  *
- * @param pButton Pins in which the buttons are be connected
- * @param qty Quantity of buttons used in the ISR
- * @param button_isr_handler ISR handler function
+ * @param pButton Pins in which the buttons are connected, one per device
+ * @param qty Quantity of buttons, up to COSMOS_DEVICES_BUTTON_MAX
+ * @param cb Called from the button task with each event, btn_idx is the index of the device
  * @param pDevices Pointer to strutct that contains the
- * devices to be handled
+ * devices to be handled, passed to cb as user_data
+ * @return esp_err_t - ESP_OK on success,
+ *                     ESP_ERR_INVALID_STATE if the engine is already running,
+ *                     the new buttons are not monitored
+ *                     see cosmos_devices_button_engine_begin otherwise
  */
-void cosmos_devices_button_monitor(int *pButton, size_t qty, gpio_isr_t button_isr_handler, cosmos_devices_t *pDevices);
+esp_err_t cosmos_devices_button_monitor(const int *pButton, size_t qty, cosmos_devices_button_cb_t cb, cosmos_devices_t *pDevices);
+
+#ifdef __cplusplus
+}
+#endif
 
 #endif /* MAIN_COSMOS_DEVICES_H_ */
\ No newline at end of file
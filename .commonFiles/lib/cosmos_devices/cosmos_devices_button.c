@@ -0,0 +1,128 @@
+#include "cosmos_devices_button.h"
+
+// States of the press machine
+enum {
+    ST_IDLE = 0, // Released
+    ST_DOWN,     // Pressed, waiting for the release or the long press
+    ST_UP_WAIT,  // Released after a short press, waiting for a second one
+    ST_DOWN2,    // Second press
+    ST_HOLD,     // Long press, repeating while held
+    ST_QTY,
+};
+
+// Inputs of the press machine
+enum {
+    IN_PRESS = 0, // Debounced press
+    IN_RELEASE,   // Debounced release
+    IN_TIMEOUT,   // Deadline reached
+    IN_QTY,
+};
+
+#define KEEP 0xFF // Input ignored in that state, the state and its timeout are kept
+
+typedef struct {
+    uint8_t next;       // Next state, KEEP to ignore the input
+    uint8_t event;      // cosmos_devices_button_event_e emitted
+    uint16_t timeout;   // Timeout armed in the next state, 0 for none
+} cosmos_devices_button_tr_t;
+
+#define TR(next, event, timeout) {(next), (event), (timeout)}
+#define IGNORE                   TR(KEEP, BUTTON_EVENT_NONE, 0)
+
+static const cosmos_devices_button_tr_t s_fsm[ST_QTY][IN_QTY] = {
+    [ST_IDLE] = {
+        [IN_PRESS] = TR(ST_DOWN, BUTTON_EVENT_NONE, COSMOS_DEVICES_BUTTON_LONG_MS),
+        [IN_RELEASE] = IGNORE,
+        [IN_TIMEOUT] = IGNORE,
+    },
+    [ST_DOWN] = {
+        [IN_PRESS] = IGNORE,
+        [IN_RELEASE] = TR(ST_UP_WAIT, BUTTON_EVENT_NONE, COSMOS_DEVICES_BUTTON_DOUBLE_MS),
+        [IN_TIMEOUT] = TR(ST_HOLD, BUTTON_EVENT_LONG_PRESS, COSMOS_DEVICES_BUTTON_REPEAT_MS),
+    },
+    [ST_UP_WAIT] = {
+        [IN_PRESS] = TR(ST_DOWN2, BUTTON_EVENT_NONE, COSMOS_DEVICES_BUTTON_LONG_MS),
+        [IN_RELEASE] = IGNORE,
+        [IN_TIMEOUT] = TR(ST_IDLE, BUTTON_EVENT_CLICK, 0),
+    },
+    [ST_DOWN2] = {
+        [IN_PRESS] = IGNORE,
+        [IN_RELEASE] = TR(ST_IDLE, BUTTON_EVENT_DOUBLE_CLICK, 0),
+        [IN_TIMEOUT] = TR(ST_HOLD, BUTTON_EVENT_LONG_PRESS, COSMOS_DEVICES_BUTTON_REPEAT_MS),
+    },
+    [ST_HOLD] = {
+        [IN_PRESS] = IGNORE,
+        [IN_RELEASE] = TR(ST_IDLE, BUTTON_EVENT_LONG_RELEASE, 0),
+        [IN_TIMEOUT] = TR(ST_HOLD, BUTTON_EVENT_HOLD_REPEAT, COSMOS_DEVICES_BUTTON_REPEAT_MS),
+    },
+};
+
+/**
+ * @brief Runs one input through the transition table
+ *
+ * @param pButton Button state
+ * @param input IN_PRESS, IN_RELEASE or IN_TIMEOUT
+ * @param at_ms Time the input happened, timeouts are armed from it
+ * @return cosmos_devices_button_event_e Event of the transition
+ */
+static cosmos_devices_button_event_e cosmos_devices_button_step(cosmos_devices_button_t *pButton, int input, uint32_t at_ms)
+{
+    const cosmos_devices_button_tr_t *pTr = &s_fsm[pButton->state][input];
+
+    if (pTr->next == KEEP)
+        return BUTTON_EVENT_NONE;
+
+    pButton->state = pTr->next;
+    pButton->armed = pTr->timeout != 0;
+    pButton->deadline_ms = at_ms + pTr->timeout;
+
+    return (cosmos_devices_button_event_e)pTr->event;
+}
+
+void cosmos_devices_button_edge(cosmos_devices_button_t *pButton, bool pressed, uint32_t now_ms)
+{
+    pButton->raw = pressed;
+    pButton->edge_ms = now_ms;
+}
+
+cosmos_devices_button_event_e cosmos_devices_button_poll(cosmos_devices_button_t *pButton, uint32_t now_ms)
+{
+    cosmos_devices_button_event_e event = BUTTON_EVENT_NONE;
+    uint32_t settle_ms;
+
+    // Silent transitions are chained until one emits or nothing else is due
+    while (event == BUTTON_EVENT_NONE) {
+        settle_ms = pButton->edge_ms + COSMOS_DEVICES_BUTTON_DEBOUNCE_MS;
+
+        // Timeouts that expired before the level settled go first, in time order
+        if (pButton->armed && (int32_t)(now_ms - pButton->deadline_ms) >= 0 &&
+            (pButton->raw == pButton->pressed || (int32_t)(pButton->deadline_ms - settle_ms) < 0)) {
+            event = cosmos_devices_button_step(pButton, IN_TIMEOUT, pButton->deadline_ms);
+        }
+        // A level that held for the debounce time is the new level, from the time it settled
+        else if (pButton->raw != pButton->pressed && (int32_t)(now_ms - settle_ms) >= 0) {
+            pButton->pressed = pButton->raw;
+            event = cosmos_devices_button_step(pButton, pButton->pressed ? IN_PRESS : IN_RELEASE, settle_ms);
+        } else {
+            break;
+        }
+    }
+
+    return event;
+}
+
+int32_t cosmos_devices_button_wait_ms(const cosmos_devices_button_t *pButton, uint32_t now_ms)
+{
+    int32_t wait = INT32_MAX;
+
+    if (pButton->raw != pButton->pressed)
+        wait = (int32_t)(pButton->edge_ms + COSMOS_DEVICES_BUTTON_DEBOUNCE_MS - now_ms);
+
+    if (pButton->armed && (int32_t)(pButton->deadline_ms - now_ms) < wait)
+        wait = (int32_t)(pButton->deadline_ms - now_ms);
+
+    if (wait == INT32_MAX)
+        return -1;
+
+    return wait < 0 ? 0 : wait;
+}
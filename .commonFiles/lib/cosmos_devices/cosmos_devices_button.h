@@ -0,0 +1,79 @@
+#ifndef MAIN_COSMOS_DEVICES_BUTTON_H_
+#define MAIN_COSMOS_DEVICES_BUTTON_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define COSMOS_DEVICES_BUTTON_MAX         8   /*!< Buttons the engine can watch */
+#define COSMOS_DEVICES_BUTTON_RING_QTY    32  /*!< Edges buffered between the ISRs and the task, power of two */
+#define COSMOS_DEVICES_BUTTON_DEBOUNCE_MS 30  /*!< A level must hold this long to count */
+#define COSMOS_DEVICES_BUTTON_LONG_MS     600 /*!< Press length that makes a long press */
+#define COSMOS_DEVICES_BUTTON_DOUBLE_MS   300 /*!< Window for the second click after a release */
+#define COSMOS_DEVICES_BUTTON_REPEAT_MS   200 /*!< Hold-repeat period after a long press */
+
+/**
+ * @brief High-level button events
+ *
+ */
+typedef enum {
+    BUTTON_EVENT_NONE = 0,     /*!< Nothing to report */
+    BUTTON_EVENT_CLICK,        /*!< Short press, no second click within COSMOS_DEVICES_BUTTON_DOUBLE_MS */
+    BUTTON_EVENT_DOUBLE_CLICK, /*!< Two short presses */
+    BUTTON_EVENT_LONG_PRESS,   /*!< Held for COSMOS_DEVICES_BUTTON_LONG_MS */
+    BUTTON_EVENT_HOLD_REPEAT,  /*!< Still held, every COSMOS_DEVICES_BUTTON_REPEAT_MS after the long press */
+    BUTTON_EVENT_LONG_RELEASE, /*!< Released after a long press */
+    BUTTON_EVENT_QTY,
+} cosmos_devices_button_event_e;
+
+/**
+ * @brief State of a button, owned by the engine task
+ *
+ */
+typedef struct {
+    uint32_t edge_ms;     /*!< Time of the last raw edge */
+    uint32_t deadline_ms; /*!< Time of the pending timeout, if armed */
+    uint8_t state;        /*!< State of the press machine */
+    bool raw;             /*!< Level after the last raw edge, true is pressed */
+    bool pressed;         /*!< Debounced level */
+    bool armed;           /*!< A timeout is pending */
+} cosmos_devices_button_t;
+
+/**
+ * @brief Records a raw edge. Bounces only move the edge time, nothing
+ * is resolved until the level holds for COSMOS_DEVICES_BUTTON_DEBOUNCE_MS.
+ * Poll at the edge time first so a late caller loses no press.
+ *
+ * @param pButton Button state
+ * @param pressed Level after the edge, true is pressed
+ * @param now_ms Time of the edge
+ */
+void cosmos_devices_button_edge(cosmos_devices_button_t *pButton, bool pressed, uint32_t now_ms);
+
+/**
+ * @brief Resolves the debounced level and the timeouts due at now_ms.
+ * Call it until it returns BUTTON_EVENT_NONE.
+ *
+ * @param pButton Button state
+ * @param now_ms Current time
+ * @return cosmos_devices_button_event_e Event, BUTTON_EVENT_NONE if nothing is due
+ */
+cosmos_devices_button_event_e cosmos_devices_button_poll(cosmos_devices_button_t *pButton, uint32_t now_ms);
+
+/**
+ * @brief Time left until the button needs to be polled again
+ *
+ * @param pButton Button state
+ * @param now_ms Current time
+ * @return int32_t Milliseconds, 0 if it is due now, -1 if it only waits for an edge
+ */
+int32_t cosmos_devices_button_wait_ms(const cosmos_devices_button_t *pButton, uint32_t now_ms);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAIN_COSMOS_DEVICES_BUTTON_H_ */
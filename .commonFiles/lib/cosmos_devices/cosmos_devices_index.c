@@ -0,0 +1,114 @@
+#include <stdbool.h>
+#include <string.h>
+
+#include "cosmos_devices_index.h"
+
+#define FNV_OFFSET 2166136261u
+#define FNV_PRIME  16777619u
+
+// Open addressing table, linear probing. Written at begin time only
+static cosmos_devices_index_entry_t s_slot[COSMOS_DEVICES_INDEX_SLOTS];
+static size_t s_count = 0;
+
+static uint32_t cosmos_devices_index_hash(const char *pKey, size_t len)
+{
+    uint32_t hash = FNV_OFFSET;
+    for (size_t i = 0; i < len; i++) {
+        hash ^= (uint8_t)pKey[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+/**
+ * @brief Probes for a key
+ *
+ * @param pKey Serial number
+ * @param len Length of the serial number
+ * @param hash Hash of the serial number
+ * @return size_t Slot holding the key, or the empty slot where it would go
+ */
+static size_t cosmos_devices_index_probe(const char *pKey, size_t len, uint32_t hash)
+{
+    size_t slot = hash & (COSMOS_DEVICES_INDEX_SLOTS - 1);
+
+    // Never loops forever, the table is kept below COSMOS_DEVICES_INDEX_MAX entries
+    while (s_slot[slot].pDevice) {
+        if (s_slot[slot].hash == hash && s_slot[slot].sn_len == len && memcmp(s_slot[slot].sn, pKey, len) == 0)
+            break;
+        slot = (slot + 1) & (COSMOS_DEVICES_INDEX_SLOTS - 1);
+    }
+    return slot;
+}
+
+int cosmos_devices_index_add(const char *sn, int type, size_t idx, const void *pDevice)
+{
+    if (sn == NULL || pDevice == NULL || idx > UINT8_MAX)
+        return -1;
+
+    size_t len = strlen(sn);
+    uint32_t hash = cosmos_devices_index_hash(sn, len);
+    size_t slot = cosmos_devices_index_probe(sn, len, hash);
+
+    if (s_slot[slot].pDevice) {
+        // Same serial number on two devices would make commands ambiguous
+        if (s_slot[slot].pDevice != pDevice)
+            return -1;
+    } else {
+        if (s_count >= COSMOS_DEVICES_INDEX_MAX)
+            return -1;
+        s_count++;
+    }
+
+    s_slot[slot].pDevice = pDevice;
+    s_slot[slot].sn = sn;
+    s_slot[slot].hash = hash;
+    s_slot[slot].sn_len = len;
+    s_slot[slot].type = type;
+    s_slot[slot].idx = idx;
+    return 0;
+}
+
+const cosmos_devices_index_entry_t *cosmos_devices_index_find(const char *pKey, size_t len)
+{
+    if (pKey == NULL || s_count == 0)
+        return NULL;
+
+    size_t slot = cosmos_devices_index_probe(pKey, len, cosmos_devices_index_hash(pKey, len));
+    return s_slot[slot].pDevice ? &s_slot[slot] : NULL;
+}
+
+const cosmos_devices_index_entry_t *cosmos_devices_index_find_topic(const char *pTopic)
+{
+    if (pTopic == NULL)
+        return NULL;
+
+    // Serial number is the segment ending at the last '/'
+    const char *pEnd = NULL;
+    const char *pStart = pTopic;
+    const char *p;
+    for (p = pTopic; *p; p++) {
+        if (*p == '/') {
+            if (pEnd)
+                pStart = pEnd + 1;
+            pEnd = p;
+        }
+    }
+    if (pEnd == NULL)
+        pEnd = p;
+
+    return cosmos_devices_index_find(pStart, pEnd - pStart);
+}
+
+void cosmos_devices_index_foreach(void (*cb)(const cosmos_devices_index_entry_t *pEntry, void *pArg), void *pArg)
+{
+    for (size_t slot = 0; slot < COSMOS_DEVICES_INDEX_SLOTS; slot++)
+        if (s_slot[slot].pDevice)
+            cb(&s_slot[slot], pArg);
+}
+
+void cosmos_devices_index_clear(void)
+{
+    memset(s_slot, 0, sizeof(s_slot));
+    s_count = 0;
+}
@@ -0,0 +1,83 @@
+#ifndef MAIN_COSMOS_DEVICES_INDEX_H_
+#define MAIN_COSMOS_DEVICES_INDEX_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define COSMOS_DEVICES_INDEX_SLOTS 64 /*!< Hash slots, power of two */
+#define COSMOS_DEVICES_INDEX_MAX   48 /*!< Devices that can be registered, keeps probe chains short */
+
+#define RX_CONTROL "/rx_control" /*!< Commands for a device, "<sn>/rx_control" */
+#define RX_STATE   "/rx_state"   /*!< States reported by a device, "<sn>/rx_state" */
+
+/**
+ * @brief Where a serial number lives: the device type and
+ * its position in the array given to the *_begin function
+ *
+ */
+typedef struct {
+    const void *pDevice; /*!< Device registered, NULL for an empty slot */
+    const char *sn;      /*!< Serial number, points into the device struct */
+    uint32_t hash;       /*!< FNV-1a of the serial number */
+    uint16_t sn_len;     /*!< Length of the serial number */
+    uint8_t type;        /*!< cosmos_devices_type_e */
+    uint8_t idx;         /*!< Index in the device array of its module */
+} cosmos_devices_index_entry_t;
+
+/**
+ * @brief Registers a serial number. Called by the *_begin functions,
+ * before any command is dispatched. Registering the same device again
+ * just updates it.
+ *
+ * @param sn Serial number, must outlive the index
+ * @param type cosmos_devices_type_e of the device
+ * @param idx Index in the device array of its module
+ * @param pDevice Device struct, used to tell which device an entry is for
+ * @return int 0 on success, -1 if the index is full or the serial number
+ * is already taken by another device
+ */
+int cosmos_devices_index_add(const char *sn, int type, size_t idx, const void *pDevice);
+
+/**
+ * @brief Resolves a serial number with one hash and, in the usual case,
+ * a single compare
+ *
+ * @param pKey Serial number, not necessarily NUL terminated
+ * @param len Length of the serial number
+ * @return const cosmos_devices_index_entry_t* Entry, NULL if unknown
+ */
+const cosmos_devices_index_entry_t *cosmos_devices_index_find(const char *pKey, size_t len);
+
+/**
+ * @brief Resolves the serial number of a topic, the segment before the
+ * last '/' as in "<sn>/rx_control". A topic without '/' is taken as is.
+ *
+ * @param pTopic Topic, NUL terminated
+ * @return const cosmos_devices_index_entry_t* Entry, NULL if unknown
+ */
+const cosmos_devices_index_entry_t *cosmos_devices_index_find_topic(const char *pTopic);
+
+/**
+ * @brief Visits every registered device, in slot order. Entries stay
+ * at the same address until the index is cleared.
+ *
+ * @param cb Called with each entry
+ * @param pArg Argument passed to the callback
+ */
+void cosmos_devices_index_foreach(void (*cb)(const cosmos_devices_index_entry_t *pEntry, void *pArg), void *pArg);
+
+/**
+ * @brief Empties the index
+ *
+ */
+void cosmos_devices_index_clear(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAIN_COSMOS_DEVICES_INDEX_H_ */
@@ -0,0 +1,106 @@
+#include <stdatomic.h>
+#include <stdbool.h>
+
+#include "cosmos_devices_queue.h"
+
+#define QUEUE_MASK (COSMOS_DEVICES_QUEUE_QTY - 1)
+
+_Static_assert((COSMOS_DEVICES_QUEUE_QTY & QUEUE_MASK) == 0, "COSMOS_DEVICES_QUEUE_QTY must be a power of two");
+
+/*
+ * Bounded multi-producer queue, one sequence number per cell. A cell
+ * at position pos is free for the producer holding pos when its
+ * sequence is pos, and ready for the consumer when it is pos + 1.
+ * Sequences are stored minus the cell index, so the zeroed array
+ * already is the empty queue.
+ */
+typedef struct {
+    atomic_uint seq;
+    cosmos_devices_state_t state;
+} cosmos_devices_queue_cell_t;
+
+static cosmos_devices_queue_cell_t s_cell[COSMOS_DEVICES_QUEUE_QTY];
+static atomic_uint s_head;    // Next position to push, shared by the producers
+static unsigned s_tail;       // Next position to pop, owned by the consumer
+static atomic_uint s_dropped; // Changes that found the queue full
+
+int cosmos_devices_queue_push(const char *sn, int type, size_t idx, uint32_t value)
+{
+    unsigned pos = atomic_load_explicit(&s_head, memory_order_relaxed);
+    cosmos_devices_queue_cell_t *pCell;
+
+    for (;;) {
+        pCell = &s_cell[pos & QUEUE_MASK];
+        unsigned seq = atomic_load_explicit(&pCell->seq, memory_order_acquire) + (pos & QUEUE_MASK);
+        int diff = (int)(seq - pos);
+
+        if (diff == 0) {
+            // Claim the cell, on failure pos holds the new head
+            if (atomic_compare_exchange_weak_explicit(&s_head, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed))
+                break;
+        } else if (diff < 0) {
+            // The consumer hasn't freed the cell yet, the queue is full
+            atomic_fetch_add_explicit(&s_dropped, 1, memory_order_relaxed);
+            return -1;
+        } else {
+            pos = atomic_load_explicit(&s_head, memory_order_relaxed);
+        }
+    }
+
+    pCell->state.sn = sn;
+    pCell->state.value = value;
+    pCell->state.type = type;
+    pCell->state.idx = idx;
+
+    // Publish the cell to the consumer
+    atomic_store_explicit(&pCell->seq, pos + 1 - (pos & QUEUE_MASK), memory_order_release);
+    return 0;
+}
+
+/**
+ * @brief Takes the oldest change out of the queue
+ *
+ * @param pState Output
+ * @return true if there was one
+ */
+static bool cosmos_devices_queue_pop(cosmos_devices_state_t *pState)
+{
+    cosmos_devices_queue_cell_t *pCell = &s_cell[s_tail & QUEUE_MASK];
+    unsigned seq = atomic_load_explicit(&pCell->seq, memory_order_acquire) + (s_tail & QUEUE_MASK);
+
+    if ((int)(seq - (s_tail + 1)) < 0)
+        return false;
+
+    *pState = pCell->state;
+
+    // Free the cell for the producer one lap ahead
+    atomic_store_explicit(&pCell->seq, s_tail + COSMOS_DEVICES_QUEUE_QTY - (s_tail & QUEUE_MASK), memory_order_release);
+    s_tail++;
+    return true;
+}
+
+size_t cosmos_devices_queue_drain(cosmos_devices_state_t *pOut, size_t max)
+{
+    cosmos_devices_state_t state;
+    size_t qty = 0, i;
+
+    while (qty < max && cosmos_devices_queue_pop(&state)) {
+        // Serial numbers point into the device structs, the pointer tells devices apart
+        for (i = 0; i < qty; i++) {
+            if (pOut[i].sn == state.sn && pOut[i].type == state.type)
+                break;
+        }
+
+        if (i < qty)
+            pOut[i].value = state.value;
+        else
+            pOut[qty++] = state;
+    }
+
+    return qty;
+}
+
+uint32_t cosmos_devices_queue_dropped(void)
+{
+    return atomic_load_explicit(&s_dropped, memory_order_relaxed);
+}
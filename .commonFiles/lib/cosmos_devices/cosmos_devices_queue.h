@@ -0,0 +1,61 @@
+#ifndef MAIN_COSMOS_DEVICES_QUEUE_H_
+#define MAIN_COSMOS_DEVICES_QUEUE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define COSMOS_DEVICES_QUEUE_QTY      64  /*!< State changes the queue holds, power of two */
+#define COSMOS_DEVICES_QUEUE_FLUSH_MS 100 /*!< Transport period, changes within it are coalesced per device */
+
+/**
+ * @brief State change of a device, as queued by the cosmos_* modules
+ * and delivered to the transport
+ *
+ */
+typedef struct {
+    const char *sn; /*!< Serial number, points into the device struct */
+    uint32_t value; /*!< New state. Relays and pumps: 0 / 1, lights: the 4 command bytes */
+    uint8_t type;   /*!< cosmos_devices_type_e */
+    uint8_t idx;    /*!< Index in the device array of its module */
+} cosmos_devices_state_t;
+
+/**
+ * @brief Queues a state change. Lock-free, it never blocks, so it can
+ * be called from any task or ISR.
+ *
+ * @param sn Serial number of the device, must outlive the queue
+ * @param type cosmos_devices_type_e of the device
+ * @param idx Index in the device array of its module
+ * @param value New state
+ * @return int 0 on success, -1 if the queue is full. The change is
+ * dropped and counted, see cosmos_devices_queue_dropped
+ */
+int cosmos_devices_queue_push(const char *sn, int type, size_t idx, uint32_t value);
+
+/**
+ * @brief Takes the queued changes out, coalesced: one record per device
+ * with its latest value, in the order devices first changed. Only one
+ * consumer (the transport task) may call it.
+ *
+ * @param pOut Batch to fill
+ * @param max Room in the batch. Changes of further devices stay queued
+ * @return size_t Records written to pOut
+ */
+size_t cosmos_devices_queue_drain(cosmos_devices_state_t *pOut, size_t max);
+
+/**
+ * @brief Changes dropped because the queue was full
+ *
+ * @return uint32_t Count since boot
+ */
+uint32_t cosmos_devices_queue_dropped(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAIN_COSMOS_DEVICES_QUEUE_H_ */
@@ -0,0 +1,96 @@
+#include <stddef.h>
+#include <string.h>
+
+#include "cosmos_devices.h"
+
+#define ROUTE_SN_MAX 32 // Longest serial number given a route
+
+// Group of each device type, filled by cosmos_devices_registry_begin
+static const cosmos_devices_group_t *s_dispatch[DEVICE_TYPE_QTY];
+
+/**
+ * @brief Route of a registry device, hands the command to the handler of its type
+ *
+ * @param pTopic "<sn>/rx_control"
+ * @param pPayload Command
+ * @param pArg Index entry of the device
+ * @return int esp_err_t of the handler
+ */
+static int cosmos_devices_registry_route(const char *pTopic, const char *pPayload, void *pArg)
+{
+    const cosmos_devices_index_entry_t *pEntry = (const cosmos_devices_index_entry_t *)pArg;
+    const cosmos_devices_group_t *pGroup = s_dispatch[pEntry->type];
+
+    return pGroup->pHandler->control(pGroup, pEntry->idx, pPayload);
+}
+
+/**
+ * @brief Compiles the "<sn>/rx_control" route of a device registered by a group
+ *
+ * @param pEntry Index entry of the device
+ * @param pArg esp_err_t, set on the first failure
+ */
+static void cosmos_devices_registry_add_route(const cosmos_devices_index_entry_t *pEntry, void *pArg)
+{
+    char pattern[ROUTE_SN_MAX + sizeof(RX_CONTROL)];
+    esp_err_t *pErr = (esp_err_t *)pArg;
+
+    // Devices of modules outside the registry keep their own dispatch
+    if (pEntry->type >= DEVICE_TYPE_QTY || s_dispatch[pEntry->type] == NULL || pEntry->idx >= s_dispatch[pEntry->type]->qty)
+        return;
+
+    if (pEntry->sn_len > ROUTE_SN_MAX) {
+        *pErr = ESP_ERR_INVALID_ARG;
+        return;
+    }
+
+    memcpy(pattern, pEntry->sn, pEntry->sn_len);
+    memcpy(&pattern[pEntry->sn_len], RX_CONTROL, sizeof(RX_CONTROL));
+
+    if (cosmos_devices_router_add(pattern, cosmos_devices_registry_route, (void *)pEntry) != 0)
+        *pErr = ESP_ERR_NO_MEM;
+}
+
+esp_err_t cosmos_devices_registry_begin(const cosmos_devices_group_t *pGroup, size_t qty)
+{
+    unsigned seen = 0;
+    esp_err_t err;
+    size_t i;
+
+    if (pGroup == NULL)
+        return ESP_ERR_INVALID_ARG;
+
+    // Check the whole table before touching any hardware
+    for (i = 0; i < qty; i++) {
+        if ((unsigned)pGroup[i].type >= DEVICE_TYPE_QTY || pGroup[i].pHandler == NULL || pGroup[i].pHandler->control == NULL)
+            return ESP_ERR_INVALID_ARG;
+        if (s_dispatch[pGroup[i].type] != NULL || (seen & BIT(pGroup[i].type)))
+            return ESP_ERR_INVALID_ARG;
+
+        seen |= BIT(pGroup[i].type);
+    }
+
+    for (i = 0; i < qty; i++) {
+        s_dispatch[pGroup[i].type] = &pGroup[i];
+
+        if (pGroup[i].pHandler->begin == NULL)
+            continue;
+        if ((err = pGroup[i].pHandler->begin(&pGroup[i])) != ESP_OK)
+            return err;
+    }
+
+    // Every group registered its serial numbers while beginning, the routes are compiled once
+    err = ESP_OK;
+    cosmos_devices_index_foreach(cosmos_devices_registry_add_route, &err);
+
+    return err;
+}
+
+esp_err_t cosmos_devices_dispatch(const char *pTopic, const char *pPayload)
+{
+    const cosmos_devices_route_t *pRoute = cosmos_devices_router_match(pTopic);
+    if (pRoute == NULL)
+        return ESP_ERR_NOT_FOUND;
+
+    return pRoute->cb(pTopic, pPayload, pRoute->pArg);
+}
@@ -0,0 +1,217 @@
+#include <stdbool.h>
+#include <string.h>
+
+#include "cosmos_devices_router.h"
+
+#define HASH_RANK 16 // Rank of a '#', it loses against any number of '+'
+
+/*
+ * Byte trie of the patterns. Node 0 is the root, so 0 also means
+ * "no node" in the links. A '+' child stays active over the bytes
+ * of its level and leaves it through its own '/' child. A '#' is
+ * kept as a route on the node where its level starts.
+ */
+typedef struct {
+    uint16_t child;   // First child
+    uint16_t sibling; // Next child of the same parent
+    uint8_t route;    // Route + 1 of the pattern ending here, 0 for none
+    uint8_t hash;     // Route + 1 of a '#' starting here, 0 for none
+    char byte;        // Byte of the edge from the parent, '+' for a level wildcard
+} cosmos_devices_router_node_t;
+
+static cosmos_devices_router_node_t s_node[COSMOS_DEVICES_ROUTER_NODES];
+static size_t s_node_qty = 1;
+static cosmos_devices_route_t s_route[COSMOS_DEVICES_ROUTER_ROUTES];
+static size_t s_route_qty = 0;
+
+static uint16_t cosmos_devices_router_child(uint16_t node, char byte)
+{
+    uint16_t child;
+
+    for (child = s_node[node].child; child; child = s_node[child].sibling)
+        if (s_node[child].byte == byte)
+            break;
+
+    return child;
+}
+
+static uint16_t cosmos_devices_router_new(char byte)
+{
+    if (s_node_qty == COSMOS_DEVICES_ROUTER_NODES)
+        return 0;
+
+    memset(&s_node[s_node_qty], 0, sizeof(s_node[0]));
+    s_node[s_node_qty].byte = byte;
+
+    return s_node_qty++;
+}
+
+/**
+ * @brief Checks where the wildcards are, they must take a whole level
+ * and '#' must be the last one
+ *
+ * @return int Rank of the pattern, -1 if it is malformed
+ */
+static int cosmos_devices_router_validate(const char *pattern)
+{
+    int rank = 0;
+
+    for (const char *p = pattern; *p; p++) {
+        if (*p != '+' && *p != '#')
+            continue;
+        if (p != pattern && p[-1] != '/')
+            return -1;
+        if (*p == '+' && p[1] != '/' && p[1] != '\0')
+            return -1;
+        if (*p == '#' && p[1] != '\0')
+            return -1;
+        rank += *p == '+' ? 1 : HASH_RANK;
+    }
+
+    return rank;
+}
+
+int cosmos_devices_router_add(const char *pattern, cosmos_devices_route_cb_t cb, void *pArg)
+{
+    uint16_t node = 0;
+    uint16_t next;
+    uint8_t *pSlot;
+    int rank;
+
+    if (pattern == NULL || *pattern == '\0' || cb == NULL || (rank = cosmos_devices_router_validate(pattern)) < 0)
+        return -1;
+
+    for (const char *p = pattern; *p != '#'; p++) {
+        if (*p == '\0')
+            break;
+
+        if ((next = cosmos_devices_router_child(node, *p)) == 0) {
+            if ((next = cosmos_devices_router_new(*p)) == 0)
+                return -1;
+            s_node[next].sibling = s_node[node].child;
+            s_node[node].child = next;
+        }
+        node = next;
+    }
+
+    pSlot = pattern[strlen(pattern) - 1] == '#' ? &s_node[node].hash : &s_node[node].route;
+
+    // Same pattern again, only the handler changes
+    if (*pSlot == 0) {
+        if (s_route_qty == COSMOS_DEVICES_ROUTER_ROUTES)
+            return -1;
+        *pSlot = ++s_route_qty;
+    }
+
+    s_route[*pSlot - 1].cb = cb;
+    s_route[*pSlot - 1].pArg = pArg;
+    s_route[*pSlot - 1].rank = rank;
+
+    return 0;
+}
+
+/**
+ * @brief Keeps the better of two matches, lower rank first, then the older route
+ *
+ */
+static uint8_t cosmos_devices_router_best(uint8_t best, uint8_t route)
+{
+    if (route == 0)
+        return best;
+    if (best == 0 || s_route[route - 1].rank < s_route[best - 1].rank ||
+        (s_route[route - 1].rank == s_route[best - 1].rank && route < best))
+        return route;
+
+    return best;
+}
+
+static void cosmos_devices_router_push(uint16_t *pSet, size_t *pQty, uint16_t node)
+{
+    if (node == 0 || *pQty == COSMOS_DEVICES_ROUTER_ACTIVE)
+        return;
+
+    for (size_t i = 0; i < *pQty; i++)
+        if (pSet[i] == node)
+            return;
+
+    pSet[(*pQty)++] = node;
+}
+
+const cosmos_devices_route_t *cosmos_devices_router_match(const char *pTopic)
+{
+    uint16_t set[2][COSMOS_DEVICES_ROUTER_ACTIVE];
+    uint16_t *pActive = set[0];
+    uint16_t *pNext = set[1];
+    uint16_t *pSwap;
+    bool level_start = true;
+    size_t active = 1;
+    size_t next;
+    uint8_t best = 0;
+    const char *p;
+
+    if (pTopic == NULL || s_route_qty == 0)
+        return NULL;
+
+    pActive[0] = 0;
+
+    for (p = pTopic; *p && active; p++) {
+        next = 0;
+
+        for (size_t i = 0; i < active; i++) {
+            const cosmos_devices_router_node_t *pNode = &s_node[pActive[i]];
+            uint16_t plus = level_start ? cosmos_devices_router_child(pActive[i], '+') : 0;
+
+            // '#' takes whatever is left
+            best = cosmos_devices_router_best(best, pNode->hash);
+
+            // Inside a '+' level until the next '/'
+            if (pNode->byte == '+' && *p != '/')
+                cosmos_devices_router_push(pNext, &next, pActive[i]);
+
+            // A '+' at the start of a level, an empty level goes straight to its '/'
+            if (plus) {
+                if (*p != '/')
+                    cosmos_devices_router_push(pNext, &next, plus);
+                else
+                    cosmos_devices_router_push(pNext, &next, cosmos_devices_router_child(plus, '/'));
+            }
+
+            // The topic can't hold a wildcard, a '+' byte never follows the '+' child
+            if (*p != '+')
+                cosmos_devices_router_push(pNext, &next, cosmos_devices_router_child(pActive[i], *p));
+        }
+
+        pSwap = pActive;
+        pActive = pNext;
+        pNext = pSwap;
+        active = next;
+        level_start = *p == '/';
+    }
+
+    // Patterns that end with the topic
+    for (size_t i = 0; i < active && *p == '\0'; i++) {
+        const cosmos_devices_router_node_t *pNode = &s_node[pActive[i]];
+
+        best = cosmos_devices_router_best(best, pNode->route);
+        best = cosmos_devices_router_best(best, pNode->hash);
+
+        // Empty last level under a '+'
+        uint16_t plus = level_start ? cosmos_devices_router_child(pActive[i], '+') : 0;
+        if (plus)
+            best = cosmos_devices_router_best(best, s_node[plus].route);
+
+        // "a/#" also matches "a"
+        uint16_t slash = cosmos_devices_router_child(pActive[i], '/');
+        if (slash)
+            best = cosmos_devices_router_best(best, s_node[slash].hash);
+    }
+
+    return best ? &s_route[best - 1] : NULL;
+}
+
+void cosmos_devices_router_clear(void)
+{
+    memset(s_node, 0, sizeof(s_node[0]));
+    s_node_qty = 1;
+    s_route_qty = 0;
+}
@@ -0,0 +1,67 @@
+#ifndef MAIN_COSMOS_DEVICES_ROUTER_H_
+#define MAIN_COSMOS_DEVICES_ROUTER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define COSMOS_DEVICES_ROUTER_ROUTES 64   /*!< Topic patterns the router holds */
+#define COSMOS_DEVICES_ROUTER_NODES  1536 /*!< Trie nodes, one per pattern byte not shared with another pattern */
+#define COSMOS_DEVICES_ROUTER_ACTIVE 8    /*!< Trie paths followed at once, one more per '+' that could match */
+
+/**
+ * @brief Handles a routed topic
+ *
+ * @param pTopic Topic as received
+ * @param pPayload Payload, NUL terminated
+ * @param pArg Argument given with the route
+ * @return int Result of the dispatch
+ */
+typedef int (*cosmos_devices_route_cb_t)(const char *pTopic, const char *pPayload, void *pArg);
+
+/**
+ * @brief Topic pattern and its handler
+ *
+ */
+typedef struct {
+    cosmos_devices_route_cb_t cb; /*!< Handler */
+    void *pArg;                   /*!< Argument of the handler */
+    uint8_t rank;                 /*!< One per '+' in the pattern and more for a '#', the lowest match wins */
+} cosmos_devices_route_t;
+
+/**
+ * @brief Compiles a topic pattern into the trie. MQTT wildcards are
+ * supported: '+' matches one level and '#', last, the rest of the topic.
+ * Adding the same pattern again replaces its handler.
+ *
+ * @param pattern Topic pattern, e.g. "PWRr-0001-001/rx_control" or "+/rx_state"
+ * @param cb Handler
+ * @param pArg Argument of the handler
+ * @return int 0 on success, -1 if the pattern is malformed or the router is full
+ */
+int cosmos_devices_router_add(const char *pattern, cosmos_devices_route_cb_t cb, void *pArg);
+
+/**
+ * @brief Finds the route of a topic in a single pass over its bytes.
+ * When several patterns match the most specific wins: a literal before
+ * a '+', a '+' before a '#', then the one added first.
+ *
+ * @param pTopic Topic, NUL terminated
+ * @return const cosmos_devices_route_t* Route, NULL if no pattern matches
+ */
+const cosmos_devices_route_t *cosmos_devices_router_match(const char *pTopic);
+
+/**
+ * @brief Empties the router
+ *
+ */
+void cosmos_devices_router_clear(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAIN_COSMOS_DEVICES_ROUTER_H_ */
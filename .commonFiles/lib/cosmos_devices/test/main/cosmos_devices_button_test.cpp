@@ -0,0 +1,144 @@
+/**
+ * @file cosmos_devices_button_test.cpp
+ * @author Marcel Nahir Samur (mnsamur2014@gmail.com)
+ * @brief Unit tests for the button press machine, driven the way the
+ *        button task drives it: edges first, then polls at the wait time
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <cstdio>
+#include <vector>
+
+#include "cosmos_devices_button.h"
+#include "cosmos_test.h"
+
+struct edge_t {
+    uint32_t time_ms;
+    bool pressed;
+};
+
+/*
+ * Feeds the edges and polls exactly when the task would, until
+ * end_ms. Returns the events in order.
+ */
+static std::vector<cosmos_devices_button_event_e> run(const std::vector<edge_t> &edges, uint32_t end_ms)
+{
+    cosmos_devices_button_t button = {};
+    std::vector<cosmos_devices_button_event_e> events;
+    cosmos_devices_button_event_e event;
+    size_t next = 0;
+    uint32_t now_ms = 0;
+
+    while (now_ms <= end_ms) {
+        while (next < edges.size() && edges[next].time_ms <= now_ms) {
+            while ((event = cosmos_devices_button_poll(&button, edges[next].time_ms)) != BUTTON_EVENT_NONE)
+                events.push_back(event);
+            cosmos_devices_button_edge(&button, edges[next].pressed, edges[next].time_ms);
+            next++;
+        }
+
+        while ((event = cosmos_devices_button_poll(&button, now_ms)) != BUTTON_EVENT_NONE)
+            events.push_back(event);
+
+        int32_t wait = cosmos_devices_button_wait_ms(&button, now_ms);
+        uint32_t wake_ms = wait < 0 ? end_ms + 1 : now_ms + (wait ? wait : 1);
+        if (next < edges.size() && edges[next].time_ms < wake_ms)
+            wake_ms = edges[next].time_ms;
+        now_ms = wake_ms;
+    }
+
+    return events;
+}
+
+// Contact bounce: toggles every 1 ms for count edges, ending on the given level
+static void bounce(std::vector<edge_t> &edges, uint32_t at_ms, int count, bool final)
+{
+    for (int i = 0; i < count; i++)
+        edges.push_back({at_ms + (uint32_t)i, ((count - 1 - i) % 2 == 0) == final});
+}
+
+static void test_click(void)
+{
+    std::vector<edge_t> edges = {{100, true}, {200, false}};
+    auto events = run(edges, 2000);
+
+    CHECK(events.size() == 1 && events[0] == BUTTON_EVENT_CLICK);
+}
+
+static void test_double_click(void)
+{
+    std::vector<edge_t> edges = {{100, true}, {180, false}, {300, true}, {380, false}};
+    auto events = run(edges, 2000);
+
+    CHECK(events.size() == 1 && events[0] == BUTTON_EVENT_DOUBLE_CLICK);
+
+    // Second press outside the window makes two clicks
+    edges = {{100, true}, {180, false}, {180 + COSMOS_DEVICES_BUTTON_DOUBLE_MS + 100, true}, {180 + COSMOS_DEVICES_BUTTON_DOUBLE_MS + 180, false}};
+    events = run(edges, 3000);
+    CHECK(events.size() == 2 && events[0] == BUTTON_EVENT_CLICK && events[1] == BUTTON_EVENT_CLICK);
+}
+
+static void test_long_press(void)
+{
+    uint32_t held_ms = COSMOS_DEVICES_BUTTON_LONG_MS + 3 * COSMOS_DEVICES_BUTTON_REPEAT_MS + 50;
+    std::vector<edge_t> edges = {{100, true}, {100 + held_ms, false}};
+    auto events = run(edges, 5000);
+
+    CHECK(events.size() == 5);
+    CHECK(events.size() == 5 && events[0] == BUTTON_EVENT_LONG_PRESS);
+    CHECK(events.size() == 5 && events[1] == BUTTON_EVENT_HOLD_REPEAT && events[3] == BUTTON_EVENT_HOLD_REPEAT);
+    CHECK(events.size() == 5 && events[4] == BUTTON_EVENT_LONG_RELEASE);
+}
+
+static void test_bounce_storm(void)
+{
+    std::vector<edge_t> edges;
+
+    // 25 bounces on the press, 25 on the release, a plain click in the end
+    bounce(edges, 100, 25, true);
+    bounce(edges, 250, 25, false);
+    auto events = run(edges, 2000);
+
+    CHECK(events.size() == 1 && events[0] == BUTTON_EVENT_CLICK);
+
+    // Bursts shorter than the debounce time never reach the machine
+    edges.clear();
+    bounce(edges, 100, COSMOS_DEVICES_BUTTON_DEBOUNCE_MS / 2, false);
+    events = run(edges, 2000);
+    CHECK(events.empty());
+}
+
+static void test_late_task(void)
+{
+    // The task only wakes up long after the click, polling at each edge time keeps it
+    cosmos_devices_button_t button = {};
+    cosmos_devices_button_event_e event;
+    std::vector<cosmos_devices_button_event_e> events;
+    std::vector<edge_t> edges = {{100, true}, {101, false}, {102, true}, {180, false}};
+
+    for (const edge_t &edge : edges) {
+        while ((event = cosmos_devices_button_poll(&button, edge.time_ms)) != BUTTON_EVENT_NONE)
+            events.push_back(event);
+        cosmos_devices_button_edge(&button, edge.pressed, edge.time_ms);
+    }
+    while ((event = cosmos_devices_button_poll(&button, 5000)) != BUTTON_EVENT_NONE)
+        events.push_back(event);
+
+    CHECK(events.size() == 1 && events[0] == BUTTON_EVENT_CLICK);
+    CHECK(cosmos_devices_button_wait_ms(&button, 5000) == -1);
+}
+
+int main(void)
+{
+    test_click();
+    test_double_click();
+    test_long_press();
+    test_bounce_storm();
+    test_late_task();
+
+    return cosmos_test_report();
+}
@@ -0,0 +1,135 @@
+/**
+ * @file cosmos_devices_index_test.cpp
+ * @author Marcel Nahir Samur (mnsamur2014@gmail.com)
+ * @brief Unit tests for the serial number index, plus a lookup
+ *        benchmark against the linear strcmp scan it replaces
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+#include "cosmos_devices_index.h"
+#include "cosmos_test.h"
+
+// Same values as cosmos_devices_type_e, cosmos_devices.h needs ESP-IDF
+#define TYPE_LSC 0
+#define TYPE_PWR 1
+#define TYPE_PMP 5
+
+#define BENCH_ROUNDS 2000000
+
+// A full bank, "PWRr-0000-000" .. like the relay serial numbers
+static char s_sn[COSMOS_DEVICES_INDEX_MAX][14];
+static int s_device[COSMOS_DEVICES_INDEX_MAX];
+
+static void fill_bank(void)
+{
+    for (int i = 0; i < COSMOS_DEVICES_INDEX_MAX; i++)
+        snprintf(s_sn[i], sizeof(s_sn[i]), "PWRr-%04d-%03d", i * 7, i);
+}
+
+static void test_add_find(void)
+{
+    cosmos_devices_index_clear();
+    int light, power;
+
+    CHECK(cosmos_devices_index_find("LSCc-0001-001", 13) == NULL);
+    CHECK(cosmos_devices_index_add("LSCc-0001-001", TYPE_LSC, 0, &light) == 0);
+    CHECK(cosmos_devices_index_add("PWRr-0001-001", TYPE_PWR, 3, &power) == 0);
+
+    const cosmos_devices_index_entry_t *pEntry = cosmos_devices_index_find("PWRr-0001-001", 13);
+    CHECK(pEntry && pEntry->type == TYPE_PWR && pEntry->idx == 3 && pEntry->pDevice == &power);
+
+    pEntry = cosmos_devices_index_find("LSCc-0001-001", 13);
+    CHECK(pEntry && pEntry->type == TYPE_LSC && pEntry->idx == 0 && pEntry->pDevice == &light);
+
+    // Prefixes and longer keys are different serial numbers
+    CHECK(cosmos_devices_index_find("LSCc-0001-00", 12) == NULL);
+    CHECK(cosmos_devices_index_find("LSCc-0001-0011", 14) == NULL);
+
+    // Registering again is fine, stealing a serial number is not
+    CHECK(cosmos_devices_index_add("LSCc-0001-001", TYPE_LSC, 0, &light) == 0);
+    CHECK(cosmos_devices_index_add("LSCc-0001-001", TYPE_PWR, 0, &power) == -1);
+    CHECK(cosmos_devices_index_find("LSCc-0001-001", 13)->pDevice == &light);
+
+    CHECK(cosmos_devices_index_add(NULL, TYPE_LSC, 0, &light) == -1);
+    CHECK(cosmos_devices_index_add("LSCc-0001-002", TYPE_LSC, 0, NULL) == -1);
+    CHECK(cosmos_devices_index_add("LSCc-0001-002", TYPE_LSC, 256, &light) == -1);
+}
+
+static void test_topic(void)
+{
+    cosmos_devices_index_clear();
+    int pump;
+
+    CHECK(cosmos_devices_index_add("PMPp-0001-001", TYPE_PMP, 0, &pump) == 0);
+    CHECK(cosmos_devices_index_find_topic("PMPp-0001-001/rx_control")->pDevice == &pump);
+    CHECK(cosmos_devices_index_find_topic("home/PMPp-0001-001/rx_control")->pDevice == &pump);
+    CHECK(cosmos_devices_index_find_topic("PMPp-0001-001")->pDevice == &pump);
+    CHECK(cosmos_devices_index_find_topic("PMPp-0001-001/rx_control/x") == NULL);
+    CHECK(cosmos_devices_index_find_topic("PMPp-0001-002/rx_control") == NULL);
+    CHECK(cosmos_devices_index_find_topic("") == NULL);
+    CHECK(cosmos_devices_index_find_topic(NULL) == NULL);
+}
+
+static void test_full_bank(void)
+{
+    cosmos_devices_index_clear();
+    fill_bank();
+
+    for (int i = 0; i < COSMOS_DEVICES_INDEX_MAX; i++)
+        CHECK(cosmos_devices_index_add(s_sn[i], TYPE_PWR, i, &s_device[i]) == 0);
+
+    int extra;
+    CHECK(cosmos_devices_index_add("PWRr-9999-999", TYPE_PWR, 0, &extra) == -1);
+
+    for (int i = 0; i < COSMOS_DEVICES_INDEX_MAX; i++) {
+        const cosmos_devices_index_entry_t *pEntry = cosmos_devices_index_find(s_sn[i], strlen(s_sn[i]));
+        CHECK(pEntry && pEntry->idx == i && pEntry->pDevice == &s_device[i]);
+    }
+    CHECK(cosmos_devices_index_find("PWRr-9999-999", 13) == NULL);
+}
+
+static void bench(void)
+{
+    // Index still holds the full bank from test_full_bank
+    volatile int sink = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int n = 0; n < BENCH_ROUNDS; n++) {
+        const char *sn = s_sn[(n * 13) % COSMOS_DEVICES_INDEX_MAX];
+        for (int i = 0; i < COSMOS_DEVICES_INDEX_MAX; i++) {
+            if (strcmp(sn, s_sn[i]) == 0) {
+                sink = sink + i;
+                break;
+            }
+        }
+    }
+    double scan = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (int n = 0; n < BENCH_ROUNDS; n++) {
+        const char *sn = s_sn[(n * 13) % COSMOS_DEVICES_INDEX_MAX];
+        sink = sink + cosmos_devices_index_find(sn, 13)->idx;
+    }
+    double index = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    printf("%d devices: strcmp scan %.1f ns, index %.1f ns per lookup\n", COSMOS_DEVICES_INDEX_MAX,
+           scan / BENCH_ROUNDS, index / BENCH_ROUNDS);
+}
+
+int main(void)
+{
+    test_add_find();
+    test_topic();
+    test_full_bank();
+    bench();
+
+    return cosmos_test_report();
+}
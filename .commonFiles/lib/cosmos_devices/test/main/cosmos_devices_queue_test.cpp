@@ -0,0 +1,135 @@
+/**
+ * @file cosmos_devices_queue_test.cpp
+ * @author Marcel Nahir Samur (mnsamur2014@gmail.com)
+ * @brief Unit tests for the state change queue, plus a stress run with
+ *        several producer threads against a draining consumer
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "cosmos_devices_queue.h"
+#include "cosmos_test.h"
+
+#define PRODUCERS      4
+#define DEVICES_PER    8
+#define PUSHES_PER_DEV 20000
+
+static char s_sn[PRODUCERS * DEVICES_PER][14];
+
+static void test_coalesce(void)
+{
+    cosmos_devices_state_t out[COSMOS_DEVICES_QUEUE_QTY];
+
+    CHECK(cosmos_devices_queue_drain(out, COSMOS_DEVICES_QUEUE_QTY) == 0);
+
+    // Fast toggling of a relay is one record with the last value, in first change order
+    CHECK(cosmos_devices_queue_push(s_sn[0], 1, 0, 1) == 0);
+    CHECK(cosmos_devices_queue_push(s_sn[1], 1, 1, 1) == 0);
+    CHECK(cosmos_devices_queue_push(s_sn[0], 1, 0, 0) == 0);
+    CHECK(cosmos_devices_queue_push(s_sn[0], 1, 0, 1) == 0);
+    CHECK(cosmos_devices_queue_drain(out, COSMOS_DEVICES_QUEUE_QTY) == 2);
+    CHECK(out[0].sn == s_sn[0] && out[0].value == 1 && out[0].idx == 0);
+    CHECK(out[1].sn == s_sn[1] && out[1].value == 1 && out[1].idx == 1);
+
+    // Devices beyond the batch stay queued for the next one
+    for (int i = 0; i < 3; i++)
+        CHECK(cosmos_devices_queue_push(s_sn[i], 0, i, 10 + i) == 0);
+    CHECK(cosmos_devices_queue_drain(out, 2) == 2);
+    CHECK(cosmos_devices_queue_drain(out, 2) == 1 && out[0].sn == s_sn[2] && out[0].value == 12);
+
+    // A full queue drops and counts, it never blocks
+    for (int i = 0; i < COSMOS_DEVICES_QUEUE_QTY; i++)
+        CHECK(cosmos_devices_queue_push(s_sn[0], 0, 0, i) == 0);
+    CHECK(cosmos_devices_queue_push(s_sn[0], 0, 0, 999) == -1);
+    CHECK(cosmos_devices_queue_dropped() == 1);
+    CHECK(cosmos_devices_queue_drain(out, COSMOS_DEVICES_QUEUE_QTY) == 1);
+    CHECK(out[0].value == COSMOS_DEVICES_QUEUE_QTY - 1);
+
+    // Positions wrap around the cells many times
+    for (int lap = 0; lap < 1000; lap++) {
+        CHECK(cosmos_devices_queue_push(s_sn[lap % 4], 0, 0, lap) == 0);
+        CHECK(cosmos_devices_queue_drain(out, COSMOS_DEVICES_QUEUE_QTY) == 1 && out[0].value == (uint32_t)lap);
+    }
+}
+
+static void test_stress(void)
+{
+    std::atomic<int> running{PRODUCERS};
+    std::atomic<uint64_t> retries{0};
+    uint32_t last[PRODUCERS * DEVICES_PER] = {};
+    uint64_t records = 0, batches = 0;
+    bool ordered = true;
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; p++) {
+        producers.emplace_back([p, &running, &retries]() {
+            // Values only grow, so the consumer can tell a reordered or lost change
+            for (uint32_t v = 1; v <= PUSHES_PER_DEV; v++) {
+                for (int d = 0; d < DEVICES_PER; d++) {
+                    int dev = p * DEVICES_PER + d;
+                    // Full, let the consumer catch up
+                    while (cosmos_devices_queue_push(s_sn[dev], 0, dev, v) != 0) {
+                        retries++;
+                        std::this_thread::yield();
+                    }
+                }
+            }
+            running--;
+        });
+    }
+
+    cosmos_devices_state_t out[COSMOS_DEVICES_QUEUE_QTY];
+    for (;;) {
+        bool done = running == 0;
+        size_t qty = cosmos_devices_queue_drain(out, COSMOS_DEVICES_QUEUE_QTY);
+
+        for (size_t i = 0; i < qty; i++) {
+            if (out[i].value <= last[out[i].idx])
+                ordered = false;
+            last[out[i].idx] = out[i].value;
+        }
+        records += qty;
+        batches += qty > 0;
+
+        if (done && qty == 0)
+            break;
+        if (qty == 0)
+            std::this_thread::yield();
+    }
+
+    for (auto &t : producers)
+        t.join();
+
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    uint64_t pushes = (uint64_t)PRODUCERS * DEVICES_PER * PUSHES_PER_DEV;
+
+    CHECK(ordered);
+    for (int dev = 0; dev < PRODUCERS * DEVICES_PER; dev++)
+        CHECK(last[dev] == PUSHES_PER_DEV);
+
+    printf("%d producers, %llu changes in %.1f ms (%.1f ns each), %llu records in %llu batches, %llu full retries\n", PRODUCERS,
+           (unsigned long long)pushes, ms, ms * 1e6 / pushes, (unsigned long long)records, (unsigned long long)batches,
+           (unsigned long long)retries.load());
+}
+
+int main(void)
+{
+    for (int i = 0; i < PRODUCERS * DEVICES_PER; i++)
+        snprintf(s_sn[i], sizeof(s_sn[i]), "PWRr-%04d-000", i);
+
+    test_coalesce();
+    test_stress();
+
+    return cosmos_test_report();
+}
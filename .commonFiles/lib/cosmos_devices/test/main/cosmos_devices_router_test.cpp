@@ -0,0 +1,167 @@
+/**
+ * @file cosmos_devices_router_test.cpp
+ * @author Marcel Nahir Samur (mnsamur2014@gmail.com)
+ * @brief Unit tests for the topic router, plus a dispatch benchmark
+ *        against every device scanning the topic with strstr
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+#include "cosmos_devices_router.h"
+#include "cosmos_test.h"
+
+#define BANK_QTY     48
+#define BENCH_ROUNDS 1000000
+
+// Every route returns its own tag, so the test sees which one matched
+static int tag_cb(const char *pTopic, const char *pPayload, void *pArg)
+{
+    return (int)(intptr_t)pArg;
+}
+
+static int route_of(const char *pTopic)
+{
+    const cosmos_devices_route_t *pRoute = cosmos_devices_router_match(pTopic);
+
+    return pRoute ? pRoute->cb(pTopic, "", pRoute->pArg) : 0;
+}
+
+static void test_literal(void)
+{
+    cosmos_devices_router_clear();
+
+    CHECK(cosmos_devices_router_add("PWRr-0001-001/rx_control", tag_cb, (void *)1) == 0);
+    CHECK(cosmos_devices_router_add("PWRr-0001-002/rx_control", tag_cb, (void *)2) == 0);
+    CHECK(cosmos_devices_router_add("LSCc-0001-001/rx_control", tag_cb, (void *)3) == 0);
+
+    CHECK(route_of("PWRr-0001-001/rx_control") == 1);
+    CHECK(route_of("PWRr-0001-002/rx_control") == 2);
+    CHECK(route_of("LSCc-0001-001/rx_control") == 3);
+    CHECK(route_of("PWRr-0001-003/rx_control") == 0);
+    CHECK(route_of("PWRr-0001-001/rx_state") == 0);
+    CHECK(route_of("PWRr-0001-001/rx_control/x") == 0);
+    CHECK(route_of("PWRr-0001-001") == 0);
+    CHECK(route_of("") == 0);
+
+    // Same pattern again only swaps the handler
+    CHECK(cosmos_devices_router_add("PWRr-0001-001/rx_control", tag_cb, (void *)4) == 0);
+    CHECK(route_of("PWRr-0001-001/rx_control") == 4);
+}
+
+static void test_wildcards(void)
+{
+    cosmos_devices_router_clear();
+
+    CHECK(cosmos_devices_router_add("+/rx_state", tag_cb, (void *)1) == 0);
+    CHECK(cosmos_devices_router_add("home/+/+/rx_control", tag_cb, (void *)2) == 0);
+    CHECK(cosmos_devices_router_add("logs/#", tag_cb, (void *)3) == 0);
+
+    CHECK(route_of("PWRr-0001-001/rx_state") == 1);
+    CHECK(route_of("/rx_state") == 1);
+    CHECK(route_of("a/b/rx_state") == 0);
+    CHECK(route_of("home/kitchen/PWRr-0001-001/rx_control") == 2);
+    CHECK(route_of("home//PWRr-0001-001/rx_control") == 2);
+    CHECK(route_of("home/kitchen/rx_control") == 0);
+    CHECK(route_of("logs/pump/0") == 3);
+    CHECK(route_of("logs") == 3);
+    CHECK(route_of("logsx") == 0);
+
+    // Wildcards only take whole levels, '#' only at the end
+    CHECK(cosmos_devices_router_add("a+/b", tag_cb, NULL) == -1);
+    CHECK(cosmos_devices_router_add("a/+b", tag_cb, NULL) == -1);
+    CHECK(cosmos_devices_router_add("a/#/b", tag_cb, NULL) == -1);
+    CHECK(cosmos_devices_router_add("a#", tag_cb, NULL) == -1);
+    CHECK(cosmos_devices_router_add("", tag_cb, NULL) == -1);
+}
+
+static void test_precedence(void)
+{
+    cosmos_devices_router_clear();
+
+    // The literal path fails late, the '+' path still has to be followed in the same pass
+    CHECK(cosmos_devices_router_add("#", tag_cb, (void *)1) == 0);
+    CHECK(cosmos_devices_router_add("+/rx_control", tag_cb, (void *)2) == 0);
+    CHECK(cosmos_devices_router_add("PWRr-0001-001/rx_control", tag_cb, (void *)3) == 0);
+    CHECK(cosmos_devices_router_add("PWRr-0001-001/+", tag_cb, (void *)4) == 0);
+
+    CHECK(route_of("PWRr-0001-001/rx_control") == 3);
+    CHECK(route_of("PWRr-0001-001/rx_state") == 4);
+    CHECK(route_of("PWRr-0001-002/rx_control") == 2);
+    CHECK(route_of("PWRr-0001-002/rx_state") == 1);
+
+    // One wildcard each, the older route wins
+    cosmos_devices_router_clear();
+    CHECK(cosmos_devices_router_add("+/x", tag_cb, (void *)1) == 0);
+    CHECK(cosmos_devices_router_add("a/+", tag_cb, (void *)2) == 0);
+    CHECK(route_of("a/x") == 1);
+}
+
+static void test_full(void)
+{
+    char pattern[32];
+    int added = 0;
+
+    cosmos_devices_router_clear();
+
+    for (int i = 0; i < COSMOS_DEVICES_ROUTER_ROUTES + 1; i++) {
+        snprintf(pattern, sizeof(pattern), "PWRr-%04d-%03d/rx_control", i * 7, i);
+        added += cosmos_devices_router_add(pattern, tag_cb, (void *)(intptr_t)(i + 1)) == 0;
+    }
+
+    CHECK(added == COSMOS_DEVICES_ROUTER_ROUTES);
+    CHECK(route_of("PWRr-0000-000/rx_control") == 1);
+    snprintf(pattern, sizeof(pattern), "PWRr-%04d-%03d/rx_control", (COSMOS_DEVICES_ROUTER_ROUTES - 1) * 7, COSMOS_DEVICES_ROUTER_ROUTES - 1);
+    CHECK(route_of(pattern) == COSMOS_DEVICES_ROUTER_ROUTES);
+}
+
+static void bench(void)
+{
+    static char sn[BANK_QTY][14];
+    static char topic[BANK_QTY][32];
+    volatile int sink = 0;
+
+    cosmos_devices_router_clear();
+    for (int i = 0; i < BANK_QTY; i++) {
+        snprintf(sn[i], sizeof(sn[i]), "PWRr-%04d-%03d", i * 7, i);
+        snprintf(topic[i], sizeof(topic[i]), "PWRr-%04d-%03d/rx_control", i * 7, i);
+        cosmos_devices_router_add(topic[i], tag_cb, (void *)(intptr_t)(i + 1));
+    }
+
+    // Every device of every library checks every message
+    auto start = std::chrono::steady_clock::now();
+    for (int n = 0; n < BENCH_ROUNDS; n++) {
+        const char *pTopic = topic[(n * 13) % BANK_QTY];
+        for (int i = 0; i < BANK_QTY; i++) {
+            if (strstr(pTopic, sn[i])) {
+                sink = sink + i;
+                break;
+            }
+        }
+    }
+    double scan = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (int n = 0; n < BENCH_ROUNDS; n++)
+        sink = sink + route_of(topic[(n * 13) % BANK_QTY]);
+    double trie = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    printf("%d devices: strstr scan %.1f ns, router %.1f ns per topic\n", BANK_QTY, scan / BENCH_ROUNDS, trie / BENCH_ROUNDS);
+}
+
+int main(void)
+{
+    test_literal();
+    test_wildcards();
+    test_precedence();
+    test_full();
+    bench();
+
+    return cosmos_test_report();
+}
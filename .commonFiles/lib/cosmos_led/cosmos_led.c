@@ -0,0 +1,152 @@
+#include <stddef.h>
+
+#include "driver/gpio.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "cosmos_led.h"
+
+static const char *TAG = "cosmos_led";
+
+#define STEP(rgb, ms) {(rgb), (ms)}
+
+// Pattern tables, the last step loops back to the first one
+static const cosmos_led_step_t s_off[] = {STEP(0, 0)};
+static const cosmos_led_step_t s_started[] = {STEP(LED_G, 0)};
+static const cosmos_led_step_t s_running[] = {STEP(LED_G, 200), STEP(0, 1800)};
+static const cosmos_led_step_t s_standby[] = {STEP(LED_B, 0)};
+static const cosmos_led_step_t s_fault_wl[] = {STEP(LED_R, 1000), STEP(0, 1000)};
+static const cosmos_led_step_t s_fault_sm[] = {STEP(LED_R | LED_B, 1000), STEP(0, 1000)};
+static const cosmos_led_step_t s_fault_th[] = {STEP(LED_R | LED_G, 1000), STEP(0, 1000)};
+
+static const struct {
+    const cosmos_led_step_t *pStep;
+    uint8_t step_qty;
+} s_patterns[LED_PATTERN_QTY] = {
+    [LED_PATTERN_OFF] = {s_off, 1},
+    [LED_PATTERN_STARTED] = {s_started, 1},
+    [LED_PATTERN_RUNNING] = {s_running, 2},
+    [LED_PATTERN_STANDBY] = {s_standby, 1},
+    [LED_PATTERN_FAULT_WL] = {s_fault_wl, 2},
+    [LED_PATTERN_FAULT_SM] = {s_fault_sm, 2},
+    [LED_PATTERN_FAULT_TH] = {s_fault_th, 2},
+};
+
+static cosmos_led_t *s_leds[COSMOS_LED_MAX];
+static size_t s_led_qty = 0;
+static esp_timer_handle_t s_timer = NULL;
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+
+/**
+ * @brief Writes the current step of a LED to its pins and
+ * loads the step length. Must be called with s_lock taken.
+ *
+ * @param pLed LED to update
+ */
+static void cosmos_led_apply_step(cosmos_led_t *pLed)
+{
+    const cosmos_led_step_t *pStep = &s_patterns[pLed->pattern].pStep[pLed->step];
+
+    for (int ch = 0; ch < 3; ch++) {
+        gpio_set_level(pLed->pin[ch], (pStep->rgb >> ch) & 1);
+    }
+
+    // Round up, a step is never shorter than one tick
+    pLed->ticks_left = (pStep->time_ms + COSMOS_LED_TICK_MS - 1) / COSMOS_LED_TICK_MS;
+}
+
+/**
+ * @brief Engine tick, moves every blinking LED to its next step when due
+ *
+ * @param pArg Unused
+ */
+static void cosmos_led_tick_cb(void *pArg)
+{
+    taskENTER_CRITICAL(&s_lock);
+    for (size_t i = 0; i < s_led_qty; i++) {
+        cosmos_led_t *pLed = s_leds[i];
+
+        // Held steps (solid colours) cost nothing
+        if (pLed->ticks_left == 0 || --pLed->ticks_left > 0) {
+            continue;
+        }
+
+        pLed->step = (pLed->step + 1) % s_patterns[pLed->pattern].step_qty;
+        cosmos_led_apply_step(pLed);
+    }
+    taskEXIT_CRITICAL(&s_lock);
+}
+
+void cosmos_led_set_pattern(cosmos_led_t *pLed, cosmos_led_pattern_e pattern)
+{
+    if (pattern >= LED_PATTERN_QTY) {
+        return;
+    }
+
+    taskENTER_CRITICAL(&s_lock);
+    if (pLed->pattern != pattern) {
+        pLed->pattern = pattern;
+        pLed->step = 0;
+        cosmos_led_apply_step(pLed);
+    }
+    taskEXIT_CRITICAL(&s_lock);
+}
+
+esp_err_t cosmos_led_begin(cosmos_led_t *pLed, size_t qty)
+{
+    esp_err_t err;
+    unsigned long long my_bit_mask = 0;
+
+    if (s_led_qty + qty > COSMOS_LED_MAX) {
+        ESP_LOGE(TAG, "Too many status LEDs, raise COSMOS_LED_MAX");
+        return ESP_ERR_NO_MEM;
+    }
+
+    // Using bitwise OR we build the bit mask
+    for (size_t led_idx = 0; led_idx < qty; led_idx++) {
+        for (int ch = 0; ch < 3; ch++) {
+            my_bit_mask |= BIT64(pLed[led_idx].pin[ch]);
+        }
+    }
+
+    // Initialize GPIO config struct
+    gpio_config_t io_conf = {
+        .mode = GPIO_MODE_OUTPUT,
+        .pull_down_en = GPIO_PULLDOWN_DISABLE,
+        .pull_up_en = GPIO_PULLUP_DISABLE,
+        .intr_type = GPIO_INTR_DISABLE,
+        .pin_bit_mask = my_bit_mask,
+    };
+
+    err = gpio_config(&io_conf);
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    taskENTER_CRITICAL(&s_lock);
+    for (size_t led_idx = 0; led_idx < qty; led_idx++) {
+        pLed[led_idx].pattern = LED_PATTERN_OFF;
+        pLed[led_idx].step = 0;
+        cosmos_led_apply_step(&pLed[led_idx]);
+        s_leds[s_led_qty++] = &pLed[led_idx];
+    }
+    taskEXIT_CRITICAL(&s_lock);
+
+    if (s_timer) {
+        return ESP_OK;
+    }
+
+    // One timer for every status LED
+    const esp_timer_create_args_t tick_args = {
+        .callback = cosmos_led_tick_cb,
+        .name = "cosmos_led",
+    };
+
+    err = esp_timer_create(&tick_args, &s_timer);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to create timer for status LEDs");
+        return err;
+    }
+
+    return esp_timer_start_periodic(s_timer, COSMOS_LED_TICK_MS * 1000);
+}
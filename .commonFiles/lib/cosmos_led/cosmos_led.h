@@ -0,0 +1,82 @@
+#ifndef MAIN_COSMOS_LED_H_
+#define MAIN_COSMOS_LED_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "esp_bit_defs.h"
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+
+#define COSMOS_LED_TICK_MS 50 /*!< Resolution of the pattern engine, every step lasts a multiple of this */
+#define COSMOS_LED_MAX     8  /*!< Status LEDs the engine can drive */
+
+#define LED_R BIT(0) /*!< Red channel of a step */
+#define LED_G BIT(1) /*!< Green channel of a step */
+#define LED_B BIT(2) /*!< Blue channel of a step */
+
+/**
+ * @brief Status patterns available. Each one is a constant
+ * table of steps, see cosmos_led.c
+ *
+ */
+typedef enum {
+    LED_PATTERN_OFF = 0,  /*!< All channels off */
+    LED_PATTERN_STARTED,  /*!< Green, solid */
+    LED_PATTERN_RUNNING,  /*!< Green, short blink every 2 s */
+    LED_PATTERN_STANDBY,  /*!< Blue, solid */
+    LED_PATTERN_FAULT_WL, /*!< Red, 1 s blink. Water level out of range */
+    LED_PATTERN_FAULT_SM, /*!< Magenta (red + blue), 1 s blink. Soil moisture out of range */
+    LED_PATTERN_FAULT_TH, /*!< Yellow (red + green), 1 s blink. Temperature out of range */
+    LED_PATTERN_QTY,
+} cosmos_led_pattern_e;
+
+/**
+ * @brief Single step of a pattern
+ *
+ */
+typedef struct {
+    uint8_t rgb;      /*!< Channels on during the step (LED_R | LED_G | LED_B) */
+    uint16_t time_ms; /*!< Step length, 0 holds the step forever */
+} cosmos_led_step_t;
+
+/**
+ * @brief RGB status LED driven by the pattern engine
+ *
+ */
+typedef struct {
+    const int pin[3];             /*!< {rPin, gPin, bPin} */
+    cosmos_led_pattern_e pattern; /*!< Current pattern. Don't write it, use cosmos_led_set_pattern */
+    uint8_t step;                 /*!< Current step of the pattern */
+    uint16_t ticks_left;          /*!< Ticks until the next step, 0 if the step is held */
+} cosmos_led_t;
+
+/**
+ * @brief Configures the LED GPIOs and adds the LEDs to the engine.
+ * All LEDs share a single periodic timer, created on the first call.
+ *
+ * @param pLed Pointer to the LEDs. They must last for the lifetime of the engine
+ * @param qty Quantity of LEDs
+ * @return esp_err_t ESP_OK on success, ESP_ERR_NO_MEM if more than COSMOS_LED_MAX LEDs are added
+ */
+esp_err_t cosmos_led_begin(cosmos_led_t *pLed, size_t qty);
+
+/**
+ * @brief Starts a pattern on a LED and returns right away, the engine
+ * timer takes care of the blinking. Setting the current pattern again
+ * does not restart it.
+ *
+ * @param pLed LED added with cosmos_led_begin
+ * @param pattern Pattern to show
+ */
+void cosmos_led_set_pattern(cosmos_led_t *pLed, cosmos_led_pattern_e pattern);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAIN_COSMOS_LED_H_ */
@@ -1,156 +1,629 @@
 #include <stdbool.h>
 #include <string.h>
 
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
 #include "cosmos_light.h"
+#include "cosmos_state.h"
+
+static const char *TAG = "cosmos_light";
 
 // Handle for cosmos_ligth_begin
 static bool s_light_begin_handle = false;
 
+// Profile + 1 each timer of cosmos_light_timer_pool runs, 0 while free
+static uint8_t s_timer_profile[COSMOS_LIGHT_TIMER_POOL_QTY];
+
+// Effects engine, one timer steps every light running an effect
+static cosmos_light_info_t *s_pEffectLight = NULL;
+static size_t s_effect_light_qty = 0;
+static cosmos_light_effect_state_t s_effect[COSMOS_LIGHT_EFFECT_MAX_LIGHTS];
+static uint8_t s_effect_channels[COSMOS_LIGHT_EFFECT_MAX_LIGHTS];
+static esp_timer_handle_t s_effect_timer = NULL;
+
+// Serialises the effect tick with the commands, so no frame is written after a command took the light back
+static StaticSemaphore_t s_effect_lock_buffer;
+static SemaphoreHandle_t s_effect_lock = NULL;
+
+// Scenes kept for Matter Scenes recall
+typedef struct {
+    bool used;
+    uint16_t group_id;
+    uint8_t scene_id;
+    cosmos_light_scene_t scene;
+} cosmos_light_scene_slot_t;
+
+static cosmos_light_scene_slot_t s_scene[COSMOS_LIGHT_SCENE_QTY];
+static portMUX_TYPE s_scene_lock = portMUX_INITIALIZER_UNLOCKED;
+
+/**
+ * @brief Resolves the serial number of a light through the device index
+ *
+ * @param sn_value Serial number of the light source
+ * @param pLight Pointer to the strutct that contains all of the info
+ * @param qty Quantity of light sources used in the project
+ * @return int Index of the light in pLight, -1 if it isn't one of them
+ */
+static int cosmos_light_find(const char *sn_value, const cosmos_light_info_t *pLight, size_t qty)
+{
+    const cosmos_devices_index_entry_t *pEntry = cosmos_devices_index_find(sn_value, strlen(sn_value));
+    if (pEntry == NULL || pEntry->type != DEVICE_TYPE_LSC || pEntry->idx >= qty || pEntry->pDevice != pLight[pEntry->idx].pDevice)
+        return -1;
+
+    return pEntry->idx;
+}
+
+/**
+ * @brief Quantity of channels of a light, 3 for the 'color' (c) subtype
+ *
+ * @param pLight Light source
+ * @return int 1 or RGB_LED_CHANNEL_NUM
+ */
+static int cosmos_light_channels(const cosmos_light_info_t *pLight)
+{
+    return strpbrk(pLight->pDevice->sn, "c") ? RGB_LED_CHANNEL_NUM : 1;
+}
+
+/**
+ * @brief Hands out a timer of the pool for a speed mode and profile.
+ * Lights with the same mode and profile share it, the timer is
+ * configured the first time it is handed out.
+ *
+ * @param mode Speed mode of the light channels
+ * @param profile cosmos_light_profile_e of the light
+ * @param pTimer Timer handed out
+ * @return esp_err_t ESP_OK on success, ESP_ERR_NOT_FOUND if the pool has no timer left for the mode
+ */
+static esp_err_t cosmos_light_timer_alloc(ledc_mode_t mode, uint8_t profile, ledc_timer_t *pTimer)
+{
+    for (int i = 0; i < COSMOS_LIGHT_TIMER_POOL_QTY; i++) {
+        if (cosmos_light_timer_pool[i].mode != mode)
+            continue;
+
+        if (s_timer_profile[i] == profile + 1) {
+            *pTimer = (ledc_timer_t)cosmos_light_timer_pool[i].num;
+            return ESP_OK;
+        }
+
+        if (s_timer_profile[i] == 0) {
+            ledc_timer_config_t ledc_timer = {
+                .speed_mode = mode,
+                .duty_resolution = (ledc_timer_bit_t)cosmos_light_profile[profile].duty_bits,
+                .timer_num = (ledc_timer_t)cosmos_light_timer_pool[i].num,
+                .freq_hz = cosmos_light_profile[profile].freq_hz,
+            };
+            esp_err_t err = ledc_timer_config(&ledc_timer);
+            if (err != ESP_OK)
+                return err;
+
+            s_timer_profile[i] = profile + 1;
+            *pTimer = ledc_timer.timer_num;
+            return ESP_OK;
+        }
+    }
+
+    return ESP_ERR_NOT_FOUND;
+}
+
 /**
  * @brief Initializes the RGB LED settings per channel, including
- * the GPIOS for each color, mode and timer configuration.
+ * the GPIOS for each color, mode and timer configuration. Channels
+ * are handed out in order from cosmos_light_channel_pool and timers
+ * from cosmos_light_timer_pool, by the profile each light asks for.
  *
  * @param pLight Pointer to the strutct that contains all of the info
  * @param lsc_qty Quantity of LEDs used in the project
  */
 static void cosmos_light_begin(cosmos_light_info_t *pLight, size_t lsc_qty)
 {
-    char *pRet;
-    int led_idx, ch_idx;
-
-    // Initialize timer zero config struct
-    ledc_timer_config_t ledc_timer = {
-        .duty_resolution = LEDC_TIMER_8_BIT,
-        .freq_hz = 100,
-        .speed_mode = LEDC_HIGH_SPEED_MODE,
-        .timer_num = LEDC_TIMER_0,
-    };
-    ledc_timer_config(&ledc_timer);
-
-    // Zero-initialize ledc channel config struct
-    ledc_channel_config_t ledc_channel[lsc_qty][RGB_LED_CHANNEL_NUM];
-    memset(ledc_channel, 0, lsc_qty * RGB_LED_CHANNEL_NUM * sizeof(ledc_channel_config_t));
-
-    // Configure channels
+    size_t led_idx, pool_idx = 0;
+    int ch_idx;
+
+    // Transitions are generated by the LEDC hardware, the ISR only reports the end of a fade
+    ledc_fade_func_install(0);
+
+    s_effect_lock = xSemaphoreCreateMutexStatic(&s_effect_lock_buffer);
+
     for (led_idx = 0; led_idx < lsc_qty; led_idx++) {
-        ledc_channel[led_idx][0].gpio_num = pLight[led_idx].pDevice->pin[0];
-        ledc_channel[led_idx][0].channel = pLight[led_idx].channel[0];
-        ledc_channel[led_idx][0].duty = 0;
-        ledc_channel[led_idx][0].hpoint = 0;
-        ledc_channel[led_idx][0].intr_type = LEDC_INTR_DISABLE;
-        ledc_channel[led_idx][0].speed_mode = pLight[led_idx].mode;
-        ledc_channel[led_idx][0].timer_sel = pLight[led_idx].timer_index;
+        int channels = cosmos_light_channels(&pLight[led_idx]);
+
+        if (pLight[led_idx].profile >= COSMOS_LIGHT_PROFILE_QTY) {
+            ESP_LOGE(TAG, "%s asks for an unknown timer profile", pLight[led_idx].pDevice->sn);
+            continue;
+        }
 
-        // Set LED Controller with previously prepared configuration
-        ledc_channel_config(&ledc_channel[led_idx][0]);
+        // The channels of a light share a speed mode, skip to the next mode if this one runs out
+        while (pool_idx + channels <= COSMOS_LIGHT_CHANNEL_POOL_QTY &&
+               cosmos_light_channel_pool[pool_idx].mode != cosmos_light_channel_pool[pool_idx + channels - 1].mode)
+            pool_idx++;
+        if (pool_idx + channels > COSMOS_LIGHT_CHANNEL_POOL_QTY) {
+            ESP_LOGE(TAG, "No LEDC channels left for %s", pLight[led_idx].pDevice->sn);
+            break;
+        }
 
-        /*
-         * Check if the LED subtype (Look for types
-         * and subtypes definition in the following
-         * link -> ) is 'color' (c). If so we'll
-         * configure the rest of the LED channels.
-         */
-        pRet = strpbrk(pLight[led_idx].pDevice->sn, "c");
-        if (pRet) {
-            for (ch_idx = 1; ch_idx < 3; ch_idx++) {
-                ledc_channel[led_idx][ch_idx].gpio_num = pLight[led_idx].pDevice->pin[ch_idx];
-                ledc_channel[led_idx][ch_idx].channel = pLight[led_idx].channel[ch_idx];
-                ledc_channel[led_idx][ch_idx].duty = 0;
-                ledc_channel[led_idx][ch_idx].hpoint = 0;
-                ledc_channel[led_idx][ch_idx].intr_type = LEDC_INTR_DISABLE;
-                ledc_channel[led_idx][ch_idx].speed_mode = pLight[led_idx].mode;
-                ledc_channel[led_idx][ch_idx].timer_sel = pLight[led_idx].timer_index;
-
-                ledc_channel_config(&ledc_channel[led_idx][ch_idx]);
-            }
+        pLight[led_idx].mode = cosmos_light_channel_pool[pool_idx].mode;
+        if (cosmos_light_timer_alloc(pLight[led_idx].mode, pLight[led_idx].profile, &pLight[led_idx].timer_index) != ESP_OK) {
+            ESP_LOGE(TAG, "No LEDC timer left for %s", pLight[led_idx].pDevice->sn);
+            continue;
+        }
+
+        for (ch_idx = 0; ch_idx < channels; ch_idx++) {
+            pLight[led_idx].channel[ch_idx] = (ledc_channel_t)cosmos_light_channel_pool[pool_idx++].num;
+
+            ledc_channel_config_t ledc_channel = {
+                .gpio_num = pLight[led_idx].pDevice->pin[ch_idx],
+                .speed_mode = pLight[led_idx].mode,
+                .channel = pLight[led_idx].channel[ch_idx],
+                .intr_type = LEDC_INTR_DISABLE,
+                .timer_sel = pLight[led_idx].timer_index,
+                .duty = 0,
+                .hpoint = 0,
+            };
+            ledc_channel_config(&ledc_channel);
+        }
+
+        // Register the serial number, so commands are resolved without scanning the lights
+        cosmos_devices_index_add(pLight[led_idx].pDevice->sn, DEVICE_TYPE_LSC, led_idx, pLight[led_idx].pDevice);
+
+        // Command saved before the last reset, cosmos_light_restore applies it
+        uint32_t saved;
+        if (cosmos_state_get(pLight[led_idx].pDevice->sn, &saved)) {
+            memcpy(&pLight[led_idx].cmd, &saved, sizeof(cosmos_light_cmd_t));
+            pLight[led_idx].pDevice->state = !cosmos_light_cmd_is_off(&pLight[led_idx].cmd);
         }
     }
 
     s_light_begin_handle = true;
 }
 
-void cosmos_light_control(const char sn_value[14], char rgb_values[17], cosmos_light_info_t *pLight, size_t qty)
+/**
+ * @brief Keeps the command of a light, written to NVS with the next
+ * batch, and queues it for the transport task.
+ * Called with s_effect_lock taken.
+ *
+ * @param pLight Light source
+ * @param led_idx Index of the light
+ */
+static void cosmos_light_save(const cosmos_light_info_t *pLight, int led_idx)
+{
+    uint32_t value;
+
+    memcpy(&value, &pLight->cmd, sizeof(cosmos_light_cmd_t));
+    cosmos_state_set(pLight->pDevice->sn, value);
+    cosmos_devices_queue_push(pLight->pDevice->sn, DEVICE_TYPE_LSC, led_idx, value);
+}
+
+/**
+ * @brief Moves a channel to a level through the gamma table
+ *
+ * @param pLight Light source
+ * @param ch_idx Channel of the light source (0: R or single, 1: G, 2: B)
+ * @param level 8-bit perceptual level, clamped to the table
+ * @param fade_ms Hardware fade time, 0 jumps straight to the level
+ */
+static void cosmos_light_channel_fade(const cosmos_light_info_t *pLight, int ch_idx, uint32_t level, uint32_t fade_ms)
+{
+    if (level > COSMOS_LIGHT_GAMMA_QTY - 1)
+        level = COSMOS_LIGHT_GAMMA_QTY - 1;
+
+    uint32_t duty = cosmos_light_profile_duty(pLight->profile, cosmos_light_gamma.duty[level]);
+
+    // A new command takes over from a fade still running
+    ledc_fade_stop(pLight->mode, pLight->channel[ch_idx]);
+
+    if (fade_ms == 0)
+        ledc_set_duty_and_update(pLight->mode, pLight->channel[ch_idx], duty, 0);
+    else
+        ledc_set_fade_time_and_start(pLight->mode, pLight->channel[ch_idx], duty, fade_ms, LEDC_FADE_NO_WAIT);
+}
+
+/**
+ * @brief Moves every channel of a light to the command values
+ *
+ * @param pLight Light source
+ * @param pCmd Brigthness and RGB values
+ * @param fade_ms Hardware fade time, 0 jumps straight to the values
+ */
+static void cosmos_light_apply(const cosmos_light_info_t *pLight, const cosmos_light_cmd_t *pCmd, uint32_t fade_ms)
+{
+    char *pRet;
+
+    // Adjusts the level of the channels based on the brightness value
+    cosmos_light_channel_fade(pLight, 0, cosmos_light_cmd_duty(pCmd, pCmd->r), fade_ms);
+
+    /*
+     * Check if the LED subtype (Look for types
+     * and subtypes definition in the following
+     * link -> ) is 'color' (c). If so, we'll
+     * fade the rest of the LED channels too.
+     */
+    pRet = strpbrk(pLight->pDevice->sn, "c");
+    if (pRet) {
+        cosmos_light_channel_fade(pLight, 1, cosmos_light_cmd_duty(pCmd, pCmd->g), fade_ms);
+        cosmos_light_channel_fade(pLight, 2, cosmos_light_cmd_duty(pCmd, pCmd->b), fade_ms);
+    }
+}
+
+/**
+ * @brief Effects engine tick. The frames due are collected and every
+ * channel of every light is written back to back, all under the lock,
+ * so a command cancelling an effect is never overwritten by its frame.
+ *
+ * @param pArg Unused
+ */
+static void cosmos_light_effect_tick_cb(void *pArg)
+{
+    cosmos_light_effect_out_t out[COSMOS_LIGHT_EFFECT_MAX_LIGHTS];
+    bool active;
+
+    xSemaphoreTake(s_effect_lock, portMAX_DELAY);
+    size_t out_qty = cosmos_light_effect_step(s_effect, s_effect_light_qty, out, &active);
+
+    // Nothing left to animate, cosmos_light_set_effect starts the timer again
+    if (!active)
+        esp_timer_stop(s_effect_timer);
+
+    for (size_t i = 0; i < out_qty; i++) {
+        const cosmos_light_info_t *pLight = &s_pEffectLight[out[i].light];
+
+        for (int ch_idx = 0; ch_idx < s_effect_channels[out[i].light]; ch_idx++) {
+            uint32_t duty = cosmos_light_profile_duty(pLight->profile, out[i].pFrame->duty[ch_idx]);
+
+            if (out[i].fade_ms)
+                ledc_set_fade_time_and_start(pLight->mode, pLight->channel[ch_idx], duty, out[i].fade_ms, LEDC_FADE_NO_WAIT);
+            else
+                ledc_set_duty_and_update(pLight->mode, pLight->channel[ch_idx], duty, 0);
+        }
+    }
+    xSemaphoreGive(s_effect_lock);
+}
+
+/**
+ * @brief Stops the effect of a light, if it runs one.
+ * Called with s_effect_lock taken, until the command is written.
+ *
+ * @param led_idx Index of the light
+ */
+static void cosmos_light_effect_cancel(int led_idx)
+{
+    if (led_idx >= COSMOS_LIGHT_EFFECT_MAX_LIGHTS)
+        return;
+
+    cosmos_light_effect_start(&s_effect[led_idx], COSMOS_LIGHT_EFFECT_NONE);
+}
+
+void cosmos_light_fade_cmd(const char sn_value[14], const cosmos_light_cmd_t *pCmd, uint16_t transition_ds, cosmos_light_info_t *pLight, size_t qty)
+{
+    // Check if LED controller is configured
+    if (s_light_begin_handle == false)
+        cosmos_light_begin(pLight, qty);
+
+    /*
+     * Look the serial number up in the
+     * device index. If it isn't one of
+     * the lights in the pLight array,
+     * the command is ignored
+     */
+    int led_idx = cosmos_light_find(sn_value, pLight, qty);
+    if (led_idx < 0)
+        return;
+
+    uint32_t fade_ms = (transition_ds == COSMOS_LIGHT_TRANSITION_DEFAULT ? COSMOS_LIGHT_DEFAULT_TRANSITION_DS : transition_ds) * 100;
+
+    // A command takes the light back from a running effect
+    xSemaphoreTake(s_effect_lock, portMAX_DELAY);
+    cosmos_light_effect_cancel(led_idx);
+    cosmos_light_apply(&pLight[led_idx], pCmd, fade_ms);
+
+    // Saved under the lock, so the stored command is always the one last written
+    pLight[led_idx].pDevice->state = !cosmos_light_cmd_is_off(pCmd);
+    pLight[led_idx].cmd = *pCmd;
+    cosmos_light_save(&pLight[led_idx], led_idx);
+    xSemaphoreGive(s_effect_lock);
+}
+
+void cosmos_light_restore(cosmos_light_info_t *pLight, size_t qty)
+{
+    if (s_light_begin_handle == false)
+        cosmos_light_begin(pLight, qty);
+
+    for (size_t led_idx = 0; led_idx < qty; led_idx++) {
+        if (cosmos_light_find(pLight[led_idx].pDevice->sn, pLight, qty) == (int)led_idx)
+            cosmos_light_apply(&pLight[led_idx], &pLight[led_idx].cmd, 0);
+    }
+}
+
+void cosmos_light_control_cmd(const char sn_value[14], const cosmos_light_cmd_t *pCmd, cosmos_light_info_t *pLight, size_t qty)
+{
+    cosmos_light_fade_cmd(sn_value, pCmd, 0, pLight, qty);
+}
+
+void cosmos_light_control(const char sn_value[14], const char rgb_values[17], cosmos_light_info_t *pLight, size_t qty)
+{
+    cosmos_light_cmd_t cmd;
+
+    /*
+     * The text is decoded in place, the 4 values
+     * are 3-digit integers each followed by a
+     * forward slash. A short string fails the
+     * length check instead of being read past
+     * its terminator
+     */
+    if (cosmos_light_cmd_parse(rgb_values, strnlen(rgb_values, COSMOS_LIGHT_TEXT_LEN), &cmd) != 0)
+        return;
+
+    cosmos_light_control_cmd(sn_value, &cmd, pLight, qty);
+}
+
+esp_err_t cosmos_light_set_effect(const char sn_value[14], cosmos_light_effect_e effect, cosmos_light_info_t *pLight, size_t qty)
+{
+    esp_err_t err = ESP_OK;
+
+    // Check if LED controller is configured
+    if (s_light_begin_handle == false)
+        cosmos_light_begin(pLight, qty);
+
+    if (effect >= COSMOS_LIGHT_EFFECT_QTY)
+        return ESP_ERR_INVALID_ARG;
+
+    int led_idx = cosmos_light_find(sn_value, pLight, qty);
+    if (led_idx < 0)
+        return ESP_ERR_NOT_FOUND;
+    if (led_idx >= COSMOS_LIGHT_EFFECT_MAX_LIGHTS)
+        return ESP_ERR_INVALID_ARG;
+
+    // Frames are rendered once, the first time any effect is used
+    if (s_effect_timer == NULL) {
+        cosmos_light_effect_render();
+
+        const esp_timer_create_args_t tick_args = {
+            .callback = &cosmos_light_effect_tick_cb,
+            .arg = NULL,
+            .name = "cosmos_light_fx",
+        };
+        err = esp_timer_create(&tick_args, &s_effect_timer);
+        if (err != ESP_OK)
+            return err;
+    }
+
+    s_effect_channels[led_idx] = cosmos_light_channels(&pLight[led_idx]);
+
+    xSemaphoreTake(s_effect_lock, portMAX_DELAY);
+    s_pEffectLight = pLight;
+    s_effect_light_qty = qty < COSMOS_LIGHT_EFFECT_MAX_LIGHTS ? qty : COSMOS_LIGHT_EFFECT_MAX_LIGHTS;
+    cosmos_light_effect_start(&s_effect[led_idx], effect);
+    if (effect != COSMOS_LIGHT_EFFECT_NONE && !esp_timer_is_active(s_effect_timer))
+        err = esp_timer_start_periodic(s_effect_timer, COSMOS_LIGHT_EFFECT_TICK_MS * 1000);
+
+    if (effect == COSMOS_LIGHT_EFFECT_NONE) {
+        // Back to the last command
+        cosmos_light_apply(&pLight[led_idx], &pLight[led_idx].cmd, 0);
+        pLight[led_idx].pDevice->state = !cosmos_light_cmd_is_off(&pLight[led_idx].cmd);
+    } else {
+        pLight[led_idx].pDevice->state = 1;
+    }
+    xSemaphoreGive(s_effect_lock);
+
+    return err;
+}
+
+void cosmos_light_scene_clear(cosmos_light_scene_t *pScene)
+{
+    pScene->qty = 0;
+}
+
+esp_err_t cosmos_light_scene_stage(cosmos_light_scene_t *pScene, const char sn_value[14], const cosmos_light_cmd_t *pCmd, cosmos_light_info_t *pLight, size_t qty)
+{
+    size_t i;
+
+    int led_idx = cosmos_light_find(sn_value, pLight, qty);
+    if (led_idx < 0)
+        return ESP_ERR_NOT_FOUND;
+
+    // Staging the same light again replaces its entry
+    for (i = 0; i < pScene->qty; i++) {
+        if (pScene->entry[i].light == led_idx)
+            break;
+    }
+    if (i == COSMOS_LIGHT_SCENE_MAX_LIGHTS)
+        return ESP_ERR_NO_MEM;
+
+    cosmos_light_scene_entry_t *pEntry = &pScene->entry[i];
+    const uint8_t level[RGB_LED_CHANNEL_NUM] = {pCmd->r, pCmd->g, pCmd->b};
+
+    pEntry->light = led_idx;
+    pEntry->channels = cosmos_light_channels(&pLight[led_idx]);
+    pEntry->cmd = *pCmd;
+    for (int ch_idx = 0; ch_idx < RGB_LED_CHANNEL_NUM; ch_idx++) {
+        uint32_t duty_level = cosmos_light_cmd_duty(pCmd, level[ch_idx]);
+        uint32_t duty = cosmos_light_gamma.duty[duty_level < COSMOS_LIGHT_GAMMA_QTY ? duty_level : COSMOS_LIGHT_GAMMA_QTY - 1];
+        pEntry->duty[ch_idx] = cosmos_light_profile_duty(pLight[led_idx].profile, duty);
+    }
+
+    if (i == pScene->qty)
+        pScene->qty++;
+
+    return ESP_OK;
+}
+
+void cosmos_light_scene_capture(cosmos_light_scene_t *pScene, cosmos_light_info_t *pLight, size_t qty)
+{
+    cosmos_light_scene_clear(pScene);
+
+    for (size_t led_idx = 0; led_idx < qty && led_idx < COSMOS_LIGHT_SCENE_MAX_LIGHTS; led_idx++)
+        cosmos_light_scene_stage(pScene, pLight[led_idx].pDevice->sn, &pLight[led_idx].cmd, pLight, qty);
+}
+
+esp_err_t cosmos_light_scene_commit(const cosmos_light_scene_t *pScene, uint16_t transition_ds, cosmos_light_info_t *pLight, size_t qty)
 {
+    size_t i;
+    int ch_idx;
+
     // Check if LED controller is configured
     if (s_light_begin_handle == false)
         cosmos_light_begin(pLight, qty);
 
-    int led_idx;
+    for (i = 0; i < pScene->qty; i++) {
+        if (pScene->entry[i].light >= qty)
+            return ESP_ERR_INVALID_ARG;
+    }
+
+    uint32_t fade_ms = (transition_ds == COSMOS_LIGHT_TRANSITION_DEFAULT ? COSMOS_LIGHT_DEFAULT_TRANSITION_DS : transition_ds) * 100;
 
-    // Loop through the different LEDs
-    for (led_idx = 0; led_idx < qty; led_idx++) {
+    /*
+     * Take the lights back from effects and
+     * running fades first, so nothing else
+     * writes their channels during the pass
+     */
+    xSemaphoreTake(s_effect_lock, portMAX_DELAY);
+    for (i = 0; i < pScene->qty; i++) {
+        const cosmos_light_scene_entry_t *pEntry = &pScene->entry[i];
+
+        cosmos_light_effect_cancel(pEntry->light);
+        for (ch_idx = 0; ch_idx < pEntry->channels; ch_idx++)
+            ledc_fade_stop(pLight[pEntry->light].mode, pLight[pEntry->light].channel[ch_idx]);
+    }
+
+    if (fade_ms == 0) {
         /*
-         * If the serial number matches
-         * any of the stored in the
-         * pLight array, excution will
-         * continue. Otherwise, we'll try
-         * another with LED
+         * set_duty only loads the shadow registers,
+         * the output changes on update_duty. It takes
+         * the LEDC driver lock, so the duties are
+         * loaded first and only the latches are
+         * issued back to back, without being
+         * preempted or interrupted
          */
-        if (strcmp(sn_value, pLight[led_idx].pDevice->sn) == 0) {
-
-            int rgb_val, rgb_idx, rgb_arr[4];
-            char *pRet, *pDevState, new_msg[40];
-
-            rgb_val = 0;
-            /*
-             * This loop will break down the rgb values
-             * and store them in the 'rgb_arr' array
-             */
-            for (rgb_idx = 0; rgb_idx < 4; rgb_idx++) {
-                char aux_value[4];
-                /*
-                 * Each value is represented as a
-                 * 3-digit integer, we copy the 3
-                 * chars before the forward slash
-                 * to the 'aux_value' string
-                 */
-                strncpy(aux_value, &rgb_values[rgb_val], 3);
-                rgb_val += 4;
-
-                // Convert the str 'aux_value' to an int and store it
-                rgb_arr[rgb_idx] = atoi(aux_value);
-            }
-
-            int r_value = 0, g_value = 0, b_value = 0;
-
-            // Adjusts the duty of the channels based on the brightness value
-            r_value = COSMOS_MAP(rgb_arr[1], 0, 100, 0, rgb_arr[0]);
-            g_value = COSMOS_MAP(rgb_arr[2], 0, 100, 0, rgb_arr[0]);
-            b_value = COSMOS_MAP(rgb_arr[3], 0, 100, 0, rgb_arr[0]);
-
-            // Set and update duty for the first led channel
-            ledc_set_duty(pLight[led_idx].mode, pLight[led_idx].channel[0], r_value);
-            ledc_update_duty(pLight[led_idx].mode, pLight[led_idx].channel[0]);
-
-            /*
-             * Check if the LED subtype (Look for types
-             * and subtypes definition in the following
-             * link -> ) is 'color' (c). If so, we'll
-             * set and update the duty the rest of the
-             * LED channels.
-             */
-            pRet = strpbrk(pLight[led_idx].pDevice->sn, "c");
-            if (pRet) {
-                ledc_set_duty(pLight[led_idx].mode, pLight[led_idx].channel[1], g_value);
-                ledc_update_duty(pLight[led_idx].mode, pLight[led_idx].channel[1]);
-
-                ledc_set_duty(pLight[led_idx].mode, pLight[led_idx].channel[2], b_value);
-                ledc_update_duty(pLight[led_idx].mode, pLight[led_idx].channel[2]);
-            }
-
-            if (strcmp(rgb_values, "000/000/000/000/") == 0) {
-                pLight[led_idx].pDevice->state = 0;
-                pDevState = "0|";
-            } else {
-                pLight[led_idx].pDevice->state = 1;
-                pLight[led_idx].rgb_values = rgb_values;
-                pDevState = "1|";
-            }
-
-            memset(new_msg, '\0', sizeof(new_msg));
-            strcpy(new_msg, pDevState);
-            strcat(new_msg, sn_value);
-            strcat(new_msg, "/rx_state");
+        for (i = 0; i < pScene->qty; i++) {
+            const cosmos_light_scene_entry_t *pEntry = &pScene->entry[i];
+            for (ch_idx = 0; ch_idx < pEntry->channels; ch_idx++)
+                ledc_set_duty(pLight[pEntry->light].mode, pLight[pEntry->light].channel[ch_idx], pEntry->duty[ch_idx]);
+        }
+        taskENTER_CRITICAL(&s_scene_lock);
+        for (i = 0; i < pScene->qty; i++) {
+            const cosmos_light_scene_entry_t *pEntry = &pScene->entry[i];
+            for (ch_idx = 0; ch_idx < pEntry->channels; ch_idx++)
+                ledc_update_duty(pLight[pEntry->light].mode, pLight[pEntry->light].channel[ch_idx]);
+        }
+        taskEXIT_CRITICAL(&s_scene_lock);
+    } else {
+        // Fade calls take the LEDC fade mutex, they are configured first and started back to back
+        for (i = 0; i < pScene->qty; i++) {
+            const cosmos_light_scene_entry_t *pEntry = &pScene->entry[i];
+            for (ch_idx = 0; ch_idx < pEntry->channels; ch_idx++)
+                ledc_set_fade_with_time(pLight[pEntry->light].mode, pLight[pEntry->light].channel[ch_idx], pEntry->duty[ch_idx], fade_ms);
         }
+        for (i = 0; i < pScene->qty; i++) {
+            const cosmos_light_scene_entry_t *pEntry = &pScene->entry[i];
+            for (ch_idx = 0; ch_idx < pEntry->channels; ch_idx++)
+                ledc_fade_start(pLight[pEntry->light].mode, pLight[pEntry->light].channel[ch_idx], LEDC_FADE_NO_WAIT);
+        }
+    }
+
+    for (i = 0; i < pScene->qty; i++) {
+        const cosmos_light_scene_entry_t *pEntry = &pScene->entry[i];
+
+        pLight[pEntry->light].pDevice->state = !cosmos_light_cmd_is_off(&pEntry->cmd);
+        pLight[pEntry->light].cmd = pEntry->cmd;
+        cosmos_light_save(&pLight[pEntry->light], pEntry->light);
+    }
+    xSemaphoreGive(s_effect_lock);
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Finds the slot of a kept scene
+ *
+ * @param group_id Matter GroupID
+ * @param scene_id Matter SceneID
+ * @return cosmos_light_scene_slot_t* Slot, NULL if the scene is not kept
+ */
+static cosmos_light_scene_slot_t *cosmos_light_scene_find(uint16_t group_id, uint8_t scene_id)
+{
+    for (int i = 0; i < COSMOS_LIGHT_SCENE_QTY; i++) {
+        if (s_scene[i].used && s_scene[i].group_id == group_id && s_scene[i].scene_id == scene_id)
+            return &s_scene[i];
     }
-}
\ No newline at end of file
+
+    return NULL;
+}
+
+esp_err_t cosmos_light_scene_store(uint16_t group_id, uint8_t scene_id, const cosmos_light_scene_t *pScene)
+{
+    cosmos_light_scene_slot_t *pSlot = cosmos_light_scene_find(group_id, scene_id);
+
+    for (int i = 0; pSlot == NULL && i < COSMOS_LIGHT_SCENE_QTY; i++) {
+        if (!s_scene[i].used)
+            pSlot = &s_scene[i];
+    }
+    if (pSlot == NULL)
+        return ESP_ERR_NO_MEM;
+
+    pSlot->group_id = group_id;
+    pSlot->scene_id = scene_id;
+    pSlot->scene = *pScene;
+    pSlot->used = true;
+
+    return ESP_OK;
+}
+
+esp_err_t cosmos_light_scene_remove(uint16_t group_id, uint8_t scene_id)
+{
+    cosmos_light_scene_slot_t *pSlot = cosmos_light_scene_find(group_id, scene_id);
+    if (pSlot == NULL)
+        return ESP_ERR_NOT_FOUND;
+
+    pSlot->used = false;
+
+    return ESP_OK;
+}
+
+esp_err_t cosmos_light_scene_recall(uint16_t group_id, uint8_t scene_id, uint16_t transition_ds, cosmos_light_info_t *pLight, size_t qty)
+{
+    const cosmos_light_scene_slot_t *pSlot = cosmos_light_scene_find(group_id, scene_id);
+    if (pSlot == NULL)
+        return ESP_ERR_NOT_FOUND;
+
+    return cosmos_light_scene_commit(&pSlot->scene, transition_ds, pLight, qty);
+}
+
+/**
+ * @brief Registry begin, sets up the LEDC channels and restores the saved commands at boot
+ *
+ * @param pGroup Light sources, pDevices is a cosmos_light_info_t array
+ * @return esp_err_t ESP_OK
+ */
+static esp_err_t cosmos_light_handler_begin(const cosmos_devices_group_t *pGroup)
+{
+    cosmos_light_restore((cosmos_light_info_t *)pGroup->pDevices, pGroup->qty);
+    return ESP_OK;
+}
+
+/**
+ * @brief Registry control, applies a "Bright/Rvalue/Gvalue/Bvalue/" payload
+ *
+ * @param pGroup Light sources, pDevices is a cosmos_light_info_t array
+ * @param idx Index of the light
+ * @param pPayload Command, see cosmos_light_cmd_parse
+ * @return esp_err_t ESP_OK on success, ESP_ERR_INVALID_ARG if the payload is malformed
+ */
+static esp_err_t cosmos_light_handler_control(const cosmos_devices_group_t *pGroup, size_t idx, const char *pPayload)
+{
+    cosmos_light_info_t *pLight = (cosmos_light_info_t *)pGroup->pDevices;
+    cosmos_light_cmd_t cmd;
+
+    // A short payload fails the length check instead of being read past its end
+    if (cosmos_light_cmd_parse(pPayload, strnlen(pPayload, COSMOS_LIGHT_TEXT_LEN), &cmd) != 0)
+        return ESP_ERR_INVALID_ARG;
+
+    cosmos_light_control_cmd(pLight[idx].pDevice->sn, &cmd, pLight, pGroup->qty);
+    return ESP_OK;
+}
+
+const cosmos_devices_handler_t cosmos_light_handler = {
+    .begin = cosmos_light_handler_begin,
+    .control = cosmos_light_handler_control,
+};
\ No newline at end of file
@@ -4,21 +4,75 @@
 #include "driver/ledc.h"
 
 #include "cosmos_devices.h"
+#include "cosmos_light_cmd.h"
+#include "cosmos_light_effect.h"
+#include "cosmos_light_gamma.h"
+#include "cosmos_light_ledc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
 
 #define RGB_LED_CHANNEL_NUM 3
 
+#define COSMOS_LIGHT_TRANSITION_DEFAULT    0xFFFF /*!< Same as a null Matter TransitionTime, use the default below */
+#define COSMOS_LIGHT_DEFAULT_TRANSITION_DS 5      /*!< Default transition, in tenths of a second */
+
+#define COSMOS_LIGHT_SCENE_MAX_LIGHTS 16 /*!< Lights a scene can change */
+#define COSMOS_LIGHT_SCENE_QTY        16 /*!< Scenes kept for Matter Scenes recall */
+
+/**
+ * @brief Registry handler of DEVICE_TYPE_LSC. pDevices is the cosmos_light_info_t
+ * array, payloads are "Bright/Rvalue/Gvalue/Bvalue/" as in cosmos_light_control.
+ *
+ */
+extern const cosmos_devices_handler_t cosmos_light_handler;
+
 /**
  * @brief RGB LED configuration struct
  *
  */
 typedef struct {
     cosmos_devices_t *pDevice; /*!< Struct that contains basic info */
-    char *rgb_values;          /*!< String that contains Brigthness and RGB values */
-    ledc_channel_t channel[3]; /*!< LEDC Channel */
-    ledc_mode_t mode;          /*!< LEDC speed speed_mode */
-    ledc_timer_t timer_index;  /*!< Timer source of the channel */
+    cosmos_light_cmd_t cmd;    /*!< Last Brigthness and RGB values applied */
+    uint8_t profile;           /*!< cosmos_light_profile_e, frequency and resolution of the timer */
+    ledc_channel_t channel[3]; /*!< LEDC Channel. Assigned by the driver from cosmos_light_channel_pool */
+    ledc_mode_t mode;          /*!< LEDC speed speed_mode. Assigned by the driver */
+    ledc_timer_t timer_index;  /*!< Timer source of the channel. Assigned by the driver from cosmos_light_timer_pool */
 } cosmos_light_info_t;
 
+/**
+ * @brief Staged state of one light in a scene. Duties are looked up
+ * when the light is staged, so a commit only writes registers.
+ *
+ */
+typedef struct {
+    uint16_t light;         /*!< Index of the light in the pLight array */
+    uint16_t channels;      /*!< Channels to write, 1 or RGB_LED_CHANNEL_NUM */
+    uint16_t duty[3];       /*!< Gamma corrected duty of each channel, at the resolution of the light profile */
+    cosmos_light_cmd_t cmd; /*!< Brigthness and RGB values, kept as the last command */
+} cosmos_light_scene_entry_t;
+
+/**
+ * @brief Duty values for several lights, applied together by cosmos_light_scene_commit
+ *
+ */
+typedef struct {
+    size_t qty;                                                      /*!< Lights staged */
+    cosmos_light_scene_entry_t entry[COSMOS_LIGHT_SCENE_MAX_LIGHTS]; /*!< One entry per light, in staging order */
+} cosmos_light_scene_t;
+
+/**
+ * @brief Puts every light back on its saved command. Call it at boot,
+ * after cosmos_state_begin and before the network starts. Lights that
+ * were never changed stay off.
+ *
+ * @param pLight Pointer to the strutct that contains all of the info
+ * about the ligth sources used in the project
+ * @param qty Quantity of light sources used in the project
+ */
+void cosmos_light_restore(cosmos_light_info_t *pLight, size_t qty);
+
 /**
  * @brief This function is used to control color and brightness of
  * any RGB ligth source
@@ -27,10 +81,160 @@ typedef struct {
  * determine with which ligth source we are trying to interact
  * @param rgb_values Array that contains Brigthness and RGB values.
  * Each of them must be in the following order -> "Bright/Rvalue/Gvalue/Bvalue/" E.g. 050/255/112/017/
+ * Malformed values are ignored, see cosmos_light_cmd_parse
+ * @param pLight Pointer to the strutct that contains all of the info
+ * about the ligth sources used in the project
+ * @param qty Quantity of light sources used in the project
+ */
+void cosmos_light_control(const char sn_value[14], const char rgb_values[17], cosmos_light_info_t *pLight, size_t qty);
+
+/**
+ * @brief Same as cosmos_light_control but takes the binary command,
+ * e.g. a COSMOS_LIGHT_CMD_SIZE byte payload used in place
+ *
+ * @param sn_value Serial number of the light source
+ * @param pCmd Brigthness and RGB values
+ * @param pLight Pointer to the strutct that contains all of the info
+ * about the ligth sources used in the project
+ * @param qty Quantity of light sources used in the project
+ */
+void cosmos_light_control_cmd(const char sn_value[14], const cosmos_light_cmd_t *pCmd, cosmos_light_info_t *pLight, size_t qty);
+
+/**
+ * @brief Moves a light to the command values over a transition, the
+ * way a Matter MoveToLevel / MoveToColor does. The fade is run by the
+ * LEDC hardware, every channel through the gamma table. A new command
+ * takes over from a fade still running.
+ *
+ * @param sn_value Serial number of the light source
+ * @param pCmd Brigthness and RGB values at the end of the transition
+ * @param transition_ds Transition time in tenths of a second, 0 is
+ * immediate, COSMOS_LIGHT_TRANSITION_DEFAULT uses COSMOS_LIGHT_DEFAULT_TRANSITION_DS
+ * @param pLight Pointer to the strutct that contains all of the info
+ * about the ligth sources used in the project
+ * @param qty Quantity of light sources used in the project
+ */
+void cosmos_light_fade_cmd(const char sn_value[14], const cosmos_light_cmd_t *pCmd, uint16_t transition_ds, cosmos_light_info_t *pLight, size_t qty);
+
+/**
+ * @brief Runs an effect on a light. Frames are rendered once into a table
+ * and a single timer steps every light running an effect, so each extra
+ * light only costs its channel writes. A command sent to the light with
+ * cosmos_light_control/_cmd/fade_cmd stops its effect.
+ *
+ * @param sn_value Serial number of the light source
+ * @param effect Effect to run, COSMOS_LIGHT_EFFECT_NONE stops it and
+ * restores the last command
+ * @param pLight Pointer to the strutct that contains all of the info
+ * about the ligth sources used in the project
+ * @param qty Quantity of light sources used in the project
+ *
+ * @return esp_err_t - ESP_OK on success,
+ *                     ESP_ERR_NOT_FOUND if the serial number is not one of the lights
+ *                     ESP_ERR_INVALID_ARG if the effect is unknown or the light is
+ *                     beyond COSMOS_LIGHT_EFFECT_MAX_LIGHTS
+ *                     appropriate error code otherwise
+ */
+esp_err_t cosmos_light_set_effect(const char sn_value[14], cosmos_light_effect_e effect, cosmos_light_info_t *pLight, size_t qty);
+
+/**
+ * @brief Empties a scene
+ *
+ * @param pScene Scene to clear
+ */
+void cosmos_light_scene_clear(cosmos_light_scene_t *pScene);
+
+/**
+ * @brief Stages the command of a light in a scene. Nothing changes on
+ * the light until the scene is committed. Staging the same light again
+ * replaces its entry.
+ *
+ * @param pScene Scene being built
+ * @param sn_value Serial number of the light source
+ * @param pCmd Brigthness and RGB values
+ * @param pLight Pointer to the strutct that contains all of the info
+ * about the ligth sources used in the project
+ * @param qty Quantity of light sources used in the project
+ *
+ * @return esp_err_t - ESP_OK on success,
+ *                     ESP_ERR_NOT_FOUND if the serial number is not one of the lights
+ *                     ESP_ERR_NO_MEM if the scene already holds COSMOS_LIGHT_SCENE_MAX_LIGHTS lights
+ */
+esp_err_t cosmos_light_scene_stage(cosmos_light_scene_t *pScene, const char sn_value[14], const cosmos_light_cmd_t *pCmd, cosmos_light_info_t *pLight, size_t qty);
+
+/**
+ * @brief Stages the last command of every light, what a Matter StoreScene captures
+ *
+ * @param pScene Scene to fill, cleared first
+ * @param pLight Pointer to the strutct that contains all of the info
+ * about the ligth sources used in the project
+ * @param qty Quantity of light sources used in the project
+ */
+void cosmos_light_scene_capture(cosmos_light_scene_t *pScene, cosmos_light_info_t *pLight, size_t qty);
+
+/**
+ * @brief Applies every light of a scene in one pass. Running fades and
+ * effects of those lights are stopped first, then all the duties are
+ * set and the channels updated back to back inside a critical section,
+ * so every fixture changes within microseconds of the others. With a
+ * transition the hardware fades of every channel are configured first
+ * and started back to back instead.
+ *
+ * @param pScene Staged scene
+ * @param transition_ds Transition time in tenths of a second, 0 is immediate
  * @param pLight Pointer to the strutct that contains all of the info
  * about the ligth sources used in the project
  * @param qty Quantity of light sources used in the project
+ *
+ * @return esp_err_t - ESP_OK on success,
+ *                     ESP_ERR_INVALID_ARG if an entry is beyond qty
+ */
+esp_err_t cosmos_light_scene_commit(const cosmos_light_scene_t *pScene, uint16_t transition_ds, cosmos_light_info_t *pLight, size_t qty);
+
+/**
+ * @brief Keeps a copy of a scene under its Matter Scenes identifiers,
+ * for AddScene / StoreScene. Storing the same ids again replaces it.
+ *
+ * @param group_id Matter GroupID, 0 for scenes outside a group
+ * @param scene_id Matter SceneID
+ * @param pScene Scene to keep
+ *
+ * @return esp_err_t - ESP_OK on success,
+ *                     ESP_ERR_NO_MEM if COSMOS_LIGHT_SCENE_QTY scenes are already kept
  */
-void cosmos_light_control(const char sn_value[14], char rgb_values[17], cosmos_light_info_t *pLight, size_t qty);
+esp_err_t cosmos_light_scene_store(uint16_t group_id, uint8_t scene_id, const cosmos_light_scene_t *pScene);
+
+/**
+ * @brief Forgets a scene, for RemoveScene
+ *
+ * @param group_id Matter GroupID
+ * @param scene_id Matter SceneID
+ *
+ * @return esp_err_t - ESP_OK on success,
+ *                     ESP_ERR_NOT_FOUND if the scene is not kept
+ */
+esp_err_t cosmos_light_scene_remove(uint16_t group_id, uint8_t scene_id);
+
+/**
+ * @brief Handles a Matter Scenes RecallScene command, committing the
+ * kept scene with cosmos_light_scene_commit
+ *
+ * @param group_id Matter GroupID
+ * @param scene_id Matter SceneID
+ * @param transition_ds TransitionTime of the command in tenths of a second,
+ * COSMOS_LIGHT_TRANSITION_DEFAULT (null) uses COSMOS_LIGHT_DEFAULT_TRANSITION_DS
+ * @param pLight Pointer to the strutct that contains all of the info
+ * about the ligth sources used in the project
+ * @param qty Quantity of light sources used in the project
+ *
+ * @return esp_err_t - ESP_OK on success,
+ *                     ESP_ERR_NOT_FOUND if the scene is not kept
+ *                     appropriate error code otherwise
+ */
+esp_err_t cosmos_light_scene_recall(uint16_t group_id, uint8_t scene_id, uint16_t transition_ds, cosmos_light_info_t *pLight, size_t qty);
+
+#ifdef __cplusplus
+}
+#endif
 
 #endif /* MAIN_COSMOS_LIGHT_H_ */
\ No newline at end of file
@@ -0,0 +1,46 @@
+#include <stdbool.h>
+
+#include "cosmos_light_cmd.h"
+
+/**
+ * @brief Decodes one "DDD/" field. The comparisons compile to flag
+ * sets, so a bad character only raises the error mask.
+ *
+ * @param p First digit of the field
+ * @param pBad Error mask, non zero if the field is malformed
+ * @return uint32_t Field value (meaningless if *pBad was raised)
+ */
+static inline uint32_t cosmos_light_cmd_field(const uint8_t *p, uint32_t *pBad)
+{
+    uint32_t d0 = (uint32_t)p[0] - '0';
+    uint32_t d1 = (uint32_t)p[1] - '0';
+    uint32_t d2 = (uint32_t)p[2] - '0';
+    uint32_t value = d0 * 100 + d1 * 10 + d2;
+
+    // Unsigned wrap makes anything below '0' larger than 9 too
+    *pBad |= (d0 > 9) | (d1 > 9) | (d2 > 9) | (p[3] != '/') | (value > UINT8_MAX);
+    return value;
+}
+
+int cosmos_light_cmd_parse(const char *pText, size_t len, cosmos_light_cmd_t *pCmd)
+{
+    if (pText == NULL || len < COSMOS_LIGHT_TEXT_LEN)
+        return -1;
+
+    const uint8_t *p = (const uint8_t *)pText;
+    uint32_t bad = 0;
+
+    uint32_t bright = cosmos_light_cmd_field(&p[0], &bad);
+    uint32_t r = cosmos_light_cmd_field(&p[4], &bad);
+    uint32_t g = cosmos_light_cmd_field(&p[8], &bad);
+    uint32_t b = cosmos_light_cmd_field(&p[12], &bad);
+
+    if (bad)
+        return -1;
+
+    pCmd->bright = bright;
+    pCmd->r = r;
+    pCmd->g = g;
+    pCmd->b = b;
+    return 0;
+}
@@ -0,0 +1,69 @@
+#ifndef MAIN_COSMOS_LIGHT_CMD_H_
+#define MAIN_COSMOS_LIGHT_CMD_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define COSMOS_LIGHT_TEXT_LEN 16 /*!< Length of the legacy "BBB/RRR/GGG/BBB/" format, without NUL */
+
+/**
+ * @brief Binary light command. Every field is a byte, so the struct has
+ * no padding and no alignment requirement: a COSMOS_LIGHT_CMD_SIZE byte
+ * payload can be used in place by casting its pointer.
+ *
+ */
+typedef struct {
+    uint8_t bright; /*!< Brightness, full scale duty of the channels */
+    uint8_t r;      /*!< Red (or single channel) level, 0 .. 100 % of bright */
+    uint8_t g;      /*!< Green level, 0 .. 100 % of bright */
+    uint8_t b;      /*!< Blue level, 0 .. 100 % of bright */
+} cosmos_light_cmd_t;
+
+#define COSMOS_LIGHT_CMD_SIZE sizeof(cosmos_light_cmd_t)
+
+/**
+ * @brief Decodes the legacy text format "BBB/RRR/GGG/BBB/" in place. Digits
+ * and separators are validated without branches, reading exactly
+ * COSMOS_LIGHT_TEXT_LEN bytes. Anything after them is ignored.
+ *
+ * @param pText Text command, not necessarily NUL terminated
+ * @param len Bytes available at pText
+ * @param pCmd Output, only written on success
+ * @return int 0 on success, -1 if the text is short, a digit or a '/' is
+ * missing or a value does not fit in a byte
+ */
+int cosmos_light_cmd_parse(const char *pText, size_t len, cosmos_light_cmd_t *pCmd);
+
+/**
+ * @brief Level of a channel, level % of the brightness
+ *
+ * @param pCmd Light command
+ * @param level r, g or b field of the command
+ * @return uint32_t Perceptual level, cosmos_light maps it to a duty through its gamma table
+ */
+static inline uint32_t cosmos_light_cmd_duty(const cosmos_light_cmd_t *pCmd, uint8_t level)
+{
+    return (uint32_t)level * pCmd->bright / 100;
+}
+
+/**
+ * @brief Checks if a command switches the light off
+ *
+ * @param pCmd Light command
+ * @return true if every field is zero, same as the legacy "000/000/000/000/"
+ */
+static inline bool cosmos_light_cmd_is_off(const cosmos_light_cmd_t *pCmd)
+{
+    return (pCmd->bright | pCmd->r | pCmd->g | pCmd->b) == 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAIN_COSMOS_LIGHT_CMD_H_ */
@@ -0,0 +1,136 @@
+#include <math.h>
+
+#include "cosmos_light_color.h"
+#include "cosmos_light_gamma.h"
+
+/**
+ * @brief Stores three channel levels as percentages
+ *
+ * @param pCmd Command
+ * @param r Red, 0 .. 1
+ * @param g Green, 0 .. 1
+ * @param b Blue, 0 .. 1
+ */
+static void cosmos_light_color_store(cosmos_light_cmd_t *pCmd, float r, float g, float b)
+{
+    pCmd->r = (uint8_t)lrintf(r * 100);
+    pCmd->g = (uint8_t)lrintf(g * 100);
+    pCmd->b = (uint8_t)lrintf(b * 100);
+}
+
+/**
+ * @brief Linear sRGB of an xy point at Y = 1, scaled so the largest channel
+ * is full and encoded with the gamma of the duty table, since cosmos_light
+ * takes perceptual levels
+ *
+ * @param x CIE x
+ * @param y CIE y
+ * @param pCmd Command, r, g and b are written
+ */
+static void cosmos_light_color_xyf(float x, float y, cosmos_light_cmd_t *pCmd)
+{
+    float X, Z, r, g, b, max;
+
+    // Degenerate point, show white instead of dividing by zero
+    if (y <= 0.0f) {
+        pCmd->r = pCmd->g = pCmd->b = 100;
+        return;
+    }
+
+    X = x / y;
+    Z = (1.0f - x - y) / y;
+
+    r = 3.2406f * X - 1.5372f - 0.4986f * Z;
+    g = -0.9689f * X + 1.8758f + 0.0415f * Z;
+    b = 0.0557f * X - 0.2040f + 1.0570f * Z;
+
+    r = fmaxf(r, 0.0f);
+    g = fmaxf(g, 0.0f);
+    b = fmaxf(b, 0.0f);
+
+    max = fmaxf(r, fmaxf(g, b));
+    if (max <= 0.0f) {
+        pCmd->r = pCmd->g = pCmd->b = 100;
+        return;
+    }
+
+    cosmos_light_color_store(pCmd,
+                             powf(r / max, 1.0f / COSMOS_LIGHT_GAMMA),
+                             powf(g / max, 1.0f / COSMOS_LIGHT_GAMMA),
+                             powf(b / max, 1.0f / COSMOS_LIGHT_GAMMA));
+}
+
+void cosmos_light_color_hs(uint8_t hue, uint8_t sat, cosmos_light_cmd_t *pCmd)
+{
+    if (hue > COSMOS_LIGHT_COLOR_LEVEL_MAX)
+        hue = COSMOS_LIGHT_COLOR_LEVEL_MAX;
+    if (sat > COSMOS_LIGHT_COLOR_LEVEL_MAX)
+        sat = COSMOS_LIGHT_COLOR_LEVEL_MAX;
+
+    uint32_t pos = (uint32_t)hue * 6 * 255 / COSMOS_LIGHT_COLOR_LEVEL_MAX;
+    uint32_t sector = (pos / 255) % 6;
+    uint32_t frac = pos % 255;
+    uint32_t s = ((uint32_t)sat * 100 + COSMOS_LIGHT_COLOR_LEVEL_MAX / 2) / COSMOS_LIGHT_COLOR_LEVEL_MAX;
+
+    // Value is always full, the brightness comes from the level
+    uint8_t p = 100 - s;
+    uint8_t q = 100 - s * frac / 255;
+    uint8_t t = 100 - s * (255 - frac) / 255;
+
+    switch (sector) {
+    case 0:
+        pCmd->r = 100, pCmd->g = t, pCmd->b = p;
+        break;
+    case 1:
+        pCmd->r = q, pCmd->g = 100, pCmd->b = p;
+        break;
+    case 2:
+        pCmd->r = p, pCmd->g = 100, pCmd->b = t;
+        break;
+    case 3:
+        pCmd->r = p, pCmd->g = q, pCmd->b = 100;
+        break;
+    case 4:
+        pCmd->r = t, pCmd->g = p, pCmd->b = 100;
+        break;
+    default:
+        pCmd->r = 100, pCmd->g = p, pCmd->b = q;
+        break;
+    }
+}
+
+void cosmos_light_color_xy(uint16_t x, uint16_t y, cosmos_light_cmd_t *pCmd)
+{
+    cosmos_light_color_xyf(x / 65536.0f, y / 65536.0f, pCmd);
+}
+
+void cosmos_light_color_ct(uint16_t mireds, cosmos_light_cmd_t *pCmd)
+{
+    float t, x, y;
+
+    if (mireds < COSMOS_LIGHT_COLOR_MIREDS_MIN)
+        mireds = COSMOS_LIGHT_COLOR_MIREDS_MIN;
+    if (mireds > COSMOS_LIGHT_COLOR_MIREDS_MAX)
+        mireds = COSMOS_LIGHT_COLOR_MIREDS_MAX;
+
+    /*
+     * Cubic spline fit of the Planckian locus
+     * (Kim et al.), valid from 1667 K to 25000 K.
+     * t is in thousands of kelvin to keep the
+     * powers in range of a float.
+     */
+    t = 1000.0f / mireds;
+    if (t <= 4.0f)
+        x = -0.2661239f / (t * t * t) - 0.2343589f / (t * t) + 0.8776956f / t + 0.179910f;
+    else
+        x = -3.0258469f / (t * t * t) + 2.1070379f / (t * t) + 0.2226347f / t + 0.240390f;
+
+    if (t <= 2.222f)
+        y = -1.1063814f * x * x * x - 1.34811020f * x * x + 2.18555832f * x - 0.20219683f;
+    else if (t <= 4.0f)
+        y = -0.9549476f * x * x * x - 1.37418593f * x * x + 2.09137015f * x - 0.16748867f;
+    else
+        y = 3.0817580f * x * x * x - 5.87338670f * x * x + 3.75112997f * x - 0.37001483f;
+
+    cosmos_light_color_xyf(x, y, pCmd);
+}
@@ -0,0 +1,62 @@
+#ifndef MAIN_COSMOS_LIGHT_COLOR_H_
+#define MAIN_COSMOS_LIGHT_COLOR_H_
+
+#include <stdint.h>
+
+#include "cosmos_light_cmd.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define COSMOS_LIGHT_COLOR_LEVEL_MAX  254 /*!< Matter CurrentLevel, CurrentHue and CurrentSaturation full scale */
+#define COSMOS_LIGHT_COLOR_MIREDS_MIN 40  /*!< 25000 K, end of the Planckian locus fit */
+#define COSMOS_LIGHT_COLOR_MIREDS_MAX 600 /*!< 1667 K, start of the Planckian locus fit */
+
+/**
+ * @brief Brightness of a command from a Matter CurrentLevel
+ *
+ * @param level CurrentLevel, 0 .. COSMOS_LIGHT_COLOR_LEVEL_MAX
+ * @return uint8_t bright field, 0 .. 255
+ */
+static inline uint8_t cosmos_light_color_bright(uint8_t level)
+{
+    if (level > COSMOS_LIGHT_COLOR_LEVEL_MAX)
+        level = COSMOS_LIGHT_COLOR_LEVEL_MAX;
+    return (uint8_t)(((uint32_t)level * 255 + COSMOS_LIGHT_COLOR_LEVEL_MAX / 2) / COSMOS_LIGHT_COLOR_LEVEL_MAX);
+}
+
+/**
+ * @brief Sets r, g and b of a command from a Matter hue and saturation.
+ * Integer only, the hue circle is split in six 255 step sectors.
+ *
+ * @param hue CurrentHue, 0 .. COSMOS_LIGHT_COLOR_LEVEL_MAX is 0 .. 360 degrees
+ * @param sat CurrentSaturation, 0 .. COSMOS_LIGHT_COLOR_LEVEL_MAX
+ * @param pCmd Command, bright is left as is
+ */
+void cosmos_light_color_hs(uint8_t hue, uint8_t sat, cosmos_light_cmd_t *pCmd);
+
+/**
+ * @brief Sets r, g and b of a command from a Matter CIE 1931 xy point.
+ * The sRGB primaries are assumed, colors out of gamut are clipped.
+ *
+ * @param x CurrentX, x * 65536
+ * @param y CurrentY, y * 65536
+ * @param pCmd Command, bright is left as is
+ */
+void cosmos_light_color_xy(uint16_t x, uint16_t y, cosmos_light_cmd_t *pCmd);
+
+/**
+ * @brief Sets r, g and b of a command from a Matter color temperature,
+ * through the xy point of the black body at that temperature.
+ *
+ * @param mireds ColorTemperatureMireds, clamped to COSMOS_LIGHT_COLOR_MIREDS_MIN .. MAX
+ * @param pCmd Command, bright is left as is
+ */
+void cosmos_light_color_ct(uint16_t mireds, cosmos_light_cmd_t *pCmd);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAIN_COSMOS_LIGHT_COLOR_H_ */
@@ -0,0 +1,147 @@
+#include "cosmos_light_effect.h"
+#include "cosmos_light_gamma.h"
+
+#define KEY(ms, r, g, b) {(ms), {(r), (g), (b)}}
+
+/**
+ * @brief Effect keyframe, levels are 8-bit perceptual values
+ *
+ */
+typedef struct {
+    uint32_t time_ms;
+    uint8_t level[3];
+} cosmos_light_key_t;
+
+// Keyframe tables, levels are linearly interpolated between keys
+static const cosmos_light_key_t s_breathe[] = {KEY(0, 8, 4, 1), KEY(2000, 255, 160, 60), KEY(4000, 8, 4, 1)};
+static const cosmos_light_key_t s_color_cycle[] = {KEY(0, 255, 0, 0), KEY(2000, 0, 255, 0), KEY(4000, 0, 0, 255), KEY(6000, 255, 0, 0)};
+static const cosmos_light_key_t s_strobe[] = {KEY(0, 255, 0, 0), KEY(80, 255, 0, 0), KEY(100, 0, 0, 0), KEY(500, 0, 0, 0)};
+static const cosmos_light_key_t s_sunrise[] = {KEY(0, 0, 0, 0), KEY(600000, 120, 10, 0), KEY(1200000, 255, 110, 20), KEY(1800000, 255, 220, 150)};
+
+/*
+ * Frames rendered per effect, the key time span divided by the frame
+ * length (plus the end frame when the effect holds instead of looping).
+ * Slow effects use long frames faded by the LEDC hardware, so the
+ * table stays small.
+ */
+#define BREATHE_FRAMES     (4000 / 20)
+#define COLOR_CYCLE_FRAMES (6000 / 40)
+#define STROBE_FRAMES      (500 / 20)
+#define SUNRISE_FRAMES     (1800000 / 10000 + 1)
+
+#define COSMOS_LIGHT_EFFECT_FRAME_QTY (BREATHE_FRAMES + COLOR_CYCLE_FRAMES + STROBE_FRAMES + SUNRISE_FRAMES)
+
+static const struct {
+    const cosmos_light_key_t *pKey;
+    uint8_t key_qty;
+    bool loop;
+    bool fade;
+    uint16_t frame_ms;
+    uint16_t frame_qty;
+} s_effects[COSMOS_LIGHT_EFFECT_QTY] = {
+    [COSMOS_LIGHT_EFFECT_NONE] = {NULL, 0, false, false, COSMOS_LIGHT_EFFECT_TICK_MS, 0},
+    [COSMOS_LIGHT_EFFECT_BREATHE] = {s_breathe, 3, true, false, 20, BREATHE_FRAMES},
+    [COSMOS_LIGHT_EFFECT_COLOR_CYCLE] = {s_color_cycle, 4, true, false, 40, COLOR_CYCLE_FRAMES},
+    [COSMOS_LIGHT_EFFECT_STROBE] = {s_strobe, 4, true, false, 20, STROBE_FRAMES},
+    [COSMOS_LIGHT_EFFECT_SUNRISE] = {s_sunrise, 4, false, true, 10000, SUNRISE_FRAMES},
+};
+
+static cosmos_light_frame_t s_frame[COSMOS_LIGHT_EFFECT_FRAME_QTY];
+static uint16_t s_first_frame[COSMOS_LIGHT_EFFECT_QTY];
+static bool s_rendered = false;
+
+/**
+ * @brief Level of one channel at a point of the effect
+ *
+ * @param pKey Keyframes
+ * @param key_qty Quantity of keyframes
+ * @param time_ms Time from the start of the effect
+ * @param ch Channel
+ * @return uint32_t 8-bit perceptual level
+ */
+static uint32_t cosmos_light_effect_level(const cosmos_light_key_t *pKey, size_t key_qty, uint32_t time_ms, int ch)
+{
+    for (size_t k = 1; k < key_qty; k++) {
+        if (time_ms > pKey[k].time_ms) {
+            continue;
+        }
+
+        uint32_t span = pKey[k].time_ms - pKey[k - 1].time_ms;
+        int32_t from = pKey[k - 1].level[ch];
+        int32_t to = pKey[k].level[ch];
+        if (span == 0) {
+            return to;
+        }
+        return from + (to - from) * (int32_t)(time_ms - pKey[k - 1].time_ms) / (int32_t)span;
+    }
+    return pKey[key_qty - 1].level[ch];
+}
+
+void cosmos_light_effect_render(void)
+{
+    if (s_rendered) {
+        return;
+    }
+
+    uint16_t next = 0;
+    for (int effect = 0; effect < COSMOS_LIGHT_EFFECT_QTY; effect++) {
+        s_first_frame[effect] = next;
+
+        for (uint16_t f = 0; f < s_effects[effect].frame_qty; f++, next++) {
+            uint32_t time_ms = (uint32_t)f * s_effects[effect].frame_ms;
+            for (int ch = 0; ch < 3; ch++) {
+                uint32_t level = cosmos_light_effect_level(s_effects[effect].pKey, s_effects[effect].key_qty, time_ms, ch);
+                s_frame[next].duty[ch] = cosmos_light_gamma.duty[level];
+            }
+        }
+    }
+
+    s_rendered = true;
+}
+
+void cosmos_light_effect_start(cosmos_light_effect_state_t *pState, cosmos_light_effect_e effect)
+{
+    pState->effect = effect < COSMOS_LIGHT_EFFECT_QTY ? effect : COSMOS_LIGHT_EFFECT_NONE;
+    pState->frame = 0;
+
+    // Due on the next tick, so the first frame shows right away
+    pState->ticks = 1;
+}
+
+size_t cosmos_light_effect_step(cosmos_light_effect_state_t *pState, size_t qty, cosmos_light_effect_out_t *pOut, bool *pActive)
+{
+    size_t out_qty = 0;
+    bool active = false;
+
+    for (size_t i = 0; i < qty; i++) {
+        cosmos_light_effect_state_t *pLight = &pState[i];
+
+        // Idle lights and frames still showing cost a compare and a decrement
+        if (pLight->effect == COSMOS_LIGHT_EFFECT_NONE) {
+            continue;
+        }
+        active = true;
+        if (--pLight->ticks > 0) {
+            continue;
+        }
+
+        uint8_t effect = pLight->effect;
+        pOut[out_qty].light = i;
+        pOut[out_qty].fade_ms = s_effects[effect].fade ? s_effects[effect].frame_ms : 0;
+        pOut[out_qty].pFrame = &s_frame[s_first_frame[effect] + pLight->frame];
+        out_qty++;
+
+        pLight->ticks = s_effects[effect].frame_ms / COSMOS_LIGHT_EFFECT_TICK_MS;
+        if (++pLight->frame >= s_effects[effect].frame_qty) {
+            if (s_effects[effect].loop) {
+                pLight->frame = 0;
+            } else {
+                // Holds the last frame, the light is handed back
+                pLight->effect = COSMOS_LIGHT_EFFECT_NONE;
+            }
+        }
+    }
+
+    *pActive = active;
+    return out_qty;
+}
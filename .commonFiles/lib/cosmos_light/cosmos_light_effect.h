@@ -0,0 +1,88 @@
+#ifndef MAIN_COSMOS_LIGHT_EFFECT_H_
+#define MAIN_COSMOS_LIGHT_EFFECT_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define COSMOS_LIGHT_EFFECT_TICK_MS    20 /*!< Engine period, 50 frames per second for the fast effects */
+#define COSMOS_LIGHT_EFFECT_MAX_LIGHTS 16 /*!< Lights that can run an effect at the same time */
+
+/**
+ * @brief Effects available
+ *
+ */
+typedef enum {
+    COSMOS_LIGHT_EFFECT_NONE = 0,    /*!< No effect, the light shows its last command */
+    COSMOS_LIGHT_EFFECT_BREATHE,     /*!< Slow warm white breathing */
+    COSMOS_LIGHT_EFFECT_COLOR_CYCLE, /*!< Red, green, blue and back, looping */
+    COSMOS_LIGHT_EFFECT_STROBE,      /*!< Red alert flash, twice per second */
+    COSMOS_LIGHT_EFFECT_SUNRISE,     /*!< 30 min dark to warm white, then holds */
+    COSMOS_LIGHT_EFFECT_QTY,
+} cosmos_light_effect_e;
+
+/**
+ * @brief One rendered frame, already gamma corrected
+ *
+ */
+typedef struct {
+    uint16_t duty[3]; /*!< LEDC duty of each channel (0: R or single, 1: G, 2: B) */
+} cosmos_light_frame_t;
+
+/**
+ * @brief Effect state of a light, owned by the caller
+ *
+ */
+typedef struct {
+    uint8_t effect; /*!< cosmos_light_effect_e running, COSMOS_LIGHT_EFFECT_NONE if idle */
+    uint16_t ticks; /*!< Ticks left until the next frame */
+    uint16_t frame; /*!< Current frame of the effect */
+} cosmos_light_effect_state_t;
+
+/**
+ * @brief Frame to write, produced by cosmos_light_effect_step
+ *
+ */
+typedef struct {
+    uint16_t light;                     /*!< Index of the light in the state array */
+    uint16_t fade_ms;                   /*!< Hardware fade towards the frame, 0 writes it at once */
+    const cosmos_light_frame_t *pFrame; /*!< Frame to write */
+} cosmos_light_effect_out_t;
+
+/**
+ * @brief Renders the keyframes of every effect into the frame table.
+ * Only the first call does the work, every later one returns at once.
+ *
+ */
+void cosmos_light_effect_render(void);
+
+/**
+ * @brief Starts an effect on a light from its first frame, or stops it
+ *
+ * @param pState Effect state of the light
+ * @param effect Effect to run, COSMOS_LIGHT_EFFECT_NONE stops it
+ */
+void cosmos_light_effect_start(cosmos_light_effect_state_t *pState, cosmos_light_effect_e effect);
+
+/**
+ * @brief Advances every light by one tick. Lights due for a new frame are
+ * appended to pOut, so the caller writes all of them in one pass. Non looping
+ * effects stop on their last frame.
+ *
+ * @param pState Effect state of each light
+ * @param qty Quantity of lights
+ * @param pOut Output, room for qty frames
+ * @param pActive Output, true while any light still runs an effect
+ * @return size_t Frames written to pOut
+ */
+size_t cosmos_light_effect_step(cosmos_light_effect_state_t *pState, size_t qty, cosmos_light_effect_out_t *pOut, bool *pActive);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAIN_COSMOS_LIGHT_EFFECT_H_ */
@@ -0,0 +1,70 @@
+#include "cosmos_light_gamma.h"
+
+#define LN2 0.69314718055994530942
+
+/*
+ * std::pow is not constexpr, so level ^ gamma is computed as
+ * exp(gamma * ln(level)) with series that the compiler evaluates
+ * when building the table. Nothing of this ends up in the binary.
+ */
+static constexpr double gamma_ln(double x)
+{
+    // x = m * 2^k with m in [1, 2)
+    int k = 0;
+    while (x >= 2.0) {
+        x /= 2.0;
+        k++;
+    }
+    while (x < 1.0) {
+        x *= 2.0;
+        k--;
+    }
+
+    // ln(m) = 2 * atanh((m - 1) / (m + 1)), |y| < 1/3 so it converges fast
+    double y = (x - 1.0) / (x + 1.0);
+    double term = y;
+    double sum = 0.0;
+    for (int n = 1; n < 41; n += 2) {
+        sum += term / n;
+        term *= y * y;
+    }
+    return 2.0 * sum + k * LN2;
+}
+
+static constexpr double gamma_exp(double x)
+{
+    // x = k * ln2 + r with |r| <= ln2 / 2
+    int k = (int)(x / LN2 + (x < 0 ? -0.5 : 0.5));
+    double r = x - k * LN2;
+
+    double term = 1.0;
+    double sum = 1.0;
+    for (int n = 1; n < 25; n++) {
+        term *= r / n;
+        sum += term;
+    }
+    for (; k > 0; k--)
+        sum *= 2.0;
+    for (; k < 0; k++)
+        sum /= 2.0;
+    return sum;
+}
+
+static constexpr cosmos_light_gamma_t gamma_table(void)
+{
+    cosmos_light_gamma_t table = {};
+    for (int level = 1; level < COSMOS_LIGHT_GAMMA_QTY; level++) {
+        double linear = gamma_exp(COSMOS_LIGHT_GAMMA * gamma_ln(level / (double)(COSMOS_LIGHT_GAMMA_QTY - 1)));
+        uint16_t duty = (uint16_t)(linear * COSMOS_LIGHT_DUTY_MAX + 0.5);
+
+        // The first levels round to 0, keep them lit so any level above 0 glows
+        table.duty[level] = duty ? duty : 1;
+    }
+    return table;
+}
+
+constexpr cosmos_light_gamma_t cosmos_light_gamma = gamma_table();
+
+static_assert(cosmos_light_gamma.duty[0] == 0, "Level 0 must switch the channel off");
+static_assert(cosmos_light_gamma.duty[COSMOS_LIGHT_GAMMA_QTY - 1] == COSMOS_LIGHT_DUTY_MAX, "Level 255 must be full duty");
+static_assert(cosmos_light_gamma.duty[1] > 0, "The lowest level must still light the LED");
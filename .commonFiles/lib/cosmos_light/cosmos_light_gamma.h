@@ -0,0 +1,31 @@
+#ifndef MAIN_COSMOS_LIGHT_GAMMA_H_
+#define MAIN_COSMOS_LIGHT_GAMMA_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define COSMOS_LIGHT_DUTY_BITS 13                                  /*!< LEDC duty resolution, 13 bits at 5 kHz fits the 80 MHz APB clock */
+#define COSMOS_LIGHT_DUTY_MAX  ((1UL << COSMOS_LIGHT_DUTY_BITS) - 1) /*!< Duty at full brightness */
+#define COSMOS_LIGHT_FREQ_HZ   5000                                /*!< Well above visible flicker */
+#define COSMOS_LIGHT_GAMMA     2.2                                 /*!< Perceived brightness ~ duty ^ (1 / gamma) */
+#define COSMOS_LIGHT_GAMMA_QTY 256                                 /*!< One entry per 8-bit channel level */
+
+/**
+ * @brief Gamma correction table, 8-bit perceptual level to LEDC duty.
+ * Generated at compile time by cosmos_light_gamma.cpp, lives in flash.
+ *
+ */
+typedef struct {
+    uint16_t duty[COSMOS_LIGHT_GAMMA_QTY]; /*!< Duty for each level, duty[0] is 0 and duty[255] COSMOS_LIGHT_DUTY_MAX */
+} cosmos_light_gamma_t;
+
+extern const cosmos_light_gamma_t cosmos_light_gamma;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAIN_COSMOS_LIGHT_GAMMA_H_ */
@@ -0,0 +1,153 @@
+#include "cosmos_light_ledc.h"
+
+/*
+ * Timer profiles. The duty resolution must fit in the LEDC clock at
+ * the profile frequency: COSMOS_LIGHT_LEDC_CLK_HZ / freq_hz >= 2^duty_bits
+ */
+constexpr cosmos_light_profile_t cosmos_light_profile[COSMOS_LIGHT_PROFILE_QTY] = {
+    {COSMOS_LIGHT_FREQ_HZ, COSMOS_LIGHT_DUTY_BITS}, // COSMOS_LIGHT_PROFILE_DEFAULT
+    {20000, 10},                                    // COSMOS_LIGHT_PROFILE_FLICKER_FREE
+};
+
+/*
+ * Resources of the camera XCLK (cam_task, esp32-camera drives it in
+ * low speed mode) and of the pump PWM (pump_pwm.h, high speed mode).
+ * Without a high speed mode the pump PWM falls on the low speed
+ * channels too. The pools below must stay clear of them.
+ */
+#if SOC_LEDC_SUPPORT_HS_MODE
+static constexpr cosmos_light_ledc_res_t k_reserved_timer[] = {
+    {LEDC_LOW_SPEED_MODE, LEDC_TIMER_0},
+    {LEDC_HIGH_SPEED_MODE, LEDC_TIMER_0},
+};
+
+static constexpr cosmos_light_ledc_res_t k_reserved_channel[] = {
+    {LEDC_LOW_SPEED_MODE, LEDC_CHANNEL_0},
+    {LEDC_HIGH_SPEED_MODE, LEDC_CHANNEL_0},
+    {LEDC_HIGH_SPEED_MODE, LEDC_CHANNEL_1},
+    {LEDC_HIGH_SPEED_MODE, LEDC_CHANNEL_2},
+    {LEDC_HIGH_SPEED_MODE, LEDC_CHANNEL_3},
+};
+#else
+static constexpr cosmos_light_ledc_res_t k_reserved_timer[] = {
+    {LEDC_LOW_SPEED_MODE, LEDC_TIMER_0},
+};
+
+static constexpr cosmos_light_ledc_res_t k_reserved_channel[] = {
+    {LEDC_LOW_SPEED_MODE, LEDC_CHANNEL_0},
+    {LEDC_LOW_SPEED_MODE, LEDC_CHANNEL_1},
+    {LEDC_LOW_SPEED_MODE, LEDC_CHANNEL_2},
+    {LEDC_LOW_SPEED_MODE, LEDC_CHANNEL_3},
+};
+#endif
+
+/*
+ * Pools handed out by cosmos_light_begin, in order. Channels of the
+ * same mode are kept together, a light never mixes speed modes.
+ */
+#if SOC_LEDC_SUPPORT_HS_MODE
+constexpr cosmos_light_ledc_res_t cosmos_light_timer_pool[COSMOS_LIGHT_TIMER_POOL_QTY] = {
+    {LEDC_LOW_SPEED_MODE, LEDC_TIMER_1},
+    {LEDC_LOW_SPEED_MODE, LEDC_TIMER_2},
+    {LEDC_LOW_SPEED_MODE, LEDC_TIMER_3},
+    {LEDC_HIGH_SPEED_MODE, LEDC_TIMER_1},
+    {LEDC_HIGH_SPEED_MODE, LEDC_TIMER_2},
+    {LEDC_HIGH_SPEED_MODE, LEDC_TIMER_3},
+};
+
+constexpr cosmos_light_ledc_res_t cosmos_light_channel_pool[COSMOS_LIGHT_CHANNEL_POOL_QTY] = {
+    {LEDC_LOW_SPEED_MODE, LEDC_CHANNEL_1},
+    {LEDC_LOW_SPEED_MODE, LEDC_CHANNEL_2},
+    {LEDC_LOW_SPEED_MODE, LEDC_CHANNEL_3},
+    {LEDC_LOW_SPEED_MODE, LEDC_CHANNEL_4},
+    {LEDC_LOW_SPEED_MODE, LEDC_CHANNEL_5},
+    {LEDC_LOW_SPEED_MODE, LEDC_CHANNEL_6},
+    {LEDC_LOW_SPEED_MODE, LEDC_CHANNEL_7},
+    {LEDC_HIGH_SPEED_MODE, LEDC_CHANNEL_4},
+    {LEDC_HIGH_SPEED_MODE, LEDC_CHANNEL_5},
+    {LEDC_HIGH_SPEED_MODE, LEDC_CHANNEL_6},
+    {LEDC_HIGH_SPEED_MODE, LEDC_CHANNEL_7},
+};
+#else
+constexpr cosmos_light_ledc_res_t cosmos_light_timer_pool[COSMOS_LIGHT_TIMER_POOL_QTY] = {
+    {LEDC_LOW_SPEED_MODE, LEDC_TIMER_1},
+    {LEDC_LOW_SPEED_MODE, LEDC_TIMER_2},
+    {LEDC_LOW_SPEED_MODE, LEDC_TIMER_3},
+};
+
+constexpr cosmos_light_ledc_res_t cosmos_light_channel_pool[COSMOS_LIGHT_CHANNEL_POOL_QTY] = {
+    {LEDC_LOW_SPEED_MODE, LEDC_CHANNEL_4},
+    {LEDC_LOW_SPEED_MODE, LEDC_CHANNEL_5},
+#if SOC_LEDC_CHANNEL_NUM > 6
+    {LEDC_LOW_SPEED_MODE, LEDC_CHANNEL_6},
+    {LEDC_LOW_SPEED_MODE, LEDC_CHANNEL_7},
+#endif
+};
+#endif
+
+static constexpr bool res_equal(const cosmos_light_ledc_res_t &a, const cosmos_light_ledc_res_t &b)
+{
+    return a.mode == b.mode && a.num == b.num;
+}
+
+template <size_t N, size_t R>
+static constexpr bool pool_is_clear(const cosmos_light_ledc_res_t (&pool)[N], const cosmos_light_ledc_res_t (&reserved)[R], unsigned num_max)
+{
+    for (size_t i = 0; i < N; i++) {
+        if (pool[i].num >= num_max || pool[i].mode >= LEDC_SPEED_MODE_MAX)
+            return false;
+        for (size_t j = i + 1; j < N; j++) {
+            if (res_equal(pool[i], pool[j]))
+                return false;
+        }
+        for (size_t j = 0; j < R; j++) {
+            if (res_equal(pool[i], reserved[j]))
+                return false;
+        }
+    }
+    return true;
+}
+
+template <size_t N>
+static constexpr bool pool_is_grouped(const cosmos_light_ledc_res_t (&pool)[N])
+{
+    for (size_t i = 1; i < N; i++) {
+        for (size_t j = 0; j + 1 < i; j++) {
+            if (pool[j].mode == pool[i].mode && pool[i - 1].mode != pool[i].mode)
+                return false;
+        }
+    }
+    return true;
+}
+
+template <size_t N>
+static constexpr bool timers_cover_profiles(const cosmos_light_ledc_res_t (&timer)[N], const cosmos_light_ledc_res_t (&channel)[COSMOS_LIGHT_CHANNEL_POOL_QTY])
+{
+    // Every mode with channels needs a timer per profile, so allocating a timer never fails
+    for (size_t c = 0; c < COSMOS_LIGHT_CHANNEL_POOL_QTY; c++) {
+        size_t timers = 0;
+        for (size_t t = 0; t < N; t++)
+            timers += timer[t].mode == channel[c].mode;
+        if (timers < COSMOS_LIGHT_PROFILE_QTY)
+            return false;
+    }
+    return true;
+}
+
+static constexpr bool profiles_fit(void)
+{
+    for (int p = 0; p < COSMOS_LIGHT_PROFILE_QTY; p++) {
+        const cosmos_light_profile_t &profile = cosmos_light_profile[p];
+        if (profile.freq_hz == 0 || profile.duty_bits == 0 || profile.duty_bits > COSMOS_LIGHT_DUTY_BITS)
+            return false;
+        if (COSMOS_LIGHT_LEDC_CLK_HZ / profile.freq_hz < (1UL << profile.duty_bits))
+            return false;
+    }
+    return true;
+}
+
+static_assert(profiles_fit(), "A timer profile asks for more resolution than the LEDC clock gives at its frequency");
+static_assert(pool_is_clear(cosmos_light_timer_pool, k_reserved_timer, LEDC_TIMER_MAX), "Timer pool entries collide or are out of range");
+static_assert(pool_is_clear(cosmos_light_channel_pool, k_reserved_channel, LEDC_CHANNEL_MAX), "Channel pool entries collide or are out of range");
+static_assert(pool_is_grouped(cosmos_light_channel_pool), "Channels of the same speed mode must be together in the pool");
+static_assert(timers_cover_profiles(cosmos_light_timer_pool, cosmos_light_channel_pool), "Every speed mode with channels needs a timer per profile");
@@ -0,0 +1,81 @@
+#ifndef MAIN_COSMOS_LIGHT_LEDC_H_
+#define MAIN_COSMOS_LIGHT_LEDC_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "driver/ledc.h"
+#include "soc/soc_caps.h"
+
+#include "cosmos_light_gamma.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define COSMOS_LIGHT_LEDC_CLK_HZ 80000000 /*!< APB clock feeding the LEDC timers */
+
+/**
+ * @brief Timer profiles a light can ask for. Lights with the same
+ * profile and speed mode share a timer from the pool.
+ *
+ */
+typedef enum {
+    COSMOS_LIGHT_PROFILE_DEFAULT = 0,  /*!< 5 kHz / 13-bit, full resolution of the gamma table */
+    COSMOS_LIGHT_PROFILE_FLICKER_FREE, /*!< 20 kHz / 10-bit, no banding on camera sensors */
+    COSMOS_LIGHT_PROFILE_QTY,
+} cosmos_light_profile_e;
+
+/**
+ * @brief Frequency and duty resolution of a timer profile
+ *
+ */
+typedef struct {
+    uint32_t freq_hz;  /*!< PWM frequency */
+    uint8_t duty_bits; /*!< Duty resolution, gamma duties are shifted down from COSMOS_LIGHT_DUTY_BITS */
+} cosmos_light_profile_t;
+
+/**
+ * @brief LEDC timer or channel handed to the lights
+ *
+ */
+typedef struct {
+    ledc_mode_t mode; /*!< Speed mode of the resource */
+    uint8_t num;      /*!< ledc_timer_t or ledc_channel_t */
+} cosmos_light_ledc_res_t;
+
+/*
+ * Low speed timer 0 and channel 0 are left to the camera XCLK, high
+ * speed timer 0 and channels 0..3 to the pump PWM, see cosmos_light_ledc.cpp
+ */
+#if SOC_LEDC_SUPPORT_HS_MODE
+#define COSMOS_LIGHT_TIMER_POOL_QTY   6  /*!< Low speed timers 1..3, high speed timers 1..3 */
+#define COSMOS_LIGHT_CHANNEL_POOL_QTY 11 /*!< Low speed channels 1..7, high speed channels 4..7 */
+#else
+#define COSMOS_LIGHT_TIMER_POOL_QTY   3                          /*!< Low speed timers 1..3 */
+#define COSMOS_LIGHT_CHANNEL_POOL_QTY (SOC_LEDC_CHANNEL_NUM - 4) /*!< Low speed channels 4 and up */
+#endif
+
+extern const cosmos_light_profile_t cosmos_light_profile[COSMOS_LIGHT_PROFILE_QTY];
+extern const cosmos_light_ledc_res_t cosmos_light_timer_pool[COSMOS_LIGHT_TIMER_POOL_QTY];
+extern const cosmos_light_ledc_res_t cosmos_light_channel_pool[COSMOS_LIGHT_CHANNEL_POOL_QTY];
+
+/**
+ * @brief Scales a gamma table duty to the resolution of a profile. Levels
+ * above 0 stay lit at the lowest duty.
+ *
+ * @param profile cosmos_light_profile_e of the light
+ * @param duty Duty at COSMOS_LIGHT_DUTY_BITS
+ * @return uint32_t Duty at the resolution of the profile
+ */
+static inline uint32_t cosmos_light_profile_duty(uint8_t profile, uint32_t duty)
+{
+    uint32_t scaled = duty >> (COSMOS_LIGHT_DUTY_BITS - cosmos_light_profile[profile].duty_bits);
+    return (duty && !scaled) ? 1 : scaled;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAIN_COSMOS_LIGHT_LEDC_H_ */
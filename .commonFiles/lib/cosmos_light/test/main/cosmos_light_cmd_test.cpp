@@ -0,0 +1,201 @@
+/**
+ * @file cosmos_light_cmd_test.cpp
+ * @author Marcel Nahir Samur (mnsamur2014@gmail.com)
+ * @brief Fuzzes the cosmos_light command parser against the previous
+ *        strncpy/atoi decoding and benchmarks both, plus the binary command
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+
+#include "cosmos_light_cmd.h"
+#include "cosmos_test.h"
+
+#define FUZZ_ROUNDS  2000000
+#define BENCH_ROUNDS 10000000
+
+/**
+ * @brief The decoding done by cosmos_light_control before the parser,
+ *        with aux_value terminated so the reference is well defined
+ *
+ * @param rgb_values Text command
+ * @param rgb_arr Output, the 4 values
+ */
+static void legacy_decode(const char *rgb_values, int rgb_arr[4])
+{
+    int rgb_val = 0;
+    for (int rgb_idx = 0; rgb_idx < 4; rgb_idx++) {
+        char aux_value[4] = {0};
+        strncpy(aux_value, &rgb_values[rgb_val], 3);
+        rgb_val += 4;
+        rgb_arr[rgb_idx] = atoi(aux_value);
+    }
+}
+
+/**
+ * @brief Well formed per the format: 3 digits and a slash, 4 times, every value a byte
+ *
+ * @param pText Text command, COSMOS_LIGHT_TEXT_LEN bytes
+ */
+static bool well_formed(const char *pText)
+{
+    for (int field = 0; field < 4; field++) {
+        const char *p = &pText[field * 4];
+        for (int i = 0; i < 3; i++) {
+            if (p[i] < '0' || p[i] > '9')
+                return false;
+        }
+        if (p[3] != '/' || (p[0] - '0') * 100 + (p[1] - '0') * 10 + (p[2] - '0') > 255)
+            return false;
+    }
+    return true;
+}
+
+static void format(char *pText, int bright, int r, int g, int b)
+{
+    snprintf(pText, COSMOS_LIGHT_TEXT_LEN + 1, "%03d/%03d/%03d/%03d/", bright, r, g, b);
+}
+
+static void test_known_values(void)
+{
+    cosmos_light_cmd_t cmd = {};
+
+    CHECK(cosmos_light_cmd_parse("050/255/112/017/", 16, &cmd) == 0);
+    CHECK(cmd.bright == 50 && cmd.r == 255 && cmd.g == 112 && cmd.b == 17);
+    CHECK(cosmos_light_cmd_duty(&cmd, cmd.g) == 112 * 50 / 100);
+    CHECK(!cosmos_light_cmd_is_off(&cmd));
+
+    CHECK(cosmos_light_cmd_parse("000/000/000/000/", 16, &cmd) == 0);
+    CHECK(cosmos_light_cmd_is_off(&cmd));
+
+    // Trailing bytes are ignored, the buffer does not need a NUL
+    const char unterminated[16] = {'2', '5', '5', '/', '1', '0', '0', '/', '0', '0', '0', '/', '0', '0', '1', '/'};
+    CHECK(cosmos_light_cmd_parse(unterminated, sizeof(unterminated), &cmd) == 0);
+    CHECK(cmd.bright == 255 && cmd.r == 100 && cmd.g == 0 && cmd.b == 1);
+    CHECK(cosmos_light_cmd_parse("001/002/003/004/rx", 18, &cmd) == 0);
+    CHECK(cmd.bright == 1 && cmd.b == 4);
+}
+
+static void test_rejects(void)
+{
+    cosmos_light_cmd_t cmd = {7, 7, 7, 7};
+
+    CHECK(cosmos_light_cmd_parse("050/255/112/017/", 15, &cmd) == -1); // short
+    CHECK(cosmos_light_cmd_parse(NULL, 16, &cmd) == -1);
+    CHECK(cosmos_light_cmd_parse("256/000/000/000/", 16, &cmd) == -1); // not a byte
+    CHECK(cosmos_light_cmd_parse("999/000/000/000/", 16, &cmd) == -1);
+    CHECK(cosmos_light_cmd_parse("050/255/112/017-", 16, &cmd) == -1); // separator
+    CHECK(cosmos_light_cmd_parse("05/0255/112/017/", 16, &cmd) == -1);
+    CHECK(cosmos_light_cmd_parse("050/2a5/112/017/", 16, &cmd) == -1); // digit
+    CHECK(cosmos_light_cmd_parse("050/ 55/112/017/", 16, &cmd) == -1);
+    CHECK(cosmos_light_cmd_parse("-50/255/112/017/", 16, &cmd) == -1);
+    CHECK(cosmos_light_cmd_parse("050/255/112/01:/", 16, &cmd) == -1); // ':' is '9' + 1
+
+    // Output untouched on error
+    CHECK(cmd.bright == 7 && cmd.r == 7 && cmd.g == 7 && cmd.b == 7);
+}
+
+/**
+ * @brief Every accepted text must be well formed and decode like the old path,
+ *        every well formed text must be accepted
+ *
+ */
+static void test_fuzz(void)
+{
+    static const char k_alphabet[] = "0123456789/ -+:.\x00\xff";
+    std::mt19937 rng(1234);
+    int accepted = 0;
+
+    for (int n = 0; n < FUZZ_ROUNDS; n++) {
+        char text[COSMOS_LIGHT_TEXT_LEN + 1];
+        format(text, rng() % 300, rng() % 300, rng() % 300, rng() % 300);
+
+        // Mutate a few bytes, sometimes none
+        int mutations = rng() % 3;
+        for (int m = 0; m < mutations; m++)
+            text[rng() % COSMOS_LIGHT_TEXT_LEN] = k_alphabet[rng() % (sizeof(k_alphabet) - 1)];
+
+        cosmos_light_cmd_t cmd;
+        bool ok = cosmos_light_cmd_parse(text, COSMOS_LIGHT_TEXT_LEN, &cmd) == 0;
+        bool expected = well_formed(text);
+        if (ok != expected) {
+            printf("FAIL fuzz: '%.16s' parsed %d expected %d\n", text, ok, expected);
+            s_failures++;
+            return;
+        }
+        if (!ok)
+            continue;
+
+        accepted++;
+        int ref[4];
+        legacy_decode(text, ref);
+        if (cmd.bright != ref[0] || cmd.r != ref[1] || cmd.g != ref[2] || cmd.b != ref[3]) {
+            printf("FAIL fuzz: '%.16s' decoded %d/%d/%d/%d legacy %d/%d/%d/%d\n", text, cmd.bright, cmd.r, cmd.g,
+                   cmd.b, ref[0], ref[1], ref[2], ref[3]);
+            s_failures++;
+            return;
+        }
+    }
+    printf("fuzz: %d texts, %d accepted\n", FUZZ_ROUNDS, accepted);
+}
+
+template <typename F>
+static double bench(const char *pName, F fn)
+{
+    volatile uint32_t sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int n = 0; n < BENCH_ROUNDS; n++)
+        sink = sink + fn(n);
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    printf("%-28s %6.2f ns/cmd\n", pName, ns / BENCH_ROUNDS);
+    return ns;
+}
+
+static void bench_all(void)
+{
+    // A small ring of commands so the branch predictor can't learn a single input
+    static char texts[64][COSMOS_LIGHT_TEXT_LEN + 1];
+    static uint8_t payloads[64][COSMOS_LIGHT_CMD_SIZE];
+    std::mt19937 rng(99);
+    for (int i = 0; i < 64; i++) {
+        int v[4] = {(int)(rng() % 256), (int)(rng() % 101), (int)(rng() % 101), (int)(rng() % 101)};
+        format(texts[i], v[0], v[1], v[2], v[3]);
+        for (int j = 0; j < 4; j++)
+            payloads[i][j] = v[j];
+    }
+
+    double legacy = bench("legacy strncpy/atoi", [](int n) {
+        int arr[4];
+        legacy_decode(texts[n & 63], arr);
+        return (uint32_t)(arr[1] * arr[0] / 100);
+    });
+    double text = bench("cosmos_light_cmd_parse", [](int n) {
+        cosmos_light_cmd_t cmd;
+        cosmos_light_cmd_parse(texts[n & 63], COSMOS_LIGHT_TEXT_LEN, &cmd);
+        return cosmos_light_cmd_duty(&cmd, cmd.r);
+    });
+    double binary = bench("binary payload in place", [](int n) {
+        const cosmos_light_cmd_t *pCmd = (const cosmos_light_cmd_t *)payloads[n & 63];
+        return cosmos_light_cmd_duty(pCmd, pCmd->r);
+    });
+
+    printf("speed-up: parser %.1fx, binary %.1fx\n", legacy / text, legacy / binary);
+}
+
+int main(void)
+{
+    test_known_values();
+    test_rejects();
+    test_fuzz();
+    bench_all();
+
+    return cosmos_test_report();
+}
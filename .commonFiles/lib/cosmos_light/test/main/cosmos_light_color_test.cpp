@@ -0,0 +1,140 @@
+/**
+ * @file cosmos_light_color_test.cpp
+ * @author Marcel Nahir Samur (mnsamur2014@gmail.com)
+ * @brief Checks the Matter level, hue/saturation, xy and color
+ *        temperature conversions to a light command
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "cosmos_light_color.h"
+#include "cosmos_test.h"
+
+/**
+ * @brief Compares the channels of a command within a tolerance
+ *
+ * @param pCmd Command
+ * @param r Expected red
+ * @param g Expected green
+ * @param b Expected blue
+ * @param tol Allowed difference, in percent
+ */
+static bool rgb_near(const cosmos_light_cmd_t *pCmd, int r, int g, int b, int tol)
+{
+    return abs(pCmd->r - r) <= tol && abs(pCmd->g - g) <= tol && abs(pCmd->b - b) <= tol;
+}
+
+static void test_bright(void)
+{
+    CHECK(cosmos_light_color_bright(0) == 0);
+    CHECK(cosmos_light_color_bright(1) == 1);
+    CHECK(cosmos_light_color_bright(127) == 128);
+    CHECK(cosmos_light_color_bright(254) == 255);
+    CHECK(cosmos_light_color_bright(255) == 255);
+
+    // Monotonic, a slider never steps back
+    for (int level = 1; level <= COSMOS_LIGHT_COLOR_LEVEL_MAX; level++)
+        CHECK(cosmos_light_color_bright(level) > cosmos_light_color_bright(level - 1));
+}
+
+static void test_hs(void)
+{
+    cosmos_light_cmd_t cmd = {200, 0, 0, 0};
+
+    cosmos_light_color_hs(0, 254, &cmd);
+    CHECK(rgb_near(&cmd, 100, 0, 0, 0));
+    CHECK(cmd.bright == 200);
+
+    cosmos_light_color_hs(85, 254, &cmd); // 120 degrees, a hue step is 1.4 degrees
+    CHECK(rgb_near(&cmd, 0, 100, 0, 2));
+
+    cosmos_light_color_hs(169, 254, &cmd); // 240 degrees
+    CHECK(rgb_near(&cmd, 0, 0, 100, 2));
+
+    cosmos_light_color_hs(42, 254, &cmd); // 60 degrees, yellow
+    CHECK(rgb_near(&cmd, 100, 100, 0, 2));
+
+    cosmos_light_color_hs(254, 254, &cmd); // 360 degrees wraps to red
+    CHECK(rgb_near(&cmd, 100, 0, 0, 0));
+
+    cosmos_light_color_hs(123, 0, &cmd); // No saturation is white at any hue
+    CHECK(rgb_near(&cmd, 100, 100, 100, 0));
+
+    cosmos_light_color_hs(0, 127, &cmd);
+    CHECK(rgb_near(&cmd, 100, 50, 50, 0));
+
+    // Every hue keeps one channel full, so the level alone sets the brightness
+    for (int hue = 0; hue <= COSMOS_LIGHT_COLOR_LEVEL_MAX; hue++) {
+        cosmos_light_color_hs(hue, 254, &cmd);
+        CHECK(cmd.r == 100 || cmd.g == 100 || cmd.b == 100);
+        CHECK(cmd.r <= 100 && cmd.g <= 100 && cmd.b <= 100);
+    }
+}
+
+static void test_xy(void)
+{
+    cosmos_light_cmd_t cmd = {255, 0, 0, 0};
+
+    cosmos_light_color_xy(20493, 21561, &cmd); // D65 white point
+    CHECK(rgb_near(&cmd, 100, 100, 100, 2));
+
+    cosmos_light_color_xy(41943, 21627, &cmd); // sRGB red primary
+    CHECK(rgb_near(&cmd, 100, 0, 0, 2));
+
+    cosmos_light_color_xy(19661, 39322, &cmd); // sRGB green primary
+    CHECK(rgb_near(&cmd, 0, 100, 0, 2));
+
+    cosmos_light_color_xy(9830, 3932, &cmd); // sRGB blue primary
+    CHECK(rgb_near(&cmd, 0, 0, 100, 2));
+
+    cosmos_light_color_xy(0, 0, &cmd);
+    CHECK(rgb_near(&cmd, 100, 100, 100, 0));
+    CHECK(cmd.bright == 255);
+}
+
+static void test_ct(void)
+{
+    cosmos_light_cmd_t cmd = {255, 0, 0, 0};
+    cosmos_light_cmd_t warm, cold;
+
+    cosmos_light_color_ct(154, &cmd); // 6500 K, close to D65
+    CHECK(rgb_near(&cmd, 100, 100, 100, 4));
+
+    cosmos_light_color_ct(500, &warm); // 2000 K
+    CHECK(warm.r == 100 && warm.g < warm.r && warm.b < warm.g);
+
+    cosmos_light_color_ct(66, &cold); // 15000 K
+    CHECK(cold.b == 100 && cold.r < cold.b);
+
+    // Out of range temperatures are clamped, not extrapolated
+    cosmos_light_color_ct(0, &cmd);
+    cosmos_light_color_ct(COSMOS_LIGHT_COLOR_MIREDS_MIN, &cold);
+    CHECK(rgb_near(&cmd, cold.r, cold.g, cold.b, 0));
+    cosmos_light_color_ct(1000, &cmd);
+    cosmos_light_color_ct(COSMOS_LIGHT_COLOR_MIREDS_MAX, &warm);
+    CHECK(rgb_near(&cmd, warm.r, warm.g, warm.b, 0));
+
+    // Warmer is always redder
+    uint8_t last_b = 100;
+    for (int mireds = COSMOS_LIGHT_COLOR_MIREDS_MIN; mireds <= COSMOS_LIGHT_COLOR_MIREDS_MAX; mireds++) {
+        cosmos_light_color_ct(mireds, &cmd);
+        CHECK(cmd.b <= last_b);
+        last_b = cmd.b;
+    }
+}
+
+int main(void)
+{
+    test_bright();
+    test_hs();
+    test_xy();
+    test_ct();
+
+    return cosmos_test_report();
+}
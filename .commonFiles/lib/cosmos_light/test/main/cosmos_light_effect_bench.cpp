@@ -0,0 +1,116 @@
+/**
+ * @file cosmos_light_effect_bench.cpp
+ * @author Marcel Nahir Samur (mnsamur2014@gmail.com)
+ * @brief Checks the effects engine frame stepping and measures the
+ *        CPU time of a tick against the number of lights
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include "cosmos_light_effect.h"
+#include "cosmos_light_gamma.h"
+#include "cosmos_test.h"
+
+#define BENCH_TICKS 200000
+
+// Stand-in for the LEDC duty registers, 3 channels per light
+static volatile uint32_t s_duty_reg[3 * 1024];
+
+static void write_frames(const cosmos_light_effect_out_t *pOut, size_t out_qty)
+{
+    for (size_t i = 0; i < out_qty; i++) {
+        for (int ch = 0; ch < 3; ch++)
+            s_duty_reg[pOut[i].light * 3 + ch] = pOut[i].pFrame->duty[ch];
+    }
+}
+
+static void test_stepping(void)
+{
+    cosmos_light_effect_state_t state[2] = {};
+    cosmos_light_effect_out_t out[2];
+    bool active;
+
+    cosmos_light_effect_render();
+
+    // Idle lights produce nothing
+    CHECK(cosmos_light_effect_step(state, 2, out, &active) == 0);
+    CHECK(!active);
+
+    // First frame shows on the first tick, strobe starts full red
+    cosmos_light_effect_start(&state[1], COSMOS_LIGHT_EFFECT_STROBE);
+    CHECK(cosmos_light_effect_step(state, 2, out, &active) == 1);
+    CHECK(active && out[0].light == 1 && out[0].fade_ms == 0);
+    CHECK(out[0].pFrame->duty[0] == COSMOS_LIGHT_DUTY_MAX && out[0].pFrame->duty[1] == 0);
+    const cosmos_light_frame_t *pFirst = out[0].pFrame;
+
+    // 500 ms loop at one frame per tick
+    for (int t = 1; t < 500 / COSMOS_LIGHT_EFFECT_TICK_MS; t++)
+        CHECK(cosmos_light_effect_step(state, 2, out, &active) == 1);
+    CHECK(cosmos_light_effect_step(state, 2, out, &active) == 1);
+    CHECK(out[0].pFrame == pFirst);
+
+    // Color cycle frames last two ticks
+    cosmos_light_effect_start(&state[0], COSMOS_LIGHT_EFFECT_COLOR_CYCLE);
+    cosmos_light_effect_start(&state[1], COSMOS_LIGHT_EFFECT_NONE);
+    CHECK(cosmos_light_effect_step(state, 2, out, &active) == 1);
+    CHECK(cosmos_light_effect_step(state, 2, out, &active) == 0);
+    CHECK(cosmos_light_effect_step(state, 2, out, &active) == 1);
+
+    // Sunrise fades over 10 s frames, ends on warm white and hands the light back
+    cosmos_light_effect_start(&state[0], COSMOS_LIGHT_EFFECT_SUNRISE);
+    size_t frames = 0;
+    const cosmos_light_frame_t *pLast = NULL;
+    for (int t = 0; t < 40 * 60 * 1000 / COSMOS_LIGHT_EFFECT_TICK_MS && (t == 0 || active); t++) {
+        if (cosmos_light_effect_step(state, 2, out, &active)) {
+            CHECK(out[0].fade_ms == 10000);
+            pLast = out[0].pFrame;
+            frames++;
+        }
+    }
+    CHECK(!active && state[0].effect == COSMOS_LIGHT_EFFECT_NONE);
+    CHECK(frames == 1800000 / 10000 + 1);
+    CHECK(pLast && pLast->duty[0] == COSMOS_LIGHT_DUTY_MAX && pLast->duty[2] == cosmos_light_gamma.duty[150]);
+}
+
+static void bench(size_t light_qty)
+{
+    std::vector<cosmos_light_effect_state_t> state(light_qty);
+    std::vector<cosmos_light_effect_out_t> out(light_qty);
+    bool active;
+
+    // Mix of the fast effects, one frame per tick for most lights
+    static const cosmos_light_effect_e k_mix[] = {COSMOS_LIGHT_EFFECT_BREATHE, COSMOS_LIGHT_EFFECT_STROBE,
+                                                  COSMOS_LIGHT_EFFECT_COLOR_CYCLE};
+    for (size_t i = 0; i < light_qty; i++)
+        cosmos_light_effect_start(&state[i], k_mix[i % 3]);
+
+    size_t writes = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int t = 0; t < BENCH_TICKS; t++) {
+        size_t out_qty = cosmos_light_effect_step(state.data(), light_qty, out.data(), &active);
+        write_frames(out.data(), out_qty);
+        writes += out_qty;
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    printf("%5zu lights %9.1f ns/tick %7.2f ns/light %6.2f frames/tick\n", light_qty, ns / BENCH_TICKS,
+           ns / BENCH_TICKS / light_qty, (double)writes / BENCH_TICKS);
+}
+
+int main(void)
+{
+    test_stepping();
+
+    printf("CPU per %d ms tick, step + duty register writes (host):\n", COSMOS_LIGHT_EFFECT_TICK_MS);
+    for (size_t qty : {1, 2, 4, 8, 16, 64, 256, 1024})
+        bench(qty);
+
+    return cosmos_test_report();
+}
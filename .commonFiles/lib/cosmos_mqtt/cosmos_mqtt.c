@@ -0,0 +1,118 @@
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#include "cosmos_devices.h"
+#include "cosmos_mqtt.h"
+
+#define MQTT_STACK_SIZE 4096
+#define MQTT_PRIORITY   5
+
+static const char *TAG = "cosmos_mqtt";
+
+/*
+ * The client and its buffers are static, the MQTT task polls it and the
+ * cosmos_devices transport task publishes through it, under s_lock
+ */
+static cosmos_mqtt_client_t s_client = {.sock = -1};
+static StaticSemaphore_t s_lock_buffer;
+static SemaphoreHandle_t s_lock = NULL;
+static TaskHandle_t s_mqtt_task = NULL;
+
+/**
+ * @brief Routes a command to the registry
+ *
+ * @param pTopic "<sn>/rx_control"
+ * @param pPayload Command
+ * @param len Payload length
+ * @param user_data Unused
+ */
+static void cosmos_mqtt_on_message(const char *pTopic, const char *pPayload, size_t len, void *user_data)
+{
+    esp_err_t err = cosmos_devices_dispatch(pTopic, pPayload);
+    if (err != ESP_OK)
+        ESP_LOGD(TAG, "%s not handled: %s", pTopic, esp_err_to_name(err));
+}
+
+/**
+ * @brief Publishes a batch of state changes, called from the cosmos_devices
+ * transport task. While the broker is down the changes are dropped, the
+ * devices keep their state in cosmos_state.
+ *
+ * @param pState State changes
+ * @param qty Quantity of records
+ * @param user_data Unused
+ */
+static void cosmos_mqtt_publish(const cosmos_devices_state_t *pState, size_t qty, void *user_data)
+{
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    if (s_client.sock >= 0 && cosmos_mqtt_client_publish_states(&s_client, pState, qty) != 0)
+        ESP_LOGW(TAG, "Failed to publish %u states", (unsigned)qty);
+    xSemaphoreGive(s_lock);
+}
+
+/**
+ * @brief MQTT task, connects, subscribes and polls until the connection drops
+ *
+ * @param pArg Broker settings
+ */
+static void cosmos_mqtt_task(void *pArg)
+{
+    const cosmos_mqtt_config_t *pConfig = (const cosmos_mqtt_config_t *)pArg;
+    uint16_t port = pConfig->port ? pConfig->port : COSMOS_MQTT_PORT;
+    uint16_t keepalive_s = pConfig->keepalive_s ? pConfig->keepalive_s : COSMOS_MQTT_KEEPALIVE_S;
+    int err;
+
+    for (;;) {
+        xSemaphoreTake(s_lock, portMAX_DELAY);
+        err = cosmos_mqtt_client_connect(&s_client, pConfig->host, port, pConfig->client_id, keepalive_s, COSMOS_MQTT_CONNECT_MS);
+        if (err == 0 && (err = cosmos_mqtt_client_subscribe(&s_client, "+" RX_CONTROL)) != 0)
+            cosmos_mqtt_client_close(&s_client);
+        xSemaphoreGive(s_lock);
+
+        if (err != 0) {
+            ESP_LOGW(TAG, "Broker %s:%u unreachable, retrying", pConfig->host, port);
+            vTaskDelay(pdMS_TO_TICKS(COSMOS_MQTT_RECONNECT_MS));
+            continue;
+        }
+        ESP_LOGI(TAG, "Connected to %s:%u", pConfig->host, port);
+
+        // Waiting doesn't touch the client, the transport task can publish meanwhile
+        while (err == 0) {
+            if (cosmos_mqtt_client_wait(&s_client, keepalive_s * 500u) < 0)
+                break;
+
+            xSemaphoreTake(s_lock, portMAX_DELAY);
+            err = cosmos_mqtt_client_poll(&s_client, cosmos_mqtt_on_message, NULL);
+            xSemaphoreGive(s_lock);
+        }
+
+        xSemaphoreTake(s_lock, portMAX_DELAY);
+        cosmos_mqtt_client_close(&s_client);
+        xSemaphoreGive(s_lock);
+        ESP_LOGW(TAG, "Connection lost");
+    }
+}
+
+esp_err_t cosmos_mqtt_begin(const cosmos_mqtt_config_t *pConfig)
+{
+    if (pConfig == NULL || pConfig->host == NULL || pConfig->client_id == NULL)
+        return ESP_ERR_INVALID_ARG;
+    if (s_mqtt_task) {
+        ESP_LOGE(TAG, "Already initialized");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    s_lock = xSemaphoreCreateMutexStatic(&s_lock_buffer);
+
+    if (xTaskCreate(cosmos_mqtt_task, "cosmos_mqtt", MQTT_STACK_SIZE, (void *)pConfig, MQTT_PRIORITY, &s_mqtt_task) != pdPASS)
+        return ESP_ERR_NO_MEM;
+
+    // The transport may already run for another consumer, then it keeps its callback
+    esp_err_t err = cosmos_devices_transport_begin(cosmos_mqtt_publish, NULL);
+    if (err != ESP_OK)
+        ESP_LOGE(TAG, "Failed to start the state transport: %s", esp_err_to_name(err));
+
+    return err;
+}
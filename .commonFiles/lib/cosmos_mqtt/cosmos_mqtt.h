@@ -0,0 +1,52 @@
+#ifndef MAIN_COSMOS_MQTT_H_
+#define MAIN_COSMOS_MQTT_H_
+
+#include <stdint.h>
+
+#include "esp_err.h"
+
+#include "cosmos_mqtt_client.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define COSMOS_MQTT_PORT         1883 /*!< Default broker port */
+#define COSMOS_MQTT_KEEPALIVE_S  60   /*!< Default keep alive */
+#define COSMOS_MQTT_CONNECT_MS   5000 /*!< Time to wait for the CONNACK */
+#define COSMOS_MQTT_RECONNECT_MS 5000 /*!< Wait between connection attempts */
+
+/**
+ * @brief Broker settings
+ *
+ */
+typedef struct {
+    const char *host;      /*!< Broker host name or address */
+    const char *client_id; /*!< Client identifier, unique on the broker */
+    uint16_t port;         /*!< Broker port, 0 for COSMOS_MQTT_PORT */
+    uint16_t keepalive_s;  /*!< Keep alive, 0 for COSMOS_MQTT_KEEPALIVE_S */
+} cosmos_mqtt_config_t;
+
+/**
+ * @brief Starts the MQTT transport. A task keeps the connection up,
+ * subscribes to "+/rx_control" and routes every command through
+ * cosmos_devices_dispatch. State changes are published on "<sn>/rx_state"
+ * from the cosmos_devices transport task, one batch per flush.
+ * Call it after cosmos_devices_registry_begin and once the network is up,
+ * esp32CamServer does it on the first IP address event. lilFlowerPal leaves
+ * it out, its pumps and sensors are only Matter endpoints and no cosmos_*
+ * module there queues state changes or takes commands.
+ *
+ * @param pConfig Broker settings. This should last for the lifetime of the driver
+ * @return esp_err_t - ESP_OK on success,
+ *                     ESP_ERR_INVALID_ARG if pConfig, its host or its client_id is NULL
+ *                     ESP_ERR_INVALID_STATE if the transport is already running
+ *                     ESP_ERR_NO_MEM if the task can't be created
+ */
+esp_err_t cosmos_mqtt_begin(const cosmos_mqtt_config_t *pConfig);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAIN_COSMOS_MQTT_H_ */
@@ -0,0 +1,271 @@
+#include <errno.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "cosmos_mqtt_client.h"
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+/**
+ * @brief Monotonic time in milliseconds
+ *
+ */
+static uint32_t cosmos_mqtt_now_ms(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+/**
+ * @brief Reads what the socket has into the receive buffer, without blocking
+ *
+ * @return int Bytes read, 0 if nothing is available or the buffer is full,
+ * -1 if the connection is closed or failed
+ */
+static int cosmos_mqtt_client_read(cosmos_mqtt_client_t *pClient)
+{
+    if (pClient->rx_len == COSMOS_MQTT_RX_SIZE)
+        return 0;
+
+    ssize_t got = recv(pClient->sock, &pClient->rx[pClient->rx_len], COSMOS_MQTT_RX_SIZE - pClient->rx_len, MSG_DONTWAIT);
+    if (got == 0)
+        return -1;
+    if (got < 0)
+        return (errno == EAGAIN || errno == EWOULDBLOCK) ? 0 : -1;
+
+    pClient->rx_len += got;
+    return got;
+}
+
+/**
+ * @brief Drops the first len bytes of the receive buffer
+ *
+ */
+static void cosmos_mqtt_client_consume(cosmos_mqtt_client_t *pClient, size_t len)
+{
+    memmove(pClient->rx, &pClient->rx[len], pClient->rx_len - len);
+    pClient->rx_len -= len;
+}
+
+int cosmos_mqtt_client_connect(cosmos_mqtt_client_t *pClient, const char *host, uint16_t port, const char *client_id, uint16_t keepalive_s, uint32_t timeout_ms)
+{
+    struct addrinfo hints = {
+        .ai_family = AF_INET,
+        .ai_socktype = SOCK_STREAM,
+    };
+    struct addrinfo *pRes;
+    cosmos_mqtt_packet_t packet;
+    char port_str[6];
+    int nodelay = 1;
+    int used;
+
+    pClient->sock = -1;
+    pClient->keepalive_s = keepalive_s;
+    pClient->packet_id = 0;
+    pClient->tx_len = 0;
+    pClient->rx_len = 0;
+
+    snprintf(port_str, sizeof(port_str), "%u", port);
+    if (getaddrinfo(host, port_str, &hints, &pRes) != 0 || pRes == NULL)
+        return -1;
+
+    pClient->sock = socket(pRes->ai_family, pRes->ai_socktype, pRes->ai_protocol);
+    if (pClient->sock >= 0 && connect(pClient->sock, pRes->ai_addr, pRes->ai_addrlen) != 0) {
+        close(pClient->sock);
+        pClient->sock = -1;
+    }
+    freeaddrinfo(pRes);
+
+    if (pClient->sock < 0)
+        return -1;
+
+    // Batches are flushed explicitly, Nagle would only hold them back
+    setsockopt(pClient->sock, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay));
+
+    pClient->tx_len = cosmos_mqtt_encode_connect(pClient->tx, COSMOS_MQTT_TX_SIZE, client_id, keepalive_s);
+    if (pClient->tx_len == 0 || cosmos_mqtt_client_flush(pClient) != 0)
+        goto fail;
+
+    // The CONNACK is the first packet the broker sends
+    uint32_t start_ms = cosmos_mqtt_now_ms();
+    while ((used = cosmos_mqtt_decode(pClient->rx, pClient->rx_len, &packet)) == 0) {
+        uint32_t elapsed_ms = cosmos_mqtt_now_ms() - start_ms;
+        if (elapsed_ms >= timeout_ms || cosmos_mqtt_client_wait(pClient, timeout_ms - elapsed_ms) <= 0)
+            goto fail;
+        if (cosmos_mqtt_client_read(pClient) < 0)
+            goto fail;
+    }
+
+    if (used < 0 || packet.type != MQTT_PACKET_CONNACK || packet.rc != 0)
+        goto fail;
+
+    cosmos_mqtt_client_consume(pClient, used);
+    return 0;
+
+fail:
+    close(pClient->sock);
+    pClient->sock = -1;
+    return -1;
+}
+
+int cosmos_mqtt_client_subscribe(cosmos_mqtt_client_t *pClient, const char *filter)
+{
+    // Packet identifiers skip 0
+    if (++pClient->packet_id == 0)
+        pClient->packet_id = 1;
+
+    size_t len = cosmos_mqtt_encode_subscribe(&pClient->tx[pClient->tx_len], COSMOS_MQTT_TX_SIZE - pClient->tx_len, pClient->packet_id, filter);
+    if (len == 0)
+        return -1;
+
+    pClient->tx_len += len;
+    return cosmos_mqtt_client_flush(pClient);
+}
+
+int cosmos_mqtt_client_publish(cosmos_mqtt_client_t *pClient, const char *pTopic, const void *pPayload, size_t len)
+{
+    size_t topic_len = strlen(pTopic);
+    size_t n = cosmos_mqtt_encode_publish(&pClient->tx[pClient->tx_len], COSMOS_MQTT_TX_SIZE - pClient->tx_len, pTopic, topic_len, pPayload, len);
+
+    if (n == 0) {
+        if (pClient->tx_len == 0 || cosmos_mqtt_client_flush(pClient) != 0)
+            return -1;
+        if ((n = cosmos_mqtt_encode_publish(pClient->tx, COSMOS_MQTT_TX_SIZE, pTopic, topic_len, pPayload, len)) == 0)
+            return -1;
+    }
+
+    pClient->tx_len += n;
+    pClient->published++;
+    return 0;
+}
+
+int cosmos_mqtt_client_publish_states(cosmos_mqtt_client_t *pClient, const cosmos_devices_state_t *pState, size_t qty)
+{
+    size_t n;
+
+    for (size_t i = 0; i < qty; i++) {
+        n = cosmos_mqtt_encode_state(&pClient->tx[pClient->tx_len], COSMOS_MQTT_TX_SIZE - pClient->tx_len, &pState[i]);
+        if (n == 0) {
+            if (cosmos_mqtt_client_flush(pClient) != 0)
+                return -1;
+            if ((n = cosmos_mqtt_encode_state(pClient->tx, COSMOS_MQTT_TX_SIZE, &pState[i])) == 0)
+                return -1;
+        }
+
+        pClient->tx_len += n;
+        pClient->published++;
+    }
+
+    return cosmos_mqtt_client_flush(pClient);
+}
+
+int cosmos_mqtt_client_flush(cosmos_mqtt_client_t *pClient)
+{
+    size_t sent = 0;
+
+    while (sent < pClient->tx_len) {
+        ssize_t n = send(pClient->sock, &pClient->tx[sent], pClient->tx_len - sent, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0) {
+            pClient->tx_len = 0;
+            return -1;
+        }
+        sent += n;
+    }
+
+    pClient->tx_len = 0;
+    pClient->last_tx_ms = cosmos_mqtt_now_ms();
+    return 0;
+}
+
+int cosmos_mqtt_client_wait(const cosmos_mqtt_client_t *pClient, uint32_t timeout_ms)
+{
+    struct timeval tv = {
+        .tv_sec = timeout_ms / 1000,
+        .tv_usec = (timeout_ms % 1000) * 1000,
+    };
+    fd_set fds;
+
+    if (pClient->sock < 0)
+        return -1;
+
+    FD_ZERO(&fds);
+    FD_SET(pClient->sock, &fds);
+
+    int ready = select(pClient->sock + 1, &fds, NULL, NULL, &tv);
+    if (ready < 0)
+        return errno == EINTR ? 0 : -1;
+
+    return ready > 0;
+}
+
+int cosmos_mqtt_client_poll(cosmos_mqtt_client_t *pClient, cosmos_mqtt_message_cb_t cb, void *user_data)
+{
+    cosmos_mqtt_packet_t packet;
+    size_t off = 0;
+    int used;
+
+    if (cosmos_mqtt_client_read(pClient) < 0)
+        return -1;
+
+    while ((used = cosmos_mqtt_decode(&pClient->rx[off], pClient->rx_len - off, &packet)) > 0) {
+        if (packet.type == MQTT_PACKET_PUBLISH && packet.topic_len <= COSMOS_MQTT_TOPIC_MAX) {
+            pClient->received++;
+
+            if (cb) {
+                /*
+                 * The topic is copied out, the payload is
+                 * terminated in place and the byte after
+                 * it put back once the callback returns
+                 */
+                uint8_t *pEnd = &pClient->rx[off + used];
+                uint8_t saved = *pEnd;
+
+                memcpy(pClient->topic, packet.pTopic, packet.topic_len);
+                pClient->topic[packet.topic_len] = '\0';
+                *pEnd = '\0';
+                cb(pClient->topic, (const char *)packet.pPayload, packet.payload_len, user_data);
+                *pEnd = saved;
+            }
+        }
+        off += used;
+    }
+
+    // A packet that can't fit in the buffer would never complete
+    if (used < 0 || (off == 0 && pClient->rx_len == COSMOS_MQTT_RX_SIZE))
+        return -1;
+
+    cosmos_mqtt_client_consume(pClient, off);
+
+    // The broker drops the client after 1.5 keep alive periods of silence
+    if (pClient->keepalive_s && cosmos_mqtt_now_ms() - pClient->last_tx_ms >= pClient->keepalive_s * 500u) {
+        pClient->tx_len += cosmos_mqtt_encode_empty(&pClient->tx[pClient->tx_len], COSMOS_MQTT_TX_SIZE - pClient->tx_len, MQTT_PACKET_PINGREQ);
+        return cosmos_mqtt_client_flush(pClient);
+    }
+
+    return 0;
+}
+
+void cosmos_mqtt_client_close(cosmos_mqtt_client_t *pClient)
+{
+    if (pClient->sock < 0)
+        return;
+
+    pClient->tx_len = cosmos_mqtt_encode_empty(pClient->tx, COSMOS_MQTT_TX_SIZE, MQTT_PACKET_DISCONNECT);
+    cosmos_mqtt_client_flush(pClient);
+
+    close(pClient->sock);
+    pClient->sock = -1;
+}
@@ -0,0 +1,135 @@
+#ifndef MAIN_COSMOS_MQTT_CLIENT_H_
+#define MAIN_COSMOS_MQTT_CLIENT_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "cosmos_mqtt_codec.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define COSMOS_MQTT_TX_SIZE   2048 /*!< Transmit buffer, a batch of publishes leaves in one send */
+#define COSMOS_MQTT_RX_SIZE   1024 /*!< Receive buffer, the largest incoming packet must fit */
+#define COSMOS_MQTT_TOPIC_MAX 64   /*!< Longest incoming topic handed to the callback */
+
+/**
+ * @brief Delivers an incoming PUBLISH
+ *
+ * @param pTopic Topic, NUL terminated
+ * @param pPayload Payload, NUL terminated
+ * @param len Payload length
+ * @param user_data User data given to cosmos_mqtt_client_poll
+ */
+typedef void (*cosmos_mqtt_message_cb_t)(const char *pTopic, const char *pPayload, size_t len, void *user_data);
+
+/**
+ * @brief MQTT 3.1.1 client over a BSD socket, lwIP or POSIX. Every
+ * buffer lives in the struct, nothing is allocated per message.
+ * Not thread safe, callers sharing a client serialize the calls.
+ *
+ */
+typedef struct {
+    int sock;                              /*!< Socket, -1 when closed */
+    uint16_t keepalive_s;                  /*!< Keep alive agreed in CONNECT */
+    uint16_t packet_id;                    /*!< Last packet identifier used */
+    uint32_t last_tx_ms;                   /*!< Time of the last send, for PINGREQ */
+    uint32_t published;                    /*!< PUBLISH packets sent */
+    uint32_t received;                     /*!< PUBLISH packets received */
+    size_t tx_len;                         /*!< Bytes waiting in tx */
+    size_t rx_len;                         /*!< Bytes waiting in rx */
+    uint8_t tx[COSMOS_MQTT_TX_SIZE];       /*!< Outgoing packets, sent by cosmos_mqtt_client_flush */
+    uint8_t rx[COSMOS_MQTT_RX_SIZE + 1];   /*!< Incoming bytes, one more for the payload NUL */
+    char topic[COSMOS_MQTT_TOPIC_MAX + 1]; /*!< Topic of the message being delivered */
+} cosmos_mqtt_client_t;
+
+/**
+ * @brief Connects to a broker with a clean session and waits for the CONNACK
+ *
+ * @param pClient Client
+ * @param host Broker host name or address
+ * @param port Broker port, usually 1883
+ * @param client_id Client identifier, unique on the broker
+ * @param keepalive_s Keep alive, in seconds
+ * @param timeout_ms Time to wait for the CONNACK
+ * @return int 0 on success, -1 otherwise. The client is closed on failure
+ */
+int cosmos_mqtt_client_connect(cosmos_mqtt_client_t *pClient, const char *host, uint16_t port, const char *client_id, uint16_t keepalive_s, uint32_t timeout_ms);
+
+/**
+ * @brief Subscribes to a topic filter at QoS 0. The SUBACK is consumed
+ * by cosmos_mqtt_client_poll.
+ *
+ * @param pClient Client
+ * @param filter Topic filter, e.g. "+/rx_control"
+ * @return int 0 on success, -1 otherwise
+ */
+int cosmos_mqtt_client_subscribe(cosmos_mqtt_client_t *pClient, const char *filter);
+
+/**
+ * @brief Appends a QoS 0 PUBLISH to the transmit buffer, sending the
+ * buffer first if it is full
+ *
+ * @param pClient Client
+ * @param pTopic Topic, NUL terminated
+ * @param pPayload Payload
+ * @param len Payload length
+ * @return int 0 on success, -1 if the send failed or the packet is larger than the buffer
+ */
+int cosmos_mqtt_client_publish(cosmos_mqtt_client_t *pClient, const char *pTopic, const void *pPayload, size_t len);
+
+/**
+ * @brief Publishes a batch of state changes on "<sn>/rx_state" and
+ * flushes. QoS 0 needs no acknowledgment, so the whole batch is
+ * pipelined in as few sends as the buffer allows.
+ *
+ * @param pClient Client
+ * @param pState State changes, as drained from the cosmos_devices queue
+ * @param qty Quantity of records
+ * @return int 0 on success, -1 otherwise
+ */
+int cosmos_mqtt_client_publish_states(cosmos_mqtt_client_t *pClient, const cosmos_devices_state_t *pState, size_t qty);
+
+/**
+ * @brief Sends the transmit buffer
+ *
+ * @param pClient Client
+ * @return int 0 on success, -1 otherwise
+ */
+int cosmos_mqtt_client_flush(cosmos_mqtt_client_t *pClient);
+
+/**
+ * @brief Waits until the socket is readable. Touches no client state, so
+ * it can run without the lock the callers share.
+ *
+ * @param pClient Client
+ * @param timeout_ms Time to wait
+ * @return int 1 if readable, 0 on timeout, -1 on error
+ */
+int cosmos_mqtt_client_wait(const cosmos_mqtt_client_t *pClient, uint32_t timeout_ms);
+
+/**
+ * @brief Reads what is available without blocking, delivers every complete
+ * PUBLISH to the callback and sends a PINGREQ when the link has been idle
+ * for half the keep alive
+ *
+ * @param pClient Client
+ * @param cb Called with each incoming PUBLISH, may be NULL
+ * @param user_data User data passed to the callback
+ * @return int 0 on success, -1 if the connection is lost or a packet is malformed
+ */
+int cosmos_mqtt_client_poll(cosmos_mqtt_client_t *pClient, cosmos_mqtt_message_cb_t cb, void *user_data);
+
+/**
+ * @brief Sends a DISCONNECT and closes the socket
+ *
+ * @param pClient Client
+ */
+void cosmos_mqtt_client_close(cosmos_mqtt_client_t *pClient);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAIN_COSMOS_MQTT_CLIENT_H_ */
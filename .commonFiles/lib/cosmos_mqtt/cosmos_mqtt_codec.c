@@ -0,0 +1,215 @@
+#include <string.h>
+
+#include "cosmos_devices.h"
+#include "cosmos_mqtt_codec.h"
+
+#define REMAINING_LEN_MAX 268435455 /*!< Largest remaining length of 4 varint bytes */
+
+/**
+ * @brief Writes a fixed header, type, flags and the remaining length varint
+ *
+ * @return size_t Bytes written, 0 if the packet doesn't fit
+ */
+static size_t cosmos_mqtt_header(uint8_t *pBuf, size_t size, uint8_t first, size_t remaining)
+{
+    size_t n = 0;
+
+    if (remaining > REMAINING_LEN_MAX || size < 2)
+        return 0;
+
+    pBuf[n++] = first;
+    do {
+        uint8_t digit = remaining & 0x7F;
+        remaining >>= 7;
+        if (n == size)
+            return 0;
+        pBuf[n++] = remaining ? (digit | 0x80) : digit;
+    } while (remaining);
+
+    return n;
+}
+
+/**
+ * @brief Writes a length prefixed string
+ *
+ * @return size_t Bytes written
+ */
+static size_t cosmos_mqtt_string(uint8_t *pBuf, const char *pStr, size_t len)
+{
+    pBuf[0] = len >> 8;
+    pBuf[1] = len & 0xFF;
+    memcpy(&pBuf[2], pStr, len);
+
+    return len + 2;
+}
+
+size_t cosmos_mqtt_encode_connect(uint8_t *pBuf, size_t size, const char *client_id, uint16_t keepalive_s)
+{
+    static const uint8_t protocol[] = {0, 4, 'M', 'Q', 'T', 'T', 4, 0x02}; // MQTT 3.1.1, clean session
+    size_t id_len = strlen(client_id);
+    size_t remaining = sizeof(protocol) + 2 + 2 + id_len;
+    size_t n = cosmos_mqtt_header(pBuf, size, MQTT_PACKET_CONNECT << 4, remaining);
+
+    if (n == 0 || id_len > 0xFFFF || size - n < remaining)
+        return 0;
+
+    memcpy(&pBuf[n], protocol, sizeof(protocol));
+    n += sizeof(protocol);
+    pBuf[n++] = keepalive_s >> 8;
+    pBuf[n++] = keepalive_s & 0xFF;
+    n += cosmos_mqtt_string(&pBuf[n], client_id, id_len);
+
+    return n;
+}
+
+size_t cosmos_mqtt_encode_subscribe(uint8_t *pBuf, size_t size, uint16_t packet_id, const char *filter)
+{
+    size_t filter_len = strlen(filter);
+    size_t remaining = 2 + 2 + filter_len + 1;
+    size_t n = cosmos_mqtt_header(pBuf, size, (MQTT_PACKET_SUBSCRIBE << 4) | 0x02, remaining);
+
+    if (n == 0 || filter_len > 0xFFFF || size - n < remaining)
+        return 0;
+
+    pBuf[n++] = packet_id >> 8;
+    pBuf[n++] = packet_id & 0xFF;
+    n += cosmos_mqtt_string(&pBuf[n], filter, filter_len);
+    pBuf[n++] = 0; // Requested QoS
+
+    return n;
+}
+
+size_t cosmos_mqtt_encode_publish(uint8_t *pBuf, size_t size, const char *pTopic, size_t topic_len, const void *pPayload, size_t len)
+{
+    size_t remaining = 2 + topic_len + len;
+    size_t n = cosmos_mqtt_header(pBuf, size, MQTT_PACKET_PUBLISH << 4, remaining);
+
+    if (n == 0 || topic_len > 0xFFFF || size - n < remaining)
+        return 0;
+
+    n += cosmos_mqtt_string(&pBuf[n], pTopic, topic_len);
+    memcpy(&pBuf[n], pPayload, len);
+
+    return n + len;
+}
+
+/**
+ * @brief Writes up to 3 decimal digits, or exactly 3 with leading zeros
+ *
+ * @return size_t Digits written
+ */
+static size_t cosmos_mqtt_u8(char *pOut, uint8_t value, int padded)
+{
+    size_t n = 0;
+
+    if (padded || value >= 100)
+        pOut[n++] = '0' + value / 100;
+    if (padded || value >= 10)
+        pOut[n++] = '0' + value / 10 % 10;
+    pOut[n++] = '0' + value % 10;
+
+    return n;
+}
+
+size_t cosmos_mqtt_encode_state(uint8_t *pBuf, size_t size, const cosmos_devices_state_t *pState)
+{
+    char topic[COSMOS_MQTT_SN_MAX + sizeof(RX_STATE)];
+    char payload[COSMOS_MQTT_STATE_PAYLOAD_MAX];
+    size_t sn_len = strnlen(pState->sn, COSMOS_MQTT_SN_MAX);
+    size_t len = 0;
+
+    memcpy(topic, pState->sn, sn_len);
+    memcpy(&topic[sn_len], RX_STATE, sizeof(RX_STATE) - 1);
+
+    if (pState->type == DEVICE_TYPE_LSC) {
+        // The 4 command bytes, in the order of cosmos_light_cmd_t
+        uint8_t cmd[4];
+        memcpy(cmd, &pState->value, sizeof(cmd));
+        for (int i = 0; i < 4; i++) {
+            len += cosmos_mqtt_u8(&payload[len], cmd[i], 1);
+            payload[len++] = '/';
+        }
+    } else {
+        // Decimal, written backwards
+        char digits[10];
+        uint32_t value = pState->value;
+        size_t qty = 0;
+        do {
+            digits[qty++] = '0' + value % 10;
+            value /= 10;
+        } while (value);
+        while (qty)
+            payload[len++] = digits[--qty];
+    }
+
+    return cosmos_mqtt_encode_publish(pBuf, size, topic, sn_len + sizeof(RX_STATE) - 1, payload, len);
+}
+
+size_t cosmos_mqtt_encode_empty(uint8_t *pBuf, size_t size, cosmos_mqtt_packet_e type)
+{
+    if (size < 2)
+        return 0;
+
+    pBuf[0] = type << 4;
+    pBuf[1] = 0;
+
+    return 2;
+}
+
+int cosmos_mqtt_decode(const uint8_t *pBuf, size_t len, cosmos_mqtt_packet_t *pPacket)
+{
+    size_t remaining = 0;
+    size_t n = 1;
+    int shift = 0;
+
+    if (len < 2)
+        return 0;
+
+    // Remaining length, at most 4 varint bytes
+    for (;;) {
+        if (n == len)
+            return 0;
+        if (n > 4)
+            return -1;
+        remaining |= (size_t)(pBuf[n] & 0x7F) << shift;
+        shift += 7;
+        if ((pBuf[n++] & 0x80) == 0)
+            break;
+    }
+
+    if (len - n < remaining)
+        return 0;
+
+    memset(pPacket, 0, sizeof(*pPacket));
+    pPacket->type = pBuf[0] >> 4;
+    pPacket->flags = pBuf[0] & 0x0F;
+
+    const uint8_t *pBody = &pBuf[n];
+
+    switch (pPacket->type) {
+
+    case MQTT_PACKET_CONNACK:
+        if (remaining < 2)
+            return -1;
+        pPacket->rc = pBody[1];
+        break;
+
+    case MQTT_PACKET_PUBLISH: {
+        size_t id_len = (pPacket->flags & 0x06) ? 2 : 0; // Packet identifier only above QoS 0
+        if (remaining < 2)
+            return -1;
+        pPacket->topic_len = (pBody[0] << 8) | pBody[1];
+        if (remaining < 2 + (size_t)pPacket->topic_len + id_len)
+            return -1;
+        pPacket->pTopic = (const char *)&pBody[2];
+        pPacket->pPayload = &pBody[2 + pPacket->topic_len + id_len];
+        pPacket->payload_len = remaining - 2 - pPacket->topic_len - id_len;
+        break;
+    }
+
+    default:
+        break;
+    }
+
+    return n + remaining;
+}
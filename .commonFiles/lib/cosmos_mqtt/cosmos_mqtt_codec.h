@@ -0,0 +1,118 @@
+#ifndef MAIN_COSMOS_MQTT_CODEC_H_
+#define MAIN_COSMOS_MQTT_CODEC_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "cosmos_devices_queue.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define COSMOS_MQTT_SN_MAX            32 /*!< Longest serial number in a state topic, longer ones are cut */
+#define COSMOS_MQTT_STATE_PAYLOAD_MAX 16 /*!< Longest state payload, the "BBB/RRR/GGG/BBB/" light format */
+
+/**
+ * @brief MQTT 3.1.1 control packet types, as in the high nibble of the fixed header
+ *
+ */
+typedef enum {
+    MQTT_PACKET_CONNECT = 1,     /*!< Client request to connect */
+    MQTT_PACKET_CONNACK = 2,     /*!< Connect acknowledgment */
+    MQTT_PACKET_PUBLISH = 3,     /*!< Publish message */
+    MQTT_PACKET_PUBACK = 4,      /*!< QoS 1 acknowledgment, never requested */
+    MQTT_PACKET_SUBSCRIBE = 8,   /*!< Subscribe request */
+    MQTT_PACKET_SUBACK = 9,      /*!< Subscribe acknowledgment */
+    MQTT_PACKET_PINGREQ = 12,    /*!< Keep alive request */
+    MQTT_PACKET_PINGRESP = 13,   /*!< Keep alive response */
+    MQTT_PACKET_DISCONNECT = 14, /*!< Clean disconnect */
+} cosmos_mqtt_packet_e;
+
+/**
+ * @brief Incoming packet, pointing into the receive buffer
+ *
+ */
+typedef struct {
+    uint8_t type;            /*!< cosmos_mqtt_packet_e */
+    uint8_t flags;           /*!< Low nibble of the fixed header */
+    uint8_t rc;              /*!< CONNACK return code, 0 is accepted */
+    uint16_t topic_len;      /*!< PUBLISH topic length */
+    const char *pTopic;      /*!< PUBLISH topic, not NUL terminated */
+    const uint8_t *pPayload; /*!< PUBLISH payload */
+    size_t payload_len;      /*!< PUBLISH payload length */
+} cosmos_mqtt_packet_t;
+
+/**
+ * @brief Encodes a clean session CONNECT
+ *
+ * @param pBuf Output buffer
+ * @param size Bytes available at pBuf
+ * @param client_id Client identifier
+ * @param keepalive_s Keep alive, in seconds
+ * @return size_t Bytes written, 0 if it doesn't fit
+ */
+size_t cosmos_mqtt_encode_connect(uint8_t *pBuf, size_t size, const char *client_id, uint16_t keepalive_s);
+
+/**
+ * @brief Encodes a SUBSCRIBE for one filter at QoS 0
+ *
+ * @param pBuf Output buffer
+ * @param size Bytes available at pBuf
+ * @param packet_id Packet identifier, not 0
+ * @param filter Topic filter, e.g. "+/rx_control"
+ * @return size_t Bytes written, 0 if it doesn't fit
+ */
+size_t cosmos_mqtt_encode_subscribe(uint8_t *pBuf, size_t size, uint16_t packet_id, const char *filter);
+
+/**
+ * @brief Encodes a QoS 0 PUBLISH
+ *
+ * @param pBuf Output buffer
+ * @param size Bytes available at pBuf
+ * @param pTopic Topic
+ * @param topic_len Topic length
+ * @param pPayload Payload
+ * @param len Payload length
+ * @return size_t Bytes written, 0 if it doesn't fit
+ */
+size_t cosmos_mqtt_encode_publish(uint8_t *pBuf, size_t size, const char *pTopic, size_t topic_len, const void *pPayload, size_t len);
+
+/**
+ * @brief Encodes a QoS 0 PUBLISH of a state change on "<sn>/rx_state".
+ * Relays and pumps publish their value in decimal, lights their command
+ * in the "BBB/RRR/GGG/BBB/" format taken by cosmos_light_control.
+ *
+ * @param pBuf Output buffer
+ * @param size Bytes available at pBuf
+ * @param pState State change
+ * @return size_t Bytes written, 0 if it doesn't fit
+ */
+size_t cosmos_mqtt_encode_state(uint8_t *pBuf, size_t size, const cosmos_devices_state_t *pState);
+
+/**
+ * @brief Encodes a packet without variable header, PINGREQ or DISCONNECT
+ *
+ * @param pBuf Output buffer
+ * @param size Bytes available at pBuf
+ * @param type MQTT_PACKET_PINGREQ or MQTT_PACKET_DISCONNECT
+ * @return size_t Bytes written, 0 if it doesn't fit
+ */
+size_t cosmos_mqtt_encode_empty(uint8_t *pBuf, size_t size, cosmos_mqtt_packet_e type);
+
+/**
+ * @brief Decodes the packet at the start of a receive buffer
+ *
+ * @param pBuf Received bytes
+ * @param len Bytes available at pBuf
+ * @param pPacket Output, points into pBuf
+ * @return int Bytes taken by the packet, 0 if it isn't complete yet,
+ * -1 if it is malformed
+ */
+int cosmos_mqtt_decode(const uint8_t *pBuf, size_t len, cosmos_mqtt_packet_t *pPacket);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAIN_COSMOS_MQTT_CODEC_H_ */
@@ -0,0 +1,162 @@
+/**
+ * @file cosmos_mqtt_bench.cpp
+ * @author Marcel Nahir Samur (mnsamur2014@gmail.com)
+ * @brief Client test and throughput benchmark against a real broker,
+ *        e.g. a local mosquitto. Skipped when no broker answers.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include "cosmos_devices.h"
+#include "cosmos_mqtt_client.h"
+#include "cosmos_test.h"
+
+#define BENCH_DEVICES  COSMOS_DEVICES_QUEUE_QTY
+#define BENCH_STATES   20000
+#define BENCH_IDLE_MS  3000
+#define CONNECT_MS     2000
+#define KEEPALIVE_S    30
+
+static const char *s_host = "127.0.0.1";
+static uint16_t s_port = 1883;
+static std::string s_prefix;
+
+// Both clients are large, they live outside the stack like on the target
+static cosmos_mqtt_client_t s_pub;
+static cosmos_mqtt_client_t s_sub;
+
+struct received_t {
+    std::string topic;
+    std::string payload;
+    size_t qty = 0;
+};
+
+static void on_message(const char *pTopic, const char *pPayload, size_t len, void *user_data)
+{
+    received_t *pReceived = (received_t *)user_data;
+
+    pReceived->topic = pTopic;
+    pReceived->payload.assign(pPayload, len);
+    pReceived->qty++;
+}
+
+/**
+ * @brief Polls the subscriber until it has qty messages or stays idle for BENCH_IDLE_MS
+ *
+ */
+static void receive(received_t *pReceived, size_t qty)
+{
+    auto last = std::chrono::steady_clock::now();
+
+    while (pReceived->qty < qty) {
+        size_t before = pReceived->qty;
+        if (cosmos_mqtt_client_wait(&s_sub, 100) < 0 || cosmos_mqtt_client_poll(&s_sub, on_message, pReceived) != 0)
+            return;
+        if (pReceived->qty != before)
+            last = std::chrono::steady_clock::now();
+        else if (std::chrono::steady_clock::now() - last > std::chrono::milliseconds(BENCH_IDLE_MS))
+            return;
+    }
+}
+
+static void test_control(void)
+{
+    std::string sn = s_prefix + "/LSCc-0001-001";
+    std::string topic = sn + RX_CONTROL;
+    received_t received;
+
+    CHECK(cosmos_mqtt_client_subscribe(&s_sub, (s_prefix + "/+" RX_CONTROL).c_str()) == 0);
+
+    // The SUBACK has no ordering with the first publish, resend until one arrives
+    for (int i = 0; i < 20 && received.qty == 0; i++) {
+        CHECK(cosmos_mqtt_client_publish(&s_pub, topic.c_str(), "050/255/112/017/", 16) == 0);
+        CHECK(cosmos_mqtt_client_flush(&s_pub) == 0);
+        if (cosmos_mqtt_client_wait(&s_sub, 100) > 0)
+            cosmos_mqtt_client_poll(&s_sub, on_message, &received);
+    }
+
+    CHECK(received.qty > 0);
+    CHECK(received.topic == topic);
+    CHECK(received.payload == "050/255/112/017/");
+}
+
+/**
+ * @brief Publishes BENCH_STATES state changes in batches of batch_qty
+ * and times them until the subscriber got them all
+ *
+ */
+static void bench(size_t batch_qty)
+{
+    static char sn[BENCH_DEVICES][COSMOS_MQTT_SN_MAX];
+    std::vector<cosmos_devices_state_t> states(BENCH_DEVICES);
+    received_t received;
+
+    for (size_t i = 0; i < BENCH_DEVICES; i++) {
+        snprintf(sn[i], sizeof(sn[i]), "%s/PWRr-%04u-%03u", s_prefix.c_str(), (unsigned)batch_qty, (unsigned)i);
+        states[i] = {sn[i], 0, DEVICE_TYPE_PWR, (uint8_t)i};
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::thread subscriber(receive, &received, (size_t)BENCH_STATES);
+
+    for (size_t sent = 0; sent < BENCH_STATES; sent += batch_qty) {
+        for (size_t i = 0; i < batch_qty; i++)
+            states[i].value = sent + i;
+        if (cosmos_mqtt_client_publish_states(&s_pub, states.data(), batch_qty) != 0) {
+            CHECK(false);
+            break;
+        }
+    }
+    double publish_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    subscriber.join();
+    double total_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // QoS 0 may drop on a busy broker, a local one shouldn't
+    CHECK(received.qty == BENCH_STATES);
+    printf("batch %2u: %d states published in %.3f s (%.0f/s), %u received in %.3f s (%.0f/s)\n",
+           (unsigned)batch_qty, BENCH_STATES, publish_s, BENCH_STATES / publish_s,
+           (unsigned)received.qty, total_s, received.qty / total_s);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 1)
+        s_host = argv[1];
+    if (argc > 2)
+        s_port = atoi(argv[2]);
+
+    s_prefix = "cosmos_bench_" + std::to_string(getpid());
+
+    if (cosmos_mqtt_client_connect(&s_sub, s_host, s_port, (s_prefix + "_sub").c_str(), KEEPALIVE_S, CONNECT_MS) != 0) {
+        printf("No broker at %s:%u, skipped\n", s_host, s_port);
+        return 0;
+    }
+    CHECK(cosmos_mqtt_client_connect(&s_pub, s_host, s_port, (s_prefix + "_pub").c_str(), KEEPALIVE_S, CONNECT_MS) == 0);
+
+    test_control();
+
+    CHECK(cosmos_mqtt_client_subscribe(&s_sub, (s_prefix + "/+" RX_STATE).c_str()) == 0);
+    usleep(200000);
+
+    bench(1);
+    bench(BENCH_DEVICES);
+
+    cosmos_mqtt_client_close(&s_pub);
+    cosmos_mqtt_client_close(&s_sub);
+
+    return cosmos_test_report();
+}
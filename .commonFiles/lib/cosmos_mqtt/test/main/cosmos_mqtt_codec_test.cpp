@@ -0,0 +1,127 @@
+/**
+ * @file cosmos_mqtt_codec_test.cpp
+ * @author Marcel Nahir Samur (mnsamur2014@gmail.com)
+ * @brief Unit tests for the MQTT 3.1.1 packet codec
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "cosmos_devices.h"
+#include "cosmos_mqtt_codec.h"
+#include "cosmos_test.h"
+
+static void test_connect(void)
+{
+    const uint8_t expected[] = {0x10, 16, 0, 4, 'M', 'Q', 'T', 'T', 4, 0x02, 0, 60, 0, 4, 'p', 'a', 'l', '1'};
+    uint8_t buf[64];
+
+    CHECK(cosmos_mqtt_encode_connect(buf, sizeof(buf), "pal1", 60) == sizeof(expected));
+    CHECK(memcmp(buf, expected, sizeof(expected)) == 0);
+    CHECK(cosmos_mqtt_encode_connect(buf, sizeof(expected) - 1, "pal1", 60) == 0);
+}
+
+static void test_subscribe(void)
+{
+    const uint8_t expected[] = {0x82, 17, 0, 7, 0, 12, '+', '/', 'r', 'x', '_', 'c', 'o', 'n', 't', 'r', 'o', 'l', 0};
+    uint8_t buf[64];
+
+    CHECK(cosmos_mqtt_encode_subscribe(buf, sizeof(buf), 7, "+" RX_CONTROL) == sizeof(expected));
+    CHECK(memcmp(buf, expected, sizeof(expected)) == 0);
+}
+
+static void test_publish_roundtrip(void)
+{
+    cosmos_mqtt_packet_t packet;
+    uint8_t buf[512];
+    std::string payload(300, 'x');
+
+    // 300 bytes need two remaining length bytes
+    size_t len = cosmos_mqtt_encode_publish(buf, sizeof(buf), "PWRr-0001-001/rx_control", 24, payload.data(), payload.size());
+    CHECK(len == 1 + 2 + 2 + 24 + 300);
+    CHECK(buf[1] == (((2 + 24 + 300) & 0x7F) | 0x80) && buf[2] == (2 + 24 + 300) >> 7);
+
+    CHECK(cosmos_mqtt_decode(buf, len, &packet) == (int)len);
+    CHECK(packet.type == MQTT_PACKET_PUBLISH && packet.topic_len == 24);
+    CHECK(memcmp(packet.pTopic, "PWRr-0001-001/rx_control", 24) == 0);
+    CHECK(packet.payload_len == 300 && memcmp(packet.pPayload, payload.data(), 300) == 0);
+
+    // Every prefix is incomplete, never malformed
+    bool partial = true;
+    for (size_t i = 0; i < len; i++)
+        partial &= cosmos_mqtt_decode(buf, i, &packet) == 0;
+    CHECK(partial);
+
+    // A QoS 1 PUBLISH from the broker carries a packet identifier
+    const uint8_t qos1[] = {0x32, 9, 0, 3, 'a', '/', 'b', 0, 5, 'o', 'n'};
+    CHECK(cosmos_mqtt_decode(qos1, sizeof(qos1), &packet) == sizeof(qos1));
+    CHECK(packet.topic_len == 3 && packet.payload_len == 2 && memcmp(packet.pPayload, "on", 2) == 0);
+}
+
+static void test_decode_control(void)
+{
+    const uint8_t connack[] = {0x20, 2, 0, 0};
+    const uint8_t refused[] = {0x20, 2, 0, 5};
+    const uint8_t pingresp[] = {0xD0, 0};
+    const uint8_t bad_len[] = {0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x01};
+    const uint8_t bad_topic[] = {0x30, 3, 0, 9, 'a'};
+    cosmos_mqtt_packet_t packet;
+
+    CHECK(cosmos_mqtt_decode(connack, sizeof(connack), &packet) == 4 && packet.type == MQTT_PACKET_CONNACK && packet.rc == 0);
+    CHECK(cosmos_mqtt_decode(refused, sizeof(refused), &packet) == 4 && packet.rc == 5);
+    CHECK(cosmos_mqtt_decode(pingresp, sizeof(pingresp), &packet) == 2 && packet.type == MQTT_PACKET_PINGRESP);
+    CHECK(cosmos_mqtt_decode(bad_len, sizeof(bad_len), &packet) == -1);
+    CHECK(cosmos_mqtt_decode(bad_topic, sizeof(bad_topic), &packet) == -1);
+}
+
+static void test_state(void)
+{
+    cosmos_devices_state_t relay = {"PWRr-0001-001", 1, DEVICE_TYPE_PWR, 0};
+    cosmos_devices_state_t light = {"LSCc-0001-001", 0, DEVICE_TYPE_LSC, 0};
+    const uint8_t cmd[4] = {50, 255, 112, 17};
+    cosmos_mqtt_packet_t packet;
+    uint8_t buf[64];
+
+    size_t len = cosmos_mqtt_encode_state(buf, sizeof(buf), &relay);
+    CHECK(len > 0 && cosmos_mqtt_decode(buf, len, &packet) == (int)len);
+    CHECK(std::string(packet.pTopic, packet.topic_len) == "PWRr-0001-001" RX_STATE);
+    CHECK(std::string((const char *)packet.pPayload, packet.payload_len) == "1");
+
+    // Lights publish what cosmos_light_control takes
+    memcpy(&light.value, cmd, sizeof(cmd));
+    len = cosmos_mqtt_encode_state(buf, sizeof(buf), &light);
+    CHECK(len > 0 && cosmos_mqtt_decode(buf, len, &packet) == (int)len);
+    CHECK(std::string((const char *)packet.pPayload, packet.payload_len) == "050/255/112/017/");
+
+    relay.value = 4294967295u;
+    len = cosmos_mqtt_encode_state(buf, sizeof(buf), &relay);
+    CHECK(len > 0 && cosmos_mqtt_decode(buf, len, &packet) == (int)len);
+    CHECK(std::string((const char *)packet.pPayload, packet.payload_len) == "4294967295");
+}
+
+static void test_empty(void)
+{
+    uint8_t buf[2];
+
+    CHECK(cosmos_mqtt_encode_empty(buf, sizeof(buf), MQTT_PACKET_PINGREQ) == 2 && buf[0] == 0xC0 && buf[1] == 0);
+    CHECK(cosmos_mqtt_encode_empty(buf, sizeof(buf), MQTT_PACKET_DISCONNECT) == 2 && buf[0] == 0xE0);
+    CHECK(cosmos_mqtt_encode_empty(buf, 1, MQTT_PACKET_PINGREQ) == 0);
+}
+
+int main(void)
+{
+    test_connect();
+    test_subscribe();
+    test_publish_roundtrip();
+    test_decode_control();
+    test_state();
+    test_empty();
+
+    return cosmos_test_report();
+}
@@ -0,0 +1,3 @@
+// Host stand-in for the ESP-IDF header, the tests only need the cosmos_devices types
+#pragma once
+typedef void (*gpio_isr_t)(void *arg);
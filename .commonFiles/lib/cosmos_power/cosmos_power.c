@@ -1,12 +1,19 @@
 #include <string.h>
 
 #include "driver/gpio.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
 
 #include "cosmos_power.h"
+#include "cosmos_state.h"
 
 // Handle for cosmos_power_begin
 static bool s_power_begin_handle = false;
 
+// Serialises the toggles, so the saved state is always the one on the output
+static StaticSemaphore_t s_power_lock_buffer;
+static SemaphoreHandle_t s_power_lock = NULL;
+
 /**
  * @brief Power device setup function
  *
@@ -16,6 +23,7 @@ static bool s_power_begin_handle = false;
  */
 static void cosmos_power_begin(cosmos_devices_t *pPower, size_t dev_qty)
 {
+    s_power_lock = xSemaphoreCreateMutexStatic(&s_power_lock_buffer);
 
     // Configure the GPIO for each power device
     for (int dev_idx = 0; dev_idx < dev_qty; dev_idx++) {
@@ -25,49 +33,89 @@ static void cosmos_power_begin(cosmos_devices_t *pPower, size_t dev_qty)
         gpio_intr_disable(pPower[dev_idx].pin[0]);
 
         /*
-         * Set the gpio pin level to the innital state
-         * defined in the devices struct of the main.c file
+         * Set the gpio pin level to the state saved
+         * before the last reset, or to the innital
+         * state defined in the devices struct of the
+         * main.c file if it was never changed
          */
+        uint32_t saved;
+        if (cosmos_state_get(pPower[dev_idx].sn, &saved))
+            pPower[dev_idx].state = saved;
         gpio_set_level(pPower[dev_idx].pin[0], pPower[dev_idx].state);
         // }
+
+        // Register the serial number, so commands are resolved without scanning the devices
+        cosmos_devices_index_add(pPower[dev_idx].sn, DEVICE_TYPE_PWR, dev_idx, &pPower[dev_idx]);
     }
 
     s_power_begin_handle = true;
 }
 
+void cosmos_power_restore(cosmos_devices_t *pPower, size_t qty)
+{
+    if (s_power_begin_handle == false)
+        cosmos_power_begin(pPower, qty);
+}
+
 void cosmos_power_control(const char *sn_value, cosmos_devices_t *pPower, size_t qty)
 {
     // Check if power controller is configured
     if (s_power_begin_handle == false)
         cosmos_power_begin(pPower, qty);
 
-    // Loop through the different power devices
-    for (int pwr_idx = 0; pwr_idx < qty; pwr_idx++) {
-        /*
-         * If the serial number matches
-         * any of the stored in the
-         * pPower array, excution will
-         * continue. Otherwise, we'll try
-         * another with power
-         */
-        if (strcmp(sn_value, pPower[pwr_idx].sn) == 0) {
-
-            char *pDevState, new_msg[40];
-
-            if (pPower[pwr_idx].state == 1) {
-                gpio_set_level(pPower[pwr_idx].pin[0], 0);
-                pPower[pwr_idx].state = 0;
-                pDevState = "0|";
-            } else {
-                gpio_set_level(pPower[pwr_idx].pin[0], 1);
-                pPower[pwr_idx].state = 1;
-                pDevState = "1|";
-            }
-
-            memset(new_msg, '\0', sizeof(new_msg));
-            strcpy(new_msg, pDevState);
-            strcat(new_msg, sn_value);
-            strcat(new_msg, "/rx_state");
-        }
-    }
-}
\ No newline at end of file
+    /*
+     * Look the serial number up in the
+     * device index. If it isn't one of
+     * the power devices in the pPower
+     * array, the command is ignored
+     */
+    const cosmos_devices_index_entry_t *pEntry = cosmos_devices_index_find(sn_value, strlen(sn_value));
+    if (pEntry == NULL || pEntry->type != DEVICE_TYPE_PWR || pEntry->idx >= qty || pEntry->pDevice != &pPower[pEntry->idx])
+        return;
+
+    int pwr_idx = pEntry->idx;
+
+    xSemaphoreTake(s_power_lock, portMAX_DELAY);
+    pPower[pwr_idx].state = !pPower[pwr_idx].state;
+    gpio_set_level(pPower[pwr_idx].pin[0], pPower[pwr_idx].state);
+
+    // Written to NVS with the next batch, it survives a brownout
+    cosmos_state_set(pPower[pwr_idx].sn, pPower[pwr_idx].state);
+
+    // Published by the transport task, coalesced with other toggles of the same flush
+    cosmos_devices_queue_push(pPower[pwr_idx].sn, DEVICE_TYPE_PWR, pwr_idx, pPower[pwr_idx].state);
+    xSemaphoreGive(s_power_lock);
+}
+
+/**
+ * @brief Registry begin, restores the saved states at boot
+ *
+ * @param pGroup Power devices, pDevices is a cosmos_devices_t array
+ * @return esp_err_t ESP_OK
+ */
+static esp_err_t cosmos_power_handler_begin(const cosmos_devices_group_t *pGroup)
+{
+    cosmos_power_restore((cosmos_devices_t *)pGroup->pDevices, pGroup->qty);
+    return ESP_OK;
+}
+
+/**
+ * @brief Registry control, toggles the device. The payload is unused.
+ *
+ * @param pGroup Power devices, pDevices is a cosmos_devices_t array
+ * @param idx Index of the device
+ * @param pPayload Unused
+ * @return esp_err_t ESP_OK
+ */
+static esp_err_t cosmos_power_handler_control(const cosmos_devices_group_t *pGroup, size_t idx, const char *pPayload)
+{
+    cosmos_devices_t *pPower = (cosmos_devices_t *)pGroup->pDevices;
+
+    cosmos_power_control(pPower[idx].sn, pPower, pGroup->qty);
+    return ESP_OK;
+}
+
+const cosmos_devices_handler_t cosmos_power_handler = {
+    .begin = cosmos_power_handler_begin,
+    .control = cosmos_power_handler_control,
+};
\ No newline at end of file
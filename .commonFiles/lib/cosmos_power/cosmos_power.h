@@ -3,6 +3,28 @@
 
 #include "cosmos_devices.h"
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Registry handler of DEVICE_TYPE_PWR. pDevices is the cosmos_devices_t
+ * array, every command toggles the device.
+ *
+ */
+extern const cosmos_devices_handler_t cosmos_power_handler;
+
+/**
+ * @brief Sets every power device to its saved state. Call it at boot,
+ * after cosmos_state_begin and before the network starts, otherwise
+ * the first cosmos_power_control does it.
+ *
+ * @param pPower Pointer to the strutct that contains all of the info
+ * about the power devices used in the project
+ * @param qty Quantity of power devices used in the project
+ */
+void cosmos_power_restore(cosmos_devices_t *pPower, size_t qty);
+
 /**
  * @brief This function is used to controll the state (on/off)
  * of a certain power device
@@ -15,4 +37,8 @@
  */
 void cosmos_power_control(const char *sn_value, cosmos_devices_t *pPower, size_t qty);
 
+#ifdef __cplusplus
+}
+#endif
+
 #endif /* MAIN_COSMOS_POWER_H_ */
\ No newline at end of file
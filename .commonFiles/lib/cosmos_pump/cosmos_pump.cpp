@@ -0,0 +1,198 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "driver/gpio.h"
+
+#include "cosmos_pump.h"
+
+// Handle for cosmos_pump_begin
+static bool s_pump_begin_handle = false;
+
+/**
+ * @brief Pump setup function
+ *
+ * @param pPump Pointer to the strutct that contains all of the info
+ * about the pumps used in the project
+ */
+static void cosmos_pump_begin(cosmos_pump_t *pPump)
+{
+    // Initialize GPIO config struct, only the relay. LED pins belong to cosmos_led
+    gpio_config_t io_conf = {
+        .pin_bit_mask = BIT64(pPump->pPumpInfo->pin[0]),
+        .mode = GPIO_MODE_OUTPUT,
+        .pull_up_en = GPIO_PULLUP_DISABLE,
+        .pull_down_en = GPIO_PULLDOWN_DISABLE,
+        .intr_type = GPIO_INTR_DISABLE,
+    };
+
+    // Configure GPIO with the given settings
+    gpio_config(&io_conf);
+
+    /*
+     * Set the gpio pin level to the innital state,
+     * defined in the cosmos_devices_t struct
+     * of the main.c file
+     */
+    gpio_set_level((gpio_num_t)pPump->pPumpInfo->pin[0], pPump->pPumpInfo->state);
+
+    // Status LED starts off, the pattern engine drives it from now on
+    cosmos_led_begin(pPump->pLed, 1);
+
+    // Register the serial number, so topics are resolved without scanning them
+    cosmos_devices_index_add(pPump->pPumpInfo->sn, DEVICE_TYPE_PMP, 0, pPump->pPumpInfo);
+
+    s_pump_begin_handle = true;
+}
+
+/**
+ * @brief Simple loop used for reseting the pump state/values
+ *
+ * @param pPump Pointer to the strutct that contains all of the info
+ * about the pumps used in the project
+ */
+static void cosmos_pump_power_off(cosmos_pump_t *pPump)
+{
+    // Reset pump state
+    gpio_set_level((gpio_num_t)pPump->pPumpInfo->pin[0], 0);
+
+    // Stop rules are checked on every call, only an actual change is published
+    if (pPump->pPumpInfo->state != 0) {
+        cosmos_devices_queue_push(pPump->pPumpInfo->sn, DEVICE_TYPE_PMP, 0, 0);
+    }
+    pPump->pPumpInfo->state = 0;
+
+    // Reset pump's LED state
+    cosmos_led_set_pattern(pPump->pLed, LED_PATTERN_OFF);
+}
+
+cosmos_pump_rule_result_t cosmos_pump_control(const char *pTopic, cosmos_pump_t *pPump, int engage, const cosmos_sensor_t *pSensor, size_t snr_qty)
+{
+    cosmos_pump_rule_result_t result = {
+        .rule_idx = COSMOS_PUMP_RULE_NONE,
+        .action = RULE_ACTION_NONE,
+        .led_pattern = LED_PATTERN_OFF,
+        .matched = 0,
+    };
+    int reading[COSMOS_PUMP_SNR_MAX];
+
+    // Check if the pump is configured
+    if (s_pump_begin_handle == false) {
+        cosmos_pump_begin(pPump);
+    }
+
+    /*
+     * If the serial number of the topic
+     * resolves to the pPump struct,
+     * excution will continue. Otherwise,
+     * the function es exited
+     */
+    const cosmos_devices_index_entry_t *pEntry = cosmos_devices_index_find_topic(pTopic);
+    if (pEntry == NULL || pEntry->pDevice != pPump->pPumpInfo) {
+        return result;
+    }
+
+    // Snapshot of the latest readings, taken by cosmos_sensor_adc_read_voltage
+    if (snr_qty > COSMOS_PUMP_SNR_MAX) {
+        snr_qty = COSMOS_PUMP_SNR_MAX;
+    }
+    for (size_t i = 0; i < snr_qty; i++) {
+        reading[i] = pSensor[i].reading;
+    }
+
+    /*
+     * When trying to engage the pump, every rule
+     * of the table must be checked first.
+     *
+     * Furthermore, if pump is already activated and
+     * a stop rule matches, it'll be automatically
+     * disengaged.
+     */
+    result = cosmos_pump_rule_eval(pPump->pRule, pPump->rule_qty, reading, snr_qty);
+
+    if (result.action == RULE_ACTION_STOP) {
+        cosmos_pump_power_off(pPump);
+        cosmos_led_set_pattern(pPump->pLed, (cosmos_led_pattern_e)result.led_pattern);
+        return result;
+    }
+
+    /*
+     * Once no stop rule matches, pump
+     * will be ready to be engaged
+     */
+    switch (engage) {
+
+    case ENGAGE_OK:
+        gpio_set_level((gpio_num_t)pPump->pPumpInfo->pin[0], 1);
+        pPump->pPumpInfo->state = 1;
+        cosmos_devices_queue_push(pPump->pPumpInfo->sn, DEVICE_TYPE_PMP, 0, 1);
+        // cosmosMqttPublish("Sistema iniciado...", pPump->pPumpInfo->sn, RX_CONTROL);
+        cosmos_led_set_pattern(pPump->pLed, LED_PATTERN_STARTED);
+        break;
+
+    case ENGAGE_RN:
+        cosmos_led_set_pattern(pPump->pLed, LED_PATTERN_RUNNING);
+        // cosmosMqttPublish("Sistema en marcha OK!", pPump->pPumpInfo->sn, RX_CONTROL);
+        break;
+
+    case ENGAGE_NO:
+        cosmos_led_set_pattern(pPump->pLed, LED_PATTERN_STANDBY);
+        // cosmosMqttPublish("Sistema en espera.", pPump->pPumpInfo->sn, RX_CONTROL);
+        break;
+
+    default:
+        break;
+    }
+
+    // Warnings don't touch the pump, they only take over the LED
+    if (result.action == RULE_ACTION_WARN) {
+        cosmos_led_set_pattern(pPump->pLed, (cosmos_led_pattern_e)result.led_pattern);
+    }
+
+    return result;
+}
+
+/**
+ * @brief Registry begin, sets up the relay and the status LED at boot
+ *
+ * @param pGroup Pump, pDevices is a single cosmos_pump_t
+ * @return esp_err_t ESP_OK on success, ESP_ERR_INVALID_ARG if the group isn't a single pump
+ */
+static esp_err_t cosmos_pump_handler_begin(const cosmos_devices_group_t *pGroup)
+{
+    if (pGroup->qty != 1 || pGroup->pArg == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (s_pump_begin_handle == false) {
+        cosmos_pump_begin((cosmos_pump_t *)pGroup->pDevices);
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Registry control, runs cosmos_pump_control with the engage value of the payload
+ *
+ * @param pGroup Pump, pArg is the cosmos_pump_sensors_t checked by the rules
+ * @param idx Always 0
+ * @param pPayload cosmos_pump_state_e as text, e.g. "0" to engage
+ * @return esp_err_t ESP_OK, a stop rule is reported through the status LED,
+ *                   ESP_ERR_INVALID_ARG if the payload is not a cosmos_pump_state_e
+ */
+static esp_err_t cosmos_pump_handler_control(const cosmos_devices_group_t *pGroup, size_t idx, const char *pPayload)
+{
+    cosmos_pump_t *pPump = (cosmos_pump_t *)pGroup->pDevices;
+    const cosmos_pump_sensors_t *pSensors = (const cosmos_pump_sensors_t *)pGroup->pArg;
+
+    cosmos_pump_state_e engage;
+
+    if (cosmos_pump_engage_parse(pPayload, &engage) != 0)
+        return ESP_ERR_INVALID_ARG;
+
+    cosmos_pump_control(pPump->pPumpInfo->sn, pPump, engage, pSensors->pSensor, pSensors->snr_qty);
+    return ESP_OK;
+}
+
+const cosmos_devices_handler_t cosmos_pump_handler = {
+    .begin = cosmos_pump_handler_begin,
+    .control = cosmos_pump_handler_control,
+};
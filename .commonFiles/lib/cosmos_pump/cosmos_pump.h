@@ -2,31 +2,48 @@
 #define MAIN_COSMOS_PUMP_H_
 
 #include "cosmos_devices.h"
+#include "cosmos_led.h"
+#include "cosmos_pump_engage.h"
+#include "cosmos_pump_rule.h"
 #include "cosmos_sensor.h"
 
+#define COSMOS_PUMP_SNR_MAX 8 /*!< Sensors in the snapshot checked by the rule table */
+
 /**
- * @brief States of the pump
+ * @brief Use this struct to define the pump and the
+ * safety rules that needs to be checked in order to
+ * get the pump going
+ *
+ * @note Rules index the sensor array given to cosmos_pump_control.
+ * E.g. with {soil moisture, water level} as sensors:
  *
+ * const cosmos_pump_rule_t rules[] = {
+ *     {.snr_idx = 1, .cmp = RULE_CMP_LT, .action = RULE_ACTION_STOP, .led_pattern = LED_PATTERN_FAULT_WL, .threshold = 600},
+ *     {.snr_idx = 0, .cmp = RULE_CMP_LT, .action = RULE_ACTION_STOP, .led_pattern = LED_PATTERN_FAULT_SM, .threshold = 1500},
+ * };
  */
-typedef enum {
-    ENGAGE_OK = 0, /*!< Pump started */
-    ENGAGE_RN,     /*!< Pump running */
-    ENGAGE_NO,     /*!< Pump in standby */
-} cosmos_pump_state_e;
+typedef struct {
+    cosmos_devices_t *pPumpInfo;     /*<! Pump relay serial number, pins and state */
+    cosmos_led_t *pLed;              /*!< Pump's status LED, driven by cosmos_led */
+    const cosmos_pump_rule_t *pRule; /*!< Safety rules, checked in order */
+    size_t rule_qty;                 /*!< Quantity of rules */
+} cosmos_pump_t;
 
 /**
- * @brief Use this struct to define all the parameters
- * that needs to be checked in order to get the pump
- * going
+ * @brief Sensors checked by the rules when the pump is driven from the registry
  *
- * @note If you are going to do without any of the sensors,
- * just create an arry of zeros -> {0, 0}
  */
 typedef struct {
-    cosmos_devices_t *pPumpInfo;    /*<! Pump relay serial number, pins and state */
-    const int *pLedInfo;            /*!< Pins in which the pump's LED is connected */
-    cosmos_sensor_info_t *pSnrInfo; /*!< Sensor information */
-} cosmos_pump_t;
+    const cosmos_sensor_t *pSensor; /*!< Sensors read by cosmos_sensor_adc_read_voltage, indexed by the rules */
+    size_t snr_qty;                 /*!< Quantity of sensors */
+} cosmos_pump_sensors_t;
+
+/**
+ * @brief Registry handler of DEVICE_TYPE_PMP. pDevices is a single cosmos_pump_t,
+ * pArg its cosmos_pump_sensors_t and payloads a cosmos_pump_state_e as text.
+ *
+ */
+extern const cosmos_devices_handler_t cosmos_pump_handler;
 
 /**
  * @brief Call this function whenever you want to check the
@@ -38,8 +55,10 @@ typedef struct {
  *          - If you want to turn on the pump ENGAGE_OK ;
  *          - If you want to leave it in idle ENGAGE_NO ;
  *          - If pump is already running ENGAGE_RN ;
- * @param pSensorData Pointer to the struct in which the sensed data will be stored
+ * @param pSensor Sensors read by cosmos_sensor_adc_read_voltage, indexed by the rules
+ * @param snr_qty Quantity of sensors (at most COSMOS_PUMP_SNR_MAX are checked)
+ * @return cosmos_pump_rule_result_t Rule evaluation, rule_idx is COSMOS_PUMP_RULE_NONE if the topic is for another pump
  */
-void cosmos_pump_control(char *pTopic, cosmos_pump_t *pPump, int engage, cosmos_sensor_data_t *pSensorData);
+cosmos_pump_rule_result_t cosmos_pump_control(const char *pTopic, cosmos_pump_t *pPump, int engage, const cosmos_sensor_t *pSensor, size_t snr_qty);
 
-#endif /* MAIN_COSMOS_PUMP_H_ */
\ No newline at end of file
+#endif /* MAIN_COSMOS_PUMP_H_ */
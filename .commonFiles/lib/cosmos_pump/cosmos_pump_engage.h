@@ -0,0 +1,43 @@
+#ifndef MAIN_COSMOS_PUMP_ENGAGE_H_
+#define MAIN_COSMOS_PUMP_ENGAGE_H_
+
+#include <errno.h>
+#include <stdlib.h>
+
+/**
+ * @brief States of the pump
+ *
+ */
+typedef enum {
+    ENGAGE_OK = 0, /*!< Pump started */
+    ENGAGE_RN,     /*!< Pump running */
+    ENGAGE_NO,     /*!< Pump in standby */
+} cosmos_pump_state_e;
+
+/**
+ * @brief Decodes the engage value of a control payload. Only a whole
+ * decimal number from ENGAGE_OK to ENGAGE_NO is accepted, so an empty
+ * or malformed payload can't read as ENGAGE_OK and start the pump.
+ *
+ * @param pPayload cosmos_pump_state_e as text, e.g. "0" to engage
+ * @param pEngage Output, only written on success
+ * @return int 0 on success, -1 if the payload is not a valid state
+ */
+static inline int cosmos_pump_engage_parse(const char *pPayload, cosmos_pump_state_e *pEngage)
+{
+    char *pEnd;
+    long value;
+
+    if (pPayload == NULL || *pPayload == '\0')
+        return -1;
+
+    errno = 0;
+    value = strtol(pPayload, &pEnd, 10);
+    if (errno != 0 || pEnd == pPayload || *pEnd != '\0' || value < ENGAGE_OK || value > ENGAGE_NO)
+        return -1;
+
+    *pEngage = (cosmos_pump_state_e)value;
+    return 0;
+}
+
+#endif /* MAIN_COSMOS_PUMP_ENGAGE_H_ */
@@ -0,0 +1,61 @@
+#include "cosmos_pump_rule.h"
+
+/**
+ * @brief Applies a comparator
+ *
+ * @param reading Sensor reading
+ * @param cmp cosmos_pump_rule_cmp_e
+ * @param threshold Rule threshold
+ * @return true if the rule condition holds
+ */
+static bool cosmos_pump_rule_compare(int reading, uint8_t cmp, int32_t threshold)
+{
+    switch (cmp) {
+    case RULE_CMP_LT:
+        return reading < threshold;
+    case RULE_CMP_LE:
+        return reading <= threshold;
+    case RULE_CMP_GT:
+        return reading > threshold;
+    case RULE_CMP_GE:
+        return reading >= threshold;
+    default:
+        return false;
+    }
+}
+
+cosmos_pump_rule_result_t cosmos_pump_rule_eval(const cosmos_pump_rule_t *pRule, size_t rule_qty, const int *pReading, size_t snr_qty)
+{
+    cosmos_pump_rule_result_t result = {
+        .rule_idx = COSMOS_PUMP_RULE_NONE,
+        .action = RULE_ACTION_NONE,
+        .led_pattern = 0,
+        .matched = 0,
+    };
+
+    if (rule_qty > COSMOS_PUMP_RULE_MAX) {
+        rule_qty = COSMOS_PUMP_RULE_MAX;
+    }
+
+    for (size_t i = 0; i < rule_qty; i++) {
+        if (pRule[i].snr_idx >= snr_qty) {
+            // A STOP rule without its sensor fails safe, other rules are skipped
+            if (pRule[i].action != RULE_ACTION_STOP) {
+                continue;
+            }
+        } else if (!cosmos_pump_rule_compare(pReading[pRule[i].snr_idx], pRule[i].cmp, pRule[i].threshold)) {
+            continue;
+        }
+
+        result.matched |= 1UL << i;
+
+        // First match decides, later matches are only reported
+        if (result.rule_idx == COSMOS_PUMP_RULE_NONE) {
+            result.rule_idx = i;
+            result.action = pRule[i].action;
+            result.led_pattern = pRule[i].led_pattern;
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,70 @@
+#ifndef MAIN_COSMOS_PUMP_RULE_H_
+#define MAIN_COSMOS_PUMP_RULE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define COSMOS_PUMP_RULE_MAX 32 /*!< Rules per table, one bit each in cosmos_pump_rule_result_t::matched */
+#define COSMOS_PUMP_RULE_NONE -1
+
+/**
+ * @brief Comparators available in a rule. The rule
+ * matches when "reading <cmp> threshold" is true
+ *
+ */
+typedef enum {
+    RULE_CMP_LT = 0, /*!< reading < threshold */
+    RULE_CMP_LE,     /*!< reading <= threshold */
+    RULE_CMP_GT,     /*!< reading > threshold */
+    RULE_CMP_GE,     /*!< reading >= threshold */
+} cosmos_pump_rule_cmp_e;
+
+/**
+ * @brief What the pump does when a rule matches
+ *
+ */
+typedef enum {
+    RULE_ACTION_NONE = 0, /*!< Nothing, the rule is only reported */
+    RULE_ACTION_WARN,     /*!< Pump keeps its state, the LED shows the rule pattern */
+    RULE_ACTION_STOP,     /*!< Pump is switched off and can't be engaged */
+} cosmos_pump_rule_action_e;
+
+/**
+ * @brief Single row of a rule table. Rows are checked in
+ * order and the first one that matches decides the action
+ * and the LED pattern, like an if / else if chain.
+ *
+ */
+typedef struct {
+    uint8_t snr_idx;     /*!< Index of the reading in the sensor snapshot */
+    uint8_t cmp;         /*!< cosmos_pump_rule_cmp_e */
+    uint8_t action;      /*!< cosmos_pump_rule_action_e */
+    uint8_t led_pattern; /*!< cosmos_led_pattern_e shown while the rule decides */
+    int32_t threshold;   /*!< Same unit as the reading (mV for the analog sensors) */
+} cosmos_pump_rule_t;
+
+/**
+ * @brief Outcome of a rule table evaluation
+ *
+ */
+typedef struct {
+    int rule_idx;        /*!< First rule that matched, COSMOS_PUMP_RULE_NONE if none did */
+    uint8_t action;      /*!< Action of that rule, RULE_ACTION_NONE if none matched */
+    uint8_t led_pattern; /*!< LED pattern of that rule */
+    uint32_t matched;    /*!< Bit n set if rule n matched, for reporting */
+} cosmos_pump_rule_result_t;
+
+/**
+ * @brief Evaluates a rule table in one pass over a sensor snapshot.
+ * STOP rules pointing outside the snapshot always match, so a missing
+ * sensor keeps the pump off. Other rules pointing outside never match.
+ *
+ * @param pRule Rule table, at most COSMOS_PUMP_RULE_MAX rows
+ * @param rule_qty Quantity of rules
+ * @param pReading Sensor snapshot, one reading per sensor
+ * @param snr_qty Quantity of readings
+ * @return cosmos_pump_rule_result_t Result of the evaluation
+ */
+cosmos_pump_rule_result_t cosmos_pump_rule_eval(const cosmos_pump_rule_t *pRule, size_t rule_qty, const int *pReading, size_t snr_qty);
+
+#endif /* MAIN_COSMOS_PUMP_RULE_H_ */
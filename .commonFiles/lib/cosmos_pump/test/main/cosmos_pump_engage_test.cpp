@@ -0,0 +1,63 @@
+/**
+ * @file cosmos_pump_engage_test.cpp
+ * @author Marcel Nahir Samur (mnsamur2014@gmail.com)
+ * @brief Checks that only well formed engage payloads reach the pump
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "cosmos_pump_engage.h"
+#include "cosmos_test.h"
+
+/**
+ * @brief Runs the parser on a payload that must be rejected
+ *
+ * @param pPayload Payload
+ * @return true if it was rejected and the output left untouched
+ */
+static bool rejected(const char *pPayload)
+{
+    cosmos_pump_state_e engage = ENGAGE_RN;
+    return cosmos_pump_engage_parse(pPayload, &engage) == -1 && engage == ENGAGE_RN;
+}
+
+static void test_valid(void)
+{
+    cosmos_pump_state_e engage = ENGAGE_RN;
+
+    CHECK(cosmos_pump_engage_parse("0", &engage) == 0 && engage == ENGAGE_OK);
+    CHECK(cosmos_pump_engage_parse("1", &engage) == 0 && engage == ENGAGE_RN);
+    CHECK(cosmos_pump_engage_parse("2", &engage) == 0 && engage == ENGAGE_NO);
+}
+
+static void test_empty(void)
+{
+    // atoi("") is 0, which used to engage the pump
+    CHECK(rejected(""));
+    CHECK(rejected(NULL));
+}
+
+static void test_malformed(void)
+{
+    CHECK(rejected("on"));
+    CHECK(rejected("x0"));
+    CHECK(rejected("0x"));
+    CHECK(rejected("1 "));
+    CHECK(rejected(" "));
+    CHECK(rejected("-"));
+    CHECK(rejected("3"));
+    CHECK(rejected("-1"));
+    CHECK(rejected("99999999999999999999"));
+}
+
+int main(void)
+{
+    test_valid();
+    test_empty();
+    test_malformed();
+
+    return cosmos_test_report();
+}
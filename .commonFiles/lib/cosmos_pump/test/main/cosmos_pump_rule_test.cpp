@@ -0,0 +1,144 @@
+/**
+ * @file cosmos_pump_rule_test.cpp
+ * @author Marcel Nahir Samur (mnsamur2014@gmail.com)
+ * @brief Unit tests for the cosmos_pump rule evaluator
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <cstdio>
+
+#include "cosmos_pump_rule.h"
+#include "cosmos_test.h"
+
+// Stand-ins for cosmos_led_pattern_e, the evaluator only carries the value
+#define PATTERN_FAULT_WL 4
+#define PATTERN_FAULT_SM 5
+#define PATTERN_FAULT_TH 6
+
+// Sensor snapshot layout used by the tests
+#define SNR_SM 0
+#define SNR_WL 1
+#define SNR_TH 2
+
+// Same priorities as the old if / else chain: water level, soil moisture, temperature
+static const cosmos_pump_rule_t s_rules[] = {
+    {.snr_idx = SNR_WL, .cmp = RULE_CMP_LT, .action = RULE_ACTION_STOP, .led_pattern = PATTERN_FAULT_WL, .threshold = 600},
+    {.snr_idx = SNR_SM, .cmp = RULE_CMP_LE, .action = RULE_ACTION_STOP, .led_pattern = PATTERN_FAULT_SM, .threshold = 1500},
+    {.snr_idx = SNR_TH, .cmp = RULE_CMP_GT, .action = RULE_ACTION_WARN, .led_pattern = PATTERN_FAULT_TH, .threshold = 40},
+};
+
+static void test_no_match(void)
+{
+    const int reading[] = {2500, 1800, 25};
+
+    cosmos_pump_rule_result_t result = cosmos_pump_rule_eval(s_rules, 3, reading, 3);
+    CHECK(result.rule_idx == COSMOS_PUMP_RULE_NONE);
+    CHECK(result.action == RULE_ACTION_NONE);
+    CHECK(result.matched == 0);
+}
+
+static void test_first_match_wins(void)
+{
+    // Tank empty, soil wet and too hot at the same time
+    const int reading[] = {1200, 300, 45};
+
+    cosmos_pump_rule_result_t result = cosmos_pump_rule_eval(s_rules, 3, reading, 3);
+    CHECK(result.rule_idx == 0);
+    CHECK(result.action == RULE_ACTION_STOP);
+    CHECK(result.led_pattern == PATTERN_FAULT_WL);
+    CHECK(result.matched == 0x7);
+}
+
+static void test_single_match(void)
+{
+    const int reading[] = {2500, 1800, 45};
+
+    cosmos_pump_rule_result_t result = cosmos_pump_rule_eval(s_rules, 3, reading, 3);
+    CHECK(result.rule_idx == 2);
+    CHECK(result.action == RULE_ACTION_WARN);
+    CHECK(result.led_pattern == PATTERN_FAULT_TH);
+    CHECK(result.matched == 0x4);
+}
+
+static void test_comparators(void)
+{
+    const int at[] = {100};
+    const int below[] = {99};
+    const int above[] = {101};
+    cosmos_pump_rule_t rule = {.snr_idx = 0, .cmp = RULE_CMP_LT, .action = RULE_ACTION_STOP, .led_pattern = 0, .threshold = 100};
+
+    CHECK(cosmos_pump_rule_eval(&rule, 1, below, 1).matched == 1);
+    CHECK(cosmos_pump_rule_eval(&rule, 1, at, 1).matched == 0);
+
+    rule.cmp = RULE_CMP_LE;
+    CHECK(cosmos_pump_rule_eval(&rule, 1, at, 1).matched == 1);
+    CHECK(cosmos_pump_rule_eval(&rule, 1, above, 1).matched == 0);
+
+    rule.cmp = RULE_CMP_GT;
+    CHECK(cosmos_pump_rule_eval(&rule, 1, above, 1).matched == 1);
+    CHECK(cosmos_pump_rule_eval(&rule, 1, at, 1).matched == 0);
+
+    rule.cmp = RULE_CMP_GE;
+    CHECK(cosmos_pump_rule_eval(&rule, 1, at, 1).matched == 1);
+    CHECK(cosmos_pump_rule_eval(&rule, 1, below, 1).matched == 0);
+
+    // Unknown comparators never match
+    rule.cmp = 0xFF;
+    CHECK(cosmos_pump_rule_eval(&rule, 1, at, 1).matched == 0);
+}
+
+static void test_short_snapshot(void)
+{
+    // Only soil moisture and water level are wired, the temperature rule must be skipped
+    const int reading[] = {2500, 1800, 45};
+
+    cosmos_pump_rule_result_t result = cosmos_pump_rule_eval(s_rules, 3, reading, 2);
+    CHECK(result.rule_idx == COSMOS_PUMP_RULE_NONE);
+    CHECK(result.matched == 0);
+}
+
+static void test_missing_stop_sensor(void)
+{
+    // Water level not wired: its STOP rule must hold the pump off even with wet soil
+    const int reading[] = {2500};
+
+    cosmos_pump_rule_result_t result = cosmos_pump_rule_eval(s_rules, 3, reading, 1);
+    CHECK(result.rule_idx == 0);
+    CHECK(result.action == RULE_ACTION_STOP);
+    CHECK(result.led_pattern == PATTERN_FAULT_WL);
+    CHECK(result.matched == 0x1);
+}
+
+static void test_empty_and_long_tables(void)
+{
+    const int reading[] = {0};
+    cosmos_pump_rule_t rules[COSMOS_PUMP_RULE_MAX + 4];
+
+    CHECK(cosmos_pump_rule_eval(s_rules, 0, reading, 1).rule_idx == COSMOS_PUMP_RULE_NONE);
+
+    for (size_t i = 0; i < COSMOS_PUMP_RULE_MAX + 4; i++) {
+        rules[i] = {.snr_idx = 0, .cmp = RULE_CMP_GE, .action = RULE_ACTION_WARN, .led_pattern = 0, .threshold = 0};
+    }
+
+    // Rows past COSMOS_PUMP_RULE_MAX are ignored, every other one is reported
+    cosmos_pump_rule_result_t result = cosmos_pump_rule_eval(rules, COSMOS_PUMP_RULE_MAX + 4, reading, 1);
+    CHECK(result.rule_idx == 0);
+    CHECK(result.matched == 0xFFFFFFFF);
+}
+
+int main(void)
+{
+    test_no_match();
+    test_first_match_wins();
+    test_single_match();
+    test_comparators();
+    test_short_snapshot();
+    test_missing_stop_sensor();
+    test_empty_and_long_tables();
+
+    return cosmos_test_report();
+}
@@ -55,40 +55,54 @@ static int cosmos_sensor_moving_avg_update(cosmos_sensor_moving_avg_t *f, int ne
  *
  * @note Also, if possible, consider adding a 0.1uF capacitor to the
  * ADC input pad in use, when designing the PCB
+ * @note A conversion can fail while the fast lane holds the ADC
+ * (cosmos_sensor_adc_read_fast), those samples are skipped
  * @param pSensor Pointer to the struct that contains the information of
  * the analog sensors
- * @return int Multisampled readings from adc1
+ * @return int Multisampled readings from adc1, -1 if no sample could be read
  */
 static int cosmos_sensor_adc_discard(cosmos_sensor_t *pSensor)
 {
     int v;
     int min = INT32_MAX, max = INT32_MIN;
     long sum = 0;
+    int samples = 0;
 
     for (int i = 0; i < NO_OF_SAMPLES; i++) {
         ets_delay_us(20); // ADC sampling time
 
-        adc_oneshot_read(adc1_handle, pSensor->snr_chn, &v);
+        if (adc_oneshot_read(adc1_handle, pSensor->snr_chn, &v) != ESP_OK)
+            continue;
+
         if (v < min)
             min = v;
         if (v > max)
             max = v;
         sum += v;
+        samples++;
     }
 
-    // if NO_OF_SAMPLES < 3 just return average (safe path)
-    if (NO_OF_SAMPLES <= 2)
-        return (int)(sum / NO_OF_SAMPLES);
+    if (samples == 0)
+        return -1;
+
+    // if less than 3 samples just return average (safe path)
+    if (samples <= 2)
+        return (int)(sum / samples);
 
     // discard min and max
     sum -= min;
     sum -= max;
-    return (int)(sum / (NO_OF_SAMPLES - 2));
+    return (int)(sum / (samples - 2));
 }
 
 int cosmos_sensor_adc_filtered(cosmos_sensor_t *pSensor, cosmos_sensor_moving_avg_t *pFilter)
 {
     int sample = cosmos_sensor_adc_discard(pSensor);
+
+    // A failed read leaves the filter as it is
+    if (sample < 0)
+        return pFilter->count ? (int)(pFilter->sum / pFilter->count) : -1;
+
     return cosmos_sensor_moving_avg_update(pFilter, sample);
 }
 
@@ -203,8 +217,96 @@ void cosmos_sensor_adc_read_voltage(cosmos_sensor_t *pSensor, int snr_qty)
             // Start readings
             int adc_reading = cosmos_sensor_adc_filtered(&pSensor[snr_idx], &filter[snr_idx]);
 
+            // The ADC could not be read, keep the previous reading
+            if (adc_reading < 0)
+                continue;
+
             // Convert ADC reading to calibrated voltage
             adc_cali_raw_to_voltage(pSensor[snr_idx].snr_handle, adc_reading, &pSensor[snr_idx].reading);
         }
     }
 }
+
+int cosmos_sensor_adc_read_fast(cosmos_sensor_t *pSensor)
+{
+    int raw, voltage;
+
+    if (s_sensor_begin_handle == false)
+        return -1;
+
+    if (adc_oneshot_read(adc1_handle, pSensor->snr_chn, &raw) != ESP_OK)
+        return -1;
+
+    if (pSensor->cali_flag && adc_cali_raw_to_voltage(pSensor->snr_handle, raw, &voltage) == ESP_OK)
+        return voltage;
+
+    // 12 dB attenuation full scale is roughly 3100 mV
+    return raw * 3100 / 4095;
+}
+
+esp_err_t cosmos_sensor_fm_begin(cosmos_sensor_fm_t *pSensor, int snr_qty)
+{
+    esp_err_t err;
+
+    for (int snr_idx = 0; snr_idx < snr_qty; snr_idx++) {
+        /*
+         * accum_count keeps the count going past the
+         * high limit, so a free running counter can be
+         * read periodically without ever clearing it
+         */
+        pcnt_unit_config_t unit_config = {
+            .low_limit = -1,
+            .high_limit = FM_PCNT_HIGH_LIMIT,
+            .flags = {
+                .accum_count = true,
+            },
+        };
+        err = pcnt_new_unit(&unit_config, &pSensor[snr_idx].pcnt_unit);
+        if (err != ESP_OK) {
+            ESP_LOGE(TAG, "Flowmeter on pin %d: no free PCNT unit", pSensor[snr_idx].pin_num);
+            return err;
+        }
+
+        pcnt_glitch_filter_config_t filter_config = {
+            .max_glitch_ns = FM_GLITCH_FILTER_NS,
+        };
+        ESP_ERROR_CHECK(pcnt_unit_set_glitch_filter(pSensor[snr_idx].pcnt_unit, &filter_config));
+
+        // Count rising edges only, no level gating
+        pcnt_chan_config_t chan_config = {
+            .edge_gpio_num = pSensor[snr_idx].pin_num,
+            .level_gpio_num = -1,
+        };
+        pcnt_channel_handle_t pcnt_chan = NULL;
+        ESP_ERROR_CHECK(pcnt_new_channel(pSensor[snr_idx].pcnt_unit, &chan_config, &pcnt_chan));
+        ESP_ERROR_CHECK(pcnt_channel_set_edge_action(pcnt_chan, PCNT_CHANNEL_EDGE_ACTION_INCREASE, PCNT_CHANNEL_EDGE_ACTION_HOLD));
+
+        // Overflow watch point, needed by accum_count
+        ESP_ERROR_CHECK(pcnt_unit_add_watch_point(pSensor[snr_idx].pcnt_unit, FM_PCNT_HIGH_LIMIT));
+
+        ESP_ERROR_CHECK(pcnt_unit_enable(pSensor[snr_idx].pcnt_unit));
+        ESP_ERROR_CHECK(pcnt_unit_clear_count(pSensor[snr_idx].pcnt_unit));
+        ESP_ERROR_CHECK(pcnt_unit_start(pSensor[snr_idx].pcnt_unit));
+
+        pSensor[snr_idx].last_count = 0;
+    }
+
+    ESP_LOGI(TAG, "Flowmeter init success");
+    return ESP_OK;
+}
+
+uint32_t cosmos_sensor_fm_read_pulses(cosmos_sensor_fm_t *pSensor)
+{
+    int count = 0;
+
+    if (pSensor->pcnt_unit == NULL)
+        return 0;
+
+    pcnt_unit_get_count(pSensor->pcnt_unit, &count);
+
+    // Unsigned difference survives the int wrap of the accumulated count
+    uint32_t pulses = (uint32_t)count - (uint32_t)pSensor->last_count;
+    pSensor->last_count = count;
+
+    return pulses;
+}
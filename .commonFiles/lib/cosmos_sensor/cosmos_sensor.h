@@ -1,12 +1,16 @@
 #ifndef MAIN_COSMOS_SENSOR_H_
 #define MAIN_COSMOS_SENSOR_H_
 
+#include "driver/pulse_cnt.h"
 #include "esp_adc/adc_cali.h"
 
 #define NO_OF_SAMPLES 16   /*!< Standard sample rate for ADC multisampling */
 #define FILTER_SIZE   10   /*!< moving average window size */
 #define DEFAULT_VREF  1100 /*!< By design, the ADC reference voltage for ESP32 is 1100 mV */
 
+#define FM_GLITCH_FILTER_NS 1000  /*!< Pulses shorter than this are filtered out by the PCNT hardware */
+#define FM_PCNT_HIGH_LIMIT  32767 /*!< PCNT overflow point, only then the CPU gets an interrupt */
+
 #define COSMOS_MAP(x, in_min, in_max, out_min, out_max) ((x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min) /*!< Arduino style map function */
 
 /**
@@ -46,6 +50,19 @@ typedef struct {
     cosmos_sensor_type_e snr_type;       /*!< Sensor type */
 } cosmos_sensor_t;
 
+/**
+ * @brief Use this struct to store the
+ * parameters of the pulse output
+ * flowmeters (SNR_TYPE_FM)
+ */
+typedef struct {
+    const int pin_num;                           /*!< Pin number in which the flowmeter pulse output is connected */
+    float pulses_per_litre;                      /*!< K-factor of the flowmeter, e.g. 450 for a YF-S201 */
+    pcnt_unit_handle_t pcnt_unit = NULL;         /*!< PCNT unit counting the pulses */
+    int last_count = 0;                          /*!< Accumulated count at the previous read */
+    cosmos_sensor_type_e snr_type = SNR_TYPE_FM; /*!< Sensor type */
+} cosmos_sensor_fm_t;
+
 /**
  * @brief Configures and characterize the ADC at
  * 12db attenuation and a bandwidth of 12bits.
@@ -67,4 +84,37 @@ void cosmos_sensor_begin(cosmos_sensor_t *pSensor, int snr_qty);
  */
 void cosmos_sensor_adc_read_voltage(cosmos_sensor_t *pSensor, int snr_qty);
 
+/**
+ * @brief Single shot read of one analog sensor, without multisampling
+ * nor filtering. Meant for fast sampling lanes (e.g. safety interlocks)
+ * that poll a single channel at a high rate.
+ *
+ * @note The sensor calibration is done by cosmos_sensor_adc_read_voltage,
+ * until then an uncalibrated linear conversion is used.
+ *
+ * @param pSensor Pointer to the sensor
+ * @return int Reading in mV, or -1 if the ADC could not be read
+ */
+int cosmos_sensor_adc_read_fast(cosmos_sensor_t *pSensor);
+
+/**
+ * @brief Installs one PCNT unit with hardware glitch filtering per
+ * flowmeter. Pulses are counted by the peripheral, the CPU is only
+ * interrupted once every FM_PCNT_HIGH_LIMIT pulses.
+ *
+ * @param pSensor Pointer to the struct which contains the flowmeters'
+ * information
+ * @param snr_qty Quantity of flowmeters used in the project
+ * @return esp_err_t ESP_OK on success
+ */
+esp_err_t cosmos_sensor_fm_begin(cosmos_sensor_fm_t *pSensor, int snr_qty);
+
+/**
+ * @brief Reads the pulses counted since the previous call
+ *
+ * @param pSensor Pointer to the flowmeter
+ * @return uint32_t Pulses since the previous read
+ */
+uint32_t cosmos_sensor_fm_read_pulses(cosmos_sensor_fm_t *pSensor);
+
 #endif /* MAIN_COSMOS_SENSOR_H_ */
\ No newline at end of file
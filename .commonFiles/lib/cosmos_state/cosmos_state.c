@@ -0,0 +1,224 @@
+#include <string.h>
+
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "nvs.h"
+
+#include "cosmos_state.h"
+
+static const char *TAG = "cosmos_state";
+
+#define COSMOS_STATE_NVS_KEY "states"
+
+#define FLUSH_STACK_SIZE 3072
+#define FLUSH_PRIORITY   1
+
+// States in RAM, the blob holds a copy from the last write
+static cosmos_state_record_t s_record[COSMOS_STATE_MAX];
+static size_t s_record_qty = 0;
+
+// Debounce bookkeeping, in ms since boot
+static bool s_dirty = false;
+static int64_t s_first_dirty_ms = 0;
+static int64_t s_last_change_ms = 0;
+static int64_t s_last_flush_ms = 0;
+
+static esp_timer_handle_t s_timer = NULL;
+static TaskHandle_t s_flush_task = NULL;
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static int64_t cosmos_state_now_ms(void)
+{
+    return esp_timer_get_time() / 1000;
+}
+
+/**
+ * @brief Finds the record of a key. Must be called with s_lock taken.
+ *
+ * @param pKey Serial number of the device
+ * @return int Index of the record, -1 if the key has none
+ */
+static int cosmos_state_find(const char *pKey)
+{
+    for (size_t i = 0; i < s_record_qty; i++) {
+        if (strncmp(s_record[i].key, pKey, COSMOS_STATE_KEY_LEN) == 0)
+            return i;
+    }
+
+    return -1;
+}
+
+/**
+ * @brief Moves the write timer to the time the pending changes are due
+ *
+ */
+static void cosmos_state_arm(void)
+{
+    if (s_timer == NULL)
+        return;
+
+    taskENTER_CRITICAL(&s_lock);
+    bool dirty = s_dirty;
+    int64_t due = cosmos_state_due_ms(s_first_dirty_ms, s_last_change_ms, s_last_flush_ms);
+    taskEXIT_CRITICAL(&s_lock);
+
+    if (!dirty)
+        return;
+
+    int64_t delay_ms = due - cosmos_state_now_ms();
+
+    esp_timer_stop(s_timer);
+    esp_timer_start_once(s_timer, (delay_ms > 0 ? delay_ms : 0) * 1000 + 1);
+}
+
+esp_err_t cosmos_state_flush(void)
+{
+    cosmos_state_record_t record[COSMOS_STATE_MAX];
+    nvs_handle_t handle;
+
+    taskENTER_CRITICAL(&s_lock);
+    if (!s_dirty) {
+        taskEXIT_CRITICAL(&s_lock);
+        return ESP_OK;
+    }
+    size_t qty = s_record_qty;
+    memcpy(record, s_record, qty * sizeof(cosmos_state_record_t));
+    s_dirty = false;
+    s_last_flush_ms = cosmos_state_now_ms();
+    taskEXIT_CRITICAL(&s_lock);
+
+    // Every state goes in one blob, a batch of changes costs a single write
+    esp_err_t err = nvs_open(COSMOS_STATE_NVS_NAMESPACE, NVS_READWRITE, &handle);
+    if (err == ESP_OK) {
+        err = nvs_set_blob(handle, COSMOS_STATE_NVS_KEY, record, qty * sizeof(cosmos_state_record_t));
+        if (err == ESP_OK)
+            err = nvs_commit(handle);
+        nvs_close(handle);
+    }
+
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to save device states: %d", err);
+
+        // Try again after the minimum interval, changes made meanwhile go with it
+        taskENTER_CRITICAL(&s_lock);
+        if (!s_dirty)
+            s_first_dirty_ms = s_last_change_ms = s_last_flush_ms;
+        s_dirty = true;
+        taskEXIT_CRITICAL(&s_lock);
+        cosmos_state_arm();
+    }
+
+    return err;
+}
+
+/**
+ * @brief Write task, the NVS commit may block so it runs here
+ * instead of on the esp_timer task
+ *
+ * @param pArg Unused
+ */
+static void cosmos_state_flush_task(void *pArg)
+{
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        cosmos_state_flush();
+    }
+}
+
+/**
+ * @brief Write timer, wakes the write task once the pending changes are due
+ *
+ * @param pArg Unused
+ */
+static void cosmos_state_timer_cb(void *pArg)
+{
+    xTaskNotifyGive(s_flush_task);
+}
+
+bool cosmos_state_get(const char *pKey, uint32_t *pValue)
+{
+    bool found = false;
+
+    taskENTER_CRITICAL(&s_lock);
+    int idx = cosmos_state_find(pKey);
+    if (idx >= 0) {
+        *pValue = s_record[idx].value;
+        found = true;
+    }
+    taskEXIT_CRITICAL(&s_lock);
+
+    return found;
+}
+
+void cosmos_state_set(const char *pKey, uint32_t value)
+{
+    bool full = false, changed = false;
+    int64_t now = cosmos_state_now_ms();
+
+    taskENTER_CRITICAL(&s_lock);
+    int idx = cosmos_state_find(pKey);
+    if (idx < 0 && s_record_qty < COSMOS_STATE_MAX) {
+        idx = s_record_qty++;
+        memset(&s_record[idx], 0, sizeof(cosmos_state_record_t));
+        strncpy(s_record[idx].key, pKey, COSMOS_STATE_KEY_LEN);
+        s_record[idx].value = ~value;
+    }
+
+    if (idx < 0) {
+        full = true;
+    } else if (s_record[idx].value != value) {
+        s_record[idx].value = value;
+        if (!s_dirty)
+            s_first_dirty_ms = now;
+        s_last_change_ms = now;
+        s_dirty = true;
+        changed = true;
+    }
+    taskEXIT_CRITICAL(&s_lock);
+
+    if (full)
+        ESP_LOGE(TAG, "No room to keep the state of %s, raise COSMOS_STATE_MAX", pKey);
+    if (changed)
+        cosmos_state_arm();
+}
+
+esp_err_t cosmos_state_begin(void)
+{
+    nvs_handle_t handle;
+
+    if (s_timer) {
+        ESP_LOGE(TAG, "Already initialized");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    // Restore the states, a missing or malformed blob starts empty
+    if (nvs_open(COSMOS_STATE_NVS_NAMESPACE, NVS_READONLY, &handle) == ESP_OK) {
+        size_t len = 0;
+        if (nvs_get_blob(handle, COSMOS_STATE_NVS_KEY, NULL, &len) == ESP_OK && len <= sizeof(s_record) &&
+            len % sizeof(cosmos_state_record_t) == 0 && nvs_get_blob(handle, COSMOS_STATE_NVS_KEY, s_record, &len) == ESP_OK)
+            s_record_qty = len / sizeof(cosmos_state_record_t);
+        nvs_close(handle);
+    }
+
+    if (xTaskCreate(cosmos_state_flush_task, "cosmos_state", FLUSH_STACK_SIZE, NULL, FLUSH_PRIORITY, &s_flush_task) != pdPASS)
+        return ESP_ERR_NO_MEM;
+
+    const esp_timer_create_args_t timer_args = {
+        .callback = &cosmos_state_timer_cb,
+        .arg = NULL,
+        .name = "cosmos_state",
+    };
+    esp_err_t err = esp_timer_create(&timer_args, &s_timer);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to create timer for device states");
+        return err;
+    }
+
+    // Boot counts as a write, a boot loop can't wear the flash either
+    s_last_flush_ms = cosmos_state_now_ms();
+    ESP_LOGI(TAG, "%u device states restored", (unsigned)s_record_qty);
+
+    return ESP_OK;
+}
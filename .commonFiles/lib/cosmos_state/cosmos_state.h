@@ -0,0 +1,94 @@
+#ifndef MAIN_COSMOS_STATE_H_
+#define MAIN_COSMOS_STATE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define COSMOS_STATE_MAX             32    /*!< Device states kept, one record each in the blob */
+#define COSMOS_STATE_KEY_LEN         16    /*!< Key bytes kept, serial numbers are 13 characters */
+#define COSMOS_STATE_DEBOUNCE_MS     2000  /*!< Pending changes are written once the states are quiet this long */
+#define COSMOS_STATE_MAX_DELAY_MS    30000 /*!< ... but never later than this after the first pending change */
+#define COSMOS_STATE_MIN_INTERVAL_MS 10000 /*!< Writes are at least this far apart, whatever the toggling rate */
+#define COSMOS_STATE_NVS_NAMESPACE   "cosmos_state"
+
+/**
+ * @brief State of a device, as kept in RAM and in the blob
+ *
+ */
+typedef struct {
+    char key[COSMOS_STATE_KEY_LEN]; /*!< Serial number or module key, NUL padded */
+    uint32_t value;                 /*!< State, the module decides the encoding */
+} cosmos_state_record_t;
+
+/**
+ * @brief Loads the states saved in NVS. Call it once, after nvs_flash_init
+ * and before the modules restore their outputs, so every relay and light
+ * is back in its last state before the network comes up.
+ *
+ * @return esp_err_t - ESP_OK on success, also when nothing was saved yet
+ *                     ESP_ERR_INVALID_STATE if already initialized
+ *                     ESP_ERR_NO_MEM if the write task could not be created
+ *                     appropriate error code otherwise
+ */
+esp_err_t cosmos_state_begin(void);
+
+/**
+ * @brief Looks a restored state up
+ *
+ * @param pKey Serial number of the device
+ * @param pValue Output, only written if the state is known
+ * @return true if a state was saved for the key
+ */
+bool cosmos_state_get(const char *pKey, uint32_t *pValue);
+
+/**
+ * @brief Records the state of a device in RAM. Only changed values mark
+ * the blob dirty, which is written once the debounce delay expires.
+ * Safe to call from any task, it never touches flash.
+ *
+ * @param pKey Serial number of the device
+ * @param value New state
+ */
+void cosmos_state_set(const char *pKey, uint32_t value);
+
+/**
+ * @brief Writes the pending changes to NVS now, e.g. before a restart
+ *
+ * @return esp_err_t ESP_OK on success or if nothing is pending
+ */
+esp_err_t cosmos_state_flush(void);
+
+/**
+ * @brief When the pending changes are due. Quiet for COSMOS_STATE_DEBOUNCE_MS,
+ * capped at COSMOS_STATE_MAX_DELAY_MS from the first change, and never
+ * sooner than COSMOS_STATE_MIN_INTERVAL_MS after the last write. This bounds
+ * the flash writes to one per COSMOS_STATE_MIN_INTERVAL_MS under any load.
+ *
+ * @param first_dirty_ms First change since the last write
+ * @param last_change_ms Latest change
+ * @param last_flush_ms Last write
+ * @return int64_t Time at which the blob should be written
+ */
+static inline int64_t cosmos_state_due_ms(int64_t first_dirty_ms, int64_t last_change_ms, int64_t last_flush_ms)
+{
+    int64_t due = last_change_ms + COSMOS_STATE_DEBOUNCE_MS;
+
+    if (due > first_dirty_ms + COSMOS_STATE_MAX_DELAY_MS)
+        due = first_dirty_ms + COSMOS_STATE_MAX_DELAY_MS;
+    if (due < last_flush_ms + COSMOS_STATE_MIN_INTERVAL_MS)
+        due = last_flush_ms + COSMOS_STATE_MIN_INTERVAL_MS;
+
+    return due;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAIN_COSMOS_STATE_H_ */
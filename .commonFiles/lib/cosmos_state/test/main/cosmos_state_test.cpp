@@ -0,0 +1,116 @@
+/**
+ * @file cosmos_state_test.cpp
+ * @author Marcel Nahir Samur (mnsamur2014@gmail.com)
+ * @brief Replays toggling patterns against the cosmos_state write
+ *        policy and checks the flash writes stay bounded
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <cstdio>
+#include <vector>
+
+#include "cosmos_state.h"
+#include "cosmos_test.h"
+
+#define HOUR_MS (60 * 60 * 1000LL)
+
+/**
+ * @brief Same bookkeeping as cosmos_state.c, driven by a simulated clock
+ *
+ */
+struct sim_t {
+    bool dirty = false;
+    int64_t first_dirty_ms = 0;
+    int64_t last_change_ms = 0;
+    int64_t last_flush_ms = 0;
+    std::vector<int64_t> writes;
+
+    void change(int64_t now)
+    {
+        if (!dirty)
+            first_dirty_ms = now;
+        last_change_ms = now;
+        dirty = true;
+    }
+
+    void tick(int64_t now)
+    {
+        if (dirty && now >= cosmos_state_due_ms(first_dirty_ms, last_change_ms, last_flush_ms)) {
+            writes.push_back(now);
+            last_flush_ms = now;
+            dirty = false;
+        }
+    }
+};
+
+/**
+ * @brief Runs a toggling pattern for a while, then leaves the states quiet
+ *
+ * @param period_ms Time between changes, 0 for none
+ * @param busy_ms How long the changes go on
+ * @return sim_t Simulation with the writes done
+ */
+static sim_t run(int64_t period_ms, int64_t busy_ms)
+{
+    sim_t sim;
+
+    // Boot counts as a write, as in cosmos_state_begin
+    for (int64_t now = 0; now < busy_ms + HOUR_MS; now++) {
+        if (period_ms && now > 0 && now < busy_ms && now % period_ms == 0)
+            sim.change(now);
+        sim.tick(now);
+    }
+    return sim;
+}
+
+int main(void)
+{
+    // A single change well after boot is written once the debounce expires
+    {
+        sim_t sim;
+        for (int64_t now = 0; now < 5 * 60 * 1000; now++) {
+            if (now == 60000)
+                sim.change(now);
+            sim.tick(now);
+        }
+        CHECK(sim.writes.size() == 1 && sim.writes[0] == 60000 + COSMOS_STATE_DEBOUNCE_MS);
+    }
+
+    // A change right after boot waits for the minimum interval
+    {
+        sim_t sim;
+        sim.change(1000);
+        for (int64_t now = 1000; now < 60000; now++)
+            sim.tick(now);
+        CHECK(sim.writes.size() == 1 && sim.writes[0] == COSMOS_STATE_MIN_INTERVAL_MS);
+    }
+
+    // Toggling patterns, the write count is bounded whatever the rate
+    static const int64_t k_period_ms[] = {10, 100, 1000, 2500, 15000};
+    printf("%10s %12s %12s %12s\n", "period ms", "changes", "writes", "bound");
+    for (int64_t period_ms : k_period_ms) {
+        sim_t sim = run(period_ms, HOUR_MS);
+        int64_t changes = (HOUR_MS - 1) / period_ms;
+        size_t bound = HOUR_MS / COSMOS_STATE_MIN_INTERVAL_MS + 1;
+
+        printf("%10lld %12lld %12zu %12zu\n", (long long)period_ms, (long long)changes, sim.writes.size(), bound);
+        CHECK(sim.writes.size() <= bound);
+
+        for (size_t i = 1; i < sim.writes.size(); i++)
+            CHECK(sim.writes[i] - sim.writes[i - 1] >= COSMOS_STATE_MIN_INTERVAL_MS);
+
+        // The last state always reaches flash, at most the minimum interval after the toggling stops
+        CHECK(!sim.dirty);
+        CHECK(!sim.writes.empty() && sim.writes.back() <= HOUR_MS + COSMOS_STATE_MIN_INTERVAL_MS);
+
+        // Continuous toggling still saves a recent state, every COSMOS_STATE_MAX_DELAY_MS at worst
+        for (size_t i = 1; i < sim.writes.size() && period_ms < COSMOS_STATE_DEBOUNCE_MS; i++)
+            CHECK(sim.writes[i] - sim.writes[i - 1] <= COSMOS_STATE_MAX_DELAY_MS + period_ms);
+    }
+
+    return cosmos_test_report();
+}
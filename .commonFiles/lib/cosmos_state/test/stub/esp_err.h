@@ -0,0 +1,3 @@
+// Host stand-in for the ESP-IDF header, the test only uses the inline write policy of cosmos_state.h
+#pragma once
+typedef int esp_err_t;
@@ -0,0 +1,39 @@
+#ifndef COSMOS_TEST_H_
+#define COSMOS_TEST_H_
+
+/*
+ * Checks shared by the host (Linux) tests of the
+ * common libraries and the projects. A failed check
+ * is printed and counted, the test keeps running so
+ * one run reports every failure.
+ */
+
+#include <cstdio>
+
+static int s_failures = 0;
+
+#define CHECK(cond)                                                \
+    do {                                                           \
+        if (!(cond)) {                                             \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+            s_failures++;                                          \
+        }                                                          \
+    } while (0)
+
+/**
+ * @brief Prints the outcome of the checks, call it last from main
+ *
+ * @return int Exit code of the test, 0 if every check passed
+ */
+static inline int cosmos_test_report(void)
+{
+    if (s_failures) {
+        printf("%d check(s) failed\n", s_failures);
+        return 1;
+    }
+
+    printf("All checks passed\n");
+    return 0;
+}
+
+#endif /* COSMOS_TEST_H_ */
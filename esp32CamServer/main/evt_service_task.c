@@ -5,6 +5,7 @@
 
 #include <evt_service_task.h>
 #include <http_stream_task.h>
+#include <light_task.h>
 
 #define EVT_QUEUE_SIZE 32
 
@@ -28,14 +29,14 @@ static void evt_service_task_handler(void *pArg)
             case EVT_SOURCE_PIR:
                 if (evt.type == EVT_TYPE_TRIGGERED) {
                     ESP_LOGI(TAG, "Motion detected!");
-                    gpio_set_level(LED_PIN, 1);
+                    light_task_set_on(LED_LIGHT_IDX, true);
                 } else if (evt.type == EVT_TYPE_SUSTAINED) {
                     ESP_LOGI(TAG, "Motion sustained - stream active");
-                    gpio_set_level(LED_PIN, 1);
+                    light_task_set_on(LED_LIGHT_IDX, true);
                     http_stream_task_service_enabled(true);
                 } else if (evt.type == EVT_TYPE_CLEARED) {
                     ESP_LOGI(TAG, "Motion ended.");
-                    gpio_set_level(LED_PIN, 0);
+                    light_task_set_on(LED_LIGHT_IDX, false);
                     http_stream_task_service_enabled(false);
                 }
                 break;
@@ -53,7 +54,7 @@ static void evt_service_task_handler(void *pArg)
             case EVT_SOURCE_DOORBELL:
                 if (evt.type == EVT_TYPE_TRIGGERED) {
                     ESP_LOGI(TAG, "Doorbell pressed! Call requested.");
-                    gpio_set_level(LED_PIN, 1);
+                    light_task_set_on(LED_LIGHT_IDX, true);
                     http_stream_task_service_enabled(true);
                 }
                 break;
@@ -61,11 +62,11 @@ static void evt_service_task_handler(void *pArg)
             case EVT_SOURCE_INTERCOM:
                 if (evt.type == EVT_TYPE_TRIGGERED) {
                     ESP_LOGI(TAG, "Call started.");
-                    gpio_set_level(LED_PIN, 1);
+                    light_task_set_on(LED_LIGHT_IDX, true);
                     http_stream_task_service_enabled(true);
                 } else if (evt.type == EVT_TYPE_CLEARED) {
                     ESP_LOGI(TAG, "Call ended.");
-                    gpio_set_level(LED_PIN, 0);
+                    light_task_set_on(LED_LIGHT_IDX, false);
                     http_stream_task_service_enabled(false);
                 }
                 break;
@@ -99,16 +100,6 @@ esp_err_t evt_service_init(void)
         return ESP_ERR_NO_MEM;
     }
 
-    // LED config
-    gpio_config_t led_conf = {
-        .pin_bit_mask = (1ULL << LED_PIN),
-        .mode = GPIO_MODE_OUTPUT,
-        .pull_up_en = GPIO_PULLUP_DISABLE,
-        .pull_down_en = GPIO_PULLDOWN_DISABLE,
-        .intr_type = GPIO_INTR_DISABLE};
-    gpio_config(&led_conf);
-    gpio_set_level(LED_PIN, 0);
-
     // Create event handling task
     BaseType_t ret = xTaskCreatePinnedToCore(
         evt_service_task_handler,
@@ -0,0 +1,665 @@
+/**
+ * @file light_task.cpp
+ * @author Marcel Nahir Samur (mnsamur2014@gmail.com)
+ * @brief Matter dimmable and extended color light endpoints driven by cosmos_light
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <string.h>
+
+#include <app-common/zap-generated/cluster-objects.h>
+
+#include <cosmos_light_color.h>
+#include <light_task.h>
+
+using namespace chip::app::Clusters;
+using namespace esp_matter;
+using namespace esp_matter::endpoint;
+
+static const char *TAG = "light_task";
+
+/**
+ * @brief Matter state of a light, what the LEDC is asked to show
+ *
+ */
+typedef struct {
+    bool on;                /*!< OnOff */
+    bool color;             /*!< Extended color light, otherwise single channel */
+    uint8_t level;          /*!< CurrentLevel */
+    uint8_t color_mode;     /*!< ColorMode, ColorControl::ColorModeEnum */
+    uint8_t hue;            /*!< CurrentHue */
+    uint8_t sat;            /*!< CurrentSaturation */
+    uint16_t x;             /*!< CurrentX */
+    uint16_t y;             /*!< CurrentY */
+    uint16_t mireds;        /*!< ColorTemperatureMireds */
+    uint16_t transition_ds; /*!< Transition of the next flush, set by a command */
+    int64_t level_end_us;   /*!< The hardware is fading the level until then, SDK steps are absorbed */
+    int64_t color_end_us;   /*!< Same for the color attributes */
+    bool dirty;             /*!< Changed since the last flush */
+} light_task_state_t;
+
+typedef struct {
+    light_config_t *config;
+    uint16_t first_endpoint_id;
+    light_task_state_t state[LIGHT_TASK_LIGHT_MAX];
+    esp_timer_handle_t flush_timer;
+    int64_t last_flush_us;
+    uint16_t recall_group_id; /*!< Last RecallScene, a group recall reaches every light endpoint */
+    uint8_t recall_scene_id;
+    int64_t recall_us;
+    bool is_initialized;
+} light_task_ctx_t;
+
+static light_task_ctx_t s_ctx;
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+
+/**
+ * @brief Index of the light of an endpoint. Endpoints are created back to
+ * back, so this is a subtraction and a bounds check.
+ *
+ * @param endpoint_id Endpoint ID
+ * @return int Index in light_config_t::pLight, -1 if it isn't a light
+ */
+static inline int light_task_index(uint16_t endpoint_id)
+{
+    uint16_t idx = endpoint_id - s_ctx.first_endpoint_id;
+    return (s_ctx.is_initialized && idx < s_ctx.config->qty) ? idx : -1;
+}
+
+/**
+ * @brief CurrentLevel of a restored command, the inverse of cosmos_light_color_bright.
+ *        An off or never saved command keeps no level, the light then
+ *        turns on at full brightness instead of the minimum.
+ *
+ * @param pCmd Command of the light
+ * @return uint8_t CurrentLevel, 1 .. COSMOS_LIGHT_COLOR_LEVEL_MAX
+ */
+static inline uint8_t light_task_level(const cosmos_light_cmd_t *pCmd)
+{
+    if (pCmd->bright == 0)
+        return COSMOS_LIGHT_COLOR_LEVEL_MAX;
+
+    return (uint8_t)((pCmd->bright * COSMOS_LIGHT_COLOR_LEVEL_MAX + 127U) / 255);
+}
+
+/**
+ * @brief Builds the cosmos_light command of a Matter state
+ *
+ * @param pState Matter state
+ * @param pCmd Output
+ */
+static void light_task_cmd(const light_task_state_t *pState, cosmos_light_cmd_t *pCmd)
+{
+    if (!pState->on) {
+        memset(pCmd, 0, sizeof(*pCmd));
+        return;
+    }
+
+    pCmd->bright = cosmos_light_color_bright(pState->level);
+    pCmd->r = 100;
+    pCmd->g = 0;
+    pCmd->b = 0;
+
+    if (!pState->color)
+        return;
+
+    switch (pState->color_mode) {
+    case chip::to_underlying(ColorControl::ColorModeEnum::kCurrentHueAndCurrentSaturation):
+        cosmos_light_color_hs(pState->hue, pState->sat, pCmd);
+        break;
+    case chip::to_underlying(ColorControl::ColorModeEnum::kCurrentXAndCurrentY):
+        cosmos_light_color_xy(pState->x, pState->y, pCmd);
+        break;
+    default:
+        cosmos_light_color_ct(pState->mireds, pCmd);
+        break;
+    }
+}
+
+/**
+ * @brief Flush timer callback, applies the last state of every light changed
+ * in the window. Only this callback touches the LEDC, so it never races.
+ *
+ * @param pArg Not used
+ */
+static void light_task_flush_cb(void *pArg)
+{
+    cosmos_light_info_t *pLight = s_ctx.config->pLight;
+    light_task_state_t state;
+    cosmos_light_cmd_t cmd;
+
+    for (size_t idx = 0; idx < s_ctx.config->qty; idx++) {
+        taskENTER_CRITICAL(&s_lock);
+        state = s_ctx.state[idx];
+        s_ctx.state[idx].dirty = false;
+        s_ctx.state[idx].transition_ds = 0;
+        taskEXIT_CRITICAL(&s_lock);
+
+        if (!state.dirty)
+            continue;
+
+        // The last step of a transition lands on the values the fade already went to
+        light_task_cmd(&state, &cmd);
+        if (memcmp(&cmd, &pLight[idx].cmd, sizeof(cmd)) == 0)
+            continue;
+
+        cosmos_light_fade_cmd(pLight[idx].pDevice->sn, &cmd, state.transition_ds, pLight, s_ctx.config->qty);
+    }
+
+    taskENTER_CRITICAL(&s_lock);
+    s_ctx.last_flush_us = esp_timer_get_time();
+    taskEXIT_CRITICAL(&s_lock);
+}
+
+/**
+ * @brief Marks a light as changed and arms the flush. The first change after
+ * a quiet window is applied right away, the ones that follow inside the window
+ * are merged into a single flush at its end.
+ *
+ * @param idx Index of the light
+ */
+static void light_task_schedule(int idx)
+{
+    int64_t wait_us;
+
+    taskENTER_CRITICAL(&s_lock);
+    s_ctx.state[idx].dirty = true;
+    wait_us = s_ctx.last_flush_us + LIGHT_TASK_COALESCE_MS * 1000 - esp_timer_get_time();
+    taskEXIT_CRITICAL(&s_lock);
+
+    if (esp_timer_is_active(s_ctx.flush_timer))
+        return;
+
+    esp_timer_start_once(s_ctx.flush_timer, wait_us > 0 ? wait_us : 0);
+}
+
+/**
+ * @brief Effective transition of a command, in tenths of a second
+ *
+ * @param transition_ds TransitionTime, COSMOS_LIGHT_TRANSITION_DEFAULT if null
+ * @return int64_t Duration in microseconds
+ */
+static inline int64_t light_task_transition_us(uint16_t transition_ds)
+{
+    return (int64_t)(transition_ds == COSMOS_LIGHT_TRANSITION_DEFAULT ? COSMOS_LIGHT_DEFAULT_TRANSITION_DS : transition_ds) * 100000;
+}
+
+/**
+ * @brief User callback of the level and color commands that carry a target and
+ * a TransitionTime. The target is applied as one hardware fade, the Matter SDK
+ * keeps stepping the attribute for the controllers.
+ *
+ * @param command_path Endpoint, cluster and command
+ * @param tlv_data Command fields, left untouched for the SDK handler
+ * @param opaque_ptr Not used
+ * @return esp_err_t ESP_OK, a command that doesn't decode is left to the SDK to reject
+ */
+static esp_err_t light_task_command_cb(const chip::app::ConcreteCommandPath &command_path, chip::TLV::TLVReader &tlv_data,
+                                       void *opaque_ptr)
+{
+    int idx = light_task_index(command_path.mEndpointId);
+    if (idx < 0)
+        return ESP_OK;
+
+    chip::TLV::TLVReader reader;
+    reader.Init(tlv_data);
+
+    light_task_state_t next;
+    taskENTER_CRITICAL(&s_lock);
+    next = s_ctx.state[idx];
+    taskEXIT_CRITICAL(&s_lock);
+
+    uint16_t transition_ds;
+    bool level = false;
+
+    if (command_path.mClusterId == LevelControl::Id) {
+        LevelControl::Commands::MoveToLevel::DecodableType cmd;
+        if (chip::app::DataModel::Decode(reader, cmd) != CHIP_NO_ERROR)
+            return ESP_OK;
+
+        // MoveToLevelWithOnOff has the same fields
+        next.level = cmd.level;
+        transition_ds = cmd.transitionTime.IsNull() ? COSMOS_LIGHT_TRANSITION_DEFAULT : cmd.transitionTime.Value();
+        level = true;
+    } else {
+        switch (command_path.mCommandId) {
+        case ColorControl::Commands::MoveToHue::Id: {
+            ColorControl::Commands::MoveToHue::DecodableType cmd;
+            if (chip::app::DataModel::Decode(reader, cmd) != CHIP_NO_ERROR)
+                return ESP_OK;
+            next.hue = cmd.hue;
+            next.color_mode = chip::to_underlying(ColorControl::ColorModeEnum::kCurrentHueAndCurrentSaturation);
+            transition_ds = cmd.transitionTime;
+            break;
+        }
+        case ColorControl::Commands::MoveToSaturation::Id: {
+            ColorControl::Commands::MoveToSaturation::DecodableType cmd;
+            if (chip::app::DataModel::Decode(reader, cmd) != CHIP_NO_ERROR)
+                return ESP_OK;
+            next.sat = cmd.saturation;
+            next.color_mode = chip::to_underlying(ColorControl::ColorModeEnum::kCurrentHueAndCurrentSaturation);
+            transition_ds = cmd.transitionTime;
+            break;
+        }
+        case ColorControl::Commands::MoveToHueAndSaturation::Id: {
+            ColorControl::Commands::MoveToHueAndSaturation::DecodableType cmd;
+            if (chip::app::DataModel::Decode(reader, cmd) != CHIP_NO_ERROR)
+                return ESP_OK;
+            next.hue = cmd.hue;
+            next.sat = cmd.saturation;
+            next.color_mode = chip::to_underlying(ColorControl::ColorModeEnum::kCurrentHueAndCurrentSaturation);
+            transition_ds = cmd.transitionTime;
+            break;
+        }
+        case ColorControl::Commands::MoveToColor::Id: {
+            ColorControl::Commands::MoveToColor::DecodableType cmd;
+            if (chip::app::DataModel::Decode(reader, cmd) != CHIP_NO_ERROR)
+                return ESP_OK;
+            next.x = cmd.colorX;
+            next.y = cmd.colorY;
+            next.color_mode = chip::to_underlying(ColorControl::ColorModeEnum::kCurrentXAndCurrentY);
+            transition_ds = cmd.transitionTime;
+            break;
+        }
+        case ColorControl::Commands::MoveToColorTemperature::Id: {
+            ColorControl::Commands::MoveToColorTemperature::DecodableType cmd;
+            if (chip::app::DataModel::Decode(reader, cmd) != CHIP_NO_ERROR)
+                return ESP_OK;
+            next.mireds = cmd.colorTemperatureMireds;
+            next.color_mode = chip::to_underlying(ColorControl::ColorModeEnum::kColorTemperatureMireds);
+            transition_ds = cmd.transitionTime;
+            break;
+        }
+        default:
+            return ESP_OK;
+        }
+    }
+
+    int64_t end_us = esp_timer_get_time() + light_task_transition_us(transition_ds);
+
+    taskENTER_CRITICAL(&s_lock);
+    light_task_state_t *pState = &s_ctx.state[idx];
+    pState->level = next.level;
+    pState->color_mode = next.color_mode;
+    pState->hue = next.hue;
+    pState->sat = next.sat;
+    pState->x = next.x;
+    pState->y = next.y;
+    pState->mireds = next.mireds;
+    pState->transition_ds = transition_ds;
+    if (level)
+        pState->level_end_us = end_us;
+    else
+        pState->color_end_us = end_us;
+    taskEXIT_CRITICAL(&s_lock);
+
+    ESP_LOGD(TAG, "Light %d fades over %u ds", idx, transition_ds);
+    light_task_schedule(idx);
+    return ESP_OK;
+}
+
+/**
+ * @brief User callback of the Scenes Management commands. StoreScene captures
+ * every light into a cosmos_light scene and RecallScene commits it in one pass,
+ * so the fixtures change together. The SDK keeps handling the scene table, its
+ * attribute writes land on the values the commit already went to.
+ *
+ * @param command_path Endpoint, cluster and command
+ * @param tlv_data Command fields, left untouched for the SDK handler
+ * @param opaque_ptr Not used
+ * @return esp_err_t ESP_OK, a command that doesn't decode is left to the SDK to reject
+ */
+static esp_err_t light_task_scene_cb(const chip::app::ConcreteCommandPath &command_path, chip::TLV::TLVReader &tlv_data,
+                                     void *opaque_ptr)
+{
+    int idx = light_task_index(command_path.mEndpointId);
+    if (idx < 0)
+        return ESP_OK;
+
+    cosmos_light_info_t *pLight = s_ctx.config->pLight;
+    size_t qty = s_ctx.config->qty;
+
+    chip::TLV::TLVReader reader;
+    reader.Init(tlv_data);
+
+    switch (command_path.mCommandId) {
+    case ScenesManagement::Commands::StoreScene::Id: {
+        ScenesManagement::Commands::StoreScene::DecodableType cmd;
+        if (chip::app::DataModel::Decode(reader, cmd) != CHIP_NO_ERROR)
+            return ESP_OK;
+
+        cosmos_light_scene_t scene;
+        cosmos_light_scene_capture(&scene, pLight, qty);
+        if (cosmos_light_scene_store(cmd.groupID, cmd.sceneID, &scene) != ESP_OK)
+            ESP_LOGW(TAG, "No room to keep scene %u of group %u", cmd.sceneID, cmd.groupID);
+        break;
+    }
+    case ScenesManagement::Commands::RecallScene::Id: {
+        ScenesManagement::Commands::RecallScene::DecodableType cmd;
+        if (chip::app::DataModel::Decode(reader, cmd) != CHIP_NO_ERROR)
+            return ESP_OK;
+
+        // TransitionTime is in ms here, null or missing uses the default
+        uint16_t transition_ds = COSMOS_LIGHT_TRANSITION_DEFAULT;
+        if (cmd.transitionTime.HasValue() && !cmd.transitionTime.Value().IsNull()) {
+            uint32_t ds = cmd.transitionTime.Value().Value() / 100;
+            transition_ds = ds < COSMOS_LIGHT_TRANSITION_DEFAULT ? ds : COSMOS_LIGHT_TRANSITION_DEFAULT - 1;
+        }
+
+        int64_t now_us = esp_timer_get_time();
+
+        // The scene holds every light, the same recall on the next endpoints is already done
+        taskENTER_CRITICAL(&s_lock);
+        bool repeat = cmd.groupID == s_ctx.recall_group_id && cmd.sceneID == s_ctx.recall_scene_id &&
+                      now_us - s_ctx.recall_us < LIGHT_TASK_COALESCE_MS * 1000;
+        s_ctx.recall_group_id = cmd.groupID;
+        s_ctx.recall_scene_id = cmd.sceneID;
+        s_ctx.recall_us = now_us;
+        taskEXIT_CRITICAL(&s_lock);
+        if (repeat)
+            break;
+
+        // Scenes added with AddScene are only in the SDK table, its attribute writes apply them
+        if (cosmos_light_scene_recall(cmd.groupID, cmd.sceneID, transition_ds, pLight, qty) != ESP_OK)
+            break;
+
+        // The hardware fades every light, the SDK steps towards the scene are absorbed
+        int64_t end_us = now_us + light_task_transition_us(transition_ds);
+        taskENTER_CRITICAL(&s_lock);
+        for (size_t i = 0; i < qty; i++) {
+            s_ctx.state[i].level_end_us = end_us;
+            s_ctx.state[i].color_end_us = end_us;
+        }
+        taskEXIT_CRITICAL(&s_lock);
+        break;
+    }
+    case ScenesManagement::Commands::RemoveScene::Id: {
+        ScenesManagement::Commands::RemoveScene::DecodableType cmd;
+        if (chip::app::DataModel::Decode(reader, cmd) != CHIP_NO_ERROR)
+            return ESP_OK;
+
+        cosmos_light_scene_remove(cmd.groupID, cmd.sceneID);
+        break;
+    }
+    case ScenesManagement::Commands::RemoveAllScenes::Id: {
+        ScenesManagement::Commands::RemoveAllScenes::DecodableType cmd;
+        if (chip::app::DataModel::Decode(reader, cmd) != CHIP_NO_ERROR)
+            return ESP_OK;
+
+        for (uint16_t scene_id = 0; scene_id <= UINT8_MAX; scene_id++)
+            cosmos_light_scene_remove(cmd.groupID, scene_id);
+        break;
+    }
+    default:
+        break;
+    }
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Hooks light_task_command_cb and light_task_scene_cb to the commands of an endpoint
+ *
+ * @param endpoint_id Endpoint of the light
+ * @param color true for an extended color light
+ */
+static void light_task_hook_commands(uint16_t endpoint_id, bool color)
+{
+    static const uint32_t level_cmd[] = {
+        LevelControl::Commands::MoveToLevel::Id,
+        LevelControl::Commands::MoveToLevelWithOnOff::Id,
+    };
+    static const uint32_t scene_cmd[] = {
+        ScenesManagement::Commands::StoreScene::Id,
+        ScenesManagement::Commands::RecallScene::Id,
+        ScenesManagement::Commands::RemoveScene::Id,
+        ScenesManagement::Commands::RemoveAllScenes::Id,
+    };
+    static const uint32_t color_cmd[] = {
+        ColorControl::Commands::MoveToHue::Id,
+        ColorControl::Commands::MoveToSaturation::Id,
+        ColorControl::Commands::MoveToHueAndSaturation::Id,
+        ColorControl::Commands::MoveToColor::Id,
+        ColorControl::Commands::MoveToColorTemperature::Id,
+    };
+    command_t *pCommand;
+
+    for (size_t i = 0; i < sizeof(level_cmd) / sizeof(level_cmd[0]); i++) {
+        pCommand = command::get(endpoint_id, LevelControl::Id, level_cmd[i]);
+        if (pCommand)
+            command::set_user_callback(pCommand, light_task_command_cb);
+    }
+
+    for (size_t i = 0; i < sizeof(scene_cmd) / sizeof(scene_cmd[0]); i++) {
+        pCommand = command::get(endpoint_id, ScenesManagement::Id, scene_cmd[i]);
+        if (pCommand)
+            command::set_user_callback(pCommand, light_task_scene_cb);
+    }
+
+    if (!color)
+        return;
+
+    for (size_t i = 0; i < sizeof(color_cmd) / sizeof(color_cmd[0]); i++) {
+        pCommand = command::get(endpoint_id, ColorControl::Id, color_cmd[i]);
+        if (pCommand)
+            command::set_user_callback(pCommand, light_task_command_cb);
+    }
+}
+
+/**
+ * @brief Copies the color attributes of a new endpoint into its state
+ *
+ * @param endpoint_id Endpoint of the light
+ * @param pState State of the light
+ */
+static void light_task_seed_color(uint16_t endpoint_id, light_task_state_t *pState)
+{
+    esp_matter_attr_val_t val = esp_matter_invalid(NULL);
+    attribute_t *attribute;
+
+    attribute = attribute::get(endpoint_id, ColorControl::Id, ColorControl::Attributes::ColorMode::Id);
+    if (attribute && attribute::get_val(attribute, &val) == ESP_OK)
+        pState->color_mode = val.val.u8;
+    attribute = attribute::get(endpoint_id, ColorControl::Id, ColorControl::Attributes::CurrentHue::Id);
+    if (attribute && attribute::get_val(attribute, &val) == ESP_OK)
+        pState->hue = val.val.u8;
+    attribute = attribute::get(endpoint_id, ColorControl::Id, ColorControl::Attributes::CurrentSaturation::Id);
+    if (attribute && attribute::get_val(attribute, &val) == ESP_OK)
+        pState->sat = val.val.u8;
+    attribute = attribute::get(endpoint_id, ColorControl::Id, ColorControl::Attributes::CurrentX::Id);
+    if (attribute && attribute::get_val(attribute, &val) == ESP_OK)
+        pState->x = val.val.u16;
+    attribute = attribute::get(endpoint_id, ColorControl::Id, ColorControl::Attributes::CurrentY::Id);
+    if (attribute && attribute::get_val(attribute, &val) == ESP_OK)
+        pState->y = val.val.u16;
+    attribute = attribute::get(endpoint_id, ColorControl::Id, ColorControl::Attributes::ColorTemperatureMireds::Id);
+    if (attribute && attribute::get_val(attribute, &val) == ESP_OK)
+        pState->mireds = val.val.u16;
+}
+
+/**
+ * @brief Creates the endpoint of a light, seeded with its restored command
+ *
+ * @param node Matter node
+ * @param pLight Light
+ * @param color true for an extended color light
+ * @return endpoint_t* Endpoint, NULL on failure
+ */
+static endpoint_t *light_task_create_endpoint(node_t *node, const cosmos_light_info_t *pLight, bool color)
+{
+    bool on = !cosmos_light_cmd_is_off(&pLight->cmd);
+    uint8_t level = light_task_level(&pLight->cmd);
+
+    if (!color) {
+        dimmable_light::config_t light_config;
+        light_config.on_off.on_off = on;
+        light_config.level_control.current_level = level;
+        return dimmable_light::create(node, &light_config, ENDPOINT_FLAG_NONE, NULL);
+    }
+
+    extended_color_light::config_t light_config;
+    light_config.on_off.on_off = on;
+    light_config.level_control.current_level = level;
+    endpoint_t *pEndpoint = extended_color_light::create(node, &light_config, ENDPOINT_FLAG_NONE, NULL);
+    if (!pEndpoint)
+        return NULL;
+
+    // Color temperature and xy come with the device type, hue and saturation are added
+    cluster_t *pCluster = cluster::get(pEndpoint, ColorControl::Id);
+    cluster::color_control::feature::hue_saturation::config_t hs_config;
+    cluster::color_control::feature::hue_saturation::add(pCluster, &hs_config);
+    return pEndpoint;
+}
+
+esp_err_t light_task_attribute_update(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id, esp_matter_attr_val_t *val)
+{
+    int idx = light_task_index(endpoint_id);
+    if (idx < 0)
+        return ESP_ERR_INVALID_ARG;
+
+    int64_t now_us = esp_timer_get_time();
+    bool changed = true;
+
+    taskENTER_CRITICAL(&s_lock);
+    light_task_state_t *pState = &s_ctx.state[idx];
+
+    if (cluster_id == OnOff::Id && attribute_id == OnOff::Attributes::OnOff::Id) {
+        pState->on = val->val.b;
+    } else if (cluster_id == LevelControl::Id && attribute_id == LevelControl::Attributes::CurrentLevel::Id) {
+        // Steps of a transition the hardware is already fading
+        if (now_us < pState->level_end_us)
+            changed = false;
+        else
+            pState->level = val->val.u8;
+    } else if (cluster_id == ColorControl::Id) {
+        if (attribute_id == ColorControl::Attributes::ColorMode::Id) {
+            pState->color_mode = val->val.u8;
+        } else if (now_us < pState->color_end_us) {
+            changed = false;
+        } else if (attribute_id == ColorControl::Attributes::CurrentHue::Id) {
+            pState->hue = val->val.u8;
+        } else if (attribute_id == ColorControl::Attributes::CurrentSaturation::Id) {
+            pState->sat = val->val.u8;
+        } else if (attribute_id == ColorControl::Attributes::CurrentX::Id) {
+            pState->x = val->val.u16;
+        } else if (attribute_id == ColorControl::Attributes::CurrentY::Id) {
+            pState->y = val->val.u16;
+        } else if (attribute_id == ColorControl::Attributes::ColorTemperatureMireds::Id) {
+            pState->mireds = val->val.u16;
+        } else {
+            changed = false;
+        }
+    } else {
+        changed = false;
+    }
+    taskEXIT_CRITICAL(&s_lock);
+
+    if (changed)
+        light_task_schedule(idx);
+    return ESP_OK;
+}
+
+bool light_task_is_light(uint16_t endpoint_id)
+{
+    return light_task_index(endpoint_id) >= 0;
+}
+
+esp_err_t light_task_set_on(size_t light_idx, bool on)
+{
+    if (!s_ctx.is_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (light_idx >= s_ctx.config->qty) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    uint16_t endpoint_id = s_ctx.first_endpoint_id + light_idx;
+
+    /*
+     * ScheduleLambda drops the work queued before esp_matter::start.
+     * Until then the attribute is set in place, there is no one to
+     * report it to yet, and the light goes through the same flush
+     */
+    if (!esp_matter::is_started()) {
+        esp_matter_attr_val_t val = esp_matter_bool(on);
+        attribute_t *attribute = attribute::get(endpoint_id, OnOff::Id, OnOff::Attributes::OnOff::Id);
+        if (attribute)
+            attribute::set_val(attribute, &val);
+
+        taskENTER_CRITICAL(&s_lock);
+        s_ctx.state[light_idx].on = on;
+        taskEXIT_CRITICAL(&s_lock);
+
+        light_task_schedule(light_idx);
+        return ESP_OK;
+    }
+
+    // schedule the attribute update so that we can report it from matter thread
+    chip::DeviceLayer::SystemLayer().ScheduleLambda([endpoint_id, on]() {
+        esp_matter_attr_val_t val = esp_matter_bool(on);
+        attribute::update(endpoint_id, OnOff::Id, OnOff::Attributes::OnOff::Id, &val);
+    });
+    return ESP_OK;
+}
+
+esp_err_t light_task_init(node_t *node, light_config_t *pConfig)
+{
+    if (node == NULL || pConfig == NULL || pConfig->pLight == NULL || pConfig->qty > LIGHT_TASK_LIGHT_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_ctx.is_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    const esp_timer_create_args_t timer_args = {
+        .callback = light_task_flush_cb,
+        .arg = NULL,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "light_flush",
+        .skip_unhandled_events = true,
+    };
+    esp_err_t err = esp_timer_create(&timer_args, &s_ctx.flush_timer);
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    for (size_t idx = 0; idx < pConfig->qty; idx++) {
+        cosmos_light_info_t *pLight = &pConfig->pLight[idx];
+        bool color = strpbrk(pLight->pDevice->sn, "c") != NULL;
+
+        endpoint_t *pEndpoint = light_task_create_endpoint(node, pLight, color);
+        if (!pEndpoint) {
+            ESP_LOGE(TAG, "Failed to create endpoint of %s", pLight->pDevice->sn);
+            return ESP_FAIL;
+        }
+
+        uint16_t endpoint_id = endpoint::get_id(pEndpoint);
+        if (idx == 0) {
+            s_ctx.first_endpoint_id = endpoint_id;
+        } else if (endpoint_id != s_ctx.first_endpoint_id + idx) {
+            // The table lookup needs the light endpoints back to back
+            ESP_LOGE(TAG, "Endpoint %u of %s is not contiguous", endpoint_id, pLight->pDevice->sn);
+            return ESP_FAIL;
+        }
+
+        light_task_state_t *pState = &s_ctx.state[idx];
+        pState->on = !cosmos_light_cmd_is_off(&pLight->cmd);
+        pState->color = color;
+        pState->level = light_task_level(&pLight->cmd);
+        if (color)
+            light_task_seed_color(endpoint_id, pState);
+
+        light_task_hook_commands(endpoint_id, color);
+        ESP_LOGI(TAG, "%s on endpoint %u (%s)", pLight->pDevice->sn, endpoint_id, color ? "extended color" : "dimmable");
+    }
+
+    s_ctx.config = pConfig;
+    s_ctx.is_initialized = true;
+    return ESP_OK;
+}
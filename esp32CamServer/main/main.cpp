@@ -21,11 +21,17 @@
 #include <esp_matter.h>
 #include <esp_matter_ota.h>
 
+// Include common libraries
+#include <cosmos_devices.h>
+#include <cosmos_light.h>
+#include <cosmos_state.h>
+
 // Include project libraries
 #include <cam_task.h>
 #include <door_intercom_task.h>
 #include <evt_service_task.h>
 #include <http_stream_task.h>
+#include <light_task.h>
 #include <matter_task.h>
 #include <security_module_task.h>
 
@@ -41,6 +47,15 @@ uint16_t intercom_endpoint_id = 0;
 uint16_t doorlock_endpoint_id = 0;
 httpd_handle_t cam_server;
 
+// Board LED, 20 kHz so it doesn't band on the camera sensor
+static cosmos_devices_t led_device = {.sn = "LSCw-0000-001", .pin = {LED_PIN, 0, 0}, .state = 0};
+static cosmos_light_info_t light[] = {
+    {.pDevice = &led_device, .profile = COSMOS_LIGHT_PROFILE_FLICKER_FREE},
+};
+static const cosmos_devices_group_t devices[] = {
+    {DEVICE_TYPE_LSC, &cosmos_light_handler, light, sizeof(light) / sizeof(light[0]), NULL},
+};
+
 // Function declarations
 static void occupancy_sensor_notification(uint16_t endpoint_id, bool occupancy, void *user_data);
 static void doorbell_notification(uint16_t endpoint_id, bool pressed, void *user_data);
@@ -63,6 +78,13 @@ extern "C" void app_main()
         return;
     }
 
+    // Restore the saved device states
+    err = cosmos_state_begin();
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "cosmos_state_begin failed: %d", err);
+        return;
+    }
+
     // Initialize GPIO ISR service
     err = gpio_install_isr_service(0);
     if (err != ESP_OK) {
@@ -77,10 +99,10 @@ extern "C" void app_main()
         return;
     }
 
-    // Initialize event service
-    err = evt_service_init();
+    // Set up the lights after the camera, its XCLK keeps low speed LEDC timer 0 and channel 0 out of the light pools
+    err = cosmos_devices_registry_begin(devices, sizeof(devices) / sizeof(devices[0]));
     if (err != ESP_OK) {
-        ESP_LOGE(TAG, "evt_service_init failed: %d", err);
+        ESP_LOGE(TAG, "cosmos_devices_registry_begin failed: %d", err);
         return;
     }
 
@@ -125,13 +147,6 @@ extern "C" void app_main()
         .user_data = NULL,
     };
 
-    // Initialize security module driver
-    err = security_module_task_init(&sec_mod_config);
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "security_module_init failed: %d", err);
-        return;
-    }
-
     // Add generic switch (for doorbell)
     on_off_light_switch::config_t doorbell_config;
 
@@ -151,6 +166,32 @@ extern "C" void app_main()
         .user_data = NULL,
     };
 
+    // Add the light endpoints (board LED)
+    static light_config_t light_config = {
+        .pLight = light,
+        .qty = sizeof(light) / sizeof(light[0]),
+    };
+
+    err = light_task_init(node, &light_config);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "light_task_init failed: %d", err);
+        return;
+    }
+
+    // Initialize event service once the LED it drives is set up, the event sources start after it
+    err = evt_service_init();
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "evt_service_init failed: %d", err);
+        return;
+    }
+
+    // Initialize security module driver
+    err = security_module_task_init(&sec_mod_config);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "security_module_init failed: %d", err);
+        return;
+    }
+
     // Initialize security module driver
     err = door_intercom_task_init(&door_intercom_config);
     if (err != ESP_OK) {
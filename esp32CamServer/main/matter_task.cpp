@@ -10,7 +10,10 @@
  */
 #include <esp_log.h>
 
+#include <cosmos_mqtt.h>
+
 #include <door_intercom_task.h>
+#include <light_task.h>
 #include <matter_task.h>
 
 static const char *TAG = "matter_task";
@@ -22,11 +25,40 @@ using namespace chip::app::Clusters;
 
 constexpr auto k_timeout_seconds = 300;
 
+/**
+ * @brief Starts the MQTT transport of the cosmos devices, which also starts
+ *        the task that publishes their state changes. Called once the network
+ *        is up, the transport reconnects by itself so later calls do nothing.
+ *
+ */
+static void matter_task_mqtt_begin(void)
+{
+    static const cosmos_mqtt_config_t mqtt_config = {
+        .host = MATTER_TASK_MQTT_HOST,
+        .client_id = MATTER_TASK_MQTT_CLIENT_ID,
+        .port = 0,
+        .keepalive_s = 0,
+    };
+    static bool started = false;
+
+    if (started) {
+        return;
+    }
+
+    esp_err_t err = cosmos_mqtt_begin(&mqtt_config);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "cosmos_mqtt_begin failed: %d", err);
+        return;
+    }
+    started = true;
+}
+
 void app_event_cb(const ChipDeviceEvent *event, intptr_t arg)
 {
     switch (event->Type) {
     case chip::DeviceLayer::DeviceEventType::kInterfaceIpAddressChanged:
         ESP_LOGI(TAG, "Interface IP Address changed");
+        matter_task_mqtt_begin();
         break;
 
     case chip::DeviceLayer::DeviceEventType::kCommissioningComplete:
@@ -107,8 +139,12 @@ esp_err_t app_attribute_update_cb(attribute::callback_type_t type, uint16_t endp
 
     if (type == PRE_UPDATE) {
         /* Driver update */
-        door_intercom_task_handle_t door_intercom_task_handle = (door_intercom_task_handle_t)priv_data;
-        err = door_intercom_attribute_update(door_intercom_task_handle, endpoint_id, cluster_id, attribute_id, val);
+        if (light_task_is_light(endpoint_id)) {
+            err = light_task_attribute_update(endpoint_id, cluster_id, attribute_id, val);
+        } else {
+            door_intercom_task_handle_t door_intercom_task_handle = (door_intercom_task_handle_t)priv_data;
+            err = door_intercom_attribute_update(door_intercom_task_handle, endpoint_id, cluster_id, attribute_id, val);
+        }
     }
 
     return err;
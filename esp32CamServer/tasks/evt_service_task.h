@@ -9,6 +9,7 @@ extern "C" {
 #include <esp_err.h>
 
 #define LED_PIN          GPIO_NUM_21
+#define LED_LIGHT_IDX    0 // Index of the LED_PIN light in light_config_t
 #define DEBOUNCE_TIME_MS 200
 
 #define EVT_SERVICE_TASK_STACK_SIZE 3072
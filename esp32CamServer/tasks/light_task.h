@@ -0,0 +1,87 @@
+#ifndef LIGHT_TASK_H_
+#define LIGHT_TASK_H_
+
+#include <esp_err.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <cosmos_light.h>
+
+#define LIGHT_TASK_LIGHT_MAX   8  /*!< Lights the adapter can expose, one endpoint each */
+#define LIGHT_TASK_COALESCE_MS 20 /*!< Changes of a light inside this window reach the LEDC once, with the last values */
+
+#ifdef __cplusplus
+
+#include <esp_matter.h>
+
+/**
+ * @brief Configuration structure for the Matter light adapter
+ *
+ */
+typedef struct {
+    cosmos_light_info_t *pLight; /*!< Lights, already registered in cosmos_devices. 'c' lights become extended color lights, the rest dimmable lights */
+    size_t qty;                  /*!< Quantity of lights, up to LIGHT_TASK_LIGHT_MAX */
+} light_config_t;
+
+/**
+ * @brief Creates one endpoint per light, back to back so the endpoint of a light
+ *        is found by subtracting the first one. The transition of the level and
+ *        color commands is handed to the LEDC hardware fades, the steps the Matter
+ *        SDK writes while the transition runs are absorbed. StoreScene and
+ *        RecallScene of the Scenes Management cluster go to the cosmos_light
+ *        scenes, so every light of a scene changes in the same pass.
+ *
+ * @param node Matter node, before esp_matter::start
+ * @param pConfig Adapter configuration. This should last for the lifetime of the driver
+ *
+ * @return esp_err_t - ESP_OK on success,
+ *                     ESP_ERR_INVALID_ARG if an argument is NULL or there are too many lights
+ *                     ESP_ERR_INVALID_STATE if driver is already initialized
+ *                     appropriate error code otherwise
+ */
+esp_err_t light_task_init(esp_matter::node_t *node, light_config_t *pConfig);
+
+/**
+ * @brief Checks if an endpoint is one of the lights
+ *
+ * @param endpoint_id Endpoint ID
+ * @return true if light_task_attribute_update should handle it
+ */
+bool light_task_is_light(uint16_t endpoint_id);
+
+/** Driver Update
+ *
+ * @brief Keeps the OnOff, CurrentLevel and color attributes of the light and queues
+ *        them for the LEDC. Called from the common `app_attribute_update_cb()`.
+ *
+ * @param endpoint_id Endpoint ID of the attribute.
+ * @param cluster_id Cluster ID of the attribute.
+ * @param attribute_id Attribute ID of the attribute.
+ * @param val Pointer to `esp_matter_attr_val_t`. Use appropriate elements as per the value type.
+ *
+ * @return error in case of failure.
+ */
+esp_err_t light_task_attribute_update(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id, esp_matter_attr_val_t *val);
+
+extern "C" {
+#endif
+
+/**
+ * @brief Switches a light through its OnOff attribute, so Matter controllers
+ *        see the change. Safe to call from any task. Before esp_matter::start
+ *        the attribute is set in place and the light is driven directly.
+ *
+ * @param light_idx Index of the light in light_config_t::pLight
+ * @param on true to switch it on at its current level and color
+ *
+ * @return esp_err_t - ESP_OK on success,
+ *                     ESP_ERR_INVALID_STATE if the driver is not initialized
+ *                     ESP_ERR_INVALID_ARG if light_idx is out of range
+ */
+esp_err_t light_task_set_on(size_t light_idx, bool on);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LIGHT_TASK_H_
@@ -12,6 +12,9 @@
 #include <app/server/CommissioningWindowManager.h>
 #include <app/server/Server.h>
 
+#define MATTER_TASK_MQTT_HOST      "homeassistant.local" /*!< Broker of the rx_control / rx_state topics */
+#define MATTER_TASK_MQTT_CLIENT_ID "esp32CamServer"      /*!< Client identifier, unique on the broker */
+
 using namespace esp_matter;
 using namespace esp_matter::attribute;
 using namespace esp_matter::endpoint;
@@ -0,0 +1,181 @@
+import argparse
+
+import joblib
+import numpy as np
+import pandas as pd
+
+# Same feature order used in 2_train_model.py and 3_ha_deploy.py
+FEATURES = ["soil_moisture_1", "soil_moisture_2", "soil_moisture_3", "soil_moisture_4",
+            "water_level", "temperature", "humidity", "pressure", "air_quality"]
+
+LEAF = 0xFF          # Feature index used to flag leaf nodes
+Q_SPAN = 30000       # Thresholds are mapped into [-Q_SPAN, Q_SPAN]
+VOTE_MAX = 65535     # Leaf votes are stored as uint16 fixed point
+
+
+def quantize(x, offset, scale):
+    # Mirror the float32 math done on the ESP32 by irrigation_model.cpp
+    q = np.floor((np.float32(x) - np.float32(offset)) * np.float32(scale))
+    return int(np.clip(q, -32768, 32767))
+
+
+def feature_ranges(forest):
+    lo = np.full(len(FEATURES), np.inf)
+    hi = np.full(len(FEATURES), -np.inf)
+    for est in forest.estimators_:
+        tree = est.tree_
+        for f, t in zip(tree.feature, tree.threshold):
+            if f >= 0:
+                lo[f] = min(lo[f], np.float32(t))
+                hi[f] = max(hi[f], np.float32(t))
+
+    offset, scale = [], []
+    for f in range(len(FEATURES)):
+        if not np.isfinite(lo[f]):
+            # Feature never used by the forest
+            offset.append(0.0)
+            scale.append(1.0)
+        elif hi[f] == lo[f]:
+            offset.append(float(lo[f]))
+            scale.append(1.0)
+        else:
+            offset.append(float(np.float32((lo[f] + hi[f]) / 2)))
+            scale.append(float(np.float32(2 * Q_SPAN / (hi[f] - lo[f]))))
+    return offset, scale
+
+
+def flatten(forest, offset, scale):
+    soa = {"feature": [], "threshold": [], "left": [], "right": [], "leaf_vote": [],
+           "tree_node_base": [], "tree_leaf_base": []}
+
+    for est in forest.estimators_:
+        tree = est.tree_
+        if tree.node_count > 0xFFFF:
+            raise SystemExit("Tree too deep for uint16 child indices (%d nodes)" % tree.node_count)
+
+        soa["tree_node_base"].append(len(soa["feature"]))
+        soa["tree_leaf_base"].append(len(soa["leaf_vote"]))
+
+        leaf_idx = 0
+        for n in range(tree.node_count):
+            if tree.children_left[n] == -1:
+                # Class-1 probability of the leaf, same value predict_proba averages
+                value = tree.value[n][0]
+                p1 = value[1] / value.sum()
+                soa["feature"].append(LEAF)
+                soa["threshold"].append(0)
+                soa["left"].append(leaf_idx)
+                soa["right"].append(0)
+                soa["leaf_vote"].append(int(round(p1 * VOTE_MAX)))
+                leaf_idx += 1
+            else:
+                f = int(tree.feature[n])
+                soa["feature"].append(f)
+                soa["threshold"].append(quantize(tree.threshold[n], offset[f], scale[f]))
+                soa["left"].append(int(tree.children_left[n]))
+                soa["right"].append(int(tree.children_right[n]))
+    return soa
+
+
+def check_dataset(forest, soa, offset, scale, data):
+    # Replays the on-device evaluator on the dataset and reports any mismatch against sklearn
+    X = data[FEATURES].to_numpy(dtype=np.float32)
+    expected = forest.predict(data[FEATURES].astype(np.float32))
+    mismatches = 0
+
+    for row, exp in zip(X, expected):
+        q = [quantize(row[f], offset[f], scale[f]) for f in range(len(FEATURES))]
+        votes = 0
+        for t in range(len(soa["tree_node_base"])):
+            base = soa["tree_node_base"][t]
+            n = 0
+            while soa["feature"][base + n] != LEAF:
+                f = soa["feature"][base + n]
+                n = soa["left"][base + n] if q[f] <= soa["threshold"][base + n] else soa["right"][base + n]
+            votes += soa["leaf_vote"][soa["tree_leaf_base"][t] + soa["left"][base + n]]
+        pred = 1 if 2 * votes > len(soa["tree_node_base"]) * VOTE_MAX else 0
+        if pred != int(exp):
+            mismatches += 1
+
+    print("Checked %d rows, %d mismatches" % (len(X), mismatches))
+    return mismatches
+
+
+def c_array(values, per_line=16):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("        " + ", ".join(str(v) for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def emit_header(path, soa, offset, scale):
+    trees = len(soa["tree_node_base"])
+    nodes = len(soa["feature"])
+    leaves = len(soa["leaf_vote"])
+
+    with open(path, "w") as out:
+        out.write("""// Generated by 5_export_model.py, do not edit by hand.
+#ifndef MAIN_IRRIGATION_FOREST_H_
+#define MAIN_IRRIGATION_FOREST_H_
+
+#include <stdint.h>
+
+#define IRRIGATION_FOREST_TREE_QTY    %d
+#define IRRIGATION_FOREST_NODE_QTY    %d
+#define IRRIGATION_FOREST_LEAF_QTY    %d
+#define IRRIGATION_FOREST_FEATURE_QTY %d
+#define IRRIGATION_FOREST_LEAF        0x%X
+#define IRRIGATION_FOREST_VOTE_MAX    %d
+
+/**
+ * @brief Flattened RandomForest. Node arrays are indexed by tree_node_base[tree] + node,
+ * child indices are relative to the tree. For leaf nodes left holds the index of the vote,
+ * relative to tree_leaf_base[tree].
+ */
+typedef struct {
+    float offset[IRRIGATION_FOREST_FEATURE_QTY];
+    float scale[IRRIGATION_FOREST_FEATURE_QTY];
+    uint32_t tree_node_base[IRRIGATION_FOREST_TREE_QTY];
+    uint32_t tree_leaf_base[IRRIGATION_FOREST_TREE_QTY];
+    uint8_t feature[IRRIGATION_FOREST_NODE_QTY];
+    int16_t threshold[IRRIGATION_FOREST_NODE_QTY];
+    uint16_t left[IRRIGATION_FOREST_NODE_QTY];
+    uint16_t right[IRRIGATION_FOREST_NODE_QTY];
+    uint16_t leaf_vote[IRRIGATION_FOREST_LEAF_QTY];
+} irrigation_forest_t;
+
+constexpr irrigation_forest_t k_irrigation_forest = {
+""" % (trees, nodes, leaves, len(FEATURES), LEAF, VOTE_MAX))
+
+        for name in ("offset", "scale"):
+            out.write("    .%s = {\n%s\n    },\n" % (name, c_array(["%.9gf" % v for v in (offset if name == "offset" else scale)], 4)))
+        for name in ("tree_node_base", "tree_leaf_base", "feature", "threshold", "left", "right", "leaf_vote"):
+            out.write("    .%s = {\n%s\n    },\n" % (name, c_array(soa[name])))
+
+        out.write("};\n\n#endif /* MAIN_IRRIGATION_FOREST_H_ */\n")
+
+    print("Wrote %s: %d trees, %d nodes, %d leaves" % (path, trees, nodes, leaves))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compile irrigation_model.pkl into a constexpr C++ header")
+    parser.add_argument("--model", default="irrigation_model.pkl")
+    parser.add_argument("--data", default=None, help="CSV used to verify the quantized forest against sklearn")
+    parser.add_argument("--out", default="../../lilFlowerPal/main/model/irrigation_forest.h")
+    args = parser.parse_args()
+
+    forest = joblib.load(args.model)
+    if list(forest.classes_) != [0, 1]:
+        raise SystemExit("Only the binary needs_watering classifier is supported")
+
+    offset, scale = feature_ranges(forest)
+    soa = flatten(forest, offset, scale)
+
+    if args.data and check_dataset(forest, soa, offset, scale, pd.read_csv(args.data)):
+        raise SystemExit("Quantized forest does not match sklearn, header not written")
+
+    emit_header(args.out, soa, offset, scale)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,65 @@
+/**
+ * @file dry_run.cpp
+ * @author Marcel Nahir Samur (mnsamur2014@gmail.com)
+ * @brief Dry-run fault decisions, shared by interlock_task and the plant simulation
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <dry_run.h>
+
+void dry_run_reset(dry_run_t *pDryRun)
+{
+    pDryRun->latched = false;
+    pDryRun->last_mv = WL_RECOVER_MV;
+    pDryRun->empty_samples = 0;
+}
+
+bool dry_run_sample(dry_run_t *pDryRun, int mv)
+{
+    pDryRun->last_mv = mv;
+
+    if (mv >= WL_EMPTY_MV) {
+        pDryRun->empty_samples = 0;
+        return false;
+    }
+
+    if (pDryRun->empty_samples < INTERLOCK_TRIP_SAMPLES) {
+        pDryRun->empty_samples++;
+    }
+    if (pDryRun->empty_samples < INTERLOCK_TRIP_SAMPLES || pDryRun->latched) {
+        return false;
+    }
+
+    // Latched before the caller cuts the pumps, see pump_task_output_write
+    pDryRun->latched = true;
+    return true;
+}
+
+bool dry_run_clear(dry_run_t *pDryRun)
+{
+    if (!pDryRun->latched) {
+        return true;
+    }
+    if (pDryRun->last_mv < WL_RECOVER_MV) {
+        return false;
+    }
+
+    pDryRun->latched = false;
+    pDryRun->empty_samples = 0;
+
+    return true;
+}
+
+bool dry_run_switch(bool latched, uint32_t state, uint32_t zone_mask, uint32_t on_mask, uint32_t *pChanged)
+{
+    if (latched && (zone_mask & on_mask)) {
+        return false;
+    }
+
+    *pChanged = (state ^ on_mask) & zone_mask;
+    return true;
+}
@@ -0,0 +1,99 @@
+/**
+ * @file drying_forecast.cpp
+ * @author Marcel Nahir Samur (mnsamur2014@gmail.com)
+ * @brief Incremental soil drying-rate estimator
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <math.h>
+#include <string.h>
+
+#include <drying_forecast.h>
+
+#define US_PER_HOUR 3600e6f
+
+/**
+ * @brief Least squares fit of the weighted sums
+ *
+ * @param pForecast Forecast state
+ * @param pSlope Output, %/h
+ * @param pNow Output, fitted moisture at the latest sample (t = 0)
+ * @return true if the fit is defined
+ */
+static bool drying_forecast_fit(const drying_forecast_t *pForecast, float *pSlope, float *pNow)
+{
+    float det = pForecast->s0 * pForecast->stt - pForecast->st * pForecast->st;
+
+    if (pForecast->s0 <= 0 || fabsf(det) < 1e-9f) {
+        return false;
+    }
+
+    *pSlope = (pForecast->s0 * pForecast->sty - pForecast->st * pForecast->sy) / det;
+    *pNow = (pForecast->sy - *pSlope * pForecast->st) / pForecast->s0;
+
+    return true;
+}
+
+void drying_forecast_reset(drying_forecast_t *pForecast)
+{
+    memset(pForecast, 0, sizeof(drying_forecast_t));
+}
+
+void drying_forecast_update(drying_forecast_t *pForecast, int64_t now_us, float moisture_pct)
+{
+    if (pForecast->last_us != 0 && now_us > pForecast->last_us) {
+        float dt = (now_us - pForecast->last_us) / US_PER_HOUR;
+        float slope, fitted;
+
+        // Watering shows up as a jump above the drying line, start over from here
+        if (drying_forecast_fit(pForecast, &slope, &fitted) && moisture_pct > fitted + slope * dt + DRYING_FORECAST_RESET_PCT) {
+            drying_forecast_reset(pForecast);
+        } else {
+            float decay = expf(-dt / DRYING_FORECAST_TAU_H);
+
+            // Move the origin to the new sample (t -> t - dt), then age every sample
+            pForecast->stt = decay * (pForecast->stt - 2 * dt * pForecast->st + dt * dt * pForecast->s0);
+            pForecast->sty = decay * (pForecast->sty - dt * pForecast->sy);
+            pForecast->st = decay * (pForecast->st - dt * pForecast->s0);
+            pForecast->sy = decay * pForecast->sy;
+            pForecast->s0 = decay * pForecast->s0;
+            pForecast->span_h += dt;
+        }
+    }
+
+    // New sample sits at t = 0, so it only adds to the weight and value sums
+    pForecast->s0 += 1;
+    pForecast->sy += moisture_pct;
+    pForecast->last_us = now_us;
+}
+
+bool drying_forecast_rate(const drying_forecast_t *pForecast, float *pRate)
+{
+    float now;
+
+    if (pForecast->span_h < DRYING_FORECAST_MIN_SPAN_H) {
+        return false;
+    }
+    return drying_forecast_fit(pForecast, pRate, &now);
+}
+
+float drying_forecast_hours_to(const drying_forecast_t *pForecast, float threshold_pct)
+{
+    float slope, now;
+
+    if (pForecast->span_h < DRYING_FORECAST_MIN_SPAN_H || !drying_forecast_fit(pForecast, &slope, &now)) {
+        return DRYING_FORECAST_NEVER;
+    }
+    if (now <= threshold_pct) {
+        return 0;
+    }
+    if (slope >= 0) {
+        return DRYING_FORECAST_NEVER;
+    }
+
+    return (threshold_pct - now) / slope;
+}
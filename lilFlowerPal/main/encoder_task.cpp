@@ -14,8 +14,61 @@
 
 static const char *TAG = "encoder_task";
 
+/**
+ * @brief PCNT watch point callback. Every step reaches one of the limits,
+ * the sign of the watch point is the direction of the step.
+ *
+ * @param unit PCNT unit
+ * @param edata Watch point that was reached
+ * @param user_ctx Event queue
+ * @return true if a higher priority task was woken
+ */
+static bool IRAM_ATTR encoder_pcnt_on_reach(pcnt_unit_handle_t unit, const pcnt_watch_event_data_t *edata, void *user_ctx)
+{
+    QueueHandle_t event_queue = (QueueHandle_t)user_ctx;
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+    encoder_event_t evt = {
+        .type = ENCODER_EVENT_ROTATE,
+        .value = edata->watch_point_value > 0 ? 1 : -1,
+    };
+    xQueueSendFromISR(event_queue, &evt, &xHigherPriorityTaskWoken);
+
+    return xHigherPriorityTaskWoken == pdTRUE;
+}
+
+/**
+ * @brief Button engine callback, runs in the cosmos_devices button task.
+ * The engine already debounced the press, the event goes to the UI as is.
+ *
+ * @param btn_idx Always 0, the encoder has one button
+ * @param event Click, double click, long press, hold repeat or long release
+ * @param user_data Event queue
+ */
+static void encoder_btn_cb(size_t btn_idx, cosmos_devices_button_event_e event, void *user_data)
+{
+    QueueHandle_t event_queue = (QueueHandle_t)user_data;
+
+    encoder_event_t evt = {
+        .type = ENCODER_EVENT_BUTTON,
+        .value = event,
+    };
+
+    // A UI that fell behind loses the press, not the button task
+    if (xQueueSend(event_queue, &evt, 0) != pdTRUE) {
+        ESP_LOGW(TAG, "Event queue full, button event dropped");
+    }
+}
+
 esp_err_t encoder_init(encoder_config_t *encoder)
 {
+    // Rotation and button events are read by the UI task
+    encoder->event_queue = xQueueCreate(ENCODER_EVENT_QUEUE_SIZE, sizeof(encoder_event_t));
+    if (!encoder->event_queue) {
+        ESP_LOGE(TAG, "Failed to create event queue");
+        return ESP_ERR_NO_MEM;
+    }
+
     // PCNT unit configuration
     pcnt_unit_config_t unit_config = {
         .low_limit = PCNT_LOW_LIMIT,
@@ -52,11 +105,27 @@ esp_err_t encoder_init(encoder_config_t *encoder)
     };
     ESP_ERROR_CHECK(pcnt_unit_set_glitch_filter(encoder->pcnt_unit, &filter_config));
 
+    // Report every step from the PCNT interrupt
+    ESP_ERROR_CHECK(pcnt_unit_add_watch_point(encoder->pcnt_unit, PCNT_HIGH_LIMIT));
+    ESP_ERROR_CHECK(pcnt_unit_add_watch_point(encoder->pcnt_unit, PCNT_LOW_LIMIT));
+    pcnt_event_callbacks_t cbs = {
+        .on_reach = encoder_pcnt_on_reach,
+    };
+    ESP_ERROR_CHECK(pcnt_unit_register_event_callbacks(encoder->pcnt_unit, &cbs, encoder->event_queue));
+
     // Start PCNT unit
     ESP_ERROR_CHECK(pcnt_unit_enable(encoder->pcnt_unit));
     ESP_ERROR_CHECK(pcnt_unit_clear_count(encoder->pcnt_unit));
     ESP_ERROR_CHECK(pcnt_unit_start(encoder->pcnt_unit));
 
+    // The button pulls the pin low, the cosmos_devices button engine debounces it
+    const int pin_btn = encoder->pin_btn;
+    esp_err_t err = cosmos_devices_button_engine_begin(&pin_btn, 1, encoder_btn_cb, encoder->event_queue);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Button engine failed (%s)", esp_err_to_name(err));
+        return err;
+    }
+
     // Initialize other encoder parameters
     encoder->counter = 0;
 
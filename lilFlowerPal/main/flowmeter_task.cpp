@@ -0,0 +1,181 @@
+/**
+ * @file flowmeter_task.cpp
+ * @author Marcel Nahir Samur (mnsamur2014@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+
+#include <flowmeter_task.h>
+
+static const char *TAG = "flowmeter_task";
+
+/**
+ * @brief Per zone volume accounting
+ *
+ */
+typedef struct {
+    uint64_t total_pulses;           /*!< Pulses counted since boot */
+    uint64_t run_start_pulses;       /*!< total_pulses when the current run started */
+    uint64_t run_done_pulses;        /*!< Pulses of the finished run, latched when it stopped */
+    uint32_t window[FM_WINDOW_SIZE]; /*!< Pulses per read period, sliding window */
+    uint32_t window_sum;             /*!< Sum of the window */
+    uint8_t window_idx;              /*!< Next slot to overwrite */
+    uint8_t window_count;            /*!< Valid slots, until the window fills up */
+    int32_t last_rate_centi;         /*!< Last reported rate, in 0.01 l/min */
+    bool running;                    /*!< Pump is on */
+    bool run_done;                   /*!< Run ended, volume not reported yet */
+} flowmeter_zone_t;
+
+/**
+ * @brief Context structure for the flowmeters
+ *        Holds all the state and configuration needed for the driver.
+ */
+typedef struct {
+    flowmeter_config_t *config;
+    cosmos_sensor_fm_t *sensor;
+    flowmeter_zone_t zone[FM_QTY];
+    portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+    esp_timer_handle_t timer;
+    bool is_initialized = false;
+} flowmeter_ctx_t;
+
+static flowmeter_ctx_t s_ctx;
+
+/**
+ * @brief Periodic readout. PCNT keeps counting in hardware,
+ *        here we only take the deltas and do the accounting.
+ *
+ * @param pArg Pointer to the flowmeter context
+ */
+static void flowmeter_task_read_cb(void *pArg)
+{
+    auto *ctx = (flowmeter_ctx_t *)pArg;
+    if (!(ctx && ctx->config)) {
+        return;
+    }
+
+    const float period_min = ctx->config->interval_ms / 60000.0f;
+
+    for (size_t i = 0; i < FM_QTY; i++) {
+        flowmeter_zone_t *pZone = &ctx->zone[i];
+        uint32_t pulses = cosmos_sensor_fm_read_pulses(&ctx->sensor[i]);
+        uint64_t run_pulses = 0;
+        bool report_run = false;
+
+        portENTER_CRITICAL(&ctx->lock);
+        pZone->total_pulses += pulses;
+        if (pZone->run_done) {
+            // Pulses left in the PCNT at the stop belong to the finished run, a run started since begins after them
+            run_pulses = pZone->run_done_pulses + pulses;
+            if (pZone->running) {
+                pZone->run_start_pulses += pulses;
+            }
+            pZone->run_done_pulses = 0;
+            pZone->run_done = false;
+            report_run = true;
+        }
+        portEXIT_CRITICAL(&ctx->lock);
+
+        // Slide the window
+        pZone->window_sum -= pZone->window[pZone->window_idx];
+        pZone->window[pZone->window_idx] = pulses;
+        pZone->window_sum += pulses;
+        pZone->window_idx = (pZone->window_idx + 1) % FM_WINDOW_SIZE;
+        if (pZone->window_count < FM_WINDOW_SIZE)
+            pZone->window_count++;
+
+        float rate = pZone->window_sum / ctx->sensor[i].pulses_per_litre / (pZone->window_count * period_min);
+        int32_t rate_centi = (int32_t)(rate * 100);
+
+        if (rate_centi != pZone->last_rate_centi && ctx->config->rate_cb) {
+            pZone->last_rate_centi = rate_centi;
+            ctx->config->rate_cb(ctx->config->endpoint_id[i], rate, ctx->config->user_data);
+        }
+
+        if (report_run) {
+            float run_litres = run_pulses / ctx->sensor[i].pulses_per_litre;
+            float total_litres = pZone->total_pulses / ctx->sensor[i].pulses_per_litre;
+
+            ESP_LOGI(TAG, "Zone %d run delivered %.2f l (%.2f l total)", (int)i + 1, run_litres, total_litres);
+
+            if (ctx->config->volume_cb) {
+                ctx->config->volume_cb(ctx->config->endpoint_id[i], run_litres, total_litres, ctx->config->user_data);
+            }
+        }
+    }
+}
+
+void flowmeter_task_run_update(size_t zone, bool running)
+{
+    if (!s_ctx.is_initialized || zone >= FM_QTY) {
+        return;
+    }
+
+    flowmeter_zone_t *pZone = &s_ctx.zone[zone];
+
+    portENTER_CRITICAL(&s_ctx.lock);
+    if (running && !pZone->running) {
+        pZone->run_start_pulses = pZone->total_pulses;
+    } else if (!running && pZone->running) {
+        // Latched now, a restart before the readout must not overwrite it. Pulses still in the PCNT are added by the readout
+        pZone->run_done_pulses += pZone->total_pulses - pZone->run_start_pulses;
+        pZone->run_done = true;
+    }
+    pZone->running = running;
+    portEXIT_CRITICAL(&s_ctx.lock);
+}
+
+esp_err_t flowmeter_task_init(flowmeter_config_t *pConfig, cosmos_sensor_fm_t *pSensor)
+{
+    esp_err_t err;
+
+    if (pConfig == NULL || pSensor == NULL) {
+        ESP_LOGE(TAG, "Invalid argument");
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_ctx.is_initialized) {
+        ESP_LOGE(TAG, "Driver already initialized");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    err = cosmos_sensor_fm_begin(pSensor, FM_QTY);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to initialize flowmeters");
+        return err;
+    }
+
+    s_ctx.config = pConfig;
+    s_ctx.sensor = pSensor;
+
+    // Create a periodic timer to read the pulse counters
+    const esp_timer_create_args_t read_args = {
+        .callback = flowmeter_task_read_cb,
+        .arg = &s_ctx,
+        .name = "flowmeter_read",
+    };
+
+    err = esp_timer_create(&read_args, &s_ctx.timer);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to create timer for flowmeters");
+        return err;
+    }
+
+    err = esp_timer_start_periodic(s_ctx.timer, pConfig->interval_ms * 1000);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to start timer for flowmeters");
+        esp_timer_delete(s_ctx.timer);
+        return err;
+    }
+
+    s_ctx.is_initialized = true;
+
+    return ESP_OK;
+}
@@ -0,0 +1,172 @@
+/**
+ * @file forecast_task.cpp
+ * @author Marcel Nahir Samur (mnsamur2014@gmail.com)
+ * @brief Per probe soil drying forecasts, reported to Matter
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+
+#include <forecast_task.h>
+
+using namespace esp_matter;
+
+static const char *TAG = "forecast_task";
+
+/**
+ * @brief Context structure for the forecasts
+ *        Holds all the state and configuration needed for the driver.
+ */
+typedef struct {
+    forecast_config_t *config;
+    drying_forecast_t forecast[FORECAST_QTY];
+    uint8_t threshold[FORECAST_QTY]; /*!< Dry threshold of each probe, in % */
+    portMUX_TYPE lock;
+    esp_timer_handle_t timer;
+    bool is_initialized = false;
+} forecast_ctx_t;
+
+static forecast_ctx_t s_ctx = {
+    .lock = portMUX_INITIALIZER_UNLOCKED,
+};
+
+/**
+ * @brief Reports the forecast of every probe
+ *
+ * @param pArg Pointer to the forecast context
+ */
+static void forecast_task_report_cb(void *pArg)
+{
+    auto *ctx = (forecast_ctx_t *)pArg;
+    if (!(ctx && ctx->config && ctx->config->cb)) {
+        return;
+    }
+
+    for (size_t i = 0; i < FORECAST_QTY; i++) {
+        float rate, hours;
+
+        taskENTER_CRITICAL(&ctx->lock);
+        bool valid = drying_forecast_rate(&ctx->forecast[i], &rate);
+        hours = drying_forecast_hours_to(&ctx->forecast[i], ctx->threshold[i]);
+        taskEXIT_CRITICAL(&ctx->lock);
+
+        // Not enough history yet (boot or just watered)
+        if (!valid) {
+            continue;
+        }
+
+        ESP_LOGI(TAG, "Probe %d: %.2f %%/h, %.1f h to %d %%", i + 1, rate, hours, ctx->threshold[i]);
+        ctx->config->cb(ctx->config->endpoint_id[i], rate, hours, ctx->config->user_data);
+    }
+}
+
+void forecast_task_add_sample(size_t probe, float moisture_pct)
+{
+    if (probe >= FORECAST_QTY) {
+        return;
+    }
+
+    int64_t now = esp_timer_get_time();
+
+    taskENTER_CRITICAL(&s_ctx.lock);
+    drying_forecast_update(&s_ctx.forecast[probe], now, moisture_pct);
+    taskEXIT_CRITICAL(&s_ctx.lock);
+}
+
+esp_err_t forecast_task_add_clusters(endpoint_t *endpoint)
+{
+    if (!endpoint) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    cluster_t *forecast_cluster = cluster::create(endpoint, FORECAST_CLUSTER_ID, CLUSTER_FLAG_SERVER);
+    if (!forecast_cluster) {
+        ESP_LOGE(TAG, "Failed to create forecast cluster");
+        return ESP_FAIL;
+    }
+    cluster::global::attribute::create_cluster_revision(forecast_cluster, 1);
+    cluster::global::attribute::create_feature_map(forecast_cluster, 0);
+
+    attribute::create(forecast_cluster, FORECAST_ATTR_DRYING_RATE, ATTRIBUTE_FLAG_NONE, esp_matter_int16(0));
+    attribute::create(forecast_cluster, FORECAST_ATTR_MINUTES_TO_DRY, ATTRIBUTE_FLAG_NONE, esp_matter_uint32(FORECAST_MINUTES_UNKNOWN));
+    attribute::create(forecast_cluster, FORECAST_ATTR_DRY_THRESHOLD, ATTRIBUTE_FLAG_WRITABLE | ATTRIBUTE_FLAG_NONVOLATILE,
+                      esp_matter_uint8(FORECAST_DEFAULT_THRESHOLD));
+
+    return ESP_OK;
+}
+
+esp_err_t forecast_task_attribute_update(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id,
+                                         esp_matter_attr_val_t *val)
+{
+    if (cluster_id != FORECAST_CLUSTER_ID || attribute_id != FORECAST_ATTR_DRY_THRESHOLD || !s_ctx.config) {
+        return ESP_OK;
+    }
+    if (val->val.u8 > 100) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    for (size_t i = 0; i < FORECAST_QTY; i++) {
+        if (endpoint_id == s_ctx.config->endpoint_id[i]) {
+            s_ctx.threshold[i] = val->val.u8;
+        }
+    }
+
+    return ESP_OK;
+}
+
+esp_err_t forecast_task_init(forecast_config_t *pConfig)
+{
+    esp_err_t err;
+
+    if (pConfig == NULL) {
+        ESP_LOGE(TAG, "Invalid argument");
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_ctx.is_initialized) {
+        ESP_LOGE(TAG, "Driver already initialized");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    s_ctx.config = pConfig;
+
+    // Thresholds are non volatile attributes, pick up the stored values
+    for (size_t i = 0; i < FORECAST_QTY; i++) {
+        esp_matter_attr_val_t val = esp_matter_uint8(FORECAST_DEFAULT_THRESHOLD);
+        attribute_t *attribute = attribute::get(pConfig->endpoint_id[i], FORECAST_CLUSTER_ID, FORECAST_ATTR_DRY_THRESHOLD);
+        if (attribute) {
+            attribute::get_val(attribute, &val);
+        }
+
+        s_ctx.threshold[i] = val.val.u8;
+    }
+
+    // Create a periodic timer to report the forecasts
+    const esp_timer_create_args_t report_args = {
+        .callback = forecast_task_report_cb,
+        .arg = &s_ctx,
+        .name = "forecast_report",
+    };
+
+    err = esp_timer_create(&report_args, &s_ctx.timer);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to create timer for forecasts");
+        return err;
+    }
+
+    err = esp_timer_start_periodic(s_ctx.timer, pConfig->interval_ms * 1000);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to start timer for forecasts");
+        esp_timer_delete(s_ctx.timer);
+        return err;
+    }
+
+    s_ctx.is_initialized = true;
+
+    return ESP_OK;
+}
@@ -0,0 +1,150 @@
+/**
+ * @file interlock_task.cpp
+ * @author Marcel Nahir Samur (mnsamur2014@gmail.com)
+ * @brief Dry-run protection, independent of Matter and Home Assistant
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <esp_log.h>
+#include <esp_timer.h>
+
+#include <interlock_task.h>
+
+static const char *TAG = "interlock_task";
+
+/**
+ * @brief Context structure for the interlock
+ *        Holds all the state and configuration needed for the driver.
+ */
+typedef struct {
+    interlock_config_t *config;
+    cosmos_sensor_t *sensor;
+    esp_timer_handle_t timer;
+    dry_run_t dry_run;
+    bool is_initialized = false;
+} interlock_ctx_t;
+
+static interlock_ctx_t s_ctx;
+
+/**
+ * @brief Reports the fault state on every pump endpoint
+ *
+ * @param ctx Pointer to the interlock context
+ * @param fault Fault state
+ */
+static void interlock_task_notify(interlock_ctx_t *ctx, bool fault)
+{
+    if (!ctx->config->cb) {
+        return;
+    }
+
+    for (size_t i = 0; i < PUMP_QTY; i++) {
+        ctx->config->cb(ctx->config->endpoint_id[i], fault, ctx->config->user_data);
+    }
+}
+
+/**
+ * @brief Fast sampling lane. A single ADC conversion per period,
+ *        the pumps are switched off right here when the tank is empty.
+ *
+ * @param pArg Pointer to the interlock context
+ */
+static void interlock_task_sample_cb(void *pArg)
+{
+    auto *ctx = (interlock_ctx_t *)pArg;
+    if (!(ctx && ctx->config)) {
+        return;
+    }
+
+    int mv = cosmos_sensor_adc_read_fast(ctx->sensor);
+    if (mv < 0) {
+        // ADC busy with the slow lane, try again next period
+        return;
+    }
+
+    /*
+     * Latched before cutting: pump_task checks the latch under
+     * the lock of the output write, so a pump switched on in
+     * between is refused or cut by the write below, which
+     * switches every pump in one register write. Reporting
+     * comes after
+     */
+    if (!dry_run_sample(&ctx->dry_run, mv)) {
+        return;
+    }
+    pump_task_set_mask(PUMP_MASK_ALL, 0);
+
+    ESP_LOGE(TAG, "Tank empty (%d mV), pumps forced off and dry-run fault latched", mv);
+    interlock_task_notify(ctx, true);
+}
+
+bool interlock_task_is_latched(void)
+{
+    return s_ctx.dry_run.latched;
+}
+
+esp_err_t interlock_task_clear(void)
+{
+    if (!s_ctx.dry_run.latched) {
+        return ESP_OK;
+    }
+    if (!dry_run_clear(&s_ctx.dry_run)) {
+        ESP_LOGW(TAG, "Tank still low (%d mV), dry-run fault kept", s_ctx.dry_run.last_mv);
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    ESP_LOGI(TAG, "Dry-run fault cleared");
+    interlock_task_notify(&s_ctx, false);
+
+    return ESP_OK;
+}
+
+esp_err_t interlock_task_init(interlock_config_t *pConfig, cosmos_sensor_t *pSensor)
+{
+    esp_err_t err;
+
+    if (pConfig == NULL || pSensor == NULL) {
+        ESP_LOGE(TAG, "Invalid argument");
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_ctx.is_initialized) {
+        ESP_LOGE(TAG, "Driver already initialized");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    s_ctx.config = pConfig;
+    s_ctx.sensor = pSensor;
+    dry_run_reset(&s_ctx.dry_run);
+
+    /*
+     * The ESP32 ADC has no digital threshold monitor,
+     * so the water level channel gets its own periodic
+     * timer, apart from the 5 s multisampled readings
+     */
+    const esp_timer_create_args_t sample_args = {
+        .callback = interlock_task_sample_cb,
+        .arg = &s_ctx,
+        .name = "interlock_sample",
+    };
+
+    err = esp_timer_create(&sample_args, &s_ctx.timer);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to create timer for interlock");
+        return err;
+    }
+
+    err = esp_timer_start_periodic(s_ctx.timer, pConfig->interval_ms * 1000);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to start timer for interlock");
+        esp_timer_delete(s_ctx.timer);
+        return err;
+    }
+
+    s_ctx.is_initialized = true;
+
+    return ESP_OK;
+}
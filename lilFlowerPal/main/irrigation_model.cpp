@@ -0,0 +1,86 @@
+/**
+ * @file irrigation_model.cpp
+ * @author Marcel Nahir Samur (mnsamur2014@gmail.com)
+ * @brief On-device evaluator for the RandomForest exported by 5_export_model.py
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <math.h>
+
+#include <irrigation_model.h>
+
+#if __has_include("model/irrigation_forest.h")
+#include "model/irrigation_forest.h"
+#define IRRIGATION_MODEL_AVAILABLE 1
+
+static_assert(IRRIGATION_FOREST_FEATURE_QTY == IRRIGATION_MODEL_FEATURE_QTY, "Forest was trained with a different feature set");
+#else
+#define IRRIGATION_MODEL_AVAILABLE 0
+#endif
+
+bool irrigation_model_available(void)
+{
+    return IRRIGATION_MODEL_AVAILABLE;
+}
+
+#if IRRIGATION_MODEL_AVAILABLE
+/**
+ * @brief Maps a feature into the int16 domain the thresholds were quantized to.
+ *        Must stay in sync with quantize() in 5_export_model.py
+ *
+ * @param value Raw feature value
+ * @param feature Feature index
+ * @return int16_t Quantized value
+ */
+static inline int16_t irrigation_model_quantize(float value, int feature)
+{
+    float q = floorf((value - k_irrigation_forest.offset[feature]) * k_irrigation_forest.scale[feature]);
+
+    if (q < INT16_MIN)
+        return INT16_MIN;
+    if (q > INT16_MAX)
+        return INT16_MAX;
+    return (int16_t)q;
+}
+#endif
+
+int irrigation_model_predict(const float *pFeatures, float *pScore)
+{
+#if IRRIGATION_MODEL_AVAILABLE
+    int16_t q[IRRIGATION_MODEL_FEATURE_QTY];
+    uint32_t votes = 0;
+
+    if (pFeatures == NULL)
+        return -1;
+
+    // Quantize once, every split below is an integer compare
+    for (int f = 0; f < IRRIGATION_MODEL_FEATURE_QTY; f++)
+        q[f] = irrigation_model_quantize(pFeatures[f], f);
+
+    for (int t = 0; t < IRRIGATION_FOREST_TREE_QTY; t++) {
+        const uint32_t base = k_irrigation_forest.tree_node_base[t];
+        uint32_t node = 0;
+
+        while (k_irrigation_forest.feature[base + node] != IRRIGATION_FOREST_LEAF) {
+            const uint32_t idx = base + node;
+            node = (q[k_irrigation_forest.feature[idx]] <= k_irrigation_forest.threshold[idx]) ? k_irrigation_forest.left[idx] : k_irrigation_forest.right[idx];
+        }
+
+        votes += k_irrigation_forest.leaf_vote[k_irrigation_forest.tree_leaf_base[t] + k_irrigation_forest.left[base + node]];
+    }
+
+    if (pScore)
+        *pScore = (float)votes / ((float)IRRIGATION_FOREST_TREE_QTY * IRRIGATION_FOREST_VOTE_MAX);
+
+    // Soft voting, ties resolve to "don't water" as in sklearn's argmax
+    return (2ULL * votes > (unsigned long long)IRRIGATION_FOREST_TREE_QTY * IRRIGATION_FOREST_VOTE_MAX) ? 1 : 0;
+#else
+    (void)pFeatures;
+    (void)pScore;
+    return -1;
+#endif
+}
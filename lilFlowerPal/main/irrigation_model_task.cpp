@@ -0,0 +1,132 @@
+/**
+ * @file irrigation_model_task.cpp
+ * @author Marcel Nahir Samur (mnsamur2014@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <string.h>
+
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+
+#include <irrigation_model_task.h>
+
+static const char *TAG = "irrigation_model_task";
+
+/**
+ * @brief Context structure for the irrigation model
+ *        Holds all the state and configuration needed for the driver.
+ */
+typedef struct {
+    irrigation_model_config_t *config;
+    float features[IRRIGATION_MODEL_FEATURE_QTY];
+    uint16_t valid_mask;
+    esp_timer_handle_t timer;
+    bool is_initialized = false;
+} irrigation_model_ctx_t;
+
+static irrigation_model_ctx_t s_ctx;
+
+// Sensor callbacks run on several tasks, features and valid_mask are only touched under it
+static portMUX_TYPE s_lock = portMUX_INITIALIZER_UNLOCKED;
+
+#define IRRIGATION_MODEL_ALL_VALID ((1U << IRRIGATION_MODEL_FEATURE_QTY) - 1)
+
+/**
+ * @brief Scores the cached features and reports the result
+ *
+ * @param pArg Pointer to the model context
+ */
+static void irrigation_model_task_score_cb(void *pArg)
+{
+    auto *ctx = (irrigation_model_ctx_t *)pArg;
+    if (!(ctx && ctx->config)) {
+        return;
+    }
+
+    // Scored on a copy, so a sensor update can't change the vector half way
+    float features[IRRIGATION_MODEL_FEATURE_QTY];
+    taskENTER_CRITICAL(&s_lock);
+    uint16_t valid_mask = ctx->valid_mask;
+    memcpy(features, ctx->features, sizeof(features));
+    taskEXIT_CRITICAL(&s_lock);
+
+    // Wait until every sensor reported at least once
+    if (valid_mask != IRRIGATION_MODEL_ALL_VALID) {
+        ESP_LOGD(TAG, "Waiting for features (mask 0x%03x)", valid_mask);
+        return;
+    }
+
+    float score = 0;
+    int64_t start = esp_timer_get_time();
+    int prediction = irrigation_model_predict(features, &score);
+    int64_t elapsed = esp_timer_get_time() - start;
+
+    ESP_LOGD(TAG, "Prediction: %d (score %.3f) in %lld us", prediction, score, elapsed);
+
+    if (ctx->config->cb) {
+        ctx->config->cb(prediction, score, ctx->config->user_data);
+    }
+}
+
+void irrigation_model_task_set_feature(irrigation_model_feature_e feature, float value)
+{
+    if (feature >= IRRIGATION_MODEL_FEATURE_QTY) {
+        return;
+    }
+
+    taskENTER_CRITICAL(&s_lock);
+    s_ctx.features[feature] = value;
+    s_ctx.valid_mask |= (1U << feature);
+    taskEXIT_CRITICAL(&s_lock);
+}
+
+esp_err_t irrigation_model_task_init(irrigation_model_config_t *pConfig)
+{
+    esp_err_t err;
+
+    if (pConfig == NULL || pConfig->cb == NULL) {
+        ESP_LOGE(TAG, "Invalid argument");
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_ctx.is_initialized) {
+        ESP_LOGE(TAG, "Driver already initialized");
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!irrigation_model_available()) {
+        ESP_LOGW(TAG, "Firmware built without main/model/irrigation_forest.h, run 5_export_model.py");
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+
+    s_ctx.config = pConfig;
+
+    // Create a periodic timer to score the model
+    const esp_timer_create_args_t score_args = {
+        .callback = irrigation_model_task_score_cb,
+        .arg = &s_ctx,
+        .name = "irrigation_model_score",
+    };
+
+    err = esp_timer_create(&score_args, &s_ctx.timer);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to create timer for irrigation model");
+        return err;
+    }
+
+    err = esp_timer_start_periodic(s_ctx.timer, pConfig->interval_ms * 1000);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to start timer for irrigation model");
+        esp_timer_delete(s_ctx.timer);
+        return err;
+    }
+
+    s_ctx.is_initialized = true;
+
+    return ESP_OK;
+}
@@ -10,13 +10,17 @@
  */
 #include <esp_log.h>
 #include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
 #include <freertos/task.h>
 
+#include <esp_lvgl_port.h>
+
 #include <lil_ui_task.h>
 
 static const char *TAG = "lil_ui_task";
 
-lv_obj_t *screens[LIL_UI_TASK_SCREEN_COUNT] = {0};
+// Screens the encoder rotates through, plus the commissioning screen of lvgl_task
+lv_obj_t *screens[LIL_UI_TASK_SCREEN_COUNT + 1] = {0};
 static int current_screen = 0;
 
 // Encoder configuration
@@ -34,42 +38,55 @@ encoder_config_t encoder = {
 static void lil_ui_task_switch_screen(void *pArg)
 {
     encoder_config_t *pEncoder = (encoder_config_t *)pArg;
-    int idx = 0;
+    encoder_event_t evt;
+    int steps;
 
     // Verify encoder configuration
-    if (!pEncoder || !pEncoder->pcnt_unit) {
+    if (!pEncoder || !pEncoder->pcnt_unit || !pEncoder->event_queue) {
         ESP_LOGE(TAG, "Invalid encoder configuration");
         vTaskDelete(NULL);
         return;
     }
 
     while (1) {
-        // Get the current count from the PCNT unit
-        pcnt_unit_get_count(pEncoder->pcnt_unit, &idx);
+        // Sleep until the encoder ISRs post something
+        if (xQueueReceive(pEncoder->event_queue, &evt, portMAX_DELAY) != pdTRUE)
+            continue;
 
-        if (idx != pEncoder->counter) {
+        if (evt.type == ENCODER_EVENT_BUTTON) {
+            ESP_LOGD(TAG, "Button event %d", evt.value);
+            continue;
+        }
 
-            ESP_LOGD(TAG, "Idx is %d", idx);
+        // Steps already queued behind this one load a single screen
+        steps = evt.value;
+        while (xQueuePeek(pEncoder->event_queue, &evt, 0) == pdTRUE && evt.type == ENCODER_EVENT_ROTATE) {
+            xQueueReceive(pEncoder->event_queue, &evt, 0);
+            steps += evt.value;
+        }
 
-            if (idx < 0)
-                current_screen = PCNT_HIGH_LIMIT + idx; // Wrap around to last screen
-            else
-                current_screen = idx;
+        pEncoder->counter += steps;
+        ESP_LOGD(TAG, "Counter is %ld", (long)pEncoder->counter);
 
-            pEncoder->counter = idx;
-            ESP_LOGD(TAG, "Switching to screen %d", current_screen + 1);
-            lv_scr_load(screens[current_screen]);
-        }
+        // Wrap around in both directions
+        current_screen = ((current_screen + steps) % LIL_UI_TASK_SCREEN_COUNT + LIL_UI_TASK_SCREEN_COUNT) % LIL_UI_TASK_SCREEN_COUNT;
 
-        // Add delay to prevent tight loop
-        vTaskDelay(pdMS_TO_TICKS(50));
+        ESP_LOGD(TAG, "Switching to screen %d", current_screen + 1);
+
+        // The LVGL port task renders concurrently
+        lvgl_port_lock(0);
+        lv_scr_load(screens[current_screen]);
+        lvgl_port_unlock();
     }
 }
 
 void lil_ui_task_start(void)
 {
     // Initialize encoder
-    encoder_init(&encoder);
+    if (encoder_init(&encoder) != ESP_OK) {
+        ESP_LOGE(TAG, "encoder_init failed");
+        return;
+    }
 
     // Create event handling task
     xTaskCreate(lil_ui_task_switch_screen, "lil_ui_task_switch_screen", LIL_UI_TASK_STACK_SIZE, &encoder, LIL_UI_TASK_PRIORITY, NULL);
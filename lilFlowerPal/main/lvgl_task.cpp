@@ -28,14 +28,15 @@
 
 static const char *TAG = "lvgl_task";
 
-// LVGL image declare
+// LVGL image declare, see main/CMakeLists.txt
+#if LVGL_TASK_QR_IMAGE
 LV_IMG_DECLARE(test_qr);
+#endif
 static bool is_commissioned = false;
 
 static esp_lcd_panel_io_handle_t lcd_io = NULL;
 static esp_lcd_panel_handle_t lcd_panel = NULL;
 
-extern lv_obj_t *screens[LIL_UI_TASK_SCREEN_COUNT + 1];
 static lv_display_t *lvgl_disp = NULL;
 
 /**
@@ -168,14 +169,16 @@ static void lvgl_task_main_display(void)
     lv_obj_center(label4);
 
     // Screen 5 - QR Code (Only shown during commissioning)
-    screens[4] = lv_obj_create(NULL);
+    screens[LVGL_TASK_QR_SCREEN] = lv_obj_create(NULL);
 
+#if LVGL_TASK_QR_IMAGE
     // Create QR code object
-    lv_obj_t *qr_img = lv_img_create(screens[4]);
+    lv_obj_t *qr_img = lv_img_create(screens[LVGL_TASK_QR_SCREEN]);
     lv_img_set_src(qr_img, &test_qr);
+#endif
 
     // Add a label with instructions
-    lv_obj_t *label = lv_label_create(screens[4]);
+    lv_obj_t *label = lv_label_create(screens[LVGL_TASK_QR_SCREEN]);
     lv_label_set_text(label, "Escanee el codigo QR\npara configurar el dispositivo");
     lv_obj_align(label, LV_ALIGN_BOTTOM_MID, 0, -20);
 
@@ -183,7 +186,7 @@ static void lvgl_task_main_display(void)
     if (is_commissioned) {
         lv_scr_load(screens[0]); // Load main screen if already commissioned
     } else {
-        lv_scr_load(screens[4]); // Load QR code screen if not commissioned
+        lv_scr_load(screens[LVGL_TASK_QR_SCREEN]); // Load QR code screen if not commissioned
     }
 
     // Task unlock
@@ -26,12 +26,21 @@
 #include <app/server/CommissioningWindowManager.h>
 #include <app/server/Server.h>
 
+// Include cosmos libraries
+#include <cosmos_state.h>
+
 // Include project libraries
 #include <analog_sensor_task.h>
 #include <bme680_task.h>
+#include <flowmeter_task.h>
+#include <forecast_task.h>
+#include <interlock_task.h>
+#include <irrigation_model_task.h>
 #include <main_tasks_common.h>
 #include <matter_task.h>
+#include <pump_stats_task.h>
 #include <pump_task.h>
+#include <schedule_task.h>
 
 #if CONFIG_ENABLE_LVGL_UI
 #include <lil_ui_task.h>
@@ -54,6 +63,27 @@ gpio_pump_t pump_gpios[PUMP_QTY] = {
     {.GPIO_PIN_VALUE = PUMP4_GPIO},
 };
 
+// Flowmeter definitions, one per pump zone
+flowmeter_config_t flowmeters_config = {};
+cosmos_sensor_fm_t flowmeters[FM_QTY] = {
+    {.pin_num = FM1_GPIO, .pulses_per_litre = FM_PULSES_PER_LITRE},
+    {.pin_num = FM2_GPIO, .pulses_per_litre = FM_PULSES_PER_LITRE},
+    {.pin_num = FM3_GPIO, .pulses_per_litre = FM_PULSES_PER_LITRE},
+    {.pin_num = FM4_GPIO, .pulses_per_litre = FM_PULSES_PER_LITRE},
+};
+
+// Pump runtime counters definitions
+pump_stats_config_t pump_stats_config = {};
+
+// Dry-run interlock definitions
+interlock_config_t interlock_config = {};
+
+// Soil drying forecast definitions, one per soil moisture probe
+forecast_config_t forecast_config = {};
+
+// Irrigation schedule definitions
+schedule_config_t schedule_config = {};
+
 // Sensor definitions
 an_sensor_config_t sensors_config[SNR_QTY] = {};
 cosmos_sensor_t sensors[SNR_QTY] = {
@@ -77,7 +107,17 @@ static esp_err_t app_create_pump(gpio_pump_t *pPump, node_t *pNode);
 static esp_err_t app_create_sm_sensor(an_sensor_config_t *pConfig, node_t *pNode);
 static void temp_sensor_notification(uint16_t endpoint_id, float temp, void *user_data);
 static void humidity_sensor_notification(uint16_t endpoint_id, float humidity, void *user_data);
+static void air_humidity_notification(uint16_t endpoint_id, float humidity, void *user_data);
+static void soil_sensor_notification(uint16_t endpoint_id, float reading, void *user_data);
 static void pressure_sensor_notification(uint16_t endpoint_id, float pressure, void *user_data);
+static void air_quality_notification(uint16_t endpoint_id, float gas_resistance, void *user_data);
+static void irrigation_model_notification(int prediction, float score, void *user_data);
+static void flow_rate_notification(uint16_t endpoint_id, float litres_per_min, void *user_data);
+static void pump_volume_notification(uint16_t endpoint_id, float run_litres, float total_litres, void *user_data);
+static void dry_run_notification(uint16_t endpoint_id, bool fault, void *user_data);
+static void schedule_pump_notification(size_t zone, bool on, void *user_data);
+static void pump_stats_notification(uint16_t endpoint_id, const pump_stats_t *pStats, void *user_data);
+static void drying_forecast_notification(uint16_t endpoint_id, float rate_pct_h, float hours_to_dry, void *user_data);
 
 extern "C" void app_main()
 {
@@ -96,6 +136,13 @@ extern "C" void app_main()
         return;
     }
 
+    // Load the saved device states, outputs are restored by their drivers before Matter starts
+    err = cosmos_state_begin();
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "cosmos_state_begin failed: %d", err);
+        return;
+    }
+
     // Create a Matter node and add the mandatory Root Node device type on endpoint 0
     node::config_t node_cfg;
     node_t *node = node::create(&node_cfg, app_attribute_update_cb, app_identification_cb);
@@ -140,7 +187,7 @@ extern "C" void app_main()
             },
         .humidity =
             {
-                .cb = humidity_sensor_notification,
+                .cb = air_humidity_notification,
                 .endpoint_id = endpoint::get_id(humidity_sensor_ep),
             },
         .pressure =
@@ -148,6 +195,10 @@ extern "C" void app_main()
                 .cb = pressure_sensor_notification,
                 .endpoint_id = endpoint::get_id(pressure_sensor_ep),
             },
+        .gas_resistance =
+            {
+                .cb = air_quality_notification,
+            },
     };
 
     // Create pump endpoints endpoints
@@ -180,9 +231,26 @@ extern "C" void app_main()
         return;
     }
 
+    // Initialize flowmeters, volume is accounted per pump zone
+    flowmeters_config.rate_cb = flow_rate_notification;
+    flowmeters_config.volume_cb = pump_volume_notification;
+    err = flowmeter_task_init(&flowmeters_config, flowmeters);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "flowmeter_task_init failed: %d", err);
+        return;
+    }
+
     // Initialize ADC channels for analog sensors
     cosmos_sensor_begin(sensors, SNR_QTY);
 
+    // Initialize soil drying forecasts, fed by the soil moisture readings
+    forecast_config.cb = drying_forecast_notification;
+    err = forecast_task_init(&forecast_config);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "forecast_task_init failed: %d", err);
+        return;
+    }
+
     // Initialize analog sensor task
     err = analog_sensor_task_sensor_init(sensors_config, sensors);
     if (err != ESP_OK) {
@@ -190,6 +258,15 @@ extern "C" void app_main()
         return;
     }
 
+    // Initialize on-device irrigation model, the device keeps working without it
+    static irrigation_model_config_t irrigation_model_config = {
+        .cb = irrigation_model_notification,
+    };
+    err = irrigation_model_task_init(&irrigation_model_config);
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "irrigation_model_task_init failed: %d", err);
+    }
+
 // Initialize LVGL task loads main screen
 #if CONFIG_ENABLE_LVGL_UI
     lvgl_task_start();
@@ -202,6 +279,40 @@ extern "C" void app_main()
         return;
     }
 
+    /*
+     * Initialize dry-run interlock on the water level sensor (last one in the array).
+     * Started with the Matter stack up, a fault latched at boot is reported through
+     * ScheduleLambda and would be lost before
+     */
+    interlock_config.cb = dry_run_notification;
+    err = interlock_task_init(&interlock_config, &sensors[SNR_QTY - 1]);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "interlock_task_init failed: %d", err);
+        return;
+    }
+
+    // Initialize pump runtime counters, restored from NVS and reported to Matter
+    pump_stats_config.cb = pump_stats_notification;
+    err = pump_stats_task_init(&pump_stats_config);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "pump_stats_task_init failed: %d", err);
+    }
+
+    // Pumps running before the reset come back through the interlock, flowmeter and stats bookkeeping
+    uint32_t restored = pump_task_restore();
+    for (size_t i = 0; i < PUMP_QTY; i++) {
+        if (restored & BIT(i)) {
+            schedule_pump_notification(i, true, NULL);
+        }
+    }
+
+    // Initialize irrigation schedule, pumps are switched through Matter so the attributes stay in sync
+    schedule_config.cb = schedule_pump_notification;
+    err = schedule_task_init(&schedule_config);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "schedule_task_init failed: %d", err);
+    }
+
 // Start Lil UI task
 #if CONFIG_ENABLE_LVGL_UI
     lil_ui_task_start();
@@ -218,6 +329,8 @@ extern "C" void app_main()
     esp_matter::console::diagnostics_register_commands();
     esp_matter::console::wifi_register_commands();
     esp_matter::console::factoryreset_register_commands();
+    schedule_task_register_commands();
+    pump_stats_task_register_commands();
 #if CONFIG_OPENTHREAD_CLI
     esp_matter::console::otcli_register_commands();
 #endif
@@ -252,12 +365,17 @@ static esp_err_t app_create_pump(gpio_pump_t *pPump, node_t *pNode)
             return ESP_FAIL;
         }
 
+        // Add flow measurement and irrigation accounting clusters
+        err = pump_task_add_clusters(endpoint);
         if (err != ESP_OK) {
             ESP_LOGE(TAG, "Failed to initialize pump");
         }
 
         pumps_config[i].gpio = pPump[i].GPIO_PIN_VALUE;
         pumps_config[i].endpoint_id = endpoint::get_id(endpoint);
+        flowmeters_config.endpoint_id[i] = pumps_config[i].endpoint_id;
+        interlock_config.endpoint_id[i] = pumps_config[i].endpoint_id;
+        pump_stats_config.endpoint_id[i] = pumps_config[i].endpoint_id;
 
         // Get Endpoints Id
         ESP_LOGI(TAG, "Pump %d created with endpoint_id %d", i, pumps_config[i].endpoint_id);
@@ -291,13 +409,20 @@ static esp_err_t app_create_sm_sensor(an_sensor_config_t *pConfig, node_t *pNode
             return ESP_FAIL;
         }
 
+        // Drying forecast of the soil moisture probes
+        if (i < FORECAST_QTY) {
+            err = forecast_task_add_clusters(endpoint);
+            forecast_config.endpoint_id[i] = endpoint::get_id(endpoint);
+        }
+
         if (err != ESP_OK) {
             ESP_LOGE(TAG, "Failed to initialize soil sensor");
             return ESP_FAIL;
         }
 
         pConfig[i].endpoint_id = endpoint::get_id(endpoint);
-        pConfig[i].cb = humidity_sensor_notification;
+        pConfig[i].cb = soil_sensor_notification;
+        pConfig[i].user_data = (void *)(intptr_t)(IRRIGATION_FEATURE_SM1 + i); // SM1..SM4 then WL1, same order as the model features
 
         // Get Endpoints Id
         ESP_LOGI(TAG, "Soil sensor %d created with endpoint_id %d", i, pConfig[i].endpoint_id);
@@ -313,6 +438,8 @@ static esp_err_t app_create_sm_sensor(an_sensor_config_t *pConfig, node_t *pNode
  */
 static void temp_sensor_notification(uint16_t endpoint_id, float temp, void *user_data)
 {
+    irrigation_model_task_set_feature(IRRIGATION_FEATURE_TEMPERATURE, temp);
+
     // schedule the attribute update so that we can report it from matter thread
     chip::DeviceLayer::SystemLayer().ScheduleLambda([endpoint_id, temp]() {
         attribute_t *attribute = attribute::get(endpoint_id,
@@ -349,6 +476,38 @@ static void humidity_sensor_notification(uint16_t endpoint_id, float humidity, v
     });
 }
 
+// Feeds the irrigation model before reporting the soil/water level reading
+static void soil_sensor_notification(uint16_t endpoint_id, float reading, void *user_data)
+{
+    size_t feature = (size_t)(intptr_t)user_data;
+
+    irrigation_model_task_set_feature((irrigation_model_feature_e)feature, reading);
+
+    // Soil probes are wired one per pump zone, in the same order
+    // Readings past the dry and wet calibration points are clamped to 0 and 100 %
+    float moisture = COSMOS_MAP(reading, 3000, 1500, 0, 100);
+    if (moisture < 0) {
+        moisture = 0;
+    } else if (moisture > 100) {
+        moisture = 100;
+    }
+    if (feature < PUMP_QTY) {
+        schedule_task_set_soil_moisture(feature, moisture);
+    }
+    if (feature < FORECAST_QTY) {
+        forecast_task_add_sample(feature, moisture);
+    }
+
+    humidity_sensor_notification(endpoint_id, reading, user_data);
+}
+
+// Feeds the irrigation model before reporting the BME680 humidity
+static void air_humidity_notification(uint16_t endpoint_id, float humidity, void *user_data)
+{
+    irrigation_model_task_set_feature(IRRIGATION_FEATURE_HUMIDITY, humidity);
+    humidity_sensor_notification(endpoint_id, humidity, user_data);
+}
+
 /*
  * Application cluster specification, 2.4.5.1. Pressure
  * represents the pressure in Kilopascals (kPa).
@@ -357,6 +516,8 @@ static void humidity_sensor_notification(uint16_t endpoint_id, float humidity, v
  */
 static void pressure_sensor_notification(uint16_t endpoint_id, float pressure, void *user_data)
 {
+    irrigation_model_task_set_feature(IRRIGATION_FEATURE_PRESSURE, pressure);
+
     // schedule the attribute update so that we can report it from matter thread
     chip::DeviceLayer::SystemLayer().ScheduleLambda([endpoint_id, pressure]() {
         attribute_t *attribute = attribute::get(endpoint_id,
@@ -371,6 +532,128 @@ static void pressure_sensor_notification(uint16_t endpoint_id, float pressure, v
     });
 }
 
+/*
+ * Application cluster specification, 2.5.5.1. Flow
+ * represents the flow in m3/h.
+ * flow = (flow in m3/h) x 10 = (flow in l/min) x 0.6
+ *
+ */
+static void flow_rate_notification(uint16_t endpoint_id, float litres_per_min, void *user_data)
+{
+    // schedule the attribute update so that we can report it from matter thread
+    chip::DeviceLayer::SystemLayer().ScheduleLambda([endpoint_id, litres_per_min]() {
+        attribute_t *attribute = attribute::get(endpoint_id,
+                                                FlowMeasurement::Id,
+                                                FlowMeasurement::Attributes::MeasuredValue::Id);
+
+        esp_matter_attr_val_t val = esp_matter_invalid(NULL);
+        attribute::get_val(attribute, &val);
+        val.val.u16 = static_cast<uint16_t>(litres_per_min * 0.6f);
+
+        attribute::update(endpoint_id, FlowMeasurement::Id, FlowMeasurement::Attributes::MeasuredValue::Id, &val);
+    });
+}
+
+// Litres delivered per irrigation run, reported on the manufacturer specific pump cluster in millilitres
+static void pump_volume_notification(uint16_t endpoint_id, float run_litres, float total_litres, void *user_data)
+{
+    for (size_t i = 0; i < PUMP_QTY; i++) {
+        if (pumps_config[i].endpoint_id == endpoint_id) {
+            pump_stats_task_add_volume(i, run_litres);
+        }
+    }
+
+    // schedule the attribute update so that we can report it from matter thread
+    chip::DeviceLayer::SystemLayer().ScheduleLambda([endpoint_id, run_litres, total_litres]() {
+        esp_matter_attr_val_t run_val = esp_matter_uint32(static_cast<uint32_t>(run_litres * 1000));
+        esp_matter_attr_val_t total_val = esp_matter_uint32(static_cast<uint32_t>(total_litres * 1000));
+
+        attribute::update(endpoint_id, PUMP_CLUSTER_ID, PUMP_ATTR_LAST_RUN_VOLUME_ML, &run_val);
+        attribute::update(endpoint_id, PUMP_CLUSTER_ID, PUMP_ATTR_TOTAL_VOLUME_ML, &total_val);
+    });
+}
+
+// Dry-run fault, the pump GPIOs are already off when this is called
+static void dry_run_notification(uint16_t endpoint_id, bool fault, void *user_data)
+{
+    // schedule the attribute update so that we can report it from matter thread
+    chip::DeviceLayer::SystemLayer().ScheduleLambda([endpoint_id, fault]() {
+        esp_matter_attr_val_t fault_val = esp_matter_bool(fault);
+        attribute::update(endpoint_id, PUMP_CLUSTER_ID, PUMP_ATTR_DRY_RUN_FAULT, &fault_val);
+
+        // Keep the OnOff attribute in line with the real pump state
+        if (fault) {
+            esp_matter_attr_val_t on_off_val = esp_matter_bool(false);
+            attribute::update(endpoint_id, OnOff::Id, OnOff::Attributes::OnOff::Id, &on_off_val);
+        }
+    });
+}
+
+// Scheduled runs go through the OnOff attribute, pump_task drives the GPIO and enforces the interlock
+static void schedule_pump_notification(size_t zone, bool on, void *user_data)
+{
+    uint16_t endpoint_id = pumps_config[zone].endpoint_id;
+
+    // schedule the attribute update so that we can report it from matter thread
+    chip::DeviceLayer::SystemLayer().ScheduleLambda([endpoint_id, on]() {
+        esp_matter_attr_val_t on_off_val = esp_matter_bool(on);
+        attribute::update(endpoint_id, OnOff::Id, OnOff::Attributes::OnOff::Id, &on_off_val);
+    });
+}
+
+// Drying rate in 0.01 %/h and minutes until the probe reaches its dry threshold
+static void drying_forecast_notification(uint16_t endpoint_id, float rate_pct_h, float hours_to_dry, void *user_data)
+{
+    // schedule the attribute update so that we can report it from matter thread
+    chip::DeviceLayer::SystemLayer().ScheduleLambda([endpoint_id, rate_pct_h, hours_to_dry]() {
+        esp_matter_attr_val_t rate_val = esp_matter_int16(static_cast<int16_t>(rate_pct_h * 100));
+        esp_matter_attr_val_t minutes_val = esp_matter_uint32(FORECAST_MINUTES_UNKNOWN);
+
+        if (hours_to_dry != DRYING_FORECAST_NEVER) {
+            minutes_val.val.u32 = static_cast<uint32_t>(hours_to_dry * 60);
+        }
+
+        attribute::update(endpoint_id, FORECAST_CLUSTER_ID, FORECAST_ATTR_DRYING_RATE, &rate_val);
+        attribute::update(endpoint_id, FORECAST_CLUSTER_ID, FORECAST_ATTR_MINUTES_TO_DRY, &minutes_val);
+    });
+}
+
+// Lifetime counters of a pump, on the manufacturer specific pump cluster
+static void pump_stats_notification(uint16_t endpoint_id, const pump_stats_t *pStats, void *user_data)
+{
+    pump_stats_t stats = *pStats;
+
+    // schedule the attribute update so that we can report it from matter thread
+    chip::DeviceLayer::SystemLayer().ScheduleLambda([endpoint_id, stats]() {
+        esp_matter_attr_val_t on_time_val = esp_matter_uint32(stats.on_time_s);
+        esp_matter_attr_val_t cycles_val = esp_matter_uint32(stats.cycles);
+        esp_matter_attr_val_t last_run_val = esp_matter_uint32(stats.last_run_s);
+        esp_matter_attr_val_t litres_val = esp_matter_uint32(static_cast<uint32_t>(stats.litres));
+
+        attribute::update(endpoint_id, PUMP_CLUSTER_ID, PUMP_ATTR_ON_TIME_S, &on_time_val);
+        attribute::update(endpoint_id, PUMP_CLUSTER_ID, PUMP_ATTR_CYCLES, &cycles_val);
+        attribute::update(endpoint_id, PUMP_CLUSTER_ID, PUMP_ATTR_LAST_RUN_S, &last_run_val);
+        attribute::update(endpoint_id, PUMP_CLUSTER_ID, PUMP_ATTR_LIFETIME_VOLUME_L, &litres_val);
+    });
+}
+
+// Gas resistance is not exposed to Matter yet, it only feeds the irrigation model
+static void air_quality_notification(uint16_t endpoint_id, float gas_resistance, void *user_data)
+{
+    irrigation_model_task_set_feature(IRRIGATION_FEATURE_AIR_QUALITY, gas_resistance);
+}
+
+static void irrigation_model_notification(int prediction, float score, void *user_data)
+{
+    static int last_prediction = 0;
+
+    // Scored every few seconds, only a new suggestion is worth an INFO line
+    if (prediction == 1 && last_prediction != 1) {
+        ESP_LOGI(TAG, "Irrigation model suggests watering (score %.2f)", score);
+    }
+    last_prediction = prediction;
+}
+
 /* static void gas_sensor_notification(uint16_t endpoint_id, float gas_resistance, void *user_data)
 {
     // schedule the attribute update so that we can report it from matter thread
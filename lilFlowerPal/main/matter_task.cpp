@@ -13,8 +13,10 @@
 #include <lvgl_task.h>
 #endif
 
+#include <forecast_task.h>
 #include <matter_task.h>
 #include <pump_task.h>
+#include <schedule_task.h>
 
 static const char *TAG = "matter_task";
 
@@ -30,6 +32,7 @@ void app_event_cb(const ChipDeviceEvent *event, intptr_t arg)
     switch (event->Type) {
     case chip::DeviceLayer::DeviceEventType::kInterfaceIpAddressChanged:
         ESP_LOGI(TAG, "Interface IP Address changed");
+        schedule_task_sync_time();
         break;
 
     case chip::DeviceLayer::DeviceEventType::kCommissioningComplete:
@@ -113,6 +116,10 @@ esp_err_t app_attribute_update_cb(attribute::callback_type_t type, uint16_t endp
 
     if (type == PRE_UPDATE) {
         /* Driver update */
+        if (cluster_id == FORECAST_CLUSTER_ID) {
+            return forecast_task_attribute_update(endpoint_id, cluster_id, attribute_id, val);
+        }
+
         pump_task_handle_t pump_handle = (pump_task_handle_t)priv_data;
         err = pump_task_attribute_update(pump_handle, endpoint_id, cluster_id, attribute_id, val);
     }
@@ -0,0 +1,1452 @@
+// Generated by 5_export_model.py, do not edit by hand.
+#ifndef MAIN_IRRIGATION_FOREST_H_
+#define MAIN_IRRIGATION_FOREST_H_
+
+#include <stdint.h>
+
+#define IRRIGATION_FOREST_TREE_QTY    100
+#define IRRIGATION_FOREST_NODE_QTY    4890
+#define IRRIGATION_FOREST_LEAF_QTY    2495
+#define IRRIGATION_FOREST_FEATURE_QTY 9
+#define IRRIGATION_FOREST_LEAF        0xFF
+#define IRRIGATION_FOREST_VOTE_MAX    65535
+
+/**
+ * @brief Flattened RandomForest. Node arrays are indexed by tree_node_base[tree] + node,
+ * child indices are relative to the tree. For leaf nodes left holds the index of the vote,
+ * relative to tree_leaf_base[tree].
+ */
+typedef struct {
+    float offset[IRRIGATION_FOREST_FEATURE_QTY];
+    float scale[IRRIGATION_FOREST_FEATURE_QTY];
+    uint32_t tree_node_base[IRRIGATION_FOREST_TREE_QTY];
+    uint32_t tree_leaf_base[IRRIGATION_FOREST_TREE_QTY];
+    uint8_t feature[IRRIGATION_FOREST_NODE_QTY];
+    int16_t threshold[IRRIGATION_FOREST_NODE_QTY];
+    uint16_t left[IRRIGATION_FOREST_NODE_QTY];
+    uint16_t right[IRRIGATION_FOREST_NODE_QTY];
+    uint16_t leaf_vote[IRRIGATION_FOREST_LEAF_QTY];
+} irrigation_forest_t;
+
+constexpr irrigation_forest_t k_irrigation_forest = {
+    .offset = {
+        2283.5f, 2262.5f, 2238.5f, 2218.5f,
+        1590.5f, 21.8225021f, 56.3225021f, 1010.22498f,
+        78425.75f,
+    },
+    .scale = {
+        51.3698616f, 42.0168076f, 48.74086f, 45.6968765f,
+        27.3348522f, 2183.00879f, 833.738647f, 1589.40393f,
+        0.433173895f,
+    },
+    .tree_node_base = {
+        0, 41, 84, 129, 178, 225, 272, 321, 368, 411, 454, 511, 556, 603, 642, 691,
+        746, 797, 848, 903, 960, 1005, 1038, 1093, 1134, 1185, 1224, 1279, 1340, 1383, 1434, 1487,
+        1526, 1587, 1630, 1675, 1726, 1779, 1838, 1881, 1936, 1991, 2040, 2075, 2120, 2173, 2214, 2259,
+        2302, 2349, 2394, 2445, 2494, 2537, 2580, 2625, 2672, 2727, 2782, 2829, 2872, 2923, 2980, 3033,
+        3086, 3133, 3188, 3241, 3294, 3347, 3390, 3445, 3494, 3547, 3600, 3649, 3702, 3745, 3798, 3853,
+        3900, 3943, 3992, 4037, 4082, 4133, 4182, 4223, 4272, 4315, 4358, 4411, 4462, 4525, 4588, 4629,
+        4682, 4735, 4780, 4835,
+    },
+    .tree_leaf_base = {
+        0, 21, 43, 66, 91, 115, 139, 164, 188, 210, 232, 261, 284, 308, 328, 353,
+        381, 407, 433, 461, 490, 513, 530, 558, 579, 605, 625, 653, 684, 706, 732, 759,
+        779, 810, 832, 855, 881, 908, 938, 960, 988, 1016, 1041, 1059, 1082, 1109, 1130, 1153,
+        1175, 1199, 1222, 1248, 1273, 1295, 1317, 1340, 1364, 1392, 1420, 1444, 1466, 1492, 1521, 1548,
+        1575, 1599, 1627, 1654, 1681, 1708, 1730, 1758, 1783, 1810, 1837, 1862, 1889, 1911, 1938, 1966,
+        1990, 2012, 2037, 2060, 2083, 2109, 2134, 2155, 2180, 2202, 2224, 2251, 2277, 2309, 2341, 2362,
+        2389, 2416, 2439, 2467,
+    },
+    .feature = {
+        2, 5, 6, 255, 7, 1, 255, 255, 255, 3, 6, 255, 255, 255, 1, 2,
+        255, 6, 255, 255, 0, 3, 255, 6, 255, 1, 255, 8, 255, 255, 5, 5,
+        3, 255, 6, 4, 255, 255, 255, 255, 255, 2, 0, 6, 255, 0, 255, 0,
+        255, 5, 255, 255, 7, 255, 255, 5, 1, 255, 5, 255, 1, 255, 0, 7,
+        3, 255, 7, 4, 255, 255, 255, 255, 5, 5, 255, 255, 6, 255, 1, 255,
+        255, 4, 255, 255, 4, 255, 2, 6, 4, 7, 255, 255, 7, 255, 255, 5,
+        3, 1, 255, 255, 255, 255, 3, 0, 8, 255, 255, 4, 255, 8, 255, 255,
+        0, 6, 0, 255, 255, 255, 3, 7, 6, 255, 0, 6, 255, 255, 255, 255,
+        255, 5, 2, 6, 255, 3, 255, 6, 255, 255, 7, 0, 7, 4, 255, 5,
+        255, 255, 255, 6, 3, 255, 1, 255, 0, 6, 255, 4, 255, 3, 255, 1,
+        255, 255, 255, 255, 0, 255, 4, 255, 255, 7, 8, 8, 255, 255, 255, 7,
+        255, 255, 6, 2, 255, 255, 3, 1, 5, 2, 7, 255, 6, 255, 255, 2,
+        255, 255, 0, 255, 4, 6, 255, 6, 255, 255, 7, 255, 255, 4, 255, 255,
+        1, 255, 0, 255, 5, 2, 255, 255, 6, 3, 7, 255, 3, 255, 255, 255,
+        255, 4, 5, 7, 5, 255, 255, 2, 6, 255, 8, 6, 3, 255, 255, 8,
+        7, 7, 255, 255, 255, 255, 8, 255, 255, 2, 1, 255, 255, 255, 0, 4,
+        255, 255, 4, 255, 255, 5, 2, 6, 255, 255, 255, 6, 255, 6, 255, 255,
+        5, 3, 2, 1, 255, 255, 4, 255, 255, 6, 0, 6, 255, 255, 255, 255,
+        3, 7, 6, 255, 2, 255, 1, 255, 3, 255, 6, 255, 255, 5, 7, 255,
+        255, 2, 255, 255, 6, 7, 0, 255, 255, 7, 7, 1, 255, 255, 255, 255,
+        255, 0, 3, 6, 7, 255, 0, 0, 255, 255, 255, 7, 255, 4, 4, 255,
+        255, 255, 255, 5, 2, 7, 255, 4, 6, 255, 255, 255, 3, 255, 4, 255,
+        7, 0, 3, 4, 255, 255, 255, 6, 255, 8, 2, 255, 255, 255, 255, 255,
+        2, 5, 3, 7, 1, 255, 3, 7, 255, 3, 255, 4, 255, 255, 255, 6,
+        255, 8, 255, 3, 6, 5, 255, 255, 255, 255, 6, 255, 255, 4, 255, 4,
+        255, 8, 255, 255, 4, 255, 3, 4, 255, 255, 255, 0, 5, 7, 3, 255,
+        6, 0, 1, 255, 255, 255, 255, 8, 255, 255, 3, 0, 255, 255, 255, 2,
+        3, 5, 255, 255, 0, 255, 255, 5, 6, 2, 255, 0, 255, 255, 4, 255,
+        1, 255, 8, 255, 255, 255, 0, 2, 5, 3, 255, 6, 8, 255, 255, 2,
+        255, 1, 255, 255, 255, 4, 255, 3, 5, 6, 255, 255, 3, 255, 1, 255,
+        8, 255, 255, 6, 7, 255, 0, 1, 255, 4, 255, 0, 255, 255, 255, 7,
+        255, 255, 1, 2, 255, 255, 1, 1, 255, 6, 255, 255, 0, 255, 255, 2,
+        3, 2, 6, 255, 255, 2, 255, 0, 6, 255, 255, 255, 0, 255, 255, 4,
+        255, 1, 0, 8, 255, 255, 255, 2, 4, 255, 255, 5, 0, 255, 1, 6,
+        255, 3, 255, 255, 255, 3, 8, 255, 7, 255, 255, 255, 2, 1, 5, 6,
+        0, 5, 255, 255, 255, 255, 255, 5, 255, 255, 4, 255, 6, 0, 1, 255,
+        255, 255, 0, 0, 5, 255, 6, 255, 255, 5, 2, 255, 7, 255, 255, 6,
+        255, 8, 6, 255, 255, 255, 4, 3, 255, 255, 255, 2, 6, 255, 3, 1,
+        8, 2, 255, 2, 255, 255, 6, 2, 255, 255, 1, 255, 255, 255, 6, 255,
+        5, 3, 255, 1, 255, 255, 255, 4, 255, 5, 7, 0, 255, 255, 0, 255,
+        255, 255, 2, 3, 5, 6, 255, 2, 255, 1, 3, 7, 255, 8, 255, 255,
+        255, 4, 255, 255, 2, 0, 255, 255, 4, 255, 0, 255, 255, 5, 6, 255,
+        4, 255, 255, 2, 7, 0, 255, 255, 255, 255, 2, 2, 255, 255, 2, 255,
+        1, 255, 255, 3, 0, 5, 6, 255, 255, 4, 255, 255, 8, 5, 0, 1,
+        6, 255, 255, 255, 255, 255, 255, 6, 0, 7, 6, 3, 255, 255, 0, 3,
+        255, 255, 255, 8, 255, 255, 4, 255, 6, 1, 255, 7, 255, 2, 255, 255,
+        1, 6, 255, 8, 255, 255, 2, 255, 255, 255, 5, 6, 2, 255, 255, 2,
+        2, 255, 6, 2, 0, 255, 255, 0, 255, 255, 2, 255, 1, 255, 2, 8,
+        255, 1, 255, 255, 1, 255, 0, 255, 255, 5, 8, 255, 1, 255, 255, 255,
+        6, 5, 255, 4, 255, 5, 255, 4, 255, 255, 7, 255, 255, 0, 3, 5,
+        2, 3, 3, 255, 255, 255, 255, 1, 4, 255, 255, 6, 255, 255, 1, 255,
+        255, 6, 6, 255, 1, 4, 255, 2, 255, 255, 255, 3, 1, 5, 6, 1,
+        255, 255, 255, 255, 5, 255, 7, 255, 8, 255, 2, 255, 255, 6, 255, 255,
+        5, 2, 6, 3, 255, 6, 255, 6, 255, 5, 255, 255, 1, 0, 3, 4,
+        3, 255, 3, 255, 255, 3, 255, 255, 255, 1, 7, 3, 255, 255, 3, 255,
+        255, 255, 0, 255, 255, 6, 5, 1, 1, 255, 255, 255, 255, 255, 4, 255,
+        6, 1, 7, 255, 255, 255, 255, 2, 1, 0, 5, 6, 255, 255, 255, 6,
+        255, 5, 255, 255, 255, 7, 0, 2, 255, 255, 3, 2, 255, 6, 255, 255,
+        255, 3, 5, 8, 5, 255, 1, 2, 0, 255, 255, 7, 1, 255, 255, 255,
+        255, 6, 255, 0, 255, 255, 255, 4, 255, 6, 1, 6, 255, 255, 255, 255,
+        3, 6, 255, 7, 5, 255, 2, 4, 255, 255, 7, 8, 7, 255, 255, 2,
+        255, 255, 1, 255, 3, 255, 255, 8, 4, 255, 255, 7, 1, 8, 255, 255,
+        255, 255, 1, 255, 2, 3, 0, 255, 255, 255, 6, 255, 255, 2, 5, 0,
+        6, 255, 4, 255, 5, 255, 255, 255, 1, 0, 255, 255, 255, 0, 255, 4,
+        5, 255, 255, 5, 2, 2, 255, 255, 8, 3, 255, 255, 255, 255, 2, 0,
+        5, 6, 255, 5, 2, 255, 2, 255, 8, 255, 255, 8, 0, 255, 255, 255,
+        255, 3, 255, 7, 6, 255, 255, 255, 6, 5, 0, 255, 255, 2, 8, 255,
+        5, 255, 255, 0, 255, 255, 1, 8, 255, 5, 255, 255, 5, 2, 255, 255,
+        0, 255, 6, 255, 255, 1, 6, 0, 0, 4, 255, 255, 255, 255, 255, 4,
+        255, 3, 6, 255, 4, 5, 7, 5, 255, 255, 6, 1, 255, 5, 255, 255,
+        255, 2, 255, 255, 0, 2, 255, 255, 5, 255, 255, 0, 255, 255, 2, 6,
+        255, 4, 6, 0, 255, 5, 255, 255, 0, 8, 8, 255, 255, 255, 5, 255,
+        255, 5, 8, 255, 255, 255, 5, 0, 5, 8, 3, 255, 255, 255, 255, 2,
+        255, 1, 255, 6, 6, 255, 4, 255, 3, 255, 255, 255, 0, 7, 255, 255,
+        255, 5, 4, 6, 3, 6, 255, 255, 5, 255, 0, 255, 255, 7, 255, 2,
+        2, 255, 3, 1, 255, 7, 255, 255, 6, 255, 5, 255, 255, 255, 6, 2,
+        255, 255, 255, 1, 7, 255, 255, 255, 2, 5, 6, 255, 5, 255, 1, 3,
+        255, 255, 7, 255, 255, 6, 2, 255, 1, 255, 7, 255, 3, 255, 255, 4,
+        6, 3, 255, 8, 255, 255, 0, 1, 255, 255, 255, 255, 2, 0, 255, 4,
+        255, 4, 7, 2, 255, 255, 255, 255, 8, 1, 1, 255, 255, 255, 255, 1,
+        6, 2, 255, 255, 4, 5, 3, 255, 255, 2, 255, 7, 255, 255, 2, 5,
+        255, 255, 255, 5, 2, 7, 255, 1, 0, 255, 5, 255, 255, 255, 5, 6,
+        8, 5, 0, 255, 255, 0, 255, 5, 255, 255, 3, 8, 255, 255, 255, 255,
+        6, 4, 255, 255, 3, 255, 255, 7, 2, 255, 255, 255, 5, 3, 1, 6,
+        3, 255, 255, 5, 255, 8, 0, 255, 255, 7, 255, 7, 255, 6, 255, 255,
+        5, 255, 3, 5, 255, 2, 255, 255, 255, 6, 1, 255, 5, 255, 255, 255,
+        4, 255, 1, 6, 255, 255, 255, 1, 7, 0, 255, 0, 4, 1, 255, 255,
+        255, 7, 255, 8, 255, 255, 3, 255, 255, 7, 5, 255, 6, 0, 255, 8,
+        6, 255, 255, 3, 3, 255, 255, 255, 5, 255, 255, 4, 255, 3, 5, 8,
+        5, 5, 255, 255, 255, 255, 255, 7, 255, 255, 2, 4, 3, 255, 255, 255,
+        0, 6, 8, 255, 3, 255, 255, 0, 255, 4, 255, 5, 255, 255, 3, 6,
+        255, 1, 255, 5, 255, 255, 5, 2, 4, 5, 8, 255, 255, 4, 255, 4,
+        255, 0, 255, 255, 255, 5, 255, 4, 255, 255, 2, 255, 4, 255, 255, 2,
+        0, 6, 255, 5, 8, 255, 255, 6, 255, 255, 2, 7, 255, 1, 255, 255,
+        3, 255, 255, 4, 255, 0, 2, 255, 255, 6, 8, 8, 255, 255, 255, 5,
+        1, 255, 6, 255, 255, 255, 2, 5, 7, 0, 255, 255, 5, 8, 255, 6,
+        255, 255, 5, 6, 5, 4, 255, 255, 255, 0, 255, 255, 255, 255, 1, 3,
+        7, 1, 255, 255, 255, 255, 4, 255, 3, 255, 3, 2, 1, 5, 255, 255,
+        255, 255, 8, 4, 8, 255, 8, 255, 255, 255, 0, 255, 2, 4, 255, 6,
+        255, 255, 255, 0, 5, 4, 1, 6, 1, 255, 255, 255, 2, 255, 255, 1,
+        255, 5, 255, 255, 255, 5, 2, 255, 3, 4, 8, 0, 255, 255, 8, 255,
+        255, 255, 4, 255, 0, 6, 255, 0, 255, 3, 255, 255, 255, 255, 6, 4,
+        255, 2, 6, 255, 2, 7, 255, 255, 3, 255, 255, 7, 255, 5, 3, 255,
+        255, 255, 2, 3, 5, 4, 8, 255, 8, 255, 1, 255, 255, 8, 1, 255,
+        255, 255, 255, 1, 255, 255, 8, 2, 255, 255, 255, 0, 1, 255, 3, 255,
+        1, 4, 7, 255, 255, 6, 255, 255, 7, 7, 4, 255, 5, 255, 255, 6,
+        8, 255, 255, 255, 1, 255, 255, 6, 3, 3, 3, 255, 6, 255, 255, 255,
+        2, 5, 255, 255, 255, 3, 255, 3, 3, 255, 5, 255, 255, 255, 3, 7,
+        4, 255, 7, 2, 255, 255, 255, 0, 1, 6, 8, 255, 255, 5, 4, 255,
+        1, 255, 255, 255, 4, 255, 255, 255, 4, 0, 255, 255, 8, 5, 6, 0,
+        255, 7, 255, 2, 255, 255, 255, 255, 0, 255, 5, 8, 255, 255, 2, 1,
+        255, 255, 255, 3, 0, 0, 255, 1, 8, 255, 255, 255, 2, 3, 255, 4,
+        255, 255, 6, 7, 255, 6, 5, 2, 255, 255, 255, 2, 255, 5, 255, 4,
+        255, 255, 5, 1, 255, 255, 0, 255, 255, 0, 5, 3, 255, 7, 255, 255,
+        255, 0, 8, 1, 255, 255, 7, 255, 4, 255, 255, 1, 255, 255, 6, 2,
+        3, 255, 8, 5, 255, 6, 255, 255, 255, 1, 255, 0, 6, 3, 4, 255,
+        255, 255, 2, 8, 255, 255, 5, 1, 255, 255, 0, 6, 255, 255, 255, 255,
+        5, 7, 0, 255, 255, 255, 1, 255, 255, 4, 4, 255, 2, 255, 255, 0,
+        2, 255, 2, 7, 5, 255, 7, 255, 0, 255, 6, 255, 255, 2, 255, 255,
+        5, 255, 255, 1, 255, 5, 4, 6, 4, 5, 255, 2, 6, 255, 255, 255,
+        1, 1, 255, 255, 255, 8, 255, 6, 255, 255, 255, 8, 255, 8, 255, 255,
+        0, 3, 6, 255, 2, 255, 5, 1, 255, 2, 255, 255, 2, 255, 255, 255,
+        2, 6, 7, 255, 255, 1, 4, 2, 255, 255, 255, 0, 255, 255, 0, 5,
+        3, 255, 255, 6, 255, 2, 255, 4, 255, 255, 1, 255, 8, 255, 5, 1,
+        255, 255, 1, 6, 255, 255, 255, 5, 2, 0, 4, 255, 2, 255, 255, 1,
+        255, 0, 255, 255, 0, 2, 255, 255, 6, 6, 255, 4, 255, 6, 5, 6,
+        255, 255, 255, 1, 255, 255, 1, 255, 8, 255, 5, 255, 255, 1, 6, 255,
+        255, 8, 3, 1, 255, 255, 255, 255, 6, 5, 0, 255, 1, 255, 255, 4,
+        255, 6, 0, 255, 1, 255, 3, 255, 255, 4, 3, 255, 255, 255, 2, 1,
+        255, 8, 255, 3, 255, 5, 4, 255, 255, 255, 255, 2, 0, 8, 8, 7,
+        255, 255, 255, 0, 8, 5, 255, 255, 255, 5, 7, 255, 255, 255, 6, 7,
+        4, 3, 255, 255, 255, 2, 255, 255, 7, 255, 5, 255, 255, 4, 255, 3,
+        7, 3, 255, 255, 255, 6, 255, 255, 5, 2, 2, 255, 5, 255, 255, 4,
+        5, 3, 255, 255, 255, 3, 5, 4, 255, 255, 8, 255, 8, 2, 255, 3,
+        255, 255, 255, 255, 1, 3, 1, 255, 255, 255, 0, 255, 6, 2, 8, 5,
+        255, 255, 6, 255, 255, 3, 3, 255, 255, 4, 255, 255, 255, 1, 0, 2,
+        255, 255, 2, 255, 255, 2, 6, 255, 0, 6, 4, 255, 255, 5, 255, 255,
+        255, 5, 6, 3, 255, 4, 255, 0, 2, 255, 255, 2, 255, 7, 1, 7,
+        255, 255, 255, 255, 255, 255, 5, 6, 4, 255, 2, 0, 8, 8, 255, 255,
+        3, 255, 1, 255, 255, 255, 0, 7, 4, 255, 255, 255, 1, 255, 3, 5,
+        255, 255, 255, 5, 255, 4, 255, 255, 3, 1, 255, 255, 2, 255, 2, 1,
+        255, 255, 255, 0, 2, 6, 6, 7, 255, 255, 255, 255, 1, 5, 7, 6,
+        8, 255, 2, 255, 4, 255, 255, 255, 255, 5, 255, 8, 255, 255, 255, 5,
+        6, 255, 255, 5, 6, 2, 255, 4, 255, 255, 1, 255, 255, 255, 6, 8,
+        2, 255, 255, 6, 255, 2, 1, 255, 1, 255, 2, 255, 255, 4, 255, 255,
+        5, 1, 0, 255, 0, 255, 3, 255, 8, 2, 255, 255, 255, 5, 255, 6,
+        4, 255, 255, 255, 0, 4, 7, 255, 255, 255, 2, 255, 255, 5, 6, 4,
+        255, 7, 255, 255, 2, 1, 3, 5, 6, 2, 255, 255, 5, 255, 3, 255,
+        255, 6, 255, 4, 255, 255, 255, 3, 255, 255, 1, 255, 255, 7, 4, 255,
+        1, 4, 255, 3, 255, 255, 255, 0, 255, 255, 4, 0, 255, 8, 255, 255,
+        2, 4, 8, 0, 255, 3, 255, 255, 1, 255, 5, 255, 255, 4, 255, 6,
+        2, 1, 0, 255, 255, 255, 6, 255, 255, 255, 3, 6, 255, 0, 255, 4,
+        255, 5, 255, 255, 6, 0, 255, 255, 5, 8, 255, 255, 255, 7, 5, 3,
+        4, 8, 255, 255, 255, 0, 255, 6, 255, 255, 5, 6, 255, 5, 255, 2,
+        255, 255, 255, 3, 5, 3, 255, 2, 1, 1, 3, 6, 255, 255, 255, 255,
+        255, 7, 255, 255, 2, 255, 255, 1, 255, 3, 255, 4, 255, 255, 6, 0,
+        255, 2, 255, 4, 255, 2, 2, 255, 255, 255, 3, 2, 6, 7, 255, 255,
+        0, 255, 0, 255, 255, 255, 0, 5, 5, 255, 7, 255, 255, 255, 2, 255,
+        3, 1, 6, 255, 255, 255, 0, 255, 255, 6, 2, 2, 5, 4, 255, 255,
+        255, 7, 255, 4, 255, 255, 255, 3, 5, 2, 1, 7, 255, 3, 255, 255,
+        4, 7, 255, 255, 255, 7, 255, 1, 255, 255, 0, 3, 7, 6, 255, 255,
+        255, 255, 255, 255, 5, 2, 3, 6, 255, 8, 0, 5, 2, 255, 8, 255,
+        2, 255, 255, 8, 255, 255, 7, 0, 255, 255, 255, 255, 3, 255, 255, 3,
+        1, 6, 4, 255, 1, 255, 255, 255, 6, 255, 255, 255, 2, 7, 255, 255,
+        255, 5, 0, 8, 4, 2, 255, 3, 255, 6, 255, 255, 8, 255, 255, 4,
+        255, 255, 6, 7, 255, 8, 255, 7, 5, 3, 255, 255, 255, 7, 3, 6,
+        255, 255, 255, 255, 255, 4, 255, 4, 255, 7, 3, 255, 255, 2, 255, 255,
+        0, 2, 5, 8, 3, 6, 6, 5, 255, 4, 255, 5, 255, 255, 255, 255,
+        255, 255, 6, 4, 255, 8, 255, 255, 255, 6, 255, 255, 3, 6, 1, 255,
+        5, 7, 255, 6, 4, 255, 255, 255, 255, 5, 8, 255, 255, 255, 2, 255,
+        5, 255, 2, 255, 6, 255, 255, 2, 6, 255, 1, 7, 4, 255, 3, 6,
+        4, 255, 255, 255, 255, 255, 255, 7, 0, 8, 6, 5, 1, 255, 255, 5,
+        7, 255, 255, 255, 3, 4, 255, 7, 255, 255, 255, 255, 255, 6, 4, 255,
+        7, 255, 0, 255, 0, 5, 255, 255, 255, 3, 255, 6, 255, 255, 0, 2,
+        5, 5, 255, 6, 255, 5, 2, 255, 255, 255, 255, 3, 5, 7, 4, 255,
+        8, 255, 255, 255, 4, 255, 255, 255, 5, 4, 5, 255, 255, 255, 6, 2,
+        4, 255, 255, 3, 2, 8, 255, 255, 255, 255, 4, 255, 255, 0, 1, 5,
+        2, 3, 5, 255, 255, 255, 7, 255, 255, 4, 255, 1, 4, 255, 7, 255,
+        255, 255, 255, 5, 6, 5, 2, 255, 255, 0, 3, 255, 255, 255, 4, 1,
+        255, 3, 255, 255, 1, 255, 255, 255, 3, 1, 3, 3, 255, 3, 3, 255,
+        255, 1, 255, 4, 1, 255, 255, 255, 3, 255, 6, 255, 8, 255, 3, 6,
+        4, 255, 255, 255, 255, 255, 1, 2, 255, 7, 255, 255, 5, 6, 255, 4,
+        255, 255, 4, 255, 4, 255, 5, 6, 255, 255, 255, 0, 2, 8, 7, 8,
+        255, 255, 3, 4, 255, 255, 255, 5, 6, 6, 3, 255, 255, 255, 255, 0,
+        255, 255, 6, 4, 255, 7, 5, 3, 255, 255, 1, 255, 6, 255, 6, 255,
+        255, 255, 2, 255, 255, 5, 6, 255, 255, 7, 2, 6, 255, 255, 3, 3,
+        255, 255, 255, 255, 1, 1, 7, 0, 255, 7, 4, 255, 255, 255, 255, 3,
+        0, 255, 7, 255, 255, 5, 1, 255, 255, 0, 4, 3, 255, 255, 5, 5,
+        255, 255, 255, 4, 255, 6, 255, 2, 255, 255, 0, 8, 255, 255, 7, 0,
+        0, 4, 255, 255, 255, 255, 6, 255, 255, 2, 5, 6, 255, 4, 255, 5,
+        255, 6, 255, 6, 255, 255, 255, 0, 5, 1, 3, 5, 255, 7, 255, 255,
+        255, 255, 4, 255, 4, 255, 255, 6, 255, 1, 255, 2, 7, 6, 255, 255,
+        255, 2, 255, 2, 255, 6, 255, 5, 255, 8, 255, 8, 255, 255, 0, 255,
+        5, 1, 6, 255, 5, 0, 255, 3, 255, 255, 8, 8, 8, 0, 255, 255,
+        3, 255, 255, 7, 5, 8, 4, 255, 255, 5, 255, 5, 255, 255, 4, 255,
+        255, 255, 255, 255, 8, 8, 8, 255, 8, 255, 255, 255, 255, 3, 5, 0,
+        7, 0, 7, 255, 0, 255, 255, 6, 8, 4, 255, 5, 255, 255, 255, 255,
+        8, 8, 255, 6, 255, 255, 255, 1, 8, 255, 3, 6, 255, 255, 2, 255,
+        255, 255, 1, 0, 1, 6, 255, 255, 255, 255, 5, 4, 255, 255, 255, 0,
+        1, 255, 255, 255, 6, 0, 255, 7, 255, 4, 255, 6, 255, 1, 255, 255,
+        2, 7, 2, 5, 255, 255, 255, 3, 255, 8, 3, 255, 255, 0, 255, 5,
+        255, 255, 1, 2, 255, 2, 255, 255, 3, 6, 8, 255, 2, 255, 255, 255,
+        5, 1, 255, 255, 7, 1, 255, 255, 255, 5, 3, 0, 4, 1, 7, 6,
+        255, 255, 6, 8, 255, 255, 4, 255, 5, 255, 255, 255, 0, 255, 1, 2,
+        255, 255, 255, 7, 5, 255, 4, 3, 255, 7, 7, 255, 255, 255, 255, 7,
+        8, 255, 255, 255, 6, 4, 255, 255, 255, 2, 255, 4, 255, 255, 6, 4,
+        255, 5, 2, 0, 255, 255, 1, 255, 2, 6, 255, 6, 4, 255, 4, 255,
+        255, 255, 1, 1, 255, 7, 255, 255, 255, 6, 255, 1, 255, 255, 7, 0,
+        4, 5, 255, 255, 2, 255, 8, 255, 3, 255, 255, 4, 2, 255, 255, 3,
+        255, 255, 255, 2, 6, 255, 5, 255, 3, 6, 255, 255, 255, 3, 0, 2,
+        255, 3, 3, 255, 7, 255, 255, 255, 255, 0, 3, 1, 255, 255, 255, 1,
+        255, 4, 255, 5, 3, 7, 255, 255, 255, 6, 255, 3, 255, 255, 6, 4,
+        255, 3, 0, 7, 255, 255, 255, 2, 255, 1, 7, 255, 0, 255, 255, 255,
+        0, 5, 8, 255, 1, 2, 3, 255, 5, 255, 255, 255, 255, 4, 0, 3,
+        255, 255, 255, 6, 255, 255, 5, 0, 4, 3, 255, 4, 255, 7, 8, 255,
+        255, 255, 255, 255, 255, 2, 3, 0, 7, 5, 8, 6, 255, 255, 6, 255,
+        8, 255, 255, 255, 5, 255, 1, 255, 255, 5, 255, 255, 255, 1, 3, 6,
+        255, 255, 255, 5, 6, 1, 5, 4, 4, 255, 255, 255, 2, 255, 255, 255,
+        0, 255, 0, 255, 255, 255, 2, 0, 6, 255, 3, 255, 1, 8, 5, 1,
+        255, 255, 255, 255, 255, 6, 4, 255, 4, 255, 255, 255, 5, 6, 1, 255,
+        7, 255, 8, 5, 2, 255, 255, 255, 5, 255, 255, 5, 1, 255, 255, 255,
+        0, 255, 5, 4, 255, 3, 3, 255, 255, 255, 255, 3, 2, 3, 255, 7,
+        7, 3, 0, 255, 255, 255, 6, 255, 255, 6, 255, 4, 255, 7, 255, 255,
+        5, 0, 255, 2, 0, 255, 4, 255, 255, 255, 5, 6, 255, 7, 255, 255,
+        255, 4, 255, 0, 4, 255, 255, 1, 2, 255, 255, 4, 255, 8, 255, 255,
+        5, 0, 1, 6, 8, 255, 255, 4, 255, 7, 255, 255, 255, 3, 8, 0,
+        6, 255, 255, 5, 1, 255, 3, 255, 5, 255, 255, 255, 255, 1, 255, 8,
+        255, 255, 8, 7, 255, 1, 255, 255, 7, 255, 7, 255, 0, 1, 255, 255,
+        255, 1, 3, 255, 0, 6, 2, 255, 255, 255, 8, 1, 255, 255, 255, 6,
+        0, 4, 1, 255, 255, 255, 3, 1, 255, 255, 7, 255, 0, 255, 1, 255,
+        1, 255, 255, 5, 0, 1, 255, 255, 6, 6, 255, 255, 5, 4, 2, 255,
+        255, 255, 3, 255, 255, 255, 4, 255, 5, 1, 255, 6, 5, 2, 255, 255,
+        255, 1, 3, 5, 255, 4, 255, 5, 255, 255, 0, 7, 255, 255, 255, 255,
+        6, 7, 8, 7, 255, 255, 255, 4, 255, 1, 5, 255, 255, 6, 255, 255,
+        255, 3, 5, 6, 255, 2, 4, 255, 3, 255, 1, 255, 255, 255, 6, 2,
+        255, 7, 255, 0, 255, 255, 255, 6, 0, 8, 1, 255, 255, 5, 8, 255,
+        6, 255, 255, 4, 255, 255, 3, 0, 5, 255, 4, 255, 2, 255, 7, 255,
+        1, 255, 255, 255, 255, 255, 2, 6, 255, 5, 0, 7, 255, 5, 255, 0,
+        255, 255, 5, 7, 255, 255, 255, 1, 255, 8, 5, 255, 255, 255, 6, 5,
+        3, 6, 255, 6, 1, 255, 255, 8, 255, 255, 255, 7, 255, 6, 255, 7,
+        255, 255, 8, 4, 8, 1, 255, 255, 255, 255, 8, 255, 255, 3, 2, 6,
+        255, 7, 7, 255, 255, 255, 5, 1, 4, 6, 255, 255, 255, 2, 255, 3,
+        255, 255, 0, 2, 255, 255, 6, 255, 4, 255, 4, 255, 3, 255, 255, 5,
+        255, 4, 255, 5, 5, 3, 255, 3, 255, 255, 255, 255, 5, 3, 2, 6,
+        255, 6, 5, 255, 255, 255, 1, 4, 2, 3, 255, 255, 255, 255, 0, 3,
+        255, 255, 255, 8, 255, 0, 255, 6, 4, 255, 255, 255, 4, 255, 4, 8,
+        255, 3, 255, 255, 5, 255, 255, 1, 6, 255, 6, 7, 3, 0, 255, 255,
+        255, 255, 255, 5, 4, 7, 255, 2, 6, 255, 255, 7, 1, 255, 8, 6,
+        255, 255, 0, 255, 0, 255, 255, 255, 2, 255, 255, 3, 6, 7, 255, 8,
+        255, 8, 255, 255, 255, 4, 255, 255, 2, 4, 1, 6, 255, 0, 255, 5,
+        0, 3, 255, 8, 255, 255, 3, 255, 255, 255, 1, 255, 255, 3, 4, 255,
+        255, 255, 4, 255, 6, 1, 255, 0, 5, 255, 255, 255, 5, 2, 1, 255,
+        8, 255, 255, 255, 255, 2, 6, 255, 8, 0, 2, 1, 7, 255, 255, 255,
+        3, 255, 5, 255, 255, 1, 255, 255, 255, 6, 5, 3, 8, 255, 255, 4,
+        255, 0, 255, 1, 6, 255, 255, 255, 5, 5, 255, 2, 255, 255, 255, 5,
+        255, 255, 0, 8, 5, 6, 255, 4, 4, 255, 5, 255, 1, 255, 255, 1,
+        6, 3, 255, 255, 255, 6, 2, 255, 255, 255, 0, 3, 3, 255, 255, 6,
+        255, 255, 255, 0, 255, 5, 8, 255, 255, 6, 255, 7, 255, 4, 255, 255,
+        6, 5, 255, 255, 255, 2, 3, 2, 1, 7, 5, 1, 255, 255, 255, 255,
+        255, 6, 255, 2, 255, 0, 255, 3, 255, 255, 8, 255, 255, 4, 3, 255,
+        0, 6, 255, 255, 1, 3, 255, 3, 255, 255, 255, 6, 255, 2, 0, 255,
+        0, 255, 5, 255, 255, 255, 2, 5, 8, 4, 5, 0, 6, 255, 3, 255,
+        255, 255, 1, 255, 8, 5, 255, 255, 255, 255, 0, 255, 255, 2, 255, 255,
+        6, 4, 255, 1, 7, 255, 255, 5, 3, 255, 255, 255, 3, 255, 255, 0,
+        6, 0, 8, 6, 255, 255, 255, 4, 255, 255, 1, 5, 255, 4, 255, 255,
+        3, 255, 255, 3, 6, 6, 255, 2, 4, 255, 255, 255, 5, 7, 255, 255,
+        255, 5, 7, 3, 255, 255, 255, 6, 1, 255, 2, 255, 4, 255, 255, 255,
+        2, 6, 7, 4, 5, 3, 8, 3, 255, 5, 255, 255, 255, 255, 255, 255,
+        255, 5, 4, 3, 255, 6, 255, 255, 0, 255, 3, 255, 255, 5, 2, 255,
+        7, 255, 255, 255, 5, 0, 255, 255, 4, 255, 255, 2, 5, 255, 6, 255,
+        3, 5, 7, 255, 255, 255, 255, 5, 7, 8, 4, 255, 255, 6, 7, 0,
+        255, 1, 4, 255, 255, 255, 255, 3, 1, 255, 255, 5, 255, 255, 5, 255,
+        255, 8, 255, 6, 255, 255, 2, 5, 3, 1, 255, 6, 255, 3, 6, 8,
+        255, 255, 255, 5, 2, 3, 255, 255, 255, 255, 8, 255, 6, 255, 4, 255,
+        255, 6, 4, 255, 6, 255, 255, 4, 5, 255, 255, 1, 255, 255, 3, 3,
+        2, 5, 255, 255, 255, 255, 6, 4, 255, 255, 255, 2, 5, 4, 6, 255,
+        255, 4, 255, 255, 3, 2, 255, 8, 255, 255, 255, 3, 0, 2, 1, 3,
+        7, 255, 0, 255, 1, 255, 255, 5, 255, 255, 255, 255, 1, 6, 255, 4,
+        6, 255, 4, 255, 255, 5, 255, 255, 255, 4, 255, 6, 255, 255, 0, 3,
+        4, 8, 255, 6, 6, 5, 6, 255, 255, 255, 255, 5, 5, 255, 8, 255,
+        255, 8, 6, 255, 255, 255, 1, 6, 7, 255, 7, 255, 255, 255, 8, 255,
+        255, 2, 3, 255, 255, 2, 255, 3, 255, 255, 5, 5, 255, 255, 6, 4,
+        255, 2, 4, 255, 255, 2, 255, 8, 255, 255, 6, 255, 255, 0, 1, 4,
+        1, 7, 4, 255, 255, 2, 255, 7, 2, 255, 255, 255, 1, 0, 8, 3,
+        255, 255, 255, 255, 7, 5, 1, 255, 8, 255, 255, 255, 255, 5, 255, 0,
+        255, 255, 3, 255, 255, 5, 4, 7, 3, 255, 2, 255, 255, 2, 255, 2,
+        255, 0, 255, 255, 3, 255, 4, 5, 255, 255, 255, 255, 5, 1, 6, 2,
+        255, 255, 3, 4, 255, 7, 255, 255, 1, 255, 255, 3, 2, 8, 5, 255,
+        1, 255, 255, 3, 255, 255, 255, 2, 0, 255, 255, 255, 4, 4, 255, 255,
+        4, 255, 5, 255, 255, 6, 0, 8, 0, 255, 255, 255, 2, 255, 255, 2,
+        3, 0, 4, 5, 255, 2, 255, 255, 1, 3, 7, 255, 255, 255, 255, 8,
+        255, 0, 255, 5, 255, 255, 2, 2, 0, 255, 255, 255, 4, 255, 5, 255,
+        255, 7, 3, 255, 5, 255, 7, 255, 255, 255, 5, 3, 6, 255, 8, 255,
+        3, 255, 5, 255, 255, 6, 6, 255, 1, 8, 255, 255, 8, 0, 255, 2,
+        1, 255, 255, 255, 7, 8, 4, 255, 0, 255, 255, 255, 255, 1, 255, 1,
+        255, 255, 1, 8, 8, 255, 255, 255, 4, 255, 8, 255, 0, 255, 255, 2,
+        0, 5, 8, 6, 255, 8, 255, 255, 255, 255, 3, 5, 255, 255, 255, 0,
+        255, 6, 3, 255, 0, 4, 255, 5, 255, 7, 255, 7, 255, 255, 4, 255,
+        255, 5, 2, 7, 8, 255, 255, 255, 255, 4, 255, 255, 5, 3, 2, 6,
+        255, 4, 3, 6, 6, 255, 255, 255, 3, 0, 255, 255, 7, 8, 3, 255,
+        255, 255, 255, 0, 5, 255, 0, 255, 255, 255, 6, 5, 6, 1, 255, 255,
+        255, 255, 255, 8, 255, 255, 6, 2, 7, 4, 255, 255, 255, 5, 2, 255,
+        255, 255, 255, 6, 4, 255, 5, 6, 255, 7, 255, 255, 1, 255, 0, 3,
+        255, 255, 2, 6, 255, 255, 255, 1, 3, 2, 255, 255, 7, 255, 1, 255,
+        1, 255, 255, 3, 4, 2, 0, 255, 4, 255, 255, 8, 0, 255, 255, 255,
+        2, 255, 3, 255, 255, 2, 8, 255, 255, 255,
+    },
+    .threshold = {
+        -1658, 2559, -26136, 0, -24477, 15798, 0, 0, 0, 7288, -25565, 0, 0, 0, -4328, 1925,
+        0, -13326, 0, 0, -7783, -983, 0, 1098, 0, 14117, 0, -5128, 0, 0, 10298, 8355,
+        -9528, 0, 22859, -26666, 0, 0, 0, 0, 0, -7312, 8681, -26586, 0, -8733, 0, -8451,
+        0, 18495, 0, 0, 7446, 0, 0, 15974, -11975, 0, -19697, 0, -6849, 0, -4393, -4721,
+        1348, 0, -9942, 4797, 0, 0, 0, 0, -12656, -15571, 0, 0, 24284, 0, 12268, 0,
+        0, 27184, 0, 0, -26379, 0, -6288, -13092, 5863, 12723, 0, 0, 11101, 0, 0, 28035,
+        22574, 16869, 0, 0, 0, 0, -9528, 1489, 18038, 0, 0, 10769, 0, -7367, 0, 0,
+        -8168, -1712, -9093, 0, 0, 0, 13617, 29928, 22725, 0, 9426, 29566, 0, 0, 0, 0,
+        0, 16148, -7263, -26190, 0, 6785, 0, -7986, 0, 0, 22005, -7783, -4991, 17453, 0, -14457,
+        0, 0, 0, 22859, -9757, 0, -18173, 0, 10145, -28767, 0, -20297, 0, -6627, 0, -4454,
+        0, 0, 0, 0, 51, 0, -6848, 0, 0, 13788, -23356, -24688, 0, 0, 0, 25708,
+        0, 0, -24073, 25150, 0, 0, 10053, 14159, 13398, 15792, 28831, 0, -11179, 0, 0, 18009,
+        0, 0, -26893, 0, 28195, 773, 0, 19298, 0, 0, -6867, 0, 0, -18602, 0, 0,
+        -11996, 0, -24530, 0, -18922, 6385, 0, 0, 27873, 17022, -3624, 0, 13846, 0, 0, 0,
+        0, 17152, 12142, -26138, -16640, 0, 0, 16864, -23522, 0, 23963, -21417, 12132, 0, 0, -19700,
+        -13916, -17492, 0, 0, 0, 0, 26560, 0, 0, 24394, 4915, 0, 0, 0, -19290, -3978,
+        0, 0, -27882, 0, 0, 4742, 21762, -982, 0, 0, 0, -11796, 0, -5518, 0, 0,
+        -6773, 17364, 17936, 23193, 0, 0, 20063, 0, 0, 25493, -7012, -3734, 0, 0, 0, 0,
+        9139, 10243, 1369, 0, -5630, 0, 1281, 0, -4730, 0, 28224, 0, 0, -2244, 26153, 0,
+        0, 17839, 0, 0, 23726, 12921, -14564, 0, 0, 23499, 22156, 5714, 0, 0, 0, 0,
+        0, -8374, 26755, -14676, -25939, 0, -25069, -30000, 0, 0, 0, -25892, 0, -370, -657, 0,
+        0, 0, 0, 15111, -6288, -22983, 0, -21964, -14851, 0, 0, 0, -9528, 0, -25928, 0,
+        25358, 6113, 137, -24055, 0, 0, 0, -1824, 0, 22434, -293, 0, 0, 0, 0, 0,
+        16206, 12142, 17387, -16578, -11975, 0, 9002, -27426, 0, -9346, 0, 18587, 0, 0, 0, -26190,
+        0, 23758, 0, 15217, 13066, 714, 0, 0, 0, 0, 17752, 0, 0, -27909, 0, 8815,
+        0, 4762, 0, 0, -27144, 0, -2468, 6492, 0, 0, 0, -1439, 16694, 27647, 2924, 0,
+        -5739, -3673, 1974, 0, 0, 0, 0, 14830, 0, 0, -13710, -26944, 0, 0, 0, -7263,
+        6214, 13267, 0, 0, 8296, 0, 0, 15057, 11991, 21299, 0, 11044, 0, 0, -10429, 0,
+        11029, 0, -14722, 0, 0, 0, 9837, -1633, 28035, 2924, 0, -9149, -10870, 0, 0, -3120,
+        0, 19957, 0, 0, 0, -23905, 0, 1850, 2952, -20362, 0, 0, -24814, 0, -24853, 0,
+        21166, 0, 0, 24418, -26440, 0, -11302, -3803, 0, -5877, 0, -18905, 0, 0, 0, -10840,
+        0, 0, -8173, -5898, 0, 0, 12668, 6974, 0, 21445, 0, 0, 12739, 0, 0, -1585,
+        15491, -6288, -26099, 0, 0, -5606, 0, -18494, -8744, 0, 0, 0, -5780, 0, 0, -24288,
+        0, -5316, 1489, 948, 0, 0, 0, -342, -8679, 0, 0, -13683, -7578, 0, 26113, -10024,
+        0, 4683, 0, 0, 0, 1850, 18225, 0, 23841, 0, 0, 0, -7165, 11785, 28035, -6293,
+        15051, 18495, 0, 0, 0, 0, 0, -8531, 0, 0, -25928, 0, -1712, -18750, -21828, 0,
+        0, 0, 7525, -8040, 14577, 0, 9465, 0, 0, -7865, 17839, 0, -8687, 0, 0, 20853,
+        0, 27037, 27194, 0, 0, 0, 26173, -6124, 0, 0, 0, 7213, -25690, 0, 8773, 17962,
+        15383, 4508, 0, 5337, 0, 0, 2970, -24395, 0, 0, 7415, 0, 0, 0, -8186, 0,
+        13823, 19101, 0, 15525, 0, 0, 0, -25422, 0, -13039, -6136, 23450, 0, 0, -13228, 0,
+        0, 0, 14037, 10053, 16148, -26328, 0, -4412, 0, 14159, -3656, 15147, 0, 11938, 0, 0,
+        0, -26146, 0, 0, -16792, -25454, 0, 0, -28415, 0, -18494, 0, 0, -7570, 26948, 0,
+        -3650, 0, 0, -10236, 13223, -14846, 0, 0, 0, 0, 16596, 15645, 0, 0, 24955, 0,
+        2352, 0, 0, 1850, 1001, 16661, -25482, 0, 0, 10004, 0, 0, 24002, 16760, 24991, -7984,
+        -11558, 0, 0, 0, 0, 0, 0, 28886, -10223, 22807, -4584, 7745, 0, 0, -18905, 2810,
+        0, 0, 0, -14315, 0, 0, -26379, 0, 7509, -22206, 0, 17960, 0, -4777, 0, 0,
+        525, 12837, 0, 15764, 0, 0, -16231, 0, 0, 0, 12142, -26616, 25150, 0, 0, 19959,
+        -7312, 0, -4025, 12453, -25069, 0, 0, -2261, 0, 0, -7044, 0, 2268, 0, -1073, 5197,
+        0, 10966, 0, 0, 23025, 0, 821, 0, 0, 5965, 20809, 0, 14453, 0, 0, 0,
+        23901, 21671, 0, -26843, 0, 22916, 0, 27184, 0, 0, -2981, 0, 0, -1439, 18324, 4240,
+        24614, -7906, -8957, 0, 0, 0, 0, -7500, 15854, 0, 0, 28932, 0, 0, -10715, 0,
+        0, -8986, -18612, 0, 10042, -28401, 0, -23104, 0, 0, 0, 18552, 6428, 14969, -4709, 798,
+        0, 0, 0, 0, -18933, 0, 333, 0, -455, 0, 2412, 0, 0, 27332, 0, 0,
+        15974, 14207, -12259, -10374, 0, -26328, 0, -22388, 0, -17939, 0, 0, 23823, 3390, 26755, 29931,
+        15217, 0, 15971, 0, 0, -3633, 0, 0, 0, 14180, -14806, 12955, 0, 0, 15651, 0,
+        0, 0, 6883, 0, 0, 22859, 5168, 1407, -2437, 0, 0, 0, 0, 0, -28839, 0,
+        30000, -7648, -16387, 0, 0, 0, 0, -7312, 20609, 10479, 24728, -26586, 0, 0, 0, -21955,
+        0, 10440, 0, 0, 0, -19296, -18031, 5702, 0, 0, 9002, 1023, 0, 21412, 0, 0,
+        0, 15491, 15974, 24062, -19697, 0, 16386, -4655, 23347, 0, 0, -12763, -4286, 0, 0, 0,
+        0, 13066, 0, -7295, 0, 0, 0, -29987, 0, 25493, -5064, 3828, 0, 0, 0, 0,
+        16679, -26474, 0, -4769, -13017, 0, -9554, 17808, 0, 0, -21481, -5396, -23087, 0, 0, -2364,
+        0, 0, 10987, 0, 1348, 0, 0, 15697, 28920, 0, 0, 23229, 819, 20942, 0, 0,
+        0, 0, -7101, 0, 25247, 17387, 10428, 0, 0, 0, -13001, 0, 0, -488, 11891, 25633,
+        -25690, 0, 19079, 0, -8880, 0, 0, 0, -8257, -4418, 0, 0, 0, -18340, 0, -22921,
+        20744, 0, 0, 2908, 14207, 4167, 0, 0, -18426, 3313, 0, 0, 0, 0, -1633, 10479,
+        24269, -26495, 0, 13398, -7263, 0, -7044, 0, 29039, 0, 0, 3881, -11302, 0, 0, 0,
+        0, -5576, 0, 19017, 27594, 0, 0, 0, 1727, -16640, -848, 0, 0, 25320, 22964, 0,
+        -6806, 0, 0, -7500, 0, 0, 546, 18862, 0, 8879, 0, 0, -13017, 22981, 0, 0,
+        16746, 0, 23934, 0, 0, -10337, -1395, -5317, -23168, 22414, 0, 0, 0, 0, 0, -25887,
+        0, 15491, -14510, 0, 17125, 16388, -23317, 3934, 0, 0, 10548, 12857, 0, -12777, 0, 0,
+        0, -12356, 0, 0, -11764, 5312, 0, 0, -19762, 0, 0, -8502, 0, 0, -1633, -26257,
+        0, 17152, -15648, -19367, 0, 14555, 0, 0, 10479, -28957, -29676, 0, 0, 0, 5539, 0,
+        0, 6969, 29186, 0, 0, 0, 16650, -11661, -10375, -3538, -1508, 0, 0, 0, 0, 1925,
+        0, -3530, 0, 22859, -28362, 0, -26666, 0, -19399, 0, 0, 0, -18494, -23341, 0, 0,
+        0, 12142, 18956, -14518, 17364, -26474, 0, 0, 2548, 0, 513, 0, 0, -26480, 0, 27416,
+        -7385, 0, 15491, 13487, 0, 6683, 0, 0, 3828, 0, -17415, 0, 0, 0, 24418, -8676,
+        0, 0, 0, -7648, -14726, 0, 0, 0, 14037, 3749, -23522, 0, -11489, 0, 14180, 21888,
+        0, 0, -15497, 0, 0, -6293, -23640, 0, -30000, 0, 10315, 0, -11082, 0, 0, 15444,
+        19098, 11607, 0, -12861, 0, 0, 7268, 9684, 0, 0, 0, 0, 24272, -15899, 0, -27527,
+        0, -16948, 23348, 15548, 0, 0, 0, 0, 11516, 7226, 210, 0, 0, 0, 0, -5421,
+        -23727, 6750, 0, 0, 17740, 13965, 22208, 0, 0, -16377, 0, 5284, 0, 0, 6238, 2199,
+        0, 0, 0, 15111, -1706, -15386, 0, 420, -26225, 0, -3335, 0, 0, 0, -8563, 22859,
+        523, -23288, 1720, 0, 0, -15643, 0, -10572, 0, 0, 18827, 25622, 0, 0, 0, 0,
+        11170, -27663, 0, 0, 8453, 0, 0, -15958, 219, 0, 0, 0, 15974, 18233, 13487, -26616,
+        15514, 0, 0, -3990, 0, 11099, 12148, 0, 0, -23190, 0, 17642, 0, 13141, 0, 0,
+        -15713, 0, 1827, 911, 0, 10040, 0, 0, 0, 23859, 19411, 0, -23288, 0, 0, 0,
+        -28839, 0, -9769, 3503, 0, 0, 0, -8656, -15243, -23887, 0, -1028, -10347, -16177, 0, 0,
+        0, -18310, 0, -17240, 0, 0, -24083, 0, 0, -4721, -20668, 0, 24255, -21473, 0, -21293,
+        9381, 0, 0, 1827, 1393, 0, 0, 0, 11346, 0, 0, -25887, 0, 15491, 15057, 29039,
+        -26115, -29346, 0, 0, 0, 0, 0, -2528, 0, 0, -9359, 26241, 16245, 0, 0, 0,
+        -14564, -16215, 2805, 0, -10282, 0, 0, -19393, 0, 9580, 0, -14927, 0, 0, -5667, -4972,
+        0, 4810, 0, 1140, 0, 0, 2941, 16864, 8651, -13300, 24566, 0, 0, -26898, 0, 246,
+        0, -10531, 0, 0, 0, -10703, 0, -26666, 0, 0, 25272, 0, -8816, 0, 0, -829,
+        8501, -25690, 0, 24728, 29186, 0, 0, 14321, 0, 0, -9676, 14217, 0, 16596, 0, 0,
+        753, 0, 0, -24288, 0, -17184, 2412, 0, 0, 1852, -23618, -25554, 0, 0, 0, 17556,
+        9684, 0, 24743, 0, 0, 0, -1633, 24728, -24867, -8143, 0, 0, 2559, 29186, 0, -6206,
+        0, 0, 19761, 7780, 13398, 27170, 0, 0, 0, -14179, 0, 0, 0, 0, -7669, 13686,
+        -23341, -22690, 0, 0, 0, 0, -27978, 0, -23489, 0, 2467, 24467, 8613, 15057, 0, 0,
+        0, 0, -27391, 4851, -27889, 0, -27808, 0, 0, 0, -18237, 0, -342, -6588, 0, 16835,
+        0, 0, 0, -8733, 25819, 18369, 7542, -13980, -3929, 0, 0, 0, -147, 0, 0, -7038,
+        0, 6947, 0, 0, 0, 15308, -6239, 0, 2467, 5015, 19415, 18724, 0, 0, 28516, 0,
+        0, 0, -25067, 0, 28407, 12278, 0, 6113, 0, 10533, 0, 0, 0, 0, -4930, -25887,
+        0, -1658, -25294, 0, -21520, 12039, 0, 0, -23306, 0, 0, -30000, 0, -18169, 137, 0,
+        0, 0, 16108, 19992, 24062, 17152, 24149, 0, 24761, 0, 13823, 0, 0, 21831, -16786, 0,
+        0, 0, 0, 16596, 0, 0, -16000, 19788, 0, 0, 0, -1387, -8656, 0, -9757, 0,
+        42, -15732, 19605, 0, 0, -4584, 0, 0, 12921, -9775, 4797, 0, -14065, 0, 0, -18032,
+        -3226, 0, 0, 0, 13634, 0, 0, 22859, -6627, -8180, -22598, 0, 19278, 0, 0, 0,
+        -7897, -13781, 0, 0, 0, -10488, 0, 27783, 10099, 0, -13300, 0, 0, 0, 3952, -23436,
+        -8707, 0, -24573, 12112, 0, 0, 0, 22910, 16722, -21371, -19596, 0, 0, 29999, 27211, 0,
+        -6198, 0, 0, 0, -12698, 0, 0, 0, -24288, 18364, 0, 0, 4318, 17273, 10861, -8810,
+        0, 12524, 0, 633, 0, 0, 0, 0, -25762, 0, -15211, 18641, 0, 0, -15427, 7752,
+        0, 0, 0, 9847, -20882, -23348, 0, 6092, 5531, 0, 0, 0, -13819, 6785, 0, 7517,
+        0, 0, -5168, -27561, 0, -14676, -7286, 12526, 0, 0, 0, -8774, 0, -14479, 0, -26146,
+        0, 0, 15111, 22205, 0, 0, -13023, 0, 0, -4341, 5473, 13640, 0, 14741, 0, 0,
+        0, 30000, -28278, 7457, 0, 0, 25358, 0, -8761, 0, 0, -6639, 0, 0, 11841, -7263,
+        -11402, 0, -771, 2668, 0, -8915, 0, 0, 0, -19895, 0, 10145, -14518, 21683, -28524, 0,
+        0, 0, 0, 18768, 0, 0, -13137, 11323, 0, 0, -14564, 5742, 0, 0, 0, 0,
+        17273, -27640, 9426, 0, 0, 0, -6786, 0, 0, -24260, -25887, 0, -3144, 0, 0, -5600,
+        -26516, 0, 14037, 23642, 8573, 0, -21195, 0, -13716, 0, -9857, 0, 0, -18790, 0, 0,
+        -11216, 0, 0, -21177, 0, 4054, 28592, 20416, 7038, -29346, 0, -1999, -3054, 0, 0, 0,
+        -2627, -13173, 0, 0, 0, 12083, 0, 27102, 0, 0, 0, 23498, 0, 24002, 0, 0,
+        -8374, 26755, -27224, 0, -1658, 0, 17109, 14117, 0, 706, 0, 0, 6092, 0, 0, 0,
+        -1585, -13080, 17125, 0, 0, 22478, -4880, -7044, 0, 0, 0, 6344, 0, 0, -1465, -19893,
+        9025, 0, 0, -18382, 0, 9723, 0, -27144, 0, 0, -24139, 0, -26718, 0, -27523, -6387,
+        0, 0, -3068, -2721, 0, 0, 0, 15974, -6288, 11352, 27170, 0, -18181, 0, 0, -2921,
+        0, 15128, 0, 0, -7783, -3802, 0, 0, 11286, -29967, 0, -27527, 0, -1587, -17459, -18057,
+        0, 0, 0, 10210, 0, 0, 9684, 0, -14722, 0, -19457, 0, 0, -23845, -1695, 0,
+        0, -21750, 10053, -17690, 0, 0, 0, 0, -665, -12526, -437, 0, 13487, 0, 0, -27978,
+        0, -4751, -25788, 0, 4579, 0, -7266, 0, 0, 5193, 5118, 0, 0, 0, 20178, -4706,
+        0, -27808, 0, 5712, 0, 6358, 29412, 0, 0, 0, 0, 7164, 642, 7575, -25342, -13963,
+        0, 0, 0, -10249, 18681, 11368, 0, 0, 0, 8890, -23174, 0, 0, 0, 11678, 16577,
+        -16210, -1554, 0, 0, 0, -1901, 0, 0, -21434, 0, 14926, 0, 0, -27144, 0, -10031,
+        -18573, -24814, 0, 0, 0, 23609, 0, 0, -3335, -171, -3120, 0, -15887, 0, 0, -5700,
+        -8738, 10761, 0, 0, 0, 20769, -19020, 17671, 0, 0, -9280, 0, 14125, 8139, 0, -9643,
+        0, 0, 0, 0, -12059, -7883, -15925, 0, 0, 0, -23477, 0, 24960, -8798, -7886, 4436,
+        0, 0, -14622, 0, 0, -18051, -21044, 0, 0, -29057, 0, 0, 0, -8656, 1027, 21324,
+        0, 0, -4509, 0, 0, -10017, -25999, 0, 19006, -15923, 505, 0, 0, 20340, 0, 0,
+        0, 15111, 22859, -9643, 0, -25996, 0, -11302, 9236, 0, 0, -7994, 0, -1479, -1492, -15569,
+        0, 0, 0, 0, 0, 0, 15526, 11791, -25887, 0, -7312, 10607, -12792, -19596, 0, 0,
+        4706, 0, 7752, 0, 0, 0, -10377, 21361, -13449, 0, 0, 0, -16555, 0, 0, -13781,
+        0, 0, 0, 9446, 0, 12792, 0, 0, -24677, -16555, 0, 0, -21983, 0, -9871, 3718,
+        0, 0, 0, -1439, -171, -13113, -18783, -2750, 0, 0, 0, 0, 14243, 16650, 24842, -6218,
+        -25554, 0, 24614, 0, -20201, 0, 0, 0, 0, 24345, 0, -25682, 0, 0, 0, -18922,
+        -18887, 0, 0, 15057, 12808, -8798, 0, -27978, 0, 0, 10462, 0, 0, 0, -13092, -24839,
+        -6581, 0, 0, -30001, 0, 24053, -20106, 0, 15294, 0, -1585, 0, 0, 519, 0, 0,
+        17011, 13487, -4316, 0, -3237, 0, 6329, 0, -17412, 13647, 0, 0, 0, -19697, 0, 27873,
+        -28169, 0, 0, 0, -14050, 15854, -18310, 0, 0, 0, -19326, 0, 0, 15974, -21926, -28880,
+        0, -30000, 0, 0, 19082, 18550, 17684, 13398, -21171, -1292, 0, 0, 5397, 0, 14760, 0,
+        0, -14731, 0, 27211, 0, 0, 0, 23168, 0, 0, 714, 0, 0, 14225, -28415, 0,
+        -7648, 2842, 0, -16703, 0, 0, 0, -8502, 0, 0, -24288, 898, 0, 18771, 0, 0,
+        -1658, -7750, -10710, 11840, 0, -4205, 0, 0, -4790, 0, -17557, 0, 0, 4947, 0, 8010,
+        -12137, -9874, -27843, 0, 0, 0, 7614, 0, 0, 0, 3838, -9653, 0, 7782, 0, -10975,
+        0, 11706, 0, 0, 11149, -18673, 0, 0, 10658, 5902, 0, 0, 0, -4117, 3651, 2924,
+        5494, 4447, 0, 0, 0, -10223, 0, 24418, 0, 0, 28668, -1983, 0, 13256, 0, -1511,
+        0, 0, 0, 17364, 18058, -8066, 0, 16864, 1995, -5421, -2994, -14585, 0, 0, 0, 0,
+        0, 12762, 0, 0, -13892, 0, 0, -8908, 0, 22619, 0, -23399, 0, 0, -14952, -25994,
+        0, -27027, 0, -28866, 0, -8165, -10748, 0, 0, 0, 3313, 20203, -13092, 1589, 0, 0,
+        5085, 0, 6678, 0, 0, 0, -10223, 26572, 17251, 0, -18310, 0, 0, 0, -9676, 0,
+        26664, -4118, 10748, 0, 0, 0, 9092, 0, 0, -14518, 25247, -6532, 5211, 21949, 0, 0,
+        0, -29905, 0, -28511, 0, 0, 0, 19992, 15111, 19082, 13487, 27727, 0, 8956, 0, 0,
+        12997, -25566, 0, 0, 0, -15569, 0, 12878, 0, 0, -7629, 5095, -14726, 10365, 0, 0,
+        0, 0, 0, 0, 15974, 8480, 19878, -25690, 0, 30000, 4058, 12983, 2193, 0, -13743, 0,
+        4167, 0, 0, -4994, 0, 0, -20392, 9426, 0, 0, 0, 0, 26115, 0, 0, 18233,
+        13907, -5168, -24028, 0, -14622, 0, 0, 0, 8831, 0, 0, 0, -19326, -9124, 0, 0,
+        0, 16694, -1439, 28959, 28209, 7969, 0, 10144, 0, -18041, 0, 0, 23543, 0, 0, -2556,
+        0, 0, 20416, -19240, 0, -23472, 0, 9743, -11554, 5255, 0, 0, 0, 22800, 23990, -23998,
+        0, 0, 0, 0, 0, -27253, 0, 8815, 0, -14726, -25659, 0, 0, -9627, 0, 0,
+        -4316, 19082, 16694, 29039, 26755, 11841, 11645, 8289, 0, 4168, 0, 15046, 0, 0, 0, 0,
+        0, 0, 17769, 4346, 0, 1206, 0, 0, 0, -28504, 0, 0, 10007, 1160, -26828, 0,
+        3651, -21299, 0, -4709, -25695, 0, 0, 0, 0, 17556, 26105, 0, 0, 0, -21398, 0,
+        -18038, 0, 30000, 0, -13001, 0, 0, -7263, -25999, 0, 20609, 4537, -13449, 0, 17159, 2299,
+        18765, 0, 0, 0, 0, 0, 0, -4117, 9837, 27207, 10861, -11816, 14936, 0, 0, -4361,
+        -14965, 0, 0, 0, 30000, -9349, 0, -9155, 0, 0, 0, 0, 0, 11791, -25791, 0,
+        1207, 0, -28742, 0, -14487, -1196, 0, 0, 0, 11538, 0, 23355, 0, 0, 1566, -171,
+        28035, 4240, 0, -11554, 0, 9119, -15695, 0, 0, 0, 0, 18690, 12535, -4721, 4810, 0,
+        19616, 0, 0, 0, 24765, 0, 0, 0, -13781, 25968, -30001, 0, 0, 0, 23930, -9700,
+        8200, 0, 0, 3130, -342, -12053, 0, 0, 0, 0, -22169, 0, 0, -1439, 15504, 7984,
+        21665, -8614, 5211, 0, 0, 0, 13756, 0, 0, -24561, 0, -7500, -4224, 0, 22927, 0,
+        0, 0, 0, 9818, 12278, -17503, -4046, 0, 0, 8655, 2878, 0, 0, 0, 14104, 20315,
+        0, 12772, 0, 0, -10127, 0, 0, 0, 3952, 17878, -9917, -30000, 0, -22415, -23489, 0,
+        0, 4810, 0, -20584, 10756, 0, 0, 0, -8729, 0, -14839, 0, 18503, 0, -2605, 21520,
+        -18383, 0, 0, 0, 0, 0, -8656, -3169, 0, -12382, 0, 0, -13039, -18499, 0, 30000,
+        0, 0, -28962, 0, 1845, 0, 6085, 6684, 0, 0, 0, 10453, -74, 7885, -24064, -8543,
+        0, 0, -9414, 24833, 0, 0, 0, 8890, 26915, -16048, -10282, 0, 0, 0, 0, -16028,
+        0, 0, 11261, -25449, 0, 6333, -3171, 17067, 0, 0, -30000, 0, 2828, 0, 7009, 0,
+        0, 0, 19471, 0, 0, -18703, -4417, 0, 0, 29825, -9359, 3349, 0, 0, -1600, -3633,
+        0, 0, 0, 0, 8697, -8152, -16157, -23887, 0, -22046, -10839, 0, 0, 0, 0, -8066,
+        5034, 0, -8122, 0, 0, -7570, -6429, 0, 0, -4804, 2227, 23076, 0, 0, 6150, -2855,
+        0, 0, 0, -28948, 0, 23609, 0, 146, 0, 0, -8374, -3019, 0, 0, -7375, 7859,
+        1772, -11153, 0, 0, 0, 0, 25093, 0, 0, -7165, 24640, -26090, 0, 10154, 0, 6194,
+        0, -5022, 0, 15196, 0, 0, 0, -2338, 16367, 13550, 18324, 3356, 0, -12597, 0, 0,
+        0, 0, 26651, 0, 29904, 0, 0, -18737, 0, -10337, 0, -1633, -11555, -2162, 0, 0,
+        0, 9699, 0, 10406, 0, -13001, 0, -21912, 0, 15563, 0, 17904, 0, 0, -20625, 0,
+        15526, 23025, -26474, 0, -16706, 14897, 0, 20609, 0, 0, 25257, -19700, -27472, 11969, 0, 0,
+        8202, 0, 0, 9743, 5561, -3384, 12861, 0, 0, -836, 0, 1424, 0, 0, -10661, 0,
+        0, 0, 0, 0, -5655, -8418, -25682, 0, -17885, 0, 0, 0, 0, 17022, 15526, 5162,
+        906, -10223, -6740, 0, -25274, 0, 0, 8722, 14564, -18657, 0, -22382, 0, 0, 0, 0,
+        29039, 15923, 0, -24014, 0, 0, 0, 22584, -22530, 0, 5460, 12208, 0, 0, -11235, 0,
+        0, 0, -7648, -17672, -17732, 7864, 0, 0, 0, 0, 24062, -25668, 0, 0, 0, -9555,
+        -442, 0, 0, 0, -13092, -25994, 0, -29357, 0, -27882, 0, -15122, 0, 15987, 0, 0,
+        -1268, -14543, -4412, 1784, 0, 0, 0, -28790, 0, -28957, 9527, 0, 0, 10479, 0, 14293,
+        0, 0, -5274, 2705, 0, 21324, 0, 0, 1096, 18381, -18721, 0, 24467, 0, 0, 0,
+        -17361, 23025, 0, 0, -28045, -3467, 0, 0, 0, 15974, 18233, 3056, 18956, 18466, -26003, -27562,
+        0, 0, -26616, 13035, 0, 0, 10715, 0, 9163, 0, 0, 0, -25994, 0, 42, -12405,
+        0, 0, 0, -8687, -18038, 0, -42, -10876, 0, -16832, -24477, 0, 0, 0, 0, 22458,
+        27037, 0, 0, 0, 25493, -28456, 0, 0, 0, -24298, 0, -28839, 0, 0, 11149, -26830,
+        0, 12273, -11674, 7731, 0, 0, -12942, 0, 146, -26044, 0, 10194, 15676, 0, 22783, 0,
+        0, 0, -1366, -3866, 0, -15569, 0, 0, 0, 8581, 0, -8005, 0, 0, 10021, 7397,
+        -12233, 18146, 0, 0, 2193, 0, -11123, 0, 388, 0, 0, 8296, -10918, 0, 0, 7494,
+        0, 0, 0, -4509, -26090, 0, 13398, 0, 4135, 2695, 0, 0, 0, -6809, 9452, -3729,
+        0, -15195, -23237, 0, 2312, 0, 0, 0, 0, -18237, 4912, -3089, 0, 0, 0, -16912,
+        0, -27978, 0, -27446, 27052, 17849, 0, 0, 0, 24284, 0, 6808, 0, 0, -13113, -25449,
+        0, -20907, -15437, 5062, 0, 0, 0, -26686, 0, 17373, 20956, 0, -23656, 0, 0, 0,
+        1566, 16650, -29036, 0, 23025, 19252, 15491, 0, 5604, 0, 0, 0, 0, 6943, -14050, 9139,
+        0, 0, 0, 2695, 0, 0, 9446, 23090, 29029, 4135, 0, -20843, 0, -24302, 6551, 0,
+        0, 0, 0, 0, 0, -1585, 17113, 17054, 23833, 28035, 15551, -26528, 0, 0, -25690, 0,
+        19645, 0, 0, 0, -3335, 0, 4789, 0, 0, -683, 0, 0, 0, -7669, -6032, -17795,
+        0, 0, 0, 15111, 11149, 7941, -8476, -5727, -19203, 0, 0, 0, 28294, 0, 0, 0,
+        -2877, 0, 6035, 0, 0, 0, -1633, 8501, -25690, 0, -28881, 0, -547, 29186, 26299, -1282,
+        0, 0, 0, 0, 0, 28136, -6028, 0, 4346, 0, 0, 0, 2908, 10861, -5064, 0,
+        -20369, 0, 8158, -23528, 11454, 0, 0, 0, -24587, 0, 0, -17274, 9852, 0, 0, 0,
+        -22475, 0, 15111, -27117, 0, 3244, -3314, 0, 0, 0, 0, 10213, -317, -28881, 0, -9736,
+        -17532, 7060, 9529, 0, 0, 0, 2695, 0, 0, -26532, 0, 18478, 0, 26980, 0, 0,
+        5528, -411, 0, 21884, 3724, 0, -11249, 0, 0, 0, 27696, 7251, 0, -17802, 0, 0,
+        0, -28839, 0, -10172, -6739, 0, 0, -9832, -3437, 0, 0, 2542, 0, -23842, 0, 0,
+        10985, -4316, 14138, -27224, -3107, 0, 0, 17671, 0, 26296, 0, 0, 0, 14760, 25677, 9041,
+        -26878, 0, 0, -683, -8173, 0, -6375, 0, -18703, 0, 0, 0, 0, 13907, 0, -23482,
+        0, 0, -24011, -11881, 0, -8005, 0, 0, -12509, 0, -11611, 0, -9709, -8110, 0, 0,
+        0, -12059, -28881, 0, 1489, -24123, 6750, 0, 0, 0, -6383, -25904, 0, 0, 0, -44,
+        -14435, 2870, 13634, 0, 0, 0, -1691, -1093, 0, 0, 15059, 0, -7552, 0, 16596, 0,
+        25147, 0, 0, 16465, 2825, 18550, 0, 0, 11678, 3883, 0, 0, 9010, -10429, -6288, 0,
+        0, 0, 6146, 0, 0, 0, -25887, 0, 5211, -11450, 0, -2958, 4524, -7263, 0, 0,
+        0, 30000, 18530, -12373, 0, 18956, 0, -9884, 0, 0, 7217, -6604, 0, 0, 0, 0,
+        28987, -22046, 14001, -23087, 0, 0, 0, 8118, 0, -11702, 28035, 0, 0, 23930, 0, 0,
+        0, 2878, 12273, -26532, 0, 21177, 18355, 0, -12910, 0, -7038, 0, 0, 0, 17523, -30000,
+        0, -8830, 0, -7834, 0, 0, 0, 26373, -5009, -24260, -4706, 0, 0, 10756, 11903, 0,
+        5571, 0, 0, -22210, 0, 0, 16747, 30000, -21127, 0, -27978, 0, -18108, 0, -3720, 0,
+        -2774, 0, 0, 0, 0, 0, -1585, -26090, 0, 13802, 8501, 27798, 0, -14163, 0, -24992,
+        0, 0, 2352, -18541, 0, 0, 0, -23845, 0, 5214, 24640, 0, 0, 0, 12662, -5049,
+        17364, -26474, 0, 6517, 16050, 0, 0, -17889, 0, 0, 0, -914, 0, -28967, 0, 4204,
+        0, 0, 19338, 6956, 13407, 20483, 0, 0, 0, 0, 22079, 0, 0, 17022, -6312, -26486,
+        0, -11778, -18406, 0, 0, 0, 8169, 9642, 29931, -26616, 0, 0, 0, -3583, 0, -14281,
+        0, 0, -18494, 877, 0, 0, 8718, 0, -27499, 0, 6779, 0, 6146, 0, 0, -26573,
+        0, -28743, 0, 2439, -595, 26092, 0, 30000, 0, 0, 0, 0, 15974, 15491, -1706, -25690,
+        0, -16527, 11368, 0, 0, 0, 12899, 27211, 1949, 11241, 0, 0, 0, 0, -7783, -8637,
+        0, 0, 0, -7784, 0, -4470, 0, -17978, -20037, 0, 0, 0, -27909, 0, 26651, 27241,
+        0, -2011, 0, 0, 24345, 0, 0, -8152, -23727, 0, 3728, -13963, -16040, -19855, 0, 0,
+        0, 0, 0, 3039, 18164, -26345, 0, -342, -26044, 0, 0, 22649, -1009, 0, -23409, 4387,
+        0, 0, -1413, 0, 13227, 0, 0, 0, -8749, 0, 0, 2878, 20862, 5634, 0, -9533,
+        0, 22013, 0, 0, 0, -29987, 0, 0, -1633, 17740, 23193, -25152, 0, -14281, 0, 24728,
+        10479, 15491, 0, 12516, 0, 0, 19444, 0, 0, 0, 26680, 0, 0, -13710, 18765, 0,
+        0, 0, -26379, 0, 1852, -30000, 0, -17184, -17252, 0, 0, 0, 17458, 21884, 11575, 0,
+        -5128, 0, 0, 0, 0, -1633, -25690, 0, 29186, 8501, -21983, -4265, -14536, 0, 0, 0,
+        15491, 0, 5604, 0, 0, 14579, 0, 0, 0, 22859, 7678, 137, 22704, 0, 0, -24096,
+        0, -11302, 0, -4454, -3413, 0, 0, 0, 16367, 14587, 0, 8578, 0, 0, 0, 11346,
+        0, 0, 10761, 20349, 16050, -21171, 0, -10716, -24670, 0, -21247, 0, -8719, 0, 0, 9768,
+        -14731, 4752, 0, 0, 0, 24063, 706, 0, 0, 0, -9119, 319, -20176, 0, 0, 9961,
+        0, 0, 0, -22192, 0, -1665, 25334, 0, 0, 4529, 0, 6484, 0, -7791, 0, 0,
+        22696, -15713, 0, 0, 0, -1585, 17113, -7263, -1618, 906, 24204, -5568, 0, 0, 0, 0,
+        0, -16215, 0, -7019, 0, 6344, 0, 2010, 0, 0, -7886, 0, 0, -5700, -17320, 0,
+        -20548, 3412, 0, 0, -148, -2445, 0, 10761, 0, 0, 0, -11796, 0, 25052, -3391, 0,
+        4058, 0, 15057, 0, 0, 0, -342, 11116, 25438, 26241, 2439, 25633, 27111, 0, 12201, 0,
+        0, 0, -10568, 0, 19613, 2788, 0, 0, 0, 0, -20882, 0, 0, -19326, 0, 0,
+        22859, -25449, 0, -8740, -18310, 0, 0, -17306, 10487, 0, 0, 0, 6808, 0, 0, -4316,
+        -4797, -17184, -5549, -21655, 0, 0, 0, -17003, 0, 0, 16029, 17251, 0, 451, 0, 0,
+        15788, 0, 0, 3313, 1160, -24798, 0, -195, 41, 0, 0, 0, 12055, -28785, 0, 0,
+        0, -17306, 11276, 13229, 0, 0, 0, 27873, -22206, 0, -21398, 0, -29891, 0, 0, 0,
+        16108, -9274, 30000, -6739, 7635, 13092, 25438, 3267, 0, -12951, 0, 0, 0, 0, 0, 0,
+        0, 12142, -12766, 11698, 0, 18373, 0, 0, 12097, 0, 18872, 0, 0, 24520, -2657, 0,
+        18643, 0, 0, 0, -22153, 6190, 0, 0, -28675, 0, 0, -4363, 2559, 0, -11533, 0,
+        21637, 24728, 26781, 0, 0, 0, 0, 9097, 22005, -16677, 26610, 0, 0, -4930, 17229, -12458,
+        0, 16260, -28524, 0, 0, 0, 0, 18507, 16134, 0, 0, -23288, 0, 0, -7548, 0,
+        0, 23498, 0, 23930, 0, 0, 16108, 11760, 17501, -10232, 0, -25202, 0, 10213, -16048, 27189,
+        0, 0, 0, 6565, 1267, 12772, 0, 0, 0, 0, -27361, 0, 1098, 0, -3281, 0,
+        0, -4571, 25667, 0, -13668, 0, 0, -24260, 26845, 0, 0, -5883, 0, 0, 3838, -1943,
+        24614, -16826, 0, 0, 0, 0, -13713, -23303, 0, 0, 0, -1585, 14216, 27170, -26495, 0,
+        0, 29808, 0, 0, 17958, -21154, 0, -29676, 0, 0, 0, 17022, -3262, 24614, 15441, -12636,
+        -23341, 0, -17184, 0, -1408, 0, 0, 23243, 0, 0, 0, 0, 14159, 2865, 0, -10374,
+        23330, 0, -20584, 0, 0, 17807, 0, 0, 0, -28046, 0, 25493, 0, 0, 3287, 17182,
+        17535, -30000, 0, -15227, -18528, 11411, -27912, 0, 0, 0, 0, 16891, 8890, 0, 21911, 0,
+        0, 10676, 13408, 0, 0, 0, 9012, 7401, 10315, 0, 22895, 0, 0, 0, 10630, 0,
+        0, 243, 17958, 0, 0, 22737, 0, 19375, 0, 0, -18922, -27479, 0, 0, 24063, -29987,
+        0, -10699, -13805, 0, 0, 22786, 0, 3637, 0, 0, 28678, 0, 0, -1439, 14852, 17535,
+        -7774, -28991, -10347, 0, 0, -1633, 0, -19320, 1145, 0, 0, 0, -547, -3802, -16909, 8933,
+        0, 0, 0, 0, 10021, 26670, 7542, 0, -21099, 0, 0, 0, 0, -5944, 0, -28074,
+        0, 0, 22642, 0, 0, 15057, -1490, 7605, -10876, 0, -7409, 0, 0, -7823, 0, -5118,
+        0, 6395, 0, 0, 6329, 0, 17617, -11434, 0, 0, 0, 0, 15974, 2268, -27458, 12038,
+        0, 0, 15811, 19517, 0, 25215, 0, 0, -568, 0, 0, 17090, 21714, 26825, 5965, 0,
+        13214, 0, 0, 12817, 0, 0, 0, -829, -4829, 0, 0, 0, 8815, -30000, 0, 0,
+        15471, 0, 29148, 0, 0, -14351, -24632, 2805, -29564, 0, 0, 0, 28294, 0, 0, 16108,
+        8248, 5162, 17726, 24640, 0, -19034, 0, 0, 9915, -24334, -20059, 0, 0, 0, 0, 18503,
+        0, 11789, 0, 3672, 0, 0, -10236, -16158, -3134, 0, 0, 0, -5590, 0, -4558, 0,
+        0, -7487, -8569, 0, -8749, 0, -16467, 0, 0, 0, 11728, 1827, -25286, 0, 28084, 0,
+        -17708, 0, 714, 0, 0, 12662, -29875, 0, -8656, 24225, 0, 0, 9933, 3133, 0, -4143,
+        13907, 0, 0, 0, 22800, 26844, -10675, 0, -1002, 0, 0, 0, 0, 11008, 0, 12920,
+        0, 0, -7648, 1459, -8952, 0, 0, 0, -28456, 0, 23498, 0, 9991, 0, 0, -6312,
+        10582, 26299, -8418, -26190, 0, -8793, 0, 0, 0, 0, 15742, 9141, 0, 0, 0, -19341,
+        0, 11841, -26162, 0, -1901, -25067, 0, -19893, 0, -4991, 0, 10362, 0, 0, -28429, 0,
+        0, 9097, 24297, -27640, 6551, 0, 0, 0, 0, 22988, 0, 0, 11891, 19261, 16864, -26328,
+        0, 18956, 10281, -9274, -9586, 0, 0, 0, 12452, -20677, 0, 0, 27003, -17391, 17067, 0,
+        0, 0, 0, -4572, -12820, 0, -20882, 0, 0, 0, 15342, -6271, -10850, -2774, 0, 0,
+        0, 0, 0, -27391, 0, 0, 29987, -9871, 14225, -24397, 0, 0, 0, 15111, 8505, 0,
+        0, 0, 0, -4938, -27882, 0, -6773, -22313, 0, 25009, 0, 0, -30000, 0, -26302, -13435,
+        0, 0, -19546, -13113, 0, 0, 0, -1219, -24083, -8384, 0, 0, -27704, 0, -4328, 0,
+        -3572, 0, 0, 15491, 17125, 16108, 7320, 0, -22169, 0, 0, 19338, 23886, 0, 0, 0,
+        -16231, 0, -13938, 0, 0, 6653, -3571, 0, 0, 0,
+    },
+    .left = {
+        1, 2, 3, 0, 5, 6, 1, 2, 3, 10, 11, 4, 5, 6, 15, 16,
+        7, 18, 8, 9, 21, 22, 10, 24, 11, 26, 12, 28, 13, 14, 31, 32,
+        33, 15, 35, 36, 16, 17, 18, 19, 20, 1, 2, 3, 0, 5, 1, 7,
+        2, 9, 3, 4, 12, 5, 6, 15, 16, 7, 18, 8, 20, 9, 22, 23,
+        24, 10, 26, 27, 11, 12, 13, 14, 32, 33, 15, 16, 36, 17, 38, 18,
+        19, 41, 20, 21, 1, 0, 3, 4, 5, 6, 1, 2, 9, 3, 4, 12,
+        13, 14, 5, 6, 7, 8, 19, 20, 21, 9, 10, 24, 11, 26, 12, 13,
+        29, 30, 31, 14, 15, 16, 35, 36, 37, 17, 39, 40, 18, 19, 20, 21,
+        22, 1, 2, 3, 0, 5, 1, 7, 2, 3, 10, 11, 12, 13, 4, 15,
+        5, 6, 7, 19, 20, 8, 22, 9, 24, 25, 10, 27, 11, 29, 12, 31,
+        13, 14, 15, 16, 36, 17, 38, 18, 19, 41, 42, 43, 20, 21, 22, 47,
+        23, 24, 1, 2, 0, 1, 5, 6, 7, 8, 9, 2, 11, 3, 4, 14,
+        5, 6, 17, 7, 19, 20, 8, 22, 9, 10, 25, 11, 12, 28, 13, 14,
+        31, 15, 33, 16, 35, 36, 17, 18, 39, 40, 41, 19, 43, 20, 21, 22,
+        23, 1, 2, 3, 4, 0, 1, 7, 8, 2, 10, 11, 12, 3, 4, 15,
+        16, 17, 5, 6, 7, 8, 22, 9, 10, 25, 26, 11, 12, 13, 30, 31,
+        14, 15, 34, 16, 17, 37, 38, 39, 18, 19, 20, 43, 21, 45, 22, 23,
+        1, 2, 3, 4, 0, 1, 7, 2, 3, 10, 11, 12, 4, 5, 6, 7,
+        17, 18, 19, 8, 21, 9, 23, 10, 25, 11, 27, 12, 13, 30, 31, 14,
+        15, 34, 16, 17, 37, 38, 39, 18, 19, 42, 43, 44, 20, 21, 22, 23,
+        24, 1, 2, 3, 4, 0, 6, 7, 1, 2, 3, 11, 4, 13, 14, 5,
+        6, 7, 8, 19, 20, 21, 9, 23, 24, 10, 11, 12, 28, 13, 30, 14,
+        32, 33, 34, 35, 15, 16, 17, 39, 18, 41, 42, 19, 20, 21, 22, 23,
+        1, 2, 3, 4, 5, 0, 7, 8, 1, 10, 2, 12, 3, 4, 5, 16,
+        6, 18, 7, 20, 21, 22, 8, 9, 10, 11, 27, 12, 13, 30, 14, 32,
+        15, 34, 16, 17, 37, 18, 39, 40, 19, 20, 21, 1, 2, 3, 4, 0,
+        6, 7, 8, 1, 2, 3, 4, 13, 5, 6, 16, 17, 7, 8, 9, 21,
+        22, 23, 10, 11, 26, 12, 13, 29, 30, 31, 14, 33, 15, 16, 36, 17,
+        38, 18, 40, 19, 20, 21, 1, 2, 3, 4, 0, 6, 7, 1, 2, 10,
+        3, 12, 4, 5, 6, 16, 7, 18, 19, 20, 8, 9, 23, 10, 25, 11,
+        27, 12, 13, 30, 31, 14, 33, 34, 15, 36, 16, 38, 17, 18, 19, 42,
+        20, 21, 45, 46, 22, 23, 49, 50, 24, 52, 25, 26, 55, 27, 28, 1,
+        2, 3, 4, 0, 1, 7, 2, 9, 10, 3, 4, 5, 14, 6, 7, 17,
+        8, 19, 20, 21, 9, 10, 11, 25, 26, 12, 13, 29, 30, 14, 32, 33,
+        15, 35, 16, 17, 18, 39, 40, 19, 42, 20, 21, 22, 1, 2, 3, 4,
+        5, 6, 0, 1, 2, 3, 4, 12, 5, 6, 15, 7, 17, 18, 19, 8,
+        9, 10, 23, 24, 25, 11, 27, 12, 13, 30, 31, 14, 33, 15, 16, 36,
+        17, 38, 39, 18, 19, 20, 43, 44, 21, 22, 23, 1, 2, 0, 4, 5,
+        6, 7, 1, 9, 2, 3, 12, 13, 4, 5, 16, 6, 7, 8, 20, 9,
+        22, 23, 10, 25, 11, 12, 13, 29, 14, 31, 32, 33, 15, 16, 36, 17,
+        18, 19, 1, 2, 3, 4, 0, 6, 1, 8, 9, 10, 2, 12, 3, 4,
+        5, 16, 6, 7, 19, 20, 8, 9, 23, 10, 25, 11, 12, 28, 29, 13,
+        31, 14, 15, 34, 35, 36, 16, 17, 18, 19, 41, 42, 20, 21, 45, 22,
+        47, 23, 24, 1, 2, 3, 4, 0, 1, 7, 2, 3, 10, 11, 12, 13,
+        14, 4, 5, 6, 7, 8, 9, 21, 22, 23, 24, 25, 10, 11, 28, 29,
+        12, 13, 14, 33, 15, 16, 36, 17, 38, 39, 18, 41, 19, 43, 20, 21,
+        46, 47, 22, 49, 23, 24, 52, 25, 26, 27, 1, 2, 3, 0, 1, 6,
+        7, 2, 9, 10, 11, 3, 4, 14, 5, 6, 17, 7, 19, 8, 21, 22,
+        9, 24, 10, 11, 27, 12, 29, 13, 14, 32, 33, 15, 35, 16, 17, 18,
+        39, 40, 19, 42, 20, 44, 21, 46, 22, 23, 49, 24, 25, 1, 2, 3,
+        4, 5, 6, 0, 1, 2, 3, 11, 12, 4, 5, 15, 6, 7, 18, 8,
+        9, 21, 22, 10, 24, 25, 11, 27, 12, 13, 14, 31, 32, 33, 34, 35,
+        15, 16, 17, 18, 40, 19, 42, 20, 44, 21, 46, 22, 23, 49, 24, 25,
+        1, 2, 3, 4, 0, 6, 1, 8, 2, 10, 3, 4, 13, 14, 15, 16,
+        17, 5, 19, 6, 7, 22, 8, 9, 10, 26, 27, 28, 11, 12, 31, 13,
+        14, 15, 35, 16, 17, 38, 39, 40, 41, 18, 19, 20, 21, 22, 47, 23,
+        49, 50, 51, 24, 25, 26, 27, 1, 2, 3, 4, 5, 0, 1, 2, 9,
+        3, 11, 4, 5, 6, 15, 16, 17, 7, 8, 20, 21, 9, 23, 10, 11,
+        12, 27, 28, 29, 30, 13, 32, 33, 34, 14, 15, 37, 38, 16, 17, 18,
+        19, 43, 20, 45, 21, 22, 23, 49, 24, 51, 52, 53, 25, 26, 27, 28,
+        1, 2, 0, 4, 5, 1, 7, 8, 2, 3, 11, 12, 13, 4, 5, 16,
+        6, 7, 19, 8, 21, 9, 10, 24, 25, 11, 12, 28, 29, 30, 13, 14,
+        15, 16, 35, 17, 37, 38, 39, 18, 19, 20, 43, 21, 22, 1, 2, 3,
+        4, 0, 6, 1, 8, 2, 3, 4, 12, 13, 5, 6, 7, 17, 8, 19,
+        20, 9, 10, 23, 24, 25, 11, 12, 28, 29, 13, 14, 15, 16, 1, 2,
+        3, 4, 0, 6, 7, 1, 9, 2, 11, 3, 4, 14, 15, 5, 6, 7,
+        8, 20, 9, 22, 23, 10, 11, 12, 27, 28, 29, 13, 14, 32, 33, 15,
+        35, 16, 17, 38, 18, 19, 41, 42, 20, 44, 21, 22, 47, 48, 23, 24,
+        51, 25, 53, 26, 27, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 11,
+        5, 13, 14, 6, 16, 17, 18, 19, 7, 8, 22, 23, 9, 25, 10, 11,
+        12, 29, 13, 14, 32, 33, 15, 16, 36, 17, 18, 39, 19, 20, 1, 2,
+        0, 4, 5, 6, 1, 8, 2, 3, 11, 12, 13, 4, 5, 6, 17, 7,
+        8, 20, 21, 9, 10, 11, 25, 26, 27, 28, 29, 12, 13, 14, 15, 34,
+        16, 36, 17, 38, 39, 18, 41, 19, 43, 20, 21, 22, 47, 48, 23, 24,
+        25, 1, 2, 3, 4, 5, 0, 1, 8, 2, 10, 3, 4, 13, 5, 15,
+        16, 6, 18, 19, 7, 21, 8, 9, 24, 10, 26, 11, 12, 13, 30, 31,
+        14, 15, 16, 35, 36, 17, 18, 19, 1, 2, 3, 0, 5, 1, 7, 8,
+        2, 3, 11, 4, 5, 14, 15, 6, 17, 7, 19, 8, 21, 9, 10, 24,
+        25, 26, 11, 28, 12, 13, 31, 32, 14, 15, 16, 17, 37, 38, 18, 40,
+        19, 42, 43, 44, 20, 21, 22, 23, 49, 50, 51, 24, 25, 26, 27, 1,
+        2, 3, 0, 1, 6, 7, 8, 2, 3, 11, 4, 13, 5, 6, 16, 17,
+        7, 8, 9, 21, 22, 23, 10, 25, 26, 11, 28, 12, 13, 14, 32, 33,
+        34, 35, 36, 15, 16, 39, 17, 41, 18, 19, 44, 45, 20, 21, 22, 23,
+        50, 51, 24, 25, 54, 26, 27, 57, 58, 28, 29, 30, 1, 2, 3, 4,
+        5, 0, 1, 8, 2, 10, 11, 3, 4, 14, 5, 16, 6, 18, 7, 8,
+        21, 9, 23, 24, 10, 26, 11, 12, 13, 30, 31, 14, 33, 15, 16, 17,
+        37, 18, 39, 40, 19, 20, 21, 1, 2, 3, 0, 5, 6, 7, 1, 2,
+        3, 11, 4, 13, 5, 6, 16, 7, 8, 19, 20, 9, 22, 23, 10, 25,
+        26, 11, 12, 29, 30, 13, 14, 15, 34, 16, 17, 37, 18, 39, 40, 41,
+        42, 43, 19, 20, 21, 22, 23, 49, 24, 25, 1, 2, 3, 0, 1, 2,
+        7, 8, 9, 3, 11, 4, 5, 14, 6, 16, 7, 18, 8, 9, 21, 22,
+        10, 24, 11, 26, 12, 13, 29, 30, 31, 32, 33, 14, 15, 36, 16, 38,
+        17, 40, 18, 19, 20, 44, 21, 46, 22, 23, 49, 24, 51, 25, 26, 1,
+        2, 3, 0, 5, 6, 1, 2, 9, 3, 4, 12, 13, 5, 15, 6, 7,
+        18, 8, 9, 21, 10, 23, 24, 11, 12, 27, 28, 29, 13, 14, 15, 33,
+        34, 16, 36, 17, 18, 19, 1, 2, 3, 4, 0, 1, 7, 8, 2, 10,
+        3, 4, 13, 14, 15, 16, 5, 6, 7, 20, 8, 9, 10, 11, 25, 26,
+        27, 28, 12, 13, 14, 15, 33, 16, 35, 17, 37, 38, 39, 40, 18, 19,
+        20, 21, 45, 46, 47, 22, 49, 23, 24, 25, 53, 26, 55, 56, 27, 58,
+        28, 29, 30, 1, 2, 3, 4, 5, 6, 0, 1, 2, 10, 3, 4, 13,
+        5, 15, 6, 7, 8, 19, 20, 9, 22, 23, 24, 25, 10, 11, 28, 12,
+        13, 14, 32, 15, 34, 35, 16, 37, 17, 39, 18, 19, 20, 21, 1, 2,
+        0, 4, 5, 1, 7, 8, 2, 3, 11, 4, 5, 14, 6, 16, 17, 7,
+        8, 9, 21, 22, 23, 24, 25, 10, 27, 11, 29, 12, 13, 32, 33, 14,
+        15, 16, 17, 38, 18, 19, 41, 42, 20, 21, 22, 1, 2, 0, 4, 1,
+        6, 7, 8, 2, 3, 11, 4, 5, 14, 15, 16, 6, 18, 7, 8, 21,
+        22, 9, 10, 11, 26, 12, 13, 29, 30, 31, 32, 14, 34, 15, 16, 17,
+        38, 39, 18, 19, 20, 43, 21, 45, 46, 22, 48, 23, 24, 25, 1, 2,
+        3, 0, 5, 6, 1, 2, 3, 10, 11, 12, 13, 4, 5, 16, 17, 6,
+        19, 7, 8, 9, 23, 10, 11, 12, 27, 28, 13, 14, 31, 32, 33, 34,
+        15, 36, 16, 38, 17, 18, 19, 20, 43, 21, 45, 46, 22, 23, 49, 50,
+        24, 25, 26, 1, 2, 3, 0, 5, 6, 1, 2, 3, 10, 11, 4, 13,
+        5, 6, 16, 17, 7, 19, 20, 21, 8, 9, 10, 25, 11, 27, 12, 29,
+        13, 14, 32, 33, 15, 16, 36, 17, 18, 39, 40, 41, 19, 43, 20, 21,
+        22, 47, 48, 49, 23, 24, 52, 25, 54, 26, 27, 57, 28, 29, 1, 2,
+        3, 0, 5, 6, 1, 8, 2, 3, 4, 12, 5, 14, 15, 16, 17, 6,
+        7, 8, 21, 22, 9, 10, 25, 26, 11, 12, 29, 30, 13, 14, 15, 16,
+        35, 36, 37, 17, 18, 19, 41, 20, 21, 1, 2, 0, 4, 1, 2, 7,
+        8, 3, 10, 11, 12, 4, 14, 5, 16, 6, 18, 7, 8, 21, 9, 10,
+        24, 11, 12, 27, 13, 29, 30, 31, 32, 33, 14, 35, 36, 15, 16, 17,
+        40, 41, 18, 19, 20, 45, 21, 47, 22, 23, 24, 51, 25, 53, 26, 27,
+        1, 2, 3, 0, 5, 1, 7, 8, 2, 10, 3, 4, 13, 5, 6, 7,
+        17, 18, 19, 8, 9, 22, 23, 24, 10, 11, 12, 28, 13, 14, 31, 32,
+        33, 15, 16, 36, 17, 38, 18, 40, 19, 20, 43, 21, 45, 22, 47, 48,
+        23, 24, 51, 52, 25, 26, 27, 1, 2, 3, 4, 0, 6, 1, 2, 9,
+        3, 11, 4, 5, 14, 15, 6, 7, 18, 19, 8, 21, 9, 23, 24, 25,
+        10, 11, 12, 29, 13, 14, 32, 15, 34, 16, 36, 17, 18, 39, 40, 19,
+        20, 43, 44, 45, 21, 22, 23, 24, 1, 2, 3, 0, 5, 1, 2, 8,
+        3, 10, 11, 4, 13, 5, 15, 6, 7, 18, 19, 8, 9, 10, 23, 24,
+        11, 26, 12, 28, 13, 30, 31, 14, 15, 16, 17, 1, 2, 3, 4, 5,
+        0, 1, 2, 9, 10, 11, 3, 4, 5, 15, 16, 6, 7, 8, 20, 21,
+        22, 23, 9, 10, 11, 27, 12, 13, 30, 14, 32, 15, 16, 35, 17, 37,
+        38, 39, 18, 19, 20, 43, 21, 22, 1, 2, 3, 0, 5, 1, 2, 8,
+        9, 10, 3, 4, 5, 14, 15, 16, 6, 7, 19, 8, 21, 22, 9, 24,
+        10, 11, 12, 13, 29, 30, 31, 14, 15, 16, 35, 17, 37, 38, 39, 40,
+        18, 19, 43, 20, 21, 46, 47, 22, 23, 50, 24, 25, 26, 1, 2, 3,
+        0, 1, 6, 2, 3, 9, 10, 4, 12, 13, 14, 5, 6, 17, 7, 8,
+        9, 21, 22, 23, 10, 25, 11, 27, 28, 12, 13, 31, 14, 33, 34, 35,
+        15, 16, 17, 18, 19, 20, 1, 2, 3, 0, 5, 6, 7, 8, 1, 2,
+        11, 3, 13, 4, 5, 6, 17, 18, 19, 7, 8, 9, 23, 10, 25, 26,
+        11, 12, 13, 30, 14, 32, 15, 16, 35, 36, 17, 18, 39, 19, 41, 42,
+        20, 21, 22, 1, 2, 3, 4, 5, 0, 1, 2, 3, 10, 11, 12, 13,
+        14, 4, 16, 5, 18, 6, 7, 8, 9, 23, 10, 25, 11, 12, 13, 29,
+        30, 14, 15, 33, 34, 35, 16, 37, 17, 18, 40, 19, 20, 21, 1, 2,
+        3, 0, 1, 6, 2, 8, 9, 3, 11, 4, 13, 5, 6, 16, 7, 8,
+        19, 20, 21, 9, 23, 10, 25, 11, 27, 28, 12, 13, 14, 32, 15, 34,
+        35, 16, 17, 18, 39, 40, 41, 19, 20, 21, 45, 22, 23, 1, 2, 3,
+        0, 5, 1, 2, 8, 9, 10, 11, 12, 13, 3, 4, 16, 5, 18, 6,
+        7, 21, 8, 23, 9, 10, 11, 27, 12, 13, 30, 14, 15, 33, 34, 16,
+        36, 37, 17, 39, 18, 19, 20, 43, 21, 22, 1, 2, 0, 4, 1, 2,
+        7, 8, 9, 10, 3, 12, 4, 5, 15, 6, 17, 7, 8, 20, 9, 22,
+        23, 24, 25, 10, 11, 12, 29, 13, 14, 15, 33, 34, 16, 36, 17, 38,
+        18, 40, 19, 20, 43, 44, 21, 22, 47, 48, 23, 24, 25, 1, 2, 3,
+        4, 5, 0, 1, 2, 9, 3, 11, 4, 5, 14, 15, 6, 17, 7, 19,
+        8, 9, 10, 23, 24, 25, 11, 27, 28, 29, 30, 31, 12, 13, 14, 15,
+        16, 37, 17, 18, 40, 19, 20, 43, 21, 45, 22, 47, 23, 24, 1, 2,
+        0, 4, 1, 6, 2, 8, 9, 3, 4, 5, 13, 14, 15, 16, 6, 7,
+        19, 8, 21, 9, 10, 11, 25, 26, 27, 12, 29, 13, 14, 15, 33, 16,
+        35, 36, 37, 17, 18, 19, 41, 20, 21, 1, 2, 3, 4, 5, 0, 1,
+        2, 9, 3, 11, 4, 5, 6, 15, 16, 17, 18, 19, 7, 21, 8, 9,
+        24, 25, 10, 11, 12, 29, 13, 31, 14, 15, 34, 35, 36, 37, 16, 17,
+        18, 19, 20, 21, 1, 2, 3, 4, 0, 6, 7, 8, 9, 1, 11, 2,
+        13, 3, 4, 16, 5, 6, 19, 20, 7, 8, 9, 10, 25, 11, 12, 28,
+        29, 30, 31, 13, 33, 14, 15, 16, 37, 17, 18, 19, 41, 42, 20, 21,
+        22, 1, 2, 3, 4, 5, 0, 7, 1, 9, 2, 3, 12, 4, 5, 15,
+        6, 7, 18, 19, 8, 21, 9, 23, 24, 25, 10, 11, 12, 29, 30, 31,
+        13, 14, 15, 16, 17, 37, 18, 39, 19, 41, 42, 20, 21, 45, 22, 23,
+        1, 2, 3, 4, 5, 6, 7, 8, 0, 10, 1, 12, 2, 3, 4, 5,
+        6, 7, 19, 20, 8, 22, 9, 10, 11, 26, 12, 13, 29, 30, 31, 14,
+        33, 34, 15, 36, 37, 16, 17, 18, 19, 42, 43, 20, 21, 22, 47, 23,
+        49, 24, 51, 25, 53, 26, 27, 1, 2, 0, 4, 5, 6, 1, 8, 9,
+        10, 2, 3, 4, 5, 6, 7, 17, 18, 19, 20, 21, 22, 8, 9, 25,
+        26, 10, 11, 12, 30, 31, 13, 33, 14, 15, 16, 17, 18, 39, 40, 19,
+        42, 20, 44, 21, 46, 47, 22, 23, 24, 51, 25, 53, 26, 27, 1, 2,
+        3, 4, 0, 6, 1, 8, 9, 2, 3, 4, 5, 14, 15, 16, 17, 6,
+        19, 7, 8, 9, 23, 10, 11, 12, 27, 28, 29, 13, 14, 15, 33, 34,
+        35, 16, 17, 38, 39, 40, 18, 19, 20, 21, 45, 22, 23, 1, 2, 3,
+        4, 5, 6, 0, 1, 2, 10, 3, 4, 13, 5, 15, 16, 6, 18, 7,
+        8, 9, 10, 23, 24, 25, 26, 11, 12, 29, 30, 13, 14, 15, 34, 35,
+        16, 37, 17, 18, 40, 19, 20, 21, 1, 2, 3, 4, 0, 6, 7, 1,
+        2, 10, 3, 12, 13, 4, 5, 6, 17, 7, 19, 8, 21, 9, 23, 24,
+        25, 10, 11, 12, 13, 14, 31, 32, 15, 34, 16, 17, 37, 38, 18, 40,
+        19, 20, 43, 21, 45, 22, 47, 48, 23, 24, 25, 1, 2, 3, 4, 5,
+        0, 1, 8, 9, 2, 3, 4, 13, 14, 15, 16, 5, 6, 7, 8, 21,
+        9, 10, 24, 25, 11, 27, 28, 29, 12, 13, 32, 14, 34, 15, 36, 16,
+        17, 18, 40, 19, 20, 43, 44, 21, 22, 47, 48, 49, 23, 24, 52, 53,
+        25, 26, 27, 28, 1, 2, 3, 4, 0, 6, 7, 1, 2, 3, 4, 12,
+        13, 5, 15, 6, 7, 18, 19, 8, 9, 22, 23, 24, 10, 11, 27, 28,
+        12, 13, 14, 32, 15, 34, 16, 36, 17, 18, 39, 40, 19, 20, 43, 44,
+        45, 46, 21, 22, 23, 24, 51, 25, 26, 1, 2, 3, 0, 5, 1, 7,
+        2, 9, 3, 11, 4, 5, 6, 15, 16, 17, 18, 19, 7, 21, 8, 9,
+        10, 11, 26, 12, 28, 13, 14, 31, 15, 33, 16, 35, 36, 37, 17, 18,
+        19, 41, 20, 43, 21, 45, 22, 47, 23, 49, 24, 51, 25, 26, 1, 0,
+        3, 4, 5, 1, 7, 8, 2, 10, 3, 4, 13, 14, 15, 16, 5, 6,
+        19, 7, 8, 22, 23, 24, 25, 9, 10, 28, 11, 30, 12, 13, 33, 14,
+        15, 16, 17, 18, 39, 40, 41, 19, 43, 20, 21, 22, 23, 1, 2, 3,
+        4, 5, 6, 0, 8, 1, 2, 11, 12, 13, 3, 15, 4, 5, 6, 7,
+        20, 21, 8, 23, 9, 10, 11, 27, 28, 12, 30, 31, 13, 14, 34, 15,
+        16, 17, 38, 39, 40, 41, 18, 19, 20, 21, 46, 47, 22, 23, 24, 51,
+        52, 25, 26, 27, 1, 2, 0, 4, 1, 6, 2, 8, 3, 10, 4, 5,
+        13, 14, 15, 16, 6, 7, 8, 20, 9, 22, 23, 10, 11, 26, 12, 28,
+        13, 14, 31, 32, 15, 34, 16, 17, 37, 38, 39, 18, 41, 19, 20, 21,
+        45, 46, 22, 23, 49, 50, 24, 25, 26, 1, 2, 3, 4, 5, 6, 7,
+        0, 1, 10, 11, 2, 3, 14, 4, 16, 5, 6, 7, 20, 8, 22, 23,
+        9, 10, 11, 27, 28, 12, 30, 31, 13, 33, 34, 14, 15, 16, 17, 39,
+        40, 18, 19, 20, 44, 45, 21, 22, 23, 49, 24, 51, 25, 26, 1, 2,
+        0, 4, 5, 6, 1, 2, 9, 3, 11, 12, 4, 14, 15, 5, 17, 6,
+        7, 8, 21, 22, 9, 24, 10, 11, 12, 28, 13, 30, 14, 15, 33, 34,
+        35, 36, 16, 17, 39, 18, 41, 19, 43, 20, 21, 46, 47, 22, 23, 50,
+        24, 25, 26, 1, 2, 0, 4, 1, 6, 7, 2, 3, 4, 11, 12, 13,
+        5, 15, 16, 6, 18, 7, 8, 9, 10, 23, 24, 25, 11, 12, 13, 29,
+        14, 31, 15, 33, 34, 35, 16, 17, 18, 39, 19, 41, 20, 21, 1, 2,
+        0, 4, 5, 6, 1, 2, 3, 10, 4, 12, 13, 5, 15, 6, 7, 8,
+        19, 20, 21, 9, 23, 24, 25, 10, 27, 11, 12, 13, 14, 32, 33, 34,
+        15, 16, 17, 38, 18, 19, 41, 42, 43, 44, 20, 46, 21, 48, 49, 22,
+        23, 24, 25, 26, 27, 1, 2, 3, 4, 5, 6, 7, 0, 1, 10, 2,
+        12, 3, 4, 5, 16, 6, 18, 7, 8, 21, 9, 10, 11, 25, 26, 27,
+        12, 13, 14, 31, 32, 33, 34, 35, 36, 15, 16, 17, 40, 18, 19, 20,
+        44, 21, 46, 22, 23, 24, 1, 2, 3, 0, 5, 1, 7, 8, 9, 10,
+        2, 3, 4, 5, 6, 16, 17, 7, 19, 8, 9, 10, 23, 24, 25, 11,
+        27, 12, 29, 30, 31, 13, 14, 15, 35, 16, 17, 38, 39, 18, 19, 20,
+        43, 21, 45, 46, 22, 48, 49, 23, 24, 25, 26, 1, 2, 3, 0, 5,
+        6, 7, 8, 1, 2, 3, 12, 4, 5, 15, 6, 17, 7, 19, 8, 9,
+        22, 23, 10, 25, 26, 11, 28, 12, 13, 14, 32, 33, 15, 35, 16, 17,
+        18, 39, 19, 41, 42, 20, 21, 45, 46, 22, 23, 49, 24, 51, 25, 26,
+        1, 2, 3, 4, 5, 0, 1, 8, 2, 10, 3, 4, 5, 14, 15, 16,
+        17, 6, 7, 20, 21, 8, 23, 9, 25, 10, 11, 12, 13, 30, 14, 32,
+        15, 16, 35, 36, 17, 38, 18, 19, 41, 20, 43, 21, 45, 46, 22, 23,
+        24, 1, 2, 0, 4, 5, 6, 1, 2, 3, 10, 11, 4, 5, 6, 15,
+        16, 17, 18, 7, 8, 9, 22, 23, 10, 11, 26, 12, 28, 13, 30, 14,
+        32, 15, 16, 35, 36, 37, 17, 18, 40, 41, 19, 20, 44, 45, 46, 21,
+        22, 23, 50, 24, 25, 26, 1, 0, 3, 4, 1, 6, 7, 8, 2, 3,
+        4, 12, 13, 14, 5, 16, 6, 18, 7, 8, 21, 22, 9, 10, 11, 12,
+        27, 28, 29, 30, 13, 14, 15, 34, 16, 36, 37, 17, 18, 40, 19, 20,
+        21, 1, 2, 3, 0, 5, 6, 1, 8, 2, 10, 3, 4, 5, 14, 15,
+        6, 17, 7, 19, 8, 9, 10, 23, 24, 25, 26, 11, 12, 29, 30, 13,
+        32, 14, 15, 35, 16, 17, 38, 39, 40, 18, 42, 19, 44, 20, 46, 21,
+        48, 22, 23, 24, 25, 26, 1, 2, 0, 4, 5, 6, 1, 8, 2, 10,
+        3, 4, 13, 14, 5, 6, 7, 18, 8, 20, 21, 9, 10, 11, 25, 26,
+        27, 28, 12, 30, 31, 13, 14, 34, 15, 16, 17, 38, 18, 40, 19, 42,
+        20, 21, 45, 46, 47, 48, 22, 23, 24, 25, 53, 26, 27, 1, 2, 3,
+        0, 5, 6, 1, 2, 3, 10, 11, 12, 13, 4, 5, 6, 17, 7, 19,
+        8, 9, 22, 23, 10, 11, 26, 12, 28, 13, 30, 14, 32, 15, 16, 35,
+        17, 37, 18, 39, 40, 41, 19, 43, 20, 21, 22, 23, 1, 2, 3, 4,
+        0, 6, 7, 1, 2, 3, 11, 12, 13, 14, 4, 5, 6, 7, 19, 20,
+        8, 9, 10, 24, 11, 26, 12, 28, 29, 13, 14, 15, 33, 16, 35, 36,
+        17, 38, 18, 19, 41, 20, 21, 1, 2, 0, 4, 5, 6, 7, 1, 2,
+        3, 4, 5, 13, 14, 15, 6, 17, 18, 7, 8, 21, 22, 9, 24, 25,
+        10, 11, 28, 12, 30, 13, 14, 15, 34, 16, 17, 37, 38, 39, 18, 41,
+        19, 43, 20, 21, 22, 47, 23, 24, 1, 2, 3, 4, 0, 6, 1, 8,
+        9, 10, 2, 12, 3, 4, 15, 5, 6, 7, 19, 8, 9, 22, 23, 10,
+        11, 12, 27, 13, 29, 30, 14, 32, 33, 15, 16, 17, 37, 38, 39, 18,
+        41, 19, 20, 21, 22, 1, 2, 0, 4, 5, 6, 7, 8, 1, 2, 3,
+        12, 4, 14, 5, 6, 17, 7, 8, 9, 21, 22, 23, 24, 10, 11, 27,
+        12, 29, 13, 31, 32, 14, 15, 16, 36, 37, 17, 39, 18, 19, 20, 43,
+        21, 22, 1, 2, 3, 4, 0, 6, 7, 1, 9, 2, 11, 3, 4, 14,
+        15, 16, 5, 6, 7, 20, 21, 8, 9, 10, 25, 26, 27, 11, 12, 30,
+        13, 14, 15, 34, 16, 36, 37, 17, 18, 40, 19, 42, 20, 44, 21, 22,
+        47, 48, 23, 24, 25, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3,
+        4, 13, 5, 15, 6, 17, 7, 19, 8, 9, 22, 10, 11, 25, 26, 12,
+        28, 29, 13, 14, 32, 33, 15, 35, 16, 17, 18, 39, 19, 41, 42, 20,
+        44, 21, 46, 22, 23, 24, 1, 2, 3, 4, 5, 6, 7, 0, 9, 1,
+        2, 3, 13, 4, 15, 16, 5, 6, 7, 8, 21, 9, 10, 24, 11, 12,
+        27, 28, 13, 30, 31, 14, 15, 34, 35, 16, 17, 18, 39, 19, 20, 1,
+        2, 3, 4, 5, 0, 1, 2, 9, 3, 4, 12, 13, 5, 15, 6, 7,
+        18, 8, 9, 21, 22, 23, 10, 25, 26, 11, 12, 13, 30, 31, 14, 15,
+        16, 35, 36, 37, 17, 18, 19, 41, 42, 20, 44, 21, 46, 22, 23, 24,
+        1, 2, 3, 4, 5, 6, 7, 8, 0, 10, 1, 2, 3, 4, 5, 6,
+        7, 18, 19, 20, 8, 22, 9, 10, 25, 11, 27, 12, 13, 30, 31, 14,
+        33, 15, 16, 17, 37, 38, 18, 19, 41, 20, 21, 1, 2, 0, 4, 1,
+        6, 7, 8, 2, 3, 4, 5, 13, 14, 15, 16, 6, 7, 19, 20, 21,
+        8, 23, 24, 9, 10, 11, 12, 29, 30, 13, 14, 33, 15, 16, 36, 17,
+        18, 39, 19, 41, 20, 21, 1, 2, 3, 4, 0, 6, 1, 8, 9, 10,
+        2, 3, 4, 14, 15, 16, 5, 6, 7, 8, 21, 9, 23, 10, 25, 11,
+        12, 28, 29, 13, 31, 14, 15, 34, 35, 16, 17, 38, 18, 19, 41, 42,
+        43, 44, 20, 21, 22, 23, 49, 50, 24, 25, 26, 1, 2, 3, 4, 0,
+        1, 7, 2, 3, 10, 11, 4, 13, 5, 6, 7, 17, 18, 19, 20, 21,
+        22, 8, 24, 9, 26, 10, 11, 29, 12, 13, 14, 15, 34, 35, 16, 37,
+        38, 17, 40, 18, 19, 43, 20, 21, 22, 47, 23, 49, 24, 25, 1, 2,
+        3, 4, 0, 6, 7, 8, 9, 1, 2, 3, 4, 14, 15, 5, 17, 6,
+        7, 20, 21, 8, 9, 10, 25, 26, 27, 11, 29, 12, 13, 14, 33, 15,
+        16, 36, 37, 17, 18, 40, 19, 42, 20, 21, 45, 46, 22, 23, 49, 50,
+        24, 52, 53, 25, 26, 56, 27, 58, 28, 29, 61, 30, 31, 1, 2, 3,
+        4, 5, 6, 0, 1, 9, 2, 11, 12, 3, 4, 5, 16, 17, 18, 19,
+        6, 7, 8, 9, 24, 25, 26, 10, 28, 11, 12, 13, 14, 33, 15, 35,
+        16, 17, 38, 18, 19, 41, 42, 43, 44, 20, 46, 21, 22, 49, 23, 51,
+        24, 53, 25, 26, 56, 27, 58, 59, 28, 29, 30, 31, 1, 2, 3, 4,
+        0, 1, 7, 8, 2, 10, 3, 4, 13, 5, 6, 16, 17, 18, 19, 7,
+        21, 8, 9, 24, 10, 11, 12, 28, 29, 13, 14, 15, 33, 34, 16, 17,
+        37, 18, 39, 19, 20, 1, 2, 3, 4, 0, 1, 2, 8, 3, 4, 11,
+        12, 13, 14, 15, 5, 17, 6, 7, 20, 21, 22, 8, 9, 10, 11, 27,
+        12, 29, 13, 31, 14, 15, 34, 35, 36, 16, 17, 18, 40, 19, 42, 20,
+        21, 45, 46, 22, 48, 23, 50, 24, 25, 26, 1, 2, 3, 0, 5, 1,
+        7, 2, 9, 3, 4, 12, 13, 5, 15, 16, 6, 7, 19, 20, 8, 22,
+        23, 9, 10, 11, 27, 28, 29, 12, 31, 13, 14, 15, 16, 36, 17, 38,
+        18, 19, 41, 42, 43, 20, 21, 22, 47, 23, 49, 24, 51, 25, 26, 1,
+        2, 3, 4, 5, 0, 7, 1, 2, 3, 4, 12, 13, 5, 6, 7, 17,
+        8, 19, 20, 9, 22, 23, 10, 25, 11, 27, 12, 29, 13, 14, 32, 15,
+        16, 35, 36, 37, 38, 17, 18, 19, 20, 43, 21, 22, 1, 2, 3, 4,
+        0, 6, 7, 8, 9, 1, 2, 3, 13, 14, 4, 5, 17, 18, 19, 6,
+        7, 8, 9, 24, 25, 10, 27, 11, 12, 13, 31, 32, 33, 34, 14, 15,
+        16, 17, 18, 40, 19, 20, 43, 44, 45, 46, 21, 22, 23, 50, 51, 24,
+        25, 26, 27, 1, 2, 0, 4, 5, 1, 7, 2, 3, 10, 4, 12, 13,
+        5, 6, 16, 17, 7, 8, 9, 21, 22, 23, 10, 11, 26, 12, 28, 13,
+        30, 14, 15, 33, 34, 35, 36, 16, 38, 17, 18, 41, 42, 19, 20, 21,
+        46, 22, 48, 23, 24, 51, 52, 25, 26, 27,
+    },
+    .right = {
+        14, 9, 4, 0, 8, 7, 0, 0, 0, 13, 12, 0, 0, 0, 20, 17,
+        0, 19, 0, 0, 30, 23, 0, 25, 0, 27, 0, 29, 0, 0, 40, 39,
+        34, 0, 38, 37, 0, 0, 0, 0, 0, 14, 11, 4, 0, 6, 0, 8,
+        0, 10, 0, 0, 13, 0, 0, 40, 17, 0, 19, 0, 21, 0, 31, 30,
+        25, 0, 29, 28, 0, 0, 0, 0, 35, 34, 0, 0, 37, 0, 39, 0,
+        0, 42, 0, 0, 2, 0, 18, 11, 8, 7, 0, 0, 10, 0, 0, 17,
+        16, 15, 0, 0, 0, 0, 28, 23, 22, 0, 0, 25, 0, 27, 0, 0,
+        34, 33, 32, 0, 0, 0, 44, 43, 38, 0, 42, 41, 0, 0, 0, 0,
+        0, 40, 9, 4, 0, 6, 0, 8, 0, 0, 35, 18, 17, 14, 0, 16,
+        0, 0, 0, 34, 21, 0, 23, 0, 33, 26, 0, 28, 0, 30, 0, 32,
+        0, 0, 0, 0, 37, 0, 39, 0, 0, 46, 45, 44, 0, 0, 0, 48,
+        0, 0, 4, 3, 0, 0, 30, 27, 16, 13, 10, 0, 12, 0, 0, 15,
+        0, 0, 18, 0, 24, 21, 0, 23, 0, 0, 26, 0, 0, 29, 0, 0,
+        32, 0, 34, 0, 38, 37, 0, 0, 46, 45, 42, 0, 44, 0, 0, 0,
+        0, 36, 29, 6, 5, 0, 0, 24, 9, 0, 21, 14, 13, 0, 0, 20,
+        19, 18, 0, 0, 0, 0, 23, 0, 0, 28, 27, 0, 0, 0, 33, 32,
+        0, 0, 35, 0, 0, 42, 41, 40, 0, 0, 0, 44, 0, 46, 0, 0,
+        16, 9, 6, 5, 0, 0, 8, 0, 0, 15, 14, 13, 0, 0, 0, 0,
+        36, 29, 20, 0, 22, 0, 24, 0, 26, 0, 28, 0, 0, 33, 32, 0,
+        0, 35, 0, 0, 48, 41, 40, 0, 0, 47, 46, 45, 0, 0, 0, 0,
+        0, 18, 17, 10, 5, 0, 9, 8, 0, 0, 0, 12, 0, 16, 15, 0,
+        0, 0, 0, 46, 27, 22, 0, 26, 25, 0, 0, 0, 29, 0, 31, 0,
+        45, 38, 37, 36, 0, 0, 0, 40, 0, 44, 43, 0, 0, 0, 0, 0,
+        36, 29, 26, 15, 6, 0, 14, 9, 0, 11, 0, 13, 0, 0, 0, 17,
+        0, 19, 0, 25, 24, 23, 0, 0, 0, 0, 28, 0, 0, 31, 0, 33,
+        0, 35, 0, 0, 38, 0, 42, 41, 0, 0, 0, 20, 15, 12, 5, 0,
+        11, 10, 9, 0, 0, 0, 0, 14, 0, 0, 19, 18, 0, 0, 0, 28,
+        25, 24, 0, 0, 27, 0, 0, 42, 35, 32, 0, 34, 0, 0, 37, 0,
+        39, 0, 41, 0, 0, 0, 44, 15, 14, 5, 0, 9, 8, 0, 0, 11,
+        0, 13, 0, 0, 0, 17, 0, 29, 22, 21, 0, 0, 24, 0, 26, 0,
+        28, 0, 0, 41, 32, 0, 40, 35, 0, 37, 0, 39, 0, 0, 0, 43,
+        0, 0, 48, 47, 0, 0, 54, 51, 0, 53, 0, 0, 56, 0, 0, 16,
+        13, 6, 5, 0, 0, 8, 0, 12, 11, 0, 0, 0, 15, 0, 0, 18,
+        0, 24, 23, 22, 0, 0, 0, 28, 27, 0, 0, 38, 31, 0, 37, 34,
+        0, 36, 0, 0, 0, 44, 41, 0, 43, 0, 0, 0, 14, 11, 10, 9,
+        8, 7, 0, 0, 0, 0, 0, 13, 0, 0, 16, 0, 22, 21, 20, 0,
+        0, 0, 42, 29, 26, 0, 28, 0, 0, 35, 32, 0, 34, 0, 0, 37,
+        0, 41, 40, 0, 0, 0, 46, 45, 0, 0, 0, 28, 3, 0, 19, 18,
+        11, 8, 0, 10, 0, 0, 15, 14, 0, 0, 17, 0, 0, 0, 21, 0,
+        27, 24, 0, 26, 0, 0, 0, 30, 0, 38, 35, 34, 0, 0, 37, 0,
+        0, 0, 40, 27, 18, 5, 0, 7, 0, 15, 14, 11, 0, 13, 0, 0,
+        0, 17, 0, 0, 22, 21, 0, 0, 24, 0, 26, 0, 0, 33, 30, 0,
+        32, 0, 0, 39, 38, 37, 0, 0, 0, 0, 44, 43, 0, 0, 46, 0,
+        48, 0, 0, 20, 9, 6, 5, 0, 0, 8, 0, 0, 19, 18, 17, 16,
+        15, 0, 0, 0, 0, 0, 0, 54, 35, 32, 27, 26, 0, 0, 31, 30,
+        0, 0, 0, 34, 0, 0, 37, 0, 45, 40, 0, 42, 0, 44, 0, 0,
+        51, 48, 0, 50, 0, 0, 53, 0, 0, 0, 38, 5, 4, 0, 0, 31,
+        8, 0, 16, 13, 12, 0, 0, 15, 0, 0, 18, 0, 20, 0, 26, 23,
+        0, 25, 0, 0, 28, 0, 30, 0, 0, 37, 34, 0, 36, 0, 0, 0,
+        48, 41, 0, 43, 0, 45, 0, 47, 0, 0, 50, 0, 0, 20, 17, 10,
+        9, 8, 7, 0, 0, 0, 0, 14, 13, 0, 0, 16, 0, 0, 19, 0,
+        0, 30, 23, 0, 29, 26, 0, 28, 0, 0, 0, 48, 39, 38, 37, 36,
+        0, 0, 0, 0, 41, 0, 43, 0, 45, 0, 47, 0, 0, 50, 0, 0,
+        46, 37, 12, 5, 0, 7, 0, 9, 0, 11, 0, 0, 34, 25, 24, 21,
+        18, 0, 20, 0, 0, 23, 0, 0, 0, 33, 30, 29, 0, 0, 32, 0,
+        0, 0, 36, 0, 0, 45, 44, 43, 42, 0, 0, 0, 0, 0, 48, 0,
+        54, 53, 52, 0, 0, 0, 0, 14, 13, 8, 7, 6, 0, 0, 0, 10,
+        0, 12, 0, 0, 0, 26, 19, 18, 0, 0, 25, 22, 0, 24, 0, 0,
+        0, 48, 47, 42, 31, 0, 41, 36, 35, 0, 0, 40, 39, 0, 0, 0,
+        0, 44, 0, 46, 0, 0, 0, 50, 0, 56, 55, 54, 0, 0, 0, 0,
+        34, 3, 0, 23, 6, 0, 10, 9, 0, 0, 18, 15, 14, 0, 0, 17,
+        0, 0, 20, 0, 22, 0, 0, 27, 26, 0, 0, 33, 32, 31, 0, 0,
+        0, 0, 36, 0, 42, 41, 40, 0, 0, 0, 44, 0, 0, 16, 11, 10,
+        5, 0, 7, 0, 9, 0, 0, 0, 15, 14, 0, 0, 0, 18, 0, 22,
+        21, 0, 0, 32, 27, 26, 0, 0, 31, 30, 0, 0, 0, 0, 26, 19,
+        18, 5, 0, 13, 8, 0, 10, 0, 12, 0, 0, 17, 16, 0, 0, 0,
+        0, 21, 0, 25, 24, 0, 0, 0, 40, 31, 30, 0, 0, 37, 34, 0,
+        36, 0, 0, 39, 0, 0, 46, 43, 0, 45, 0, 0, 50, 49, 0, 0,
+        52, 0, 54, 0, 0, 10, 9, 8, 7, 6, 0, 0, 0, 0, 0, 12,
+        0, 38, 15, 0, 31, 28, 21, 20, 0, 0, 27, 24, 0, 26, 0, 0,
+        0, 30, 0, 0, 35, 34, 0, 0, 37, 0, 0, 40, 0, 0, 24, 3,
+        0, 19, 10, 7, 0, 9, 0, 0, 16, 15, 14, 0, 0, 0, 18, 0,
+        0, 23, 22, 0, 0, 0, 46, 33, 32, 31, 30, 0, 0, 0, 0, 35,
+        0, 37, 0, 45, 40, 0, 42, 0, 44, 0, 0, 0, 50, 49, 0, 0,
+        0, 34, 29, 12, 7, 6, 0, 0, 9, 0, 11, 0, 0, 14, 0, 28,
+        17, 0, 23, 20, 0, 22, 0, 0, 25, 0, 27, 0, 0, 0, 33, 32,
+        0, 0, 0, 38, 37, 0, 0, 0, 36, 13, 4, 0, 6, 0, 10, 9,
+        0, 0, 12, 0, 0, 23, 16, 0, 18, 0, 20, 0, 22, 0, 0, 35,
+        30, 27, 0, 29, 0, 0, 34, 33, 0, 0, 0, 0, 48, 39, 0, 41,
+        0, 47, 46, 45, 0, 0, 0, 0, 54, 53, 52, 0, 0, 0, 0, 20,
+        5, 4, 0, 0, 15, 10, 9, 0, 0, 12, 0, 14, 0, 0, 19, 18,
+        0, 0, 0, 56, 31, 24, 0, 30, 27, 0, 29, 0, 0, 0, 49, 48,
+        43, 38, 37, 0, 0, 40, 0, 42, 0, 0, 47, 46, 0, 0, 0, 0,
+        53, 52, 0, 0, 55, 0, 0, 60, 59, 0, 0, 0, 36, 29, 20, 7,
+        6, 0, 0, 9, 0, 13, 12, 0, 0, 15, 0, 17, 0, 19, 0, 0,
+        22, 0, 28, 25, 0, 27, 0, 0, 0, 35, 32, 0, 34, 0, 0, 0,
+        38, 0, 42, 41, 0, 0, 0, 18, 15, 4, 0, 10, 9, 8, 0, 0,
+        0, 12, 0, 14, 0, 0, 17, 0, 0, 36, 21, 0, 33, 24, 0, 28,
+        27, 0, 0, 32, 31, 0, 0, 0, 35, 0, 0, 38, 0, 48, 47, 46,
+        45, 44, 0, 0, 0, 0, 0, 50, 0, 0, 6, 5, 4, 0, 0, 0,
+        20, 13, 10, 0, 12, 0, 0, 15, 0, 17, 0, 19, 0, 0, 28, 23,
+        0, 25, 0, 27, 0, 0, 48, 43, 42, 35, 34, 0, 0, 37, 0, 39,
+        0, 41, 0, 0, 0, 45, 0, 47, 0, 0, 50, 0, 52, 0, 0, 20,
+        11, 4, 0, 8, 7, 0, 0, 10, 0, 0, 17, 14, 0, 16, 0, 0,
+        19, 0, 0, 22, 0, 26, 25, 0, 0, 32, 31, 30, 0, 0, 0, 38,
+        35, 0, 37, 0, 0, 0, 24, 23, 6, 5, 0, 0, 12, 9, 0, 11,
+        0, 0, 22, 19, 18, 17, 0, 0, 0, 21, 0, 0, 0, 0, 32, 31,
+        30, 29, 0, 0, 0, 0, 34, 0, 36, 0, 44, 43, 42, 41, 0, 0,
+        0, 0, 52, 51, 48, 0, 50, 0, 0, 0, 54, 0, 60, 57, 0, 59,
+        0, 0, 0, 18, 17, 12, 9, 8, 7, 0, 0, 0, 11, 0, 0, 14,
+        0, 16, 0, 0, 0, 42, 21, 0, 31, 30, 27, 26, 0, 0, 29, 0,
+        0, 0, 33, 0, 41, 36, 0, 38, 0, 40, 0, 0, 0, 0, 20, 3,
+        0, 13, 6, 0, 10, 9, 0, 0, 12, 0, 0, 15, 0, 19, 18, 0,
+        0, 0, 40, 37, 36, 31, 26, 0, 28, 0, 30, 0, 0, 35, 34, 0,
+        0, 0, 0, 39, 0, 0, 44, 43, 0, 0, 0, 28, 3, 0, 5, 0,
+        13, 10, 9, 0, 0, 12, 0, 0, 25, 20, 17, 0, 19, 0, 0, 24,
+        23, 0, 0, 0, 27, 0, 0, 42, 37, 36, 33, 0, 35, 0, 0, 0,
+        41, 40, 0, 0, 0, 44, 0, 50, 47, 0, 49, 0, 0, 0, 26, 9,
+        4, 0, 8, 7, 0, 0, 0, 25, 22, 15, 14, 0, 0, 21, 18, 0,
+        20, 0, 0, 0, 24, 0, 0, 0, 30, 29, 0, 0, 42, 41, 40, 35,
+        0, 37, 0, 39, 0, 0, 0, 0, 44, 0, 48, 47, 0, 0, 52, 51,
+        0, 0, 0, 38, 9, 4, 0, 8, 7, 0, 0, 0, 15, 12, 0, 14,
+        0, 0, 31, 18, 0, 24, 23, 22, 0, 0, 0, 26, 0, 28, 0, 30,
+        0, 0, 35, 34, 0, 0, 37, 0, 0, 46, 45, 42, 0, 44, 0, 0,
+        0, 56, 51, 50, 0, 0, 53, 0, 55, 0, 0, 58, 0, 0, 34, 11,
+        4, 0, 10, 7, 0, 9, 0, 0, 0, 13, 0, 33, 20, 19, 18, 0,
+        0, 0, 24, 23, 0, 0, 28, 27, 0, 0, 32, 31, 0, 0, 0, 0,
+        40, 39, 38, 0, 0, 0, 42, 0, 0, 6, 3, 0, 5, 0, 0, 26,
+        9, 0, 23, 20, 13, 0, 15, 0, 17, 0, 19, 0, 0, 22, 0, 0,
+        25, 0, 0, 28, 0, 50, 49, 44, 39, 34, 0, 38, 37, 0, 0, 0,
+        43, 42, 0, 0, 0, 46, 0, 48, 0, 0, 0, 52, 0, 54, 0, 0,
+        16, 15, 4, 0, 6, 0, 12, 9, 0, 11, 0, 0, 14, 0, 0, 0,
+        30, 21, 20, 0, 0, 27, 26, 25, 0, 0, 0, 29, 0, 0, 42, 35,
+        34, 0, 0, 37, 0, 39, 0, 41, 0, 0, 44, 0, 46, 0, 50, 49,
+        0, 0, 54, 53, 0, 0, 0, 38, 13, 8, 5, 0, 7, 0, 0, 10,
+        0, 12, 0, 0, 17, 16, 0, 0, 31, 20, 0, 22, 0, 28, 27, 26,
+        0, 0, 0, 30, 0, 0, 33, 0, 35, 0, 37, 0, 0, 42, 41, 0,
+        0, 48, 47, 46, 0, 0, 0, 0, 22, 7, 4, 0, 6, 0, 0, 9,
+        0, 17, 12, 0, 14, 0, 16, 0, 0, 21, 20, 0, 0, 0, 34, 25,
+        0, 27, 0, 29, 0, 33, 32, 0, 0, 0, 0, 34, 19, 8, 7, 6,
+        0, 0, 0, 14, 13, 12, 0, 0, 0, 18, 17, 0, 0, 0, 29, 26,
+        25, 24, 0, 0, 0, 28, 0, 0, 31, 0, 33, 0, 0, 36, 0, 42,
+        41, 40, 0, 0, 0, 44, 0, 0, 28, 7, 4, 0, 6, 0, 0, 13,
+        12, 11, 0, 0, 0, 27, 18, 17, 0, 0, 20, 0, 26, 23, 0, 25,
+        0, 0, 0, 0, 34, 33, 32, 0, 0, 0, 36, 0, 52, 45, 42, 41,
+        0, 0, 44, 0, 0, 49, 48, 0, 0, 51, 0, 0, 0, 8, 5, 4,
+        0, 0, 7, 0, 0, 20, 11, 0, 19, 16, 15, 0, 0, 18, 0, 0,
+        0, 40, 39, 24, 0, 26, 0, 30, 29, 0, 0, 32, 0, 38, 37, 36,
+        0, 0, 0, 0, 0, 0, 34, 29, 4, 0, 16, 15, 10, 9, 0, 0,
+        12, 0, 14, 0, 0, 0, 22, 21, 20, 0, 0, 0, 24, 0, 28, 27,
+        0, 0, 0, 31, 0, 33, 0, 0, 38, 37, 0, 0, 40, 0, 44, 43,
+        0, 0, 0, 28, 9, 8, 7, 6, 0, 0, 0, 0, 27, 22, 21, 20,
+        15, 0, 17, 0, 19, 0, 0, 0, 0, 24, 0, 26, 0, 0, 0, 32,
+        31, 0, 0, 42, 39, 36, 0, 38, 0, 0, 41, 0, 0, 0, 18, 5,
+        4, 0, 0, 7, 0, 15, 10, 0, 12, 0, 14, 0, 0, 17, 0, 0,
+        38, 31, 22, 0, 24, 0, 26, 0, 30, 29, 0, 0, 0, 33, 0, 37,
+        36, 0, 0, 0, 44, 43, 42, 0, 0, 0, 46, 0, 0, 32, 7, 4,
+        0, 6, 0, 0, 29, 26, 25, 20, 15, 14, 0, 0, 17, 0, 19, 0,
+        0, 22, 0, 24, 0, 0, 0, 28, 0, 0, 31, 0, 0, 42, 35, 0,
+        41, 38, 0, 40, 0, 0, 0, 44, 0, 0, 6, 3, 0, 5, 0, 0,
+        32, 19, 14, 11, 0, 13, 0, 0, 16, 0, 18, 0, 0, 21, 0, 31,
+        28, 27, 26, 0, 0, 0, 30, 0, 0, 0, 42, 35, 0, 37, 0, 39,
+        0, 41, 0, 0, 46, 45, 0, 0, 50, 49, 0, 0, 0, 22, 13, 8,
+        7, 6, 0, 0, 0, 10, 0, 12, 0, 0, 21, 16, 0, 18, 0, 20,
+        0, 0, 0, 42, 39, 26, 0, 36, 35, 34, 33, 32, 0, 0, 0, 0,
+        0, 38, 0, 0, 41, 0, 0, 44, 0, 46, 0, 48, 0, 0, 12, 3,
+        0, 5, 0, 7, 0, 11, 10, 0, 0, 0, 24, 23, 18, 17, 0, 0,
+        20, 0, 22, 0, 0, 0, 32, 31, 28, 0, 30, 0, 0, 0, 34, 0,
+        40, 39, 38, 0, 0, 0, 42, 0, 0, 14, 13, 8, 7, 6, 0, 0,
+        0, 10, 0, 12, 0, 0, 0, 42, 33, 28, 23, 20, 0, 22, 0, 0,
+        27, 26, 0, 0, 0, 30, 0, 32, 0, 0, 41, 40, 39, 38, 0, 0,
+        0, 0, 0, 0, 40, 27, 24, 5, 0, 23, 18, 15, 10, 0, 12, 0,
+        14, 0, 0, 17, 0, 0, 22, 21, 0, 0, 0, 0, 26, 0, 0, 39,
+        36, 35, 32, 0, 34, 0, 0, 0, 38, 0, 0, 0, 44, 43, 0, 0,
+        0, 36, 17, 14, 11, 6, 0, 8, 0, 10, 0, 0, 13, 0, 0, 16,
+        0, 0, 35, 20, 0, 22, 0, 28, 27, 26, 0, 0, 0, 34, 33, 32,
+        0, 0, 0, 0, 0, 38, 0, 40, 0, 44, 43, 0, 0, 46, 0, 0,
+        28, 25, 18, 17, 16, 15, 14, 9, 0, 11, 0, 13, 0, 0, 0, 0,
+        0, 0, 24, 21, 0, 23, 0, 0, 0, 27, 0, 0, 46, 41, 32, 0,
+        40, 35, 0, 39, 38, 0, 0, 0, 0, 45, 44, 0, 0, 0, 48, 0,
+        50, 0, 52, 0, 54, 0, 0, 16, 3, 0, 15, 14, 7, 0, 13, 12,
+        11, 0, 0, 0, 0, 0, 0, 38, 37, 36, 29, 24, 23, 0, 0, 28,
+        27, 0, 0, 0, 35, 32, 0, 34, 0, 0, 0, 0, 0, 50, 41, 0,
+        43, 0, 45, 0, 49, 48, 0, 0, 0, 52, 0, 54, 0, 0, 26, 13,
+        12, 5, 0, 7, 0, 11, 10, 0, 0, 0, 0, 25, 22, 21, 18, 0,
+        20, 0, 0, 0, 24, 0, 0, 0, 32, 31, 30, 0, 0, 0, 44, 37,
+        36, 0, 0, 43, 42, 41, 0, 0, 0, 0, 46, 0, 0, 22, 21, 12,
+        9, 8, 7, 0, 0, 0, 11, 0, 0, 14, 0, 20, 17, 0, 19, 0,
+        0, 0, 0, 42, 33, 28, 27, 0, 0, 32, 31, 0, 0, 0, 39, 36,
+        0, 38, 0, 0, 41, 0, 0, 0, 30, 29, 16, 5, 0, 9, 8, 0,
+        0, 11, 0, 15, 14, 0, 0, 0, 18, 0, 20, 0, 22, 0, 28, 27,
+        26, 0, 0, 0, 0, 0, 36, 33, 0, 35, 0, 0, 42, 39, 0, 41,
+        0, 0, 44, 0, 46, 0, 50, 49, 0, 0, 0, 42, 23, 12, 7, 6,
+        0, 0, 11, 10, 0, 0, 0, 20, 19, 18, 17, 0, 0, 0, 0, 22,
+        0, 0, 39, 26, 0, 38, 31, 30, 0, 0, 33, 0, 35, 0, 37, 0,
+        0, 0, 41, 0, 0, 46, 45, 0, 0, 56, 51, 50, 0, 0, 55, 54,
+        0, 0, 0, 0, 38, 11, 10, 5, 0, 9, 8, 0, 0, 0, 0, 17,
+        14, 0, 16, 0, 0, 21, 20, 0, 0, 31, 26, 25, 0, 0, 30, 29,
+        0, 0, 0, 33, 0, 35, 0, 37, 0, 0, 42, 41, 0, 0, 50, 49,
+        48, 47, 0, 0, 0, 0, 52, 0, 0, 14, 13, 4, 0, 6, 0, 8,
+        0, 10, 0, 12, 0, 0, 0, 30, 25, 24, 23, 20, 0, 22, 0, 0,
+        0, 0, 27, 0, 29, 0, 0, 32, 0, 34, 0, 40, 39, 38, 0, 0,
+        0, 42, 0, 44, 0, 46, 0, 48, 0, 50, 0, 52, 0, 0, 2, 0,
+        38, 37, 6, 0, 12, 9, 0, 11, 0, 0, 36, 21, 18, 17, 0, 0,
+        20, 0, 0, 35, 32, 27, 26, 0, 0, 29, 0, 31, 0, 0, 34, 0,
+        0, 0, 0, 0, 46, 45, 42, 0, 44, 0, 0, 0, 0, 50, 37, 26,
+        19, 10, 7, 0, 9, 0, 0, 18, 17, 14, 0, 16, 0, 0, 0, 0,
+        25, 22, 0, 24, 0, 0, 0, 36, 29, 0, 33, 32, 0, 0, 35, 0,
+        0, 0, 45, 44, 43, 42, 0, 0, 0, 0, 49, 48, 0, 0, 0, 54,
+        53, 0, 0, 0, 12, 3, 0, 5, 0, 7, 0, 9, 0, 11, 0, 0,
+        30, 19, 18, 17, 0, 0, 0, 21, 0, 25, 24, 0, 0, 27, 0, 29,
+        0, 0, 36, 33, 0, 35, 0, 0, 44, 43, 40, 0, 42, 0, 0, 0,
+        48, 47, 0, 0, 52, 51, 0, 0, 0, 48, 43, 26, 19, 18, 9, 8,
+        0, 0, 13, 12, 0, 0, 15, 0, 17, 0, 0, 0, 21, 0, 25, 24,
+        0, 0, 0, 38, 29, 0, 37, 32, 0, 36, 35, 0, 0, 0, 0, 42,
+        41, 0, 0, 0, 47, 46, 0, 0, 0, 50, 0, 52, 0, 0, 32, 3,
+        0, 27, 8, 7, 0, 0, 10, 0, 20, 13, 0, 19, 16, 0, 18, 0,
+        0, 0, 26, 23, 0, 25, 0, 0, 0, 29, 0, 31, 0, 0, 52, 45,
+        38, 37, 0, 0, 40, 0, 42, 0, 44, 0, 0, 49, 48, 0, 0, 51,
+        0, 0, 0, 10, 3, 0, 5, 0, 9, 8, 0, 0, 0, 22, 21, 14,
+        0, 20, 17, 0, 19, 0, 0, 0, 0, 28, 27, 26, 0, 0, 0, 30,
+        0, 32, 0, 38, 37, 36, 0, 0, 0, 40, 0, 42, 0, 0, 18, 3,
+        0, 9, 8, 7, 0, 0, 0, 11, 0, 17, 14, 0, 16, 0, 0, 0,
+        40, 31, 22, 0, 30, 29, 26, 0, 28, 0, 0, 0, 0, 37, 36, 35,
+        0, 0, 0, 39, 0, 0, 54, 53, 52, 45, 0, 47, 0, 51, 50, 0,
+        0, 0, 0, 0, 0, 24, 23, 20, 15, 14, 9, 8, 0, 0, 11, 0,
+        13, 0, 0, 0, 17, 0, 19, 0, 0, 22, 0, 0, 0, 30, 29, 28,
+        0, 0, 0, 48, 43, 42, 39, 38, 37, 0, 0, 0, 41, 0, 0, 0,
+        45, 0, 47, 0, 0, 0, 22, 15, 4, 0, 6, 0, 14, 13, 12, 11,
+        0, 0, 0, 0, 0, 21, 18, 0, 20, 0, 0, 0, 42, 37, 26, 0,
+        28, 0, 34, 33, 32, 0, 0, 0, 36, 0, 0, 41, 40, 0, 0, 0,
+        44, 0, 52, 47, 0, 51, 50, 0, 0, 0, 0, 38, 21, 4, 0, 14,
+        11, 10, 9, 0, 0, 0, 13, 0, 0, 16, 0, 18, 0, 20, 0, 0,
+        31, 24, 0, 30, 27, 0, 29, 0, 0, 0, 37, 34, 0, 36, 0, 0,
+        0, 40, 0, 44, 43, 0, 0, 48, 47, 0, 0, 50, 0, 52, 0, 0,
+        34, 13, 12, 7, 6, 0, 0, 9, 0, 11, 0, 0, 0, 29, 28, 19,
+        18, 0, 0, 27, 22, 0, 24, 0, 26, 0, 0, 0, 0, 31, 0, 33,
+        0, 0, 40, 37, 0, 39, 0, 0, 42, 0, 44, 0, 48, 47, 0, 0,
+        0, 14, 3, 0, 9, 8, 7, 0, 0, 0, 13, 12, 0, 0, 0, 34,
+        21, 20, 19, 0, 0, 0, 25, 24, 0, 0, 27, 0, 29, 0, 31, 0,
+        33, 0, 0, 52, 39, 38, 0, 0, 43, 42, 0, 0, 49, 48, 47, 0,
+        0, 0, 51, 0, 0, 0, 2, 0, 26, 5, 0, 11, 10, 9, 0, 0,
+        0, 25, 20, 15, 0, 17, 0, 19, 0, 0, 24, 23, 0, 0, 0, 0,
+        42, 33, 32, 31, 0, 0, 0, 35, 0, 39, 38, 0, 0, 41, 0, 0,
+        0, 22, 13, 4, 0, 12, 7, 0, 9, 0, 11, 0, 0, 0, 21, 16,
+        0, 18, 0, 20, 0, 0, 0, 52, 37, 28, 27, 0, 0, 34, 31, 0,
+        33, 0, 0, 36, 0, 0, 51, 50, 41, 0, 43, 0, 45, 0, 47, 0,
+        49, 0, 0, 0, 0, 0, 24, 3, 0, 17, 12, 7, 0, 9, 0, 11,
+        0, 0, 16, 15, 0, 0, 0, 19, 0, 23, 22, 0, 0, 0, 44, 37,
+        36, 29, 0, 33, 32, 0, 0, 35, 0, 0, 0, 39, 0, 41, 0, 43,
+        0, 0, 52, 51, 50, 49, 0, 0, 0, 0, 54, 0, 0, 34, 9, 4,
+        0, 8, 7, 0, 0, 0, 21, 16, 15, 14, 0, 0, 0, 18, 0, 20,
+        0, 0, 25, 24, 0, 0, 27, 0, 29, 0, 31, 0, 33, 0, 0, 36,
+        0, 38, 0, 46, 45, 42, 0, 44, 0, 0, 0, 0, 32, 23, 10, 5,
+        0, 9, 8, 0, 0, 0, 18, 17, 16, 15, 0, 0, 0, 0, 22, 21,
+        0, 0, 0, 25, 0, 27, 0, 31, 30, 0, 0, 0, 34, 0, 40, 37,
+        0, 39, 0, 0, 42, 0, 0, 12, 3, 0, 11, 10, 9, 8, 0, 0,
+        0, 0, 0, 36, 33, 16, 0, 20, 19, 0, 0, 32, 23, 0, 27, 26,
+        0, 0, 29, 0, 31, 0, 0, 0, 35, 0, 0, 46, 45, 40, 0, 42,
+        0, 44, 0, 0, 0, 48, 0, 0, 26, 21, 18, 5, 0, 7, 0, 17,
+        14, 11, 0, 13, 0, 0, 16, 0, 0, 0, 20, 0, 0, 25, 24, 0,
+        0, 0, 28, 0, 36, 31, 0, 35, 34, 0, 0, 0, 44, 43, 40, 0,
+        42, 0, 0, 0, 0, 20, 3, 0, 19, 16, 11, 10, 9, 0, 0, 0,
+        13, 0, 15, 0, 0, 18, 0, 0, 0, 42, 35, 26, 25, 0, 0, 28,
+        0, 30, 0, 34, 33, 0, 0, 0, 41, 38, 0, 40, 0, 0, 0, 44,
+        0, 0, 46, 33, 24, 5, 0, 13, 8, 0, 10, 0, 12, 0, 0, 19,
+        18, 17, 0, 0, 0, 23, 22, 0, 0, 0, 32, 29, 28, 0, 0, 31,
+        0, 0, 0, 35, 0, 39, 38, 0, 0, 41, 0, 43, 0, 45, 0, 0,
+        50, 49, 0, 0, 0, 24, 21, 12, 11, 10, 9, 8, 0, 0, 0, 0,
+        0, 14, 0, 16, 0, 18, 0, 20, 0, 0, 23, 0, 0, 38, 27, 0,
+        31, 30, 0, 0, 37, 34, 0, 36, 0, 0, 0, 40, 0, 48, 43, 0,
+        45, 0, 47, 0, 0, 0, 26, 23, 20, 19, 12, 11, 8, 0, 10, 0,
+        0, 0, 14, 0, 18, 17, 0, 0, 0, 0, 22, 0, 0, 25, 0, 0,
+        38, 29, 0, 33, 32, 0, 0, 37, 36, 0, 0, 0, 40, 0, 0, 20,
+        11, 8, 7, 6, 0, 0, 0, 10, 0, 0, 17, 14, 0, 16, 0, 0,
+        19, 0, 0, 34, 29, 24, 0, 28, 27, 0, 0, 0, 33, 32, 0, 0,
+        0, 40, 39, 38, 0, 0, 0, 48, 43, 0, 45, 0, 47, 0, 0, 0,
+        36, 17, 16, 15, 14, 13, 12, 9, 0, 11, 0, 0, 0, 0, 0, 0,
+        0, 29, 24, 21, 0, 23, 0, 0, 26, 0, 28, 0, 0, 35, 32, 0,
+        34, 0, 0, 0, 40, 39, 0, 0, 42, 0, 0, 12, 3, 0, 5, 0,
+        11, 10, 9, 0, 0, 0, 0, 38, 35, 18, 17, 0, 0, 28, 27, 22,
+        0, 26, 25, 0, 0, 0, 0, 32, 31, 0, 0, 34, 0, 0, 37, 0,
+        0, 40, 0, 42, 0, 0, 40, 27, 20, 5, 0, 7, 0, 13, 12, 11,
+        0, 0, 0, 19, 18, 17, 0, 0, 0, 0, 22, 0, 24, 0, 26, 0,
+        0, 33, 30, 0, 32, 0, 0, 37, 36, 0, 0, 39, 0, 0, 48, 47,
+        46, 45, 0, 0, 0, 0, 52, 51, 0, 0, 0, 16, 9, 6, 5, 0,
+        0, 8, 0, 0, 15, 12, 0, 14, 0, 0, 0, 46, 33, 32, 31, 28,
+        23, 0, 25, 0, 27, 0, 0, 30, 0, 0, 0, 0, 45, 36, 0, 42,
+        39, 0, 41, 0, 0, 44, 0, 0, 0, 48, 0, 50, 0, 0, 44, 35,
+        24, 5, 0, 13, 12, 11, 10, 0, 0, 0, 0, 19, 16, 0, 18, 0,
+        0, 23, 22, 0, 0, 0, 32, 31, 28, 0, 30, 0, 0, 0, 34, 0,
+        0, 39, 38, 0, 0, 41, 0, 43, 0, 0, 48, 47, 0, 0, 60, 51,
+        0, 55, 54, 0, 0, 57, 0, 59, 0, 0, 62, 0, 0, 40, 37, 32,
+        15, 8, 7, 0, 0, 10, 0, 14, 13, 0, 0, 0, 23, 22, 21, 20,
+        0, 0, 0, 0, 31, 30, 27, 0, 29, 0, 0, 0, 0, 34, 0, 36,
+        0, 0, 39, 0, 0, 62, 55, 48, 45, 0, 47, 0, 0, 50, 0, 52,
+        0, 54, 0, 0, 57, 0, 61, 60, 0, 0, 0, 0, 32, 15, 6, 5,
+        0, 0, 12, 9, 0, 11, 0, 0, 14, 0, 0, 27, 26, 23, 20, 0,
+        22, 0, 0, 25, 0, 0, 0, 31, 30, 0, 0, 0, 36, 35, 0, 0,
+        38, 0, 40, 0, 0, 10, 7, 6, 5, 0, 0, 0, 9, 0, 0, 44,
+        33, 26, 19, 16, 0, 18, 0, 0, 25, 24, 23, 0, 0, 0, 0, 28,
+        0, 30, 0, 32, 0, 0, 39, 38, 37, 0, 0, 0, 41, 0, 43, 0,
+        0, 52, 47, 0, 49, 0, 51, 0, 0, 0, 40, 11, 4, 0, 6, 0,
+        8, 0, 10, 0, 0, 35, 14, 0, 18, 17, 0, 0, 26, 21, 0, 25,
+        24, 0, 0, 0, 34, 33, 30, 0, 32, 0, 0, 0, 0, 37, 0, 39,
+        0, 0, 46, 45, 44, 0, 0, 0, 48, 0, 50, 0, 52, 0, 0, 16,
+        11, 10, 9, 6, 0, 8, 0, 0, 0, 0, 15, 14, 0, 0, 0, 18,
+        0, 34, 21, 0, 31, 24, 0, 26, 0, 28, 0, 30, 0, 0, 33, 0,
+        0, 42, 41, 40, 39, 0, 0, 0, 0, 44, 0, 0, 42, 39, 30, 5,
+        0, 23, 12, 11, 10, 0, 0, 0, 16, 15, 0, 0, 22, 21, 20, 0,
+        0, 0, 0, 29, 26, 0, 28, 0, 0, 0, 38, 37, 36, 35, 0, 0,
+        0, 0, 0, 41, 0, 0, 54, 49, 48, 47, 0, 0, 0, 53, 52, 0,
+        0, 0, 0, 20, 3, 0, 9, 6, 0, 8, 0, 0, 11, 0, 15, 14,
+        0, 0, 19, 18, 0, 0, 0, 32, 25, 24, 0, 0, 27, 0, 29, 0,
+        31, 0, 0, 50, 45, 40, 37, 0, 39, 0, 0, 44, 43, 0, 0, 0,
+        47, 0, 49, 0, 0, 54, 53, 0, 0, 0,
+    },
+    .leaf_vote = {
+        65535, 0, 65535, 0, 65535, 0, 65535, 65535, 65535, 0, 0, 65535, 0, 0, 65535, 0,
+        0, 65535, 0, 0, 65535, 65535, 0, 65535, 0, 65535, 65535, 0, 0, 0, 65535, 0,
+        0, 65535, 65535, 0, 65535, 0, 65535, 0, 65535, 65535, 0, 0, 65535, 0, 65535, 0,
+        0, 65535, 65535, 65535, 0, 65535, 65535, 65535, 0, 65535, 0, 0, 65535, 65535, 0, 0,
+        0, 65535, 65535, 0, 65535, 0, 0, 0, 65535, 0, 0, 0, 0, 0, 0, 0,
+        65535, 65535, 0, 65535, 65535, 0, 65535, 0, 65535, 0, 65535, 65535, 0, 0, 65535, 0,
+        65535, 0, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 0, 0, 0, 65535, 65535, 65535,
+        0, 65535, 0, 0, 65535, 65535, 0, 65535, 0, 65535, 0, 0, 65535, 0, 65535, 0,
+        0, 65535, 0, 0, 65535, 65535, 0, 65535, 65535, 0, 65535, 0, 65535, 0, 65535, 65535,
+        0, 65535, 0, 65535, 0, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 0,
+        65535, 0, 65535, 0, 0, 65535, 0, 65535, 65535, 0, 65535, 0, 65535, 65535, 65535, 0,
+        0, 0, 0, 65535, 0, 65535, 65535, 65535, 0, 65535, 0, 65535, 0, 0, 65535, 0,
+        65535, 65535, 65535, 0, 65535, 0, 0, 65535, 65535, 0, 0, 65535, 0, 65535, 0, 65535,
+        0, 65535, 0, 65535, 0, 0, 0, 0, 65535, 0, 65535, 65535, 0, 65535, 0, 65535,
+        65535, 0, 65535, 65535, 0, 0, 65535, 65535, 0, 0, 65535, 0, 0, 65535, 65535, 0,
+        65535, 0, 0, 0, 65535, 0, 0, 0, 65535, 65535, 0, 65535, 0, 65535, 65535, 0,
+        65535, 65535, 0, 65535, 0, 65535, 0, 65535, 65535, 0, 0, 0, 65535, 0, 0, 65535,
+        65535, 65535, 0, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 65535, 0, 65535, 65535, 0,
+        65535, 0, 65535, 0, 0, 65535, 65535, 0, 65535, 0, 0, 0, 65535, 65535, 0, 65535,
+        65535, 0, 65535, 0, 65535, 0, 65535, 0, 0, 65535, 0, 65535, 65535, 65535, 0, 65535,
+        0, 65535, 0, 0, 65535, 0, 65535, 65535, 65535, 0, 0, 0, 65535, 0, 0, 65535,
+        65535, 0, 0, 0, 65535, 0, 65535, 0, 0, 65535, 0, 65535, 65535, 0, 65535, 0,
+        65535, 65535, 0, 65535, 0, 65535, 0, 0, 65535, 65535, 65535, 65535, 0, 65535, 0, 0,
+        65535, 0, 0, 0, 65535, 0, 65535, 65535, 0, 65535, 0, 65535, 0, 65535, 0, 0,
+        0, 65535, 0, 65535, 65535, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 0,
+        65535, 0, 0, 65535, 0, 65535, 0, 0, 65535, 0, 65535, 0, 65535, 65535, 0, 0,
+        65535, 65535, 0, 0, 65535, 0, 65535, 0, 0, 65535, 0, 65535, 0, 0, 65535, 65535,
+        0, 0, 65535, 0, 0, 65535, 0, 65535, 0, 0, 65535, 65535, 0, 65535, 0, 65535,
+        65535, 0, 65535, 65535, 0, 65535, 0, 0, 0, 65535, 0, 65535, 0, 65535, 0, 65535,
+        65535, 0, 65535, 65535, 65535, 0, 0, 65535, 0, 65535, 0, 0, 65535, 0, 65535, 0,
+        65535, 65535, 0, 65535, 65535, 0, 0, 65535, 65535, 0, 65535, 0, 0, 65535, 65535, 0,
+        65535, 0, 65535, 0, 65535, 0, 65535, 65535, 0, 0, 65535, 0, 0, 65535, 65535, 0,
+        65535, 65535, 0, 0, 65535, 65535, 0, 65535, 65535, 0, 0, 65535, 65535, 0, 0, 65535,
+        65535, 65535, 65535, 0, 65535, 0, 65535, 0, 65535, 65535, 65535, 0, 65535, 0, 0, 0,
+        65535, 65535, 0, 65535, 65535, 0, 0, 0, 65535, 0, 65535, 65535, 65535, 0, 65535, 0,
+        0, 65535, 0, 0, 65535, 65535, 0, 0, 0, 65535, 0, 0, 65535, 65535, 0, 0,
+        65535, 0, 65535, 65535, 65535, 0, 65535, 0, 65535, 0, 0, 65535, 0, 65535, 65535, 0,
+        65535, 0, 0, 65535, 0, 0, 0, 0, 65535, 0, 65535, 0, 65535, 65535, 0, 65535,
+        65535, 0, 65535, 0, 0, 65535, 0, 0, 0, 65535, 65535, 0, 65535, 0, 65535, 0,
+        65535, 65535, 0, 0, 65535, 0, 65535, 0, 0, 65535, 0, 65535, 0, 65535, 0, 0,
+        65535, 65535, 65535, 0, 0, 65535, 0, 65535, 65535, 65535, 0, 65535, 0, 65535, 0, 0,
+        65535, 0, 65535, 0, 0, 65535, 0, 65535, 0, 0, 65535, 0, 0, 65535, 65535, 65535,
+        0, 0, 65535, 65535, 0, 0, 65535, 0, 65535, 0, 65535, 65535, 65535, 0, 0, 0,
+        65535, 0, 65535, 65535, 0, 0, 65535, 0, 65535, 65535, 65535, 0, 65535, 0, 0, 65535,
+        0, 65535, 65535, 65535, 0, 0, 65535, 65535, 0, 65535, 0, 0, 0, 65535, 0, 65535,
+        0, 65535, 0, 65535, 0, 0, 65535, 0, 65535, 65535, 0, 65535, 0, 65535, 65535, 65535,
+        0, 65535, 0, 0, 0, 65535, 65535, 0, 0, 65535, 0, 65535, 0, 65535, 0, 65535,
+        0, 65535, 0, 65535, 65535, 0, 65535, 65535, 0, 65535, 65535, 0, 0, 65535, 0, 0,
+        65535, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 0,
+        0, 65535, 65535, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 0, 0, 0, 65535, 65535,
+        0, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 65535, 0, 65535, 0, 0, 65535, 0,
+        65535, 0, 65535, 0, 0, 65535, 65535, 0, 0, 0, 65535, 65535, 0, 65535, 0, 65535,
+        0, 65535, 65535, 0, 65535, 0, 0, 0, 65535, 65535, 0, 65535, 0, 65535, 0, 65535,
+        0, 65535, 65535, 0, 65535, 0, 65535, 0, 0, 0, 65535, 65535, 0, 0, 0, 65535,
+        65535, 0, 65535, 0, 65535, 0, 65535, 0, 0, 0, 65535, 65535, 65535, 0, 0, 65535,
+        65535, 65535, 0, 65535, 65535, 0, 65535, 0, 0, 65535, 65535, 0, 65535, 65535, 0, 65535,
+        0, 65535, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 0, 0,
+        0, 0, 65535, 0, 65535, 0, 65535, 65535, 0, 0, 65535, 0, 65535, 0, 65535, 65535,
+        0, 65535, 65535, 65535, 0, 65535, 65535, 0, 0, 65535, 0, 0, 65535, 0, 65535, 0,
+        0, 65535, 0, 0, 65535, 0, 65535, 0, 65535, 65535, 65535, 65535, 0, 0, 0, 65535,
+        0, 65535, 0, 65535, 0, 0, 65535, 65535, 0, 0, 65535, 0, 65535, 0, 0, 0,
+        65535, 65535, 0, 65535, 0, 0, 0, 65535, 65535, 65535, 0, 65535, 65535, 0, 0, 0,
+        65535, 65535, 0, 65535, 65535, 0, 65535, 0, 0, 0, 65535, 0, 65535, 0, 65535, 0,
+        65535, 0, 0, 0, 65535, 65535, 0, 65535, 0, 0, 65535, 65535, 65535, 0, 65535, 0,
+        0, 0, 65535, 0, 65535, 0, 65535, 0, 0, 0, 65535, 65535, 0, 65535, 0, 65535,
+        65535, 0, 65535, 0, 0, 0, 65535, 0, 65535, 0, 65535, 65535, 0, 65535, 0, 0,
+        65535, 65535, 65535, 65535, 0, 0, 0, 65535, 0, 0, 65535, 65535, 0, 65535, 65535, 0,
+        65535, 65535, 0, 65535, 0, 0, 65535, 0, 65535, 0, 0, 0, 65535, 0, 65535, 65535,
+        0, 65535, 0, 65535, 0, 65535, 0, 65535, 65535, 0, 0, 0, 0, 65535, 65535, 0,
+        65535, 0, 0, 65535, 0, 0, 65535, 0, 65535, 65535, 0, 65535, 0, 65535, 65535, 0,
+        0, 0, 65535, 0, 65535, 0, 65535, 65535, 0, 65535, 0, 0, 65535, 0, 65535, 0,
+        65535, 65535, 0, 65535, 0, 0, 65535, 65535, 0, 0, 65535, 65535, 0, 0, 65535, 0,
+        65535, 65535, 0, 65535, 0, 65535, 0, 0, 65535, 0, 65535, 65535, 65535, 0, 65535, 65535,
+        0, 0, 0, 65535, 0, 65535, 65535, 0, 65535, 0, 0, 65535, 0, 65535, 0, 65535,
+        0, 65535, 0, 0, 65535, 65535, 0, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 0,
+        0, 65535, 0, 65535, 0, 0, 65535, 65535, 0, 65535, 65535, 65535, 0, 0, 65535, 0,
+        65535, 65535, 0, 65535, 0, 65535, 0, 0, 65535, 65535, 0, 65535, 0, 0, 65535, 0,
+        0, 65535, 65535, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 65535,
+        0, 65535, 0, 0, 65535, 0, 65535, 0, 0, 65535, 0, 0, 65535, 0, 0, 65535,
+        0, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 0, 0, 0, 65535, 0, 65535, 65535,
+        0, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 0,
+        65535, 65535, 0, 0, 65535, 0, 0, 0, 65535, 65535, 0, 65535, 65535, 0, 65535, 65535,
+        0, 0, 0, 65535, 65535, 65535, 0, 0, 65535, 0, 0, 65535, 65535, 0, 0, 65535,
+        65535, 0, 0, 0, 65535, 0, 65535, 0, 65535, 65535, 0, 65535, 0, 0, 0, 65535,
+        65535, 0, 0, 65535, 65535, 0, 0, 65535, 65535, 65535, 0, 65535, 65535, 0, 0, 65535,
+        0, 65535, 0, 65535, 0, 0, 65535, 0, 65535, 0, 65535, 65535, 65535, 0, 65535, 0,
+        0, 65535, 0, 0, 0, 65535, 0, 65535, 0, 65535, 65535, 0, 0, 65535, 0, 65535,
+        65535, 0, 65535, 0, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 65535, 65535, 0, 65535,
+        65535, 0, 65535, 0, 0, 0, 65535, 0, 65535, 0, 65535, 0, 0, 65535, 0, 65535,
+        0, 65535, 0, 65535, 0, 0, 65535, 0, 65535, 65535, 0, 65535, 0, 65535, 65535, 0,
+        65535, 65535, 65535, 0, 0, 65535, 0, 0, 65535, 0, 65535, 0, 65535, 65535, 65535, 0,
+        65535, 0, 65535, 65535, 0, 65535, 0, 0, 65535, 65535, 65535, 0, 65535, 0, 65535, 0,
+        0, 65535, 65535, 0, 0, 65535, 0, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 0,
+        65535, 65535, 0, 65535, 65535, 0, 0, 65535, 0, 0, 65535, 0, 65535, 0, 65535, 0,
+        0, 65535, 0, 65535, 0, 65535, 65535, 0, 65535, 65535, 0, 65535, 0, 65535, 0, 65535,
+        0, 65535, 65535, 0, 65535, 0, 0, 65535, 0, 65535, 0, 0, 65535, 65535, 0, 65535,
+        0, 65535, 65535, 0, 65535, 0, 0, 65535, 0, 65535, 65535, 0, 65535, 0, 0, 65535,
+        0, 65535, 65535, 0, 65535, 0, 65535, 65535, 65535, 0, 65535, 65535, 0, 0, 65535, 0,
+        65535, 0, 0, 0, 65535, 0, 65535, 0, 65535, 0, 0, 65535, 0, 65535, 0, 65535,
+        0, 65535, 0, 65535, 0, 0, 65535, 0, 65535, 65535, 65535, 0, 65535, 0, 65535, 0,
+        0, 65535, 0, 0, 65535, 65535, 0, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 0,
+        65535, 65535, 0, 0, 65535, 0, 65535, 65535, 0, 65535, 65535, 0, 0, 0, 65535, 65535,
+        0, 0, 65535, 0, 65535, 0, 65535, 0, 0, 65535, 65535, 0, 65535, 0, 65535, 0,
+        0, 0, 65535, 65535, 0, 65535, 65535, 0, 0, 65535, 0, 0, 65535, 65535, 0, 0,
+        65535, 65535, 0, 0, 65535, 0, 65535, 65535, 0, 65535, 65535, 0, 65535, 0, 0, 0,
+        65535, 0, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 65535, 65535, 0, 65535, 65535, 0,
+        65535, 0, 65535, 0, 0, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 0,
+        65535, 65535, 0, 65535, 0, 0, 65535, 0, 65535, 0, 0, 0, 0, 65535, 65535, 65535,
+        0, 65535, 0, 65535, 0, 0, 0, 65535, 0, 65535, 0, 65535, 0, 0, 65535, 65535,
+        65535, 0, 65535, 65535, 65535, 0, 0, 65535, 0, 65535, 0, 65535, 65535, 65535, 65535, 0,
+        65535, 65535, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 65535, 0, 0, 0, 65535, 0,
+        65535, 0, 65535, 0, 65535, 0, 65535, 65535, 65535, 0, 65535, 65535, 65535, 0, 65535, 0,
+        65535, 0, 0, 65535, 0, 65535, 65535, 65535, 0, 0, 65535, 0, 0, 0, 65535, 0,
+        65535, 65535, 65535, 0, 65535, 65535, 65535, 0, 65535, 0, 0, 65535, 0, 65535, 65535, 0,
+        65535, 65535, 65535, 0, 0, 0, 65535, 0, 0, 65535, 65535, 0, 65535, 65535, 0, 0,
+        0, 65535, 65535, 65535, 0, 0, 0, 0, 65535, 0, 65535, 65535, 0, 65535, 65535, 0,
+        65535, 65535, 0, 0, 65535, 65535, 65535, 65535, 0, 0, 65535, 0, 65535, 0, 65535, 65535,
+        65535, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 0, 0, 65535,
+        65535, 0, 0, 0, 65535, 0, 0, 0, 65535, 0, 0, 65535, 65535, 65535, 65535, 0,
+        0, 65535, 0, 65535, 65535, 0, 0, 65535, 0, 0, 0, 65535, 65535, 0, 65535, 0,
+        65535, 0, 0, 65535, 0, 65535, 0, 0, 65535, 0, 0, 0, 65535, 0, 65535, 0,
+        65535, 0, 65535, 0, 0, 0, 65535, 65535, 0, 65535, 0, 0, 65535, 65535, 65535, 0,
+        65535, 0, 65535, 65535, 65535, 0, 0, 65535, 65535, 0, 0, 0, 65535, 0, 65535, 0,
+        65535, 0, 65535, 0, 65535, 0, 0, 65535, 65535, 0, 65535, 0, 65535, 0, 65535, 0,
+        0, 65535, 0, 65535, 0, 65535, 65535, 0, 65535, 0, 0, 65535, 0, 65535, 0, 65535,
+        65535, 65535, 0, 0, 65535, 65535, 0, 65535, 0, 65535, 65535, 0, 65535, 65535, 0, 65535,
+        0, 0, 65535, 65535, 0, 0, 65535, 0, 0, 65535, 0, 65535, 0, 65535, 65535, 65535,
+        0, 65535, 0, 0, 65535, 65535, 0, 0, 0, 65535, 0, 65535, 65535, 65535, 0, 65535,
+        0, 65535, 0, 0, 0, 65535, 65535, 0, 0, 65535, 65535, 65535, 65535, 65535, 0, 65535,
+        0, 0, 65535, 0, 65535, 65535, 0, 65535, 0, 0, 65535, 0, 65535, 65535, 65535, 0,
+        65535, 0, 65535, 65535, 0, 0, 0, 65535, 0, 65535, 0, 0, 65535, 0, 0, 65535,
+        0, 65535, 65535, 0, 0, 65535, 65535, 65535, 65535, 0, 0, 65535, 0, 0, 65535, 65535,
+        0, 0, 65535, 65535, 0, 0, 65535, 65535, 0, 0, 65535, 0, 65535, 0, 65535, 65535,
+        65535, 0, 65535, 0, 65535, 65535, 0, 0, 65535, 65535, 0, 65535, 0, 65535, 65535, 0,
+        65535, 0, 65535, 0, 65535, 0, 0, 65535, 65535, 0, 65535, 65535, 0, 0, 0, 65535,
+        0, 65535, 0, 65535, 0, 65535, 0, 65535, 65535, 65535, 0, 65535, 0, 65535, 0, 0,
+        0, 0, 65535, 0, 0, 0, 65535, 65535, 65535, 65535, 65535, 0, 0, 65535, 0, 0,
+        0, 65535, 0, 65535, 0, 65535, 65535, 0, 0, 65535, 0, 65535, 0, 65535, 65535, 65535,
+        0, 65535, 0, 0, 65535, 0, 0, 0, 65535, 0, 65535, 0, 65535, 65535, 65535, 0,
+        0, 65535, 0, 65535, 0, 65535, 0, 65535, 65535, 0, 65535, 65535, 0, 65535, 65535, 0,
+        0, 65535, 0, 65535, 0, 65535, 0, 0, 0, 65535, 65535, 65535, 0, 65535, 0, 65535,
+        0, 65535, 0, 65535, 0, 65535, 0, 0, 65535, 65535, 65535, 65535, 65535, 65535, 0, 0,
+        65535, 65535, 0, 65535, 0, 65535, 65535, 0, 65535, 65535, 0, 0, 65535, 0, 65535, 65535,
+        65535, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 65535, 0, 0, 65535, 0,
+        65535, 65535, 0, 0, 65535, 65535, 0, 0, 65535, 0, 0, 0, 65535, 65535, 0, 0,
+        65535, 0, 65535, 0, 0, 0, 65535, 65535, 0, 0, 0, 65535, 0, 65535, 0, 65535,
+        0, 0, 65535, 65535, 65535, 65535, 0, 0, 0, 65535, 65535, 0, 0, 0, 65535, 65535,
+        0, 65535, 0, 65535, 65535, 0, 65535, 0, 65535, 0, 65535, 0, 0, 65535, 0, 0,
+        0, 65535, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 65535, 0, 0, 65535, 0, 65535,
+        65535, 0, 65535, 0, 65535, 65535, 0, 0, 65535, 0, 0, 0, 65535, 65535, 65535, 0,
+        65535, 0, 65535, 0, 65535, 65535, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 0, 65535,
+        65535, 0, 65535, 0, 65535, 0, 65535, 65535, 0, 0, 0, 0, 65535, 0, 65535, 0,
+        65535, 0, 65535, 0, 65535, 65535, 0, 65535, 0, 65535, 0, 0, 65535, 0, 65535, 0,
+        65535, 0, 0, 65535, 65535, 65535, 0, 65535, 65535, 0, 0, 65535, 0, 65535, 0, 65535,
+        0, 65535, 0, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 65535, 0, 65535,
+        0, 65535, 0, 0, 65535, 0, 0, 65535, 65535, 0, 0, 65535, 0, 65535, 65535,
+    },
+};
+
+#endif /* MAIN_IRRIGATION_FOREST_H_ */
@@ -0,0 +1,81 @@
+/**
+ * @file pump_bank.cpp
+ * @author Marcel Nahir Samur (mnsamur2014@gmail.com)
+ * @brief Switches several pump relays with one register write
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <pump_bank.h>
+
+int pump_bank_init(pump_bank_t *pBank, const pump_bank_regs_t *pRegs, const int *pPins, size_t qty)
+{
+    if (pBank == NULL || pRegs == NULL || pPins == NULL || qty == 0 || qty > PUMP_BANK_MAX_PUMPS) {
+        return -1;
+    }
+
+    for (size_t i = 0; i < qty; i++) {
+        if (!PUMP_BANK_HAL_IS_OUTPUT(pPins[i])) {
+            return -1;
+        }
+        pBank->pin_reg[i] = pPins[i] / PUMP_BANK_HAL_PINS_PER_REG;
+        pBank->pin_mask[i] = 1UL << (pPins[i] % PUMP_BANK_HAL_PINS_PER_REG);
+    }
+
+    pBank->regs = *pRegs;
+    pBank->qty = qty;
+    pBank->state = 0;
+
+    return 0;
+}
+
+void pump_bank_write(pump_bank_t *pBank, uint32_t zone_mask, uint32_t on_mask)
+{
+    uint32_t set[2] = {0, 0};
+    uint32_t clear[2] = {0, 0};
+
+    // Translate pump bits into register bits
+    for (size_t i = 0; i < pBank->qty; i++) {
+        if (!(zone_mask & (1UL << i))) {
+            continue;
+        }
+        if (on_mask & (1UL << i)) {
+            set[pBank->pin_reg[i]] |= pBank->pin_mask[i];
+        } else {
+            clear[pBank->pin_reg[i]] |= pBank->pin_mask[i];
+        }
+    }
+
+    // Off first, so swapping zones never has both relays on
+    if (clear[0]) {
+        *pBank->regs.out_w1tc = clear[0];
+    }
+    if (clear[1]) {
+        *pBank->regs.out1_w1tc = clear[1];
+    }
+    if (set[0]) {
+        *pBank->regs.out_w1ts = set[0];
+    }
+    if (set[1]) {
+        *pBank->regs.out1_w1ts = set[1];
+    }
+
+    uint32_t state = pBank->state.load();
+    while (!pBank->state.compare_exchange_weak(state, (state & ~zone_mask) | (on_mask & zone_mask))) {
+    }
+}
+
+void pump_bank_apply(pump_bank_t *pBank, uint32_t on_mask)
+{
+    uint32_t all = pBank->qty == PUMP_BANK_MAX_PUMPS ? UINT32_MAX : (1UL << pBank->qty) - 1;
+
+    pump_bank_write(pBank, all, on_mask);
+}
+
+uint32_t pump_bank_get(const pump_bank_t *pBank)
+{
+    return pBank->state.load();
+}
@@ -0,0 +1,203 @@
+/**
+ * @file pump_pwm.cpp
+ * @author Marcel Nahir Samur (mnsamur2014@gmail.com)
+ * @brief LEDC pump output for MOSFET drivers, soft-start and low flow duty
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <esp_log.h>
+#include <freertos/FreeRTOS.h>
+
+#include <pump_pwm.h>
+
+static const char *TAG = "pump_pwm";
+
+/**
+ * @brief Context structure for the pump PWM output
+ *        Holds all the state needed for the driver.
+ */
+typedef struct {
+    uint8_t level[PUMP_QTY];    /*!< Running level of each pump */
+    uint16_t ramp_ms[PUMP_QTY]; /*!< Soft-start time of each pump */
+    uint32_t on_mask;           /*!< Pumps currently on */
+    portMUX_TYPE lock;
+    bool is_initialized = false;
+} pump_pwm_ctx_t;
+
+static pump_pwm_ctx_t s_ctx = {
+    .lock = portMUX_INITIALIZER_UNLOCKED,
+};
+
+/**
+ * @brief Converts a Matter level into a LEDC duty
+ *
+ * @param level 0 .. PUMP_PWM_MAX_LEVEL
+ * @return uint32_t Duty for PUMP_PWM_RESOLUTION
+ */
+static uint32_t pump_pwm_duty(uint8_t level)
+{
+    if (level > PUMP_PWM_MAX_LEVEL) {
+        level = PUMP_PWM_MAX_LEVEL;
+    }
+    return (uint32_t)level * PUMP_PWM_MAX_DUTY / PUMP_PWM_MAX_LEVEL;
+}
+
+/**
+ * @brief Starts a hardware fade of a pump channel towards a duty
+ *
+ * @param pump Pump index
+ * @param duty Target duty
+ * @param fade_ms Fade time, 0 jumps straight to the duty
+ * @return esp_err_t ESP_OK on success
+ */
+static esp_err_t pump_pwm_fade(size_t pump, uint32_t duty, uint32_t fade_ms)
+{
+    ledc_channel_t channel = (ledc_channel_t)(PUMP_PWM_FIRST_CHANNEL + pump);
+
+    // Abort a soft-start still in progress, the last request wins
+    ledc_fade_stop(PUMP_PWM_SPEED_MODE, channel);
+
+    if (fade_ms == 0) {
+        return ledc_set_duty_and_update(PUMP_PWM_SPEED_MODE, channel, duty, 0);
+    }
+    return ledc_set_fade_time_and_start(PUMP_PWM_SPEED_MODE, channel, duty, fade_ms, LEDC_FADE_NO_WAIT);
+}
+
+esp_err_t pump_pwm_write(uint32_t zone_mask, uint32_t on_mask)
+{
+    esp_err_t err = ESP_OK;
+
+    if (!s_ctx.is_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    taskENTER_CRITICAL(&s_ctx.lock);
+    uint32_t starting = zone_mask & on_mask & ~s_ctx.on_mask;
+    s_ctx.on_mask = (s_ctx.on_mask & ~zone_mask) | (on_mask & zone_mask);
+    taskEXIT_CRITICAL(&s_ctx.lock);
+
+    for (size_t i = 0; i < PUMP_QTY; i++) {
+        if (!(zone_mask & BIT(i))) {
+            continue;
+        }
+
+        esp_err_t ret;
+        if (!(on_mask & BIT(i))) {
+            // No ramp down, the interlock relies on this being immediate
+            ret = pump_pwm_fade(i, 0, 0);
+        } else if (starting & BIT(i)) {
+            ret = pump_pwm_fade(i, pump_pwm_duty(s_ctx.level[i]), s_ctx.ramp_ms[i]);
+        } else {
+            continue;
+        }
+
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to drive pump %d: %d", i, ret);
+            err = ret;
+        }
+    }
+
+    return err;
+}
+
+esp_err_t pump_pwm_set_level(size_t pump, uint8_t level)
+{
+    if (pump >= PUMP_QTY || level == 0 || level > PUMP_PWM_MAX_LEVEL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!s_ctx.is_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    s_ctx.level[pump] = level;
+
+    if (pump_pwm_get_mask() & BIT(pump)) {
+        return pump_pwm_fade(pump, pump_pwm_duty(level), PUMP_PWM_STEP_MS);
+    }
+    return ESP_OK;
+}
+
+esp_err_t pump_pwm_set_ramp(size_t pump, uint16_t ramp_ms)
+{
+    if (pump >= PUMP_QTY) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    s_ctx.ramp_ms[pump] = ramp_ms;
+
+    return ESP_OK;
+}
+
+uint32_t pump_pwm_get_mask(void)
+{
+    taskENTER_CRITICAL(&s_ctx.lock);
+    uint32_t on_mask = s_ctx.on_mask;
+    taskEXIT_CRITICAL(&s_ctx.lock);
+
+    return on_mask;
+}
+
+esp_err_t pump_pwm_init(const gpio_pump_t *pPump)
+{
+    esp_err_t err;
+
+    if (pPump == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_ctx.is_initialized) {
+        ESP_LOGE(TAG, "Driver already initialized");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    ledc_timer_config_t timer_conf = {
+        .speed_mode = PUMP_PWM_SPEED_MODE,
+        .duty_resolution = PUMP_PWM_RESOLUTION,
+        .timer_num = PUMP_PWM_TIMER,
+        .freq_hz = PUMP_PWM_FREQ_HZ,
+        .clk_cfg = LEDC_AUTO_CLK,
+    };
+
+    err = ledc_timer_config(&timer_conf);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to configure LEDC timer");
+        return err;
+    }
+
+    for (size_t i = 0; i < PUMP_QTY; i++) {
+        ESP_LOGI(TAG, "Initializing PWM pump at GPIO %d", pPump[i].GPIO_PIN_VALUE);
+
+        ledc_channel_config_t channel_conf = {
+            .gpio_num = pPump[i].GPIO_PIN_VALUE,
+            .speed_mode = PUMP_PWM_SPEED_MODE,
+            .channel = (ledc_channel_t)(PUMP_PWM_FIRST_CHANNEL + i),
+            .intr_type = LEDC_INTR_DISABLE,
+            .timer_sel = PUMP_PWM_TIMER,
+            .duty = 0, // Ensure pump is off at start
+            .hpoint = 0,
+        };
+
+        err = ledc_channel_config(&channel_conf);
+        if (err != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to configure LEDC channel for pump %d", i);
+            return err;
+        }
+
+        s_ctx.level[i] = PUMP_PWM_MAX_LEVEL;
+        s_ctx.ramp_ms[i] = PUMP_PWM_RAMP_MS;
+    }
+
+    // Fades are generated by the LEDC hardware, the ISR only reports the end of a fade
+    err = ledc_fade_func_install(0);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to install LEDC fade service");
+        return err;
+    }
+
+    s_ctx.is_initialized = true;
+
+    return ESP_OK;
+}
@@ -0,0 +1,299 @@
+/**
+ * @file pump_stats_task.cpp
+ * @author Marcel Nahir Samur (mnsamur2014@gmail.com)
+ * @brief Pump runtime counters with batched NVS persistence
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <esp_log.h>
+#include <esp_matter_console.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <nvs.h>
+
+#include <main_tasks_common.h>
+#include <pump_stats_task.h>
+
+static const char *TAG = "pump_stats_task";
+
+#define US_PER_S 1000000LL
+
+/**
+ * @brief Context structure for the pump counters
+ *        Holds all the state and configuration needed for the driver.
+ */
+typedef struct {
+    pump_stats_config_t *config;
+    pump_stats_t stats[PUMP_QTY];   /*!< Counters, NVS holds a copy from the last flush */
+    int64_t run_start_us[PUMP_QTY]; /*!< Start of the current run, 0 if the pump is off */
+    uint32_t pending_runs;          /*!< Runs finished since the last flush */
+    int64_t last_flush_us;
+    portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+    esp_timer_handle_t timer;
+    TaskHandle_t task; /*!< Checks the thresholds and writes NVS, woken by the timer */
+    bool is_initialized = false;
+} pump_stats_ctx_t;
+
+static pump_stats_ctx_t s_ctx;
+
+/**
+ * @brief Reports the counters of a pump
+ *
+ * @param pump Pump index
+ */
+static void pump_stats_task_notify(size_t pump)
+{
+    pump_stats_t stats;
+
+    if (!s_ctx.config->cb) {
+        return;
+    }
+
+    portENTER_CRITICAL(&s_ctx.lock);
+    stats = s_ctx.stats[pump];
+    portEXIT_CRITICAL(&s_ctx.lock);
+
+    s_ctx.config->cb(s_ctx.config->endpoint_id[pump], &stats, s_ctx.config->user_data);
+}
+
+esp_err_t pump_stats_task_flush(void)
+{
+    pump_stats_t stats[PUMP_QTY];
+    nvs_handle_t handle;
+
+    if (!s_ctx.is_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    portENTER_CRITICAL(&s_ctx.lock);
+    memcpy(stats, s_ctx.stats, sizeof(stats));
+    s_ctx.pending_runs = 0;
+    s_ctx.last_flush_us = esp_timer_get_time();
+    portEXIT_CRITICAL(&s_ctx.lock);
+
+    esp_err_t err = nvs_open(PUMP_STATS_NVS_NAMESPACE, NVS_READWRITE, &handle);
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    err = nvs_set_blob(handle, "counters", stats, sizeof(stats));
+    if (err == ESP_OK) {
+        err = nvs_commit(handle);
+    }
+    nvs_close(handle);
+
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to save counters: %d", err);
+    }
+    return err;
+}
+
+/**
+ * @brief Flush task, NVS is only written if a batch threshold was reached.
+ *        The commit may block, so it runs here instead of on the esp_timer task.
+ *
+ * @param pArg Unused
+ */
+static void pump_stats_task(void *pArg)
+{
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        portENTER_CRITICAL(&s_ctx.lock);
+        uint32_t pending_runs = s_ctx.pending_runs;
+        int64_t last_flush_us = s_ctx.last_flush_us;
+        portEXIT_CRITICAL(&s_ctx.lock);
+
+        if (pending_runs == 0) {
+            continue;
+        }
+
+        if (pending_runs >= PUMP_STATS_FLUSH_RUNS || esp_timer_get_time() - last_flush_us >= PUMP_STATS_FLUSH_S * US_PER_S) {
+            pump_stats_task_flush();
+        }
+    }
+}
+
+/**
+ * @brief Flush timer, wakes the flush task
+ *
+ * @param pArg Unused
+ */
+static void pump_stats_task_check_cb(void *pArg)
+{
+    xTaskNotifyGive(s_ctx.task);
+}
+
+void pump_stats_task_run_update(size_t pump, bool running)
+{
+    if (!s_ctx.is_initialized || pump >= PUMP_QTY) {
+        return;
+    }
+
+    int64_t now = esp_timer_get_time();
+    bool run_done = false;
+
+    portENTER_CRITICAL(&s_ctx.lock);
+    if (running && s_ctx.run_start_us[pump] == 0) {
+        s_ctx.run_start_us[pump] = now;
+        s_ctx.stats[pump].cycles++;
+    } else if (!running && s_ctx.run_start_us[pump] != 0) {
+        uint32_t run_s = (now - s_ctx.run_start_us[pump] + US_PER_S / 2) / US_PER_S;
+
+        s_ctx.run_start_us[pump] = 0;
+        s_ctx.stats[pump].on_time_s += run_s;
+        s_ctx.stats[pump].last_run_s = run_s;
+        s_ctx.pending_runs++;
+        run_done = true;
+    }
+    portEXIT_CRITICAL(&s_ctx.lock);
+
+    if (run_done) {
+        pump_stats_task_notify(pump);
+    }
+}
+
+void pump_stats_task_add_volume(size_t pump, float litres)
+{
+    if (!s_ctx.is_initialized || pump >= PUMP_QTY) {
+        return;
+    }
+
+    // Part of the run that was just counted, flushed with it
+    portENTER_CRITICAL(&s_ctx.lock);
+    s_ctx.stats[pump].litres += litres;
+    portEXIT_CRITICAL(&s_ctx.lock);
+
+    pump_stats_task_notify(pump);
+}
+
+esp_err_t pump_stats_task_init(pump_stats_config_t *pConfig)
+{
+    esp_err_t err;
+    nvs_handle_t handle;
+
+    if (pConfig == NULL) {
+        ESP_LOGE(TAG, "Invalid argument");
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_ctx.is_initialized) {
+        ESP_LOGE(TAG, "Driver already initialized");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    s_ctx.config = pConfig;
+
+    // Restore the counters, a missing or outdated blob starts from zero
+    if (nvs_open(PUMP_STATS_NVS_NAMESPACE, NVS_READONLY, &handle) == ESP_OK) {
+        size_t len = sizeof(s_ctx.stats);
+        if (nvs_get_blob(handle, "counters", NULL, &len) == ESP_OK && len == sizeof(s_ctx.stats)) {
+            nvs_get_blob(handle, "counters", s_ctx.stats, &len);
+        }
+        nvs_close(handle);
+    }
+
+    if (xTaskCreate(pump_stats_task, "pump_stats", PUMP_STATS_TASK_STACK_SIZE, NULL, PUMP_STATS_TASK_PRIORITY, &s_ctx.task) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create pump counters task");
+        return ESP_ERR_NO_MEM;
+    }
+
+    // Create a periodic timer to check the flush thresholds
+    const esp_timer_create_args_t check_args = {
+        .callback = pump_stats_task_check_cb,
+        .arg = &s_ctx,
+        .name = "pump_stats_check",
+    };
+
+    err = esp_timer_create(&check_args, &s_ctx.timer);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to create timer for pump counters");
+        return err;
+    }
+
+    err = esp_timer_start_periodic(s_ctx.timer, pConfig->interval_ms * 1000);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to start timer for pump counters");
+        esp_timer_delete(s_ctx.timer);
+        return err;
+    }
+
+    s_ctx.last_flush_us = esp_timer_get_time();
+    s_ctx.is_initialized = true;
+
+    for (size_t i = 0; i < PUMP_QTY; i++) {
+        pump_stats_task_notify(i);
+    }
+
+    return ESP_OK;
+}
+
+/**
+ * @brief CHIP console handler:
+ *        pumpstats list
+ *        pumpstats reset <pump>
+ *        pumpstats flush
+ *
+ * @param argc Argument count
+ * @param argv Arguments, argv[0] is the sub command
+ * @return esp_err_t ESP_OK on success
+ */
+static esp_err_t pump_stats_task_console_handler(int argc, char **argv)
+{
+    if (argc >= 1 && strcmp(argv[0], "list") == 0) {
+        int64_t now = esp_timer_get_time();
+
+        for (size_t i = 0; i < PUMP_QTY; i++) {
+            portENTER_CRITICAL(&s_ctx.lock);
+            pump_stats_t stats = s_ctx.stats[i];
+            int64_t run_start = s_ctx.run_start_us[i];
+            portEXIT_CRITICAL(&s_ctx.lock);
+
+            printf("pump %d: on %lu s, %lu cycles, last run %lu s, %.1f l%s\n", i + 1, (unsigned long)stats.on_time_s,
+                   (unsigned long)stats.cycles, (unsigned long)stats.last_run_s, stats.litres,
+                   run_start ? " (running)" : "");
+            if (run_start) {
+                printf("        current run %lld s\n", (now - run_start) / US_PER_S);
+            }
+        }
+        return ESP_OK;
+    }
+
+    if (argc >= 2 && strcmp(argv[0], "reset") == 0) {
+        int pump = atoi(argv[1]) - 1;
+        if (pump < 0 || pump >= PUMP_QTY) {
+            return ESP_ERR_INVALID_ARG;
+        }
+
+        portENTER_CRITICAL(&s_ctx.lock);
+        memset(&s_ctx.stats[pump], 0, sizeof(pump_stats_t));
+        portEXIT_CRITICAL(&s_ctx.lock);
+
+        pump_stats_task_notify(pump);
+        return pump_stats_task_flush();
+    }
+
+    if (argc >= 1 && strcmp(argv[0], "flush") == 0) {
+        return pump_stats_task_flush();
+    }
+
+    printf("pumpstats list | reset <pump> | flush\n");
+    return ESP_ERR_INVALID_ARG;
+}
+
+void pump_stats_task_register_commands(void)
+{
+    static const esp_matter::console::command_t command = {
+        .name = "pumpstats",
+        .description = "Pump runtime counters. Usage: matter esp pumpstats <list|reset|flush> ...",
+        .handler = pump_stats_task_console_handler,
+    };
+    esp_matter::console::add_commands(&command, 1);
+}
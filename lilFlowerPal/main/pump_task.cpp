@@ -11,8 +11,18 @@
 
 // Include ESP-IDF libraries
 #include <esp_log.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+// Include cosmos libraries
+#include <cosmos_state.h>
 
 // Include project libraries
+#include <flowmeter_task.h>
+#include <interlock_task.h>
+#include <pump_bank.h>
+#include <pump_pwm.h>
+#include <pump_stats_task.h>
 #include <pump_task.h>
 
 using namespace chip::app::Clusters;
@@ -22,22 +32,141 @@ static const char *TAG = "pump_task";
 
 extern pump_task_config_t pumps_config[PUMP_QTY];
 
+static pump_bank_t s_bank;
+static uint32_t s_saved; // Pump state saved before the last reset, kept for pump_task_restore
+
+// Serialises the dry-run latch check with the output write, see pump_task_output_write
+static StaticSemaphore_t s_output_lock_buffer;
+static SemaphoreHandle_t s_output_lock = NULL;
+
+/**
+ * @brief Drives the pump outputs, relays through the pump bank
+ *        or MOSFETs through the LEDC soft-start backend.
+ *        Every path to the outputs goes through here, and the latch is
+ *        checked under the same lock as the write. The interlock latches
+ *        before cutting, so a pump switched on while it trips is either
+ *        refused here or cut by the interlock right after.
+ *
+ * @param zone_mask Pumps to update
+ * @param on_mask New state of those pumps
+ * @param pChanged Pumps that actually changed state
+ *
+ * @return ESP_OK on success
+ *         ESP_ERR_INVALID_STATE if a pump is turned on while the dry-run fault is latched
+ */
+static esp_err_t pump_task_output_write(uint32_t zone_mask, uint32_t on_mask, uint32_t *pChanged)
+{
+    if (s_output_lock == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    xSemaphoreTake(s_output_lock, portMAX_DELAY);
+
+    if (!dry_run_switch(interlock_task_is_latched(), pump_task_get_mask(), zone_mask, on_mask, pChanged)) {
+        xSemaphoreGive(s_output_lock);
+        return ESP_ERR_INVALID_STATE;
+    }
+
+#if PUMP_DRIVE_PWM
+    pump_pwm_write(zone_mask, on_mask);
+#else
+    pump_bank_write(&s_bank, zone_mask, on_mask);
+#endif
+
+    // Written to NVS with the next batch of device states, under the lock so the saved mask is the last one written
+    cosmos_state_set(PUMP_STATE_KEY, pump_task_get_mask());
+
+    xSemaphoreGive(s_output_lock);
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Saves the pumps actually on, under the output lock so a
+ *        concurrent switch can't be overwritten with a stale mask
+ *
+ */
+static void pump_task_state_save(void)
+{
+    if (s_output_lock == NULL) {
+        return;
+    }
+
+    xSemaphoreTake(s_output_lock, portMAX_DELAY);
+    cosmos_state_set(PUMP_STATE_KEY, pump_task_get_mask());
+    xSemaphoreGive(s_output_lock);
+}
+
 /**
  * @brief Changes the state of the pump based on the attribute value.
  *
  * @param val value of the attribute to be changed
- * @param pump_gpio GPIO pin associated with the pump
+ * @param pump Index of the pump
  * @return esp_err_t
  */
-static esp_err_t pump_task_pump_set_on_off(esp_matter_attr_val_t *val, gpio_num_t pump_gpio)
+static esp_err_t pump_task_pump_set_on_off(esp_matter_attr_val_t *val, size_t pump)
 {
     /* print val as text */
-    ESP_LOGI(TAG, "Changing the pump GPIO %d state to %s!", pump_gpio, val->val.b ? "ON" : "OFF");
-    gpio_set_level(pump_gpio, val->val.b);
+    ESP_LOGI(TAG, "Changing the pump GPIO %d state to %s!", pumps_config[pump].gpio, val->val.b ? "ON" : "OFF");
+
+    return pump_task_set_mask(BIT(pump), val->val.b ? BIT(pump) : 0);
+}
+
+esp_err_t pump_task_set_mask(uint32_t zone_mask, uint32_t on_mask)
+{
+    uint32_t changed = 0;
+
+    zone_mask &= PUMP_MASK_ALL;
+
+    // Refuse to run dry, the interlock already cut the pumps
+    esp_err_t err = pump_task_output_write(zone_mask, on_mask, &changed);
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "Pumps 0x%02lx kept off, dry-run fault latched", (unsigned long)(zone_mask & on_mask));
+        return err;
+    }
+
+    for (size_t i = 0; i < PUMP_QTY; i++) {
+        if (changed & BIT(i)) {
+            flowmeter_task_run_update(i, on_mask & BIT(i));
+            pump_stats_task_run_update(i, on_mask & BIT(i));
+        }
+    }
 
     return ESP_OK;
 }
 
+uint32_t pump_task_restore(void)
+{
+    uint32_t saved = s_saved & PUMP_MASK_ALL;
+
+    s_saved = 0;
+    if (saved == 0) {
+        return 0;
+    }
+
+#if PUMP_RESTORE_RUNNING
+    ESP_LOGW(TAG, "Restoring pumps 0x%02lx, running before the reset", (unsigned long)saved);
+    if (pump_task_set_mask(PUMP_MASK_ALL, saved) != ESP_OK) {
+        pump_task_state_save();
+        return 0;
+    }
+    return saved;
+#else
+    ESP_LOGW(TAG, "Pumps 0x%02lx were running before the reset, left off", (unsigned long)saved);
+    pump_task_state_save();
+    return 0;
+#endif
+}
+
+uint32_t pump_task_get_mask(void)
+{
+#if PUMP_DRIVE_PWM
+    return pump_pwm_get_mask();
+#else
+    return pump_bank_get(&s_bank);
+#endif
+}
+
 esp_err_t pump_task_attribute_update(pump_task_handle_t pump_handle, uint16_t endpoint_id, uint32_t cluster_id,
                                      uint32_t attribute_id, esp_matter_attr_val_t *val)
 {
@@ -48,24 +177,126 @@ esp_err_t pump_task_attribute_update(pump_task_handle_t pump_handle, uint16_t en
         if (endpoint_id == pumps_config[i].endpoint_id) {
             if (cluster_id == OnOff::Id) {
                 if (attribute_id == OnOff::Attributes::OnOff::Id) {
-                    err = pump_task_pump_set_on_off(val, pumps_config[i].gpio);
+                    // Refused while the dry-run fault is latched, which rejects the write
+                    err = pump_task_pump_set_on_off(val, i);
                 }
+#if PUMP_DRIVE_PWM
+            } else if (cluster_id == LevelControl::Id) {
+                // Null or out of range levels leave the duty as it is
+                if (attribute_id == LevelControl::Attributes::CurrentLevel::Id && val->val.u8 >= 1 && val->val.u8 <= PUMP_PWM_MAX_LEVEL) {
+                    err = pump_pwm_set_level(i, val->val.u8);
+                }
+#endif
+            } else if (cluster_id == PUMP_CLUSTER_ID) {
+                if (attribute_id == PUMP_ATTR_DRY_RUN_FAULT && !val->val.b) {
+                    err = interlock_task_clear();
+                }
+#if PUMP_DRIVE_PWM
+                if (attribute_id == PUMP_ATTR_RAMP_MS) {
+                    err = pump_pwm_set_ramp(i, val->val.u16);
+                }
+#endif
             }
         }
     }
     return err;
 }
 
+esp_err_t pump_task_add_clusters(endpoint_t *endpoint)
+{
+    if (!endpoint) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    // Flow rate of the zone, reported by the flowmeter task
+    cluster::flow_measurement::config_t flow_config;
+    if (!cluster::flow_measurement::create(endpoint, &flow_config, CLUSTER_FLAG_SERVER)) {
+        ESP_LOGE(TAG, "Failed to create flow measurement cluster");
+        return ESP_FAIL;
+    }
+
+    // Irrigation accounting attributes
+    cluster_t *pump_cluster = cluster::create(endpoint, PUMP_CLUSTER_ID, CLUSTER_FLAG_SERVER);
+    if (!pump_cluster) {
+        ESP_LOGE(TAG, "Failed to create pump cluster");
+        return ESP_FAIL;
+    }
+    cluster::global::attribute::create_cluster_revision(pump_cluster, 1);
+    cluster::global::attribute::create_feature_map(pump_cluster, 0);
+
+    attribute::create(pump_cluster, PUMP_ATTR_LAST_RUN_VOLUME_ML, ATTRIBUTE_FLAG_NONE, esp_matter_uint32(0));
+    attribute::create(pump_cluster, PUMP_ATTR_TOTAL_VOLUME_ML, ATTRIBUTE_FLAG_NONE, esp_matter_uint32(0));
+    attribute::create(pump_cluster, PUMP_ATTR_DRY_RUN_FAULT, ATTRIBUTE_FLAG_WRITABLE, esp_matter_bool(false));
+
+    // Lifetime counters, restored from NVS by pump_stats_task
+    attribute::create(pump_cluster, PUMP_ATTR_ON_TIME_S, ATTRIBUTE_FLAG_NONE, esp_matter_uint32(0));
+    attribute::create(pump_cluster, PUMP_ATTR_CYCLES, ATTRIBUTE_FLAG_NONE, esp_matter_uint32(0));
+    attribute::create(pump_cluster, PUMP_ATTR_LAST_RUN_S, ATTRIBUTE_FLAG_NONE, esp_matter_uint32(0));
+    attribute::create(pump_cluster, PUMP_ATTR_LIFETIME_VOLUME_L, ATTRIBUTE_FLAG_NONE, esp_matter_uint32(0));
+
+#if PUMP_DRIVE_PWM
+    attribute::create(pump_cluster, PUMP_ATTR_RAMP_MS, ATTRIBUTE_FLAG_WRITABLE, esp_matter_uint16(PUMP_PWM_RAMP_MS));
+
+    /*
+     * Running duty of the pump, e.g. low flow for drip zones.
+     * No OnOff feature: switching on always soft-starts in
+     * hardware instead of stepping CurrentLevel in software.
+     */
+    cluster::level_control::config_t level_config;
+    level_config.current_level = PUMP_PWM_MAX_LEVEL;
+    if (!cluster::level_control::create(endpoint, &level_config, CLUSTER_FLAG_SERVER, 0)) {
+        ESP_LOGE(TAG, "Failed to create level control cluster");
+        return ESP_FAIL;
+    }
+#endif
+
+    return ESP_OK;
+}
+
 esp_err_t pump_task_init(const gpio_pump_t *pPump)
 {
+    s_output_lock = xSemaphoreCreateMutexStatic(&s_output_lock_buffer);
+
+    // Read before the first write replaces it, restored later by pump_task_restore
+    if (!cosmos_state_get(PUMP_STATE_KEY, &s_saved)) {
+        s_saved = 0;
+    }
+
+#if PUMP_DRIVE_PWM
+    return pump_pwm_init(pPump);
+#else
+    uint64_t pin_bit_mask = 0;
+    int pins[PUMP_QTY];
+
     for (size_t i = 0; i < PUMP_QTY; i++) {
         ESP_LOGI(TAG, "Initializing pump at GPIO %d", pPump[i].GPIO_PIN_VALUE);
 
-        esp_rom_gpio_pad_select_gpio(pPump[i].GPIO_PIN_VALUE);
-        gpio_set_direction(pPump[i].GPIO_PIN_VALUE, GPIO_MODE_OUTPUT);
-        gpio_intr_disable(pPump[i].GPIO_PIN_VALUE);
-        gpio_set_level(pPump[i].GPIO_PIN_VALUE, 0); // Ensure pump is off at start
+        pin_bit_mask |= BIT64(pPump[i].GPIO_PIN_VALUE);
+        pins[i] = pPump[i].GPIO_PIN_VALUE;
+    }
+
+    gpio_config_t io_conf = {
+        .pin_bit_mask = pin_bit_mask,
+        .mode = GPIO_MODE_OUTPUT,
+        .pull_up_en = GPIO_PULLUP_DISABLE,
+        .pull_down_en = GPIO_PULLDOWN_DISABLE,
+        .intr_type = GPIO_INTR_DISABLE,
+    };
+
+    esp_err_t err = gpio_config(&io_conf);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to configure pump GPIOs");
+        return err;
+    }
+
+    // All relays are driven through the W1TS/W1TC registers from now on
+    const pump_bank_regs_t regs = PUMP_BANK_HAL_REGS();
+    if (pump_bank_init(&s_bank, &regs, pins, PUMP_QTY) != 0) {
+        ESP_LOGE(TAG, "Invalid pump GPIO");
+        return ESP_ERR_INVALID_ARG;
     }
+    pump_bank_apply(&s_bank, 0); // Ensure pumps are off at start
 
     return ESP_OK;
+#endif
 }
\ No newline at end of file
@@ -0,0 +1,54 @@
+/**
+ * @file schedule_entry.cpp
+ * @author Marcel Nahir Samur (mnsamur2014@gmail.com)
+ * @brief Schedule entry decisions, shared by schedule_task and the plant simulation
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <schedule_entry.h>
+
+time_t schedule_entry_next_fire(const schedule_entry_t *pEntry, time_t after)
+{
+    struct tm now_tm;
+
+    if (!pEntry->enabled || (pEntry->dow_mask & SCHEDULE_DOW_ALL) == 0) {
+        return 0;
+    }
+
+    localtime_r(&after, &now_tm);
+
+    // One week plus today covers every day of week mask
+    for (int day = 0; day <= 7; day++) {
+        struct tm candidate = now_tm;
+        candidate.tm_mday += day;
+        candidate.tm_hour = pEntry->hour;
+        candidate.tm_min = pEntry->minute;
+        candidate.tm_sec = 0;
+        candidate.tm_isdst = -1;
+
+        // mktime normalizes the date and fills tm_wday
+        time_t fire = mktime(&candidate);
+        if (fire > after && (pEntry->dow_mask & (1 << candidate.tm_wday))) {
+            return fire;
+        }
+    }
+
+    return 0;
+}
+
+bool schedule_entry_skips(const schedule_entry_t *pEntry, float soil_pct)
+{
+    return pEntry->sm_skip_pct && soil_pct >= pEntry->sm_skip_pct;
+}
+
+uint32_t schedule_entry_run_s(const schedule_entry_t *pEntry, const uint8_t *pSeason, time_t now)
+{
+    struct tm now_tm;
+    localtime_r(&now, &now_tm);
+
+    return (uint32_t)pEntry->duration_s * pSeason[now_tm.tm_mon] / 100;
+}
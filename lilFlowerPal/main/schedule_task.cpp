@@ -0,0 +1,542 @@
+/**
+ * @file schedule_task.cpp
+ * @author Marcel Nahir Samur (mnsamur2014@gmail.com)
+ * @brief On-device irrigation schedule, persisted in NVS
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <esp_log.h>
+#include <esp_matter_console.h>
+#include <esp_sntp.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#include <nvs.h>
+
+#include <main_tasks_common.h>
+#include <schedule_task.h>
+
+static const char *TAG = "schedule_task";
+
+#define SCHEDULE_NO_ENTRY -1
+
+/**
+ * @brief Context structure for the schedule engine
+ *        Holds all the state and configuration needed for the driver.
+ */
+typedef struct {
+    schedule_config_t *config;
+    schedule_entry_t entry[SCHEDULE_MAX_ENTRIES]; /*!< Persisted entries */
+    uint32_t last_fire[SCHEDULE_MAX_ENTRIES];     /*!< Persisted, epoch of the last fire of each entry */
+    uint32_t run_end[PUMP_QTY];                   /*!< Persisted, epoch at which each zone stops, 0 if idle */
+    uint8_t season[12];                           /*!< Persisted, duration scale per month in % */
+    time_t next_fire[SCHEDULE_MAX_ENTRIES];       /*!< Next fire of each entry, 0 if disabled */
+    int next_idx;                                 /*!< Entry that fires first */
+    time_t next_stop;                             /*!< First zone stop, 0 if no zone is running */
+    float soil_moisture[PUMP_QTY];                /*!< Latest soil moisture of each zone, in % */
+    bool indexed;                                 /*!< Next fire times computed with a valid clock */
+    time_t clock_epoch;                           /*!< Last trusted epoch, 0 if there has never been one */
+    int64_t clock_us;                             /*!< esp_timer time at which clock_epoch was taken */
+    time_t clock_saved;                           /*!< Persisted, last epoch written to NVS */
+    bool synced;                                  /*!< The system clock has been set since boot */
+    SemaphoreHandle_t lock;
+    esp_timer_handle_t timer;
+    TaskHandle_t task;                            /*!< Evaluates the schedule and writes NVS, woken by the timer */
+    bool is_initialized = false;
+} schedule_ctx_t;
+
+static schedule_ctx_t s_ctx;
+
+/**
+ * @brief Writes a blob to the schedule NVS namespace
+ *
+ * @param pKey NVS key
+ * @param pData Data to store
+ * @param len Data length
+ * @return esp_err_t ESP_OK on success
+ */
+static esp_err_t schedule_task_nvs_save(const char *pKey, const void *pData, size_t len)
+{
+    nvs_handle_t handle;
+    esp_err_t err = nvs_open(SCHEDULE_NVS_NAMESPACE, NVS_READWRITE, &handle);
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    err = nvs_set_blob(handle, pKey, pData, len);
+    if (err == ESP_OK) {
+        err = nvs_commit(handle);
+    }
+    nvs_close(handle);
+
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to save %s: %d", pKey, err);
+    }
+    return err;
+}
+
+/**
+ * @brief Reads a blob from the schedule NVS namespace. The
+ *        destination is left untouched if the key is missing.
+ *
+ * @param handle Opened NVS handle
+ * @param pKey NVS key
+ * @param pData Destination
+ * @param len Destination length
+ */
+static void schedule_task_nvs_load(nvs_handle_t handle, const char *pKey, void *pData, size_t len)
+{
+    size_t stored = len;
+
+    if (nvs_get_blob(handle, pKey, NULL, &stored) != ESP_OK || stored != len) {
+        return;
+    }
+    nvs_get_blob(handle, pKey, pData, &stored);
+}
+
+/**
+ * @brief Current epoch. The system clock once SNTP or Matter set it, otherwise
+ *        the last epoch persisted in NVS plus the time since boot, so the
+ *        schedule keeps running after a reboot without network. The time the
+ *        device was off is not counted, runs fire late but never early.
+ *
+ * @param ctx Pointer to the schedule context, with the lock taken
+ * @return time_t Current epoch, 0 if there has never been a valid clock
+ */
+static time_t schedule_task_now(schedule_ctx_t *ctx)
+{
+    time_t now = time(NULL);
+    int64_t now_us = esp_timer_get_time();
+
+    if (now >= SCHEDULE_VALID_EPOCH) {
+        if (!ctx->synced) {
+            // Entries indexed on the estimate are indexed again on the real clock
+            ctx->synced = true;
+            ctx->indexed = false;
+        }
+        ctx->clock_epoch = now;
+        ctx->clock_us = now_us;
+        return now;
+    }
+
+    if (ctx->clock_epoch == 0) {
+        return 0;
+    }
+    return ctx->clock_epoch + (time_t)((now_us - ctx->clock_us) / 1000000);
+}
+
+/**
+ * @brief Picks the entry that fires first. Only called when an
+ *        entry fires or changes, ticks just compare against it.
+ *
+ * @param ctx Pointer to the schedule context
+ */
+static void schedule_task_pick_next(schedule_ctx_t *ctx)
+{
+    ctx->next_idx = SCHEDULE_NO_ENTRY;
+
+    for (int i = 0; i < SCHEDULE_MAX_ENTRIES; i++) {
+        if (ctx->next_fire[i] == 0) {
+            continue;
+        }
+        if (ctx->next_idx == SCHEDULE_NO_ENTRY || ctx->next_fire[i] < ctx->next_fire[ctx->next_idx]) {
+            ctx->next_idx = i;
+        }
+    }
+}
+
+/**
+ * @brief Same as schedule_task_pick_next, for the zone stop times
+ *
+ * @param ctx Pointer to the schedule context
+ */
+static void schedule_task_pick_next_stop(schedule_ctx_t *ctx)
+{
+    ctx->next_stop = 0;
+
+    for (size_t zone = 0; zone < PUMP_QTY; zone++) {
+        if (ctx->run_end[zone] && (ctx->next_stop == 0 || ctx->run_end[zone] < ctx->next_stop)) {
+            ctx->next_stop = ctx->run_end[zone];
+        }
+    }
+}
+
+/**
+ * @brief Computes the next fire of an entry. Fires missed by less than
+ *        SCHEDULE_CATCHUP_S (e.g. while rebooting) are kept in the past,
+ *        so the next tick still runs them.
+ *
+ * @param ctx Pointer to the schedule context
+ * @param idx Entry index
+ * @param now Current epoch
+ */
+static void schedule_task_index_entry(schedule_ctx_t *ctx, int idx, time_t now)
+{
+    time_t from = now - SCHEDULE_CATCHUP_S;
+
+    if ((time_t)ctx->last_fire[idx] > from) {
+        from = ctx->last_fire[idx];
+    }
+    ctx->next_fire[idx] = schedule_entry_next_fire(&ctx->entry[idx], from);
+}
+
+/**
+ * @brief Starts the run of an entry, unless the soil is already wet enough
+ *
+ * @param ctx Pointer to the schedule context
+ * @param pEntry Entry being fired
+ * @param now Current epoch
+ */
+static void schedule_task_fire(schedule_ctx_t *ctx, const schedule_entry_t *pEntry, time_t now)
+{
+    if (pEntry->zone >= PUMP_QTY) {
+        return;
+    }
+
+    if (schedule_entry_skips(pEntry, ctx->soil_moisture[pEntry->zone])) {
+        ESP_LOGI(TAG, "Zone %d skipped, soil moisture %.0f%%", pEntry->zone + 1, ctx->soil_moisture[pEntry->zone]);
+        return;
+    }
+
+    uint32_t duration = schedule_entry_run_s(pEntry, ctx->season, now);
+    if (duration == 0) {
+        return;
+    }
+
+    // Overlapping entries extend the run instead of toggling the pump
+    uint32_t end = (uint32_t)now + duration;
+    if (end > ctx->run_end[pEntry->zone]) {
+        ctx->run_end[pEntry->zone] = end;
+    }
+
+    ESP_LOGI(TAG, "Zone %d on for %lu s", pEntry->zone + 1, (unsigned long)duration);
+    ctx->config->cb(pEntry->zone, true, ctx->config->user_data);
+}
+
+/**
+ * @brief Evaluates the schedule. Only the precomputed next fire and
+ *        next stop are compared against the clock on each tick.
+ *
+ * @param ctx Pointer to the schedule context
+ */
+static void schedule_task_tick(schedule_ctx_t *ctx)
+{
+    xSemaphoreTake(ctx->lock, portMAX_DELAY);
+
+    time_t now = schedule_task_now(ctx);
+    if (now == 0) {
+        // Never had a clock, wait for SNTP / Matter time sync
+        xSemaphoreGive(ctx->lock);
+        return;
+    }
+
+    if (!ctx->indexed) {
+        // First valid clock: resume interrupted runs and index every entry, runs already over are stopped below
+        for (size_t zone = 0; zone < PUMP_QTY; zone++) {
+            if (ctx->run_end[zone] > now) {
+                ESP_LOGI(TAG, "Resuming zone %d for %lu s", zone + 1, (unsigned long)(ctx->run_end[zone] - now));
+                ctx->config->cb(zone, true, ctx->config->user_data);
+            }
+        }
+        for (int i = 0; i < SCHEDULE_MAX_ENTRIES; i++) {
+            schedule_task_index_entry(ctx, i, now);
+        }
+        schedule_task_pick_next(ctx);
+        schedule_task_pick_next_stop(ctx);
+        ctx->indexed = true;
+    }
+
+    bool runs_changed = false;
+
+    if (ctx->next_stop && now >= ctx->next_stop) {
+        for (size_t zone = 0; zone < PUMP_QTY; zone++) {
+            if (ctx->run_end[zone] && now >= (time_t)ctx->run_end[zone]) {
+                ESP_LOGI(TAG, "Zone %d off", zone + 1);
+                ctx->run_end[zone] = 0;
+                ctx->config->cb(zone, false, ctx->config->user_data);
+            }
+        }
+        runs_changed = true;
+    }
+
+    bool fired = false;
+
+    while (ctx->next_idx != SCHEDULE_NO_ENTRY && now >= ctx->next_fire[ctx->next_idx]) {
+        int idx = ctx->next_idx;
+
+        schedule_task_fire(ctx, &ctx->entry[idx], now);
+        ctx->last_fire[idx] = now;
+        ctx->next_fire[idx] = schedule_entry_next_fire(&ctx->entry[idx], now);
+        schedule_task_pick_next(ctx);
+        fired = true;
+    }
+
+    if (fired) {
+        schedule_task_nvs_save("last_fire", ctx->last_fire, sizeof(ctx->last_fire));
+        runs_changed = true;
+    }
+    if (runs_changed) {
+        schedule_task_pick_next_stop(ctx);
+        schedule_task_nvs_save("run_end", ctx->run_end, sizeof(ctx->run_end));
+    }
+
+    // Saved with every run change, so a resumed run never outlasts its entry, and every SCHEDULE_CLOCK_SAVE_S
+    if (runs_changed || now - ctx->clock_saved >= SCHEDULE_CLOCK_SAVE_S) {
+        uint32_t epoch = (uint32_t)now;
+        if (schedule_task_nvs_save("clock", &epoch, sizeof(epoch)) == ESP_OK) {
+            ctx->clock_saved = now;
+        }
+    }
+
+    xSemaphoreGive(ctx->lock);
+}
+
+/**
+ * @brief Schedule task. The NVS commits and the pump callbacks may block,
+ *        so they run here instead of on the esp_timer task.
+ *
+ * @param pArg Pointer to the schedule context
+ */
+static void schedule_task(void *pArg)
+{
+    auto *ctx = (schedule_ctx_t *)pArg;
+
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        schedule_task_tick(ctx);
+    }
+}
+
+/**
+ * @brief Evaluation timer, wakes the schedule task
+ *
+ * @param pArg Pointer to the schedule context
+ */
+static void schedule_task_tick_cb(void *pArg)
+{
+    auto *ctx = (schedule_ctx_t *)pArg;
+
+    xTaskNotifyGive(ctx->task);
+}
+
+esp_err_t schedule_task_set_entry(size_t idx, const schedule_entry_t *pEntry)
+{
+    if (!s_ctx.is_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (idx >= SCHEDULE_MAX_ENTRIES) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (pEntry && (pEntry->zone >= PUMP_QTY || pEntry->hour > 23 || pEntry->minute > 59)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    xSemaphoreTake(s_ctx.lock, portMAX_DELAY);
+
+    if (pEntry) {
+        s_ctx.entry[idx] = *pEntry;
+    } else {
+        memset(&s_ctx.entry[idx], 0, sizeof(schedule_entry_t));
+    }
+
+    // A new entry starts counting from now, there is nothing to catch up
+    time_t now = schedule_task_now(&s_ctx);
+    s_ctx.last_fire[idx] = now;
+    if (s_ctx.indexed) {
+        schedule_task_index_entry(&s_ctx, idx, now);
+        schedule_task_pick_next(&s_ctx);
+    }
+
+    esp_err_t err = schedule_task_nvs_save("entries", s_ctx.entry, sizeof(s_ctx.entry));
+    if (err == ESP_OK) {
+        err = schedule_task_nvs_save("last_fire", s_ctx.last_fire, sizeof(s_ctx.last_fire));
+    }
+
+    xSemaphoreGive(s_ctx.lock);
+
+    return err;
+}
+
+esp_err_t schedule_task_set_season(const uint8_t *pScale)
+{
+    if (!s_ctx.is_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (pScale == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    xSemaphoreTake(s_ctx.lock, portMAX_DELAY);
+    memcpy(s_ctx.season, pScale, sizeof(s_ctx.season));
+    esp_err_t err = schedule_task_nvs_save("season", s_ctx.season, sizeof(s_ctx.season));
+    xSemaphoreGive(s_ctx.lock);
+
+    return err;
+}
+
+void schedule_task_sync_time(void)
+{
+    // Called on every address change, SNTP keeps polling once started
+    if (esp_sntp_enabled()) {
+        return;
+    }
+
+    ESP_LOGI(TAG, "Starting SNTP with %s", SCHEDULE_SNTP_SERVER);
+    esp_sntp_setoperatingmode(ESP_SNTP_OPMODE_POLL);
+    esp_sntp_setservername(0, SCHEDULE_SNTP_SERVER);
+    esp_sntp_init();
+}
+
+void schedule_task_set_soil_moisture(size_t zone, float pct)
+{
+    if (zone < PUMP_QTY) {
+        s_ctx.soil_moisture[zone] = pct;
+    }
+}
+
+esp_err_t schedule_task_init(schedule_config_t *pConfig)
+{
+    esp_err_t err;
+
+    if (pConfig == NULL || pConfig->cb == NULL) {
+        ESP_LOGE(TAG, "Invalid argument");
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_ctx.is_initialized) {
+        ESP_LOGE(TAG, "Driver already initialized");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    // Entries are in local time
+    setenv("TZ", SCHEDULE_TZ, 1);
+    tzset();
+
+    s_ctx.config = pConfig;
+    s_ctx.next_idx = SCHEDULE_NO_ENTRY;
+    memset(s_ctx.season, 100, sizeof(s_ctx.season));
+
+    s_ctx.lock = xSemaphoreCreateMutex();
+    if (!s_ctx.lock) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    // Load the persisted schedule, defaults are kept for missing keys
+    nvs_handle_t handle;
+    if (nvs_open(SCHEDULE_NVS_NAMESPACE, NVS_READONLY, &handle) == ESP_OK) {
+        schedule_task_nvs_load(handle, "entries", s_ctx.entry, sizeof(s_ctx.entry));
+        schedule_task_nvs_load(handle, "last_fire", s_ctx.last_fire, sizeof(s_ctx.last_fire));
+        schedule_task_nvs_load(handle, "run_end", s_ctx.run_end, sizeof(s_ctx.run_end));
+        schedule_task_nvs_load(handle, "season", s_ctx.season, sizeof(s_ctx.season));
+
+        // Last known time, counted on from boot until the clock is set
+        uint32_t epoch = 0;
+        schedule_task_nvs_load(handle, "clock", &epoch, sizeof(epoch));
+        if (epoch >= SCHEDULE_VALID_EPOCH) {
+            s_ctx.clock_epoch = epoch;
+            s_ctx.clock_saved = epoch;
+        }
+        nvs_close(handle);
+    }
+
+    if (xTaskCreate(schedule_task, "schedule", SCHEDULE_TASK_STACK_SIZE, &s_ctx, SCHEDULE_TASK_PRIORITY, &s_ctx.task) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create schedule task");
+        return ESP_ERR_NO_MEM;
+    }
+
+    // Create a periodic timer to evaluate the schedule
+    const esp_timer_create_args_t tick_args = {
+        .callback = schedule_task_tick_cb,
+        .arg = &s_ctx,
+        .name = "schedule_tick",
+    };
+
+    err = esp_timer_create(&tick_args, &s_ctx.timer);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to create timer for schedule");
+        return err;
+    }
+
+    err = esp_timer_start_periodic(s_ctx.timer, pConfig->interval_ms * 1000);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to start timer for schedule");
+        esp_timer_delete(s_ctx.timer);
+        return err;
+    }
+
+    s_ctx.is_initialized = true;
+
+    return ESP_OK;
+}
+
+/**
+ * @brief CHIP console handler:
+ *        schedule list
+ *        schedule set <idx> <zone> <hour> <minute> <dow_mask> <duration_s> [sm_skip_pct]
+ *        schedule del <idx>
+ *        schedule season <jan> ... <dec>
+ *
+ * @param argc Argument count
+ * @param argv Arguments, argv[0] is the sub command
+ * @return esp_err_t ESP_OK on success
+ */
+static esp_err_t schedule_task_console_handler(int argc, char **argv)
+{
+    if (argc >= 1 && strcmp(argv[0], "list") == 0) {
+        for (int i = 0; i < SCHEDULE_MAX_ENTRIES; i++) {
+            const schedule_entry_t *pEntry = &s_ctx.entry[i];
+            if (!pEntry->enabled) {
+                continue;
+            }
+            printf("%2d: zone %d %02d:%02d dow 0x%02x %u s skip %u%% next %lld\n", i, pEntry->zone + 1, pEntry->hour,
+                   pEntry->minute, pEntry->dow_mask, pEntry->duration_s, pEntry->sm_skip_pct, (long long)s_ctx.next_fire[i]);
+        }
+        return ESP_OK;
+    }
+
+    if (argc >= 7 && strcmp(argv[0], "set") == 0) {
+        schedule_entry_t entry = {
+            .enabled = 1,
+            .zone = (uint8_t)(atoi(argv[2]) - 1),
+            .hour = (uint8_t)atoi(argv[3]),
+            .minute = (uint8_t)atoi(argv[4]),
+            .dow_mask = (uint8_t)strtol(argv[5], NULL, 0),
+            .sm_skip_pct = (uint8_t)(argc >= 8 ? atoi(argv[7]) : 0),
+            .duration_s = (uint16_t)atoi(argv[6]),
+        };
+        return schedule_task_set_entry(atoi(argv[1]), &entry);
+    }
+
+    if (argc >= 2 && strcmp(argv[0], "del") == 0) {
+        return schedule_task_set_entry(atoi(argv[1]), NULL);
+    }
+
+    if (argc >= 13 && strcmp(argv[0], "season") == 0) {
+        uint8_t scale[12];
+        for (int m = 0; m < 12; m++) {
+            scale[m] = (uint8_t)atoi(argv[m + 1]);
+        }
+        return schedule_task_set_season(scale);
+    }
+
+    printf("schedule list | set <idx> <zone> <hour> <minute> <dow_mask> <duration_s> [sm_skip_pct] | del <idx> | season <jan> .. <dec>\n");
+    return ESP_ERR_INVALID_ARG;
+}
+
+void schedule_task_register_commands(void)
+{
+    static const esp_matter::console::command_t command = {
+        .name = "schedule",
+        .description = "Irrigation schedule. Usage: matter esp schedule <list|set|del|season> ...",
+        .handler = schedule_task_console_handler,
+    };
+    esp_matter::console::add_commands(&command, 1);
+}
@@ -0,0 +1,63 @@
+#ifndef MAIN_DRY_RUN_H_
+#define MAIN_DRY_RUN_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define WL_EMPTY_MV   600 /*!< Below this water level reading the tank is considered empty */
+#define WL_RECOVER_MV 900 /*!< The dry-run fault can only be cleared above this reading */
+
+#define INTERLOCK_TRIP_SAMPLES 3 /*!< Consecutive empty readings needed to trip, filters ADC noise */
+
+/**
+ * @brief Dry-run fault state, fed with the water level readings.
+ *        No ESP-IDF in here, interlock_task samples the ADC and
+ *        the plant simulation runs the same decisions on the host.
+ *
+ */
+typedef struct {
+    volatile bool latched;  /*!< Fault latched, no pump may be switched on */
+    volatile int last_mv;   /*!< Latest water level reading */
+    uint8_t empty_samples;  /*!< Consecutive readings below WL_EMPTY_MV */
+} dry_run_t;
+
+/**
+ * @brief Clears the fault and the sample count
+ *
+ * @param pDryRun Dry-run state
+ */
+void dry_run_reset(dry_run_t *pDryRun);
+
+/**
+ * @brief Adds a water level reading. The fault latches on the
+ *        INTERLOCK_TRIP_SAMPLES consecutive empty reading.
+ *
+ * @param pDryRun Dry-run state
+ * @param mv Water level reading in mV
+ * @return true if this reading latched the fault, the pumps must be cut now
+ */
+bool dry_run_sample(dry_run_t *pDryRun, int mv);
+
+/**
+ * @brief Clears the fault if the tank is back above WL_RECOVER_MV
+ *
+ * @param pDryRun Dry-run state
+ * @return true if the fault is no longer latched
+ */
+bool dry_run_clear(dry_run_t *pDryRun);
+
+/**
+ * @brief The switch rule of pump_task_output_write, shared with the plant
+ *        simulation: anything may be turned off, nothing may be turned on
+ *        while the fault is latched
+ *
+ * @param latched Fault latched
+ * @param state Current pump state
+ * @param zone_mask Pumps to update
+ * @param on_mask New state of those pumps
+ * @param pChanged Pumps that change state, only set if the switch is allowed
+ * @return true if the switch is allowed
+ */
+bool dry_run_switch(bool latched, uint32_t state, uint32_t zone_mask, uint32_t on_mask, uint32_t *pChanged);
+
+#endif /* MAIN_DRY_RUN_H_ */
@@ -0,0 +1,63 @@
+#ifndef MAIN_DRYING_FORECAST_H_
+#define MAIN_DRYING_FORECAST_H_
+
+#include <stdint.h>
+
+#define DRYING_FORECAST_TAU_H      6.0f /*!< Weight of a sample halves every 0.69 * tau hours */
+#define DRYING_FORECAST_RESET_PCT  5.0f /*!< A reading this far above the fit means the pot was watered */
+#define DRYING_FORECAST_MIN_SPAN_H 0.5f /*!< Samples must cover at least this before the rate is trusted */
+#define DRYING_FORECAST_NEVER      -1.0f
+
+/**
+ * @brief Exponentially weighted linear regression of soil moisture over time.
+ *        Sums are kept relative to the latest sample, so each update is O(1)
+ *        and float precision does not degrade with uptime.
+ *
+ */
+typedef struct {
+    float s0;        /*!< Sum of weights */
+    float st;        /*!< Sum of w * t, t in hours relative to the latest sample (t <= 0) */
+    float stt;       /*!< Sum of w * t^2 */
+    float sy;        /*!< Sum of w * y */
+    float sty;       /*!< Sum of w * t * y */
+    float span_h;    /*!< Time covered by the samples since the last reset */
+    int64_t last_us; /*!< Timestamp of the latest sample, 0 if empty */
+} drying_forecast_t;
+
+/**
+ * @brief Clears the regression, e.g. after watering
+ *
+ * @param pForecast Forecast state
+ */
+void drying_forecast_reset(drying_forecast_t *pForecast);
+
+/**
+ * @brief Adds a reading. A jump of DRYING_FORECAST_RESET_PCT above the
+ *        fitted line restarts the regression from this sample.
+ *
+ * @param pForecast Forecast state
+ * @param now_us Timestamp of the reading in microseconds (monotonic)
+ * @param moisture_pct Soil moisture in %
+ */
+void drying_forecast_update(drying_forecast_t *pForecast, int64_t now_us, float moisture_pct);
+
+/**
+ * @brief Fitted moisture change rate
+ *
+ * @param pForecast Forecast state
+ * @param pRate Output, %/h. Negative while the soil dries
+ * @return true if enough samples were collected to trust the rate
+ */
+bool drying_forecast_rate(const drying_forecast_t *pForecast, float *pRate);
+
+/**
+ * @brief Time until the fitted line crosses a moisture threshold
+ *
+ * @param pForecast Forecast state
+ * @param threshold_pct Moisture threshold in %
+ * @return float Hours from the latest sample, 0 if already below,
+ *               DRYING_FORECAST_NEVER if the soil is not drying or the rate is not known yet
+ */
+float drying_forecast_hours_to(const drying_forecast_t *pForecast, float threshold_pct);
+
+#endif /* MAIN_DRYING_FORECAST_H_ */
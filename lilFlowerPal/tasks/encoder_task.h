@@ -9,16 +9,40 @@
 #include <driver/pulse_cnt.h>
 #include <esp_err.h>
 
+#include <cosmos_devices.h>
 #include <main_tasks_common.h>
 
-#define PCNT_HIGH_LIMIT LIL_UI_TASK_SCREEN_COUNT
-#define PCNT_LOW_LIMIT  -LIL_UI_TASK_SCREEN_COUNT
+/*
+ * Every step reaches a limit, so the counter is reset to 0 by the
+ * hardware and the watch point at the limit reports the direction
+ */
+#define PCNT_HIGH_LIMIT 1
+#define PCNT_LOW_LIMIT  -1
 
 #define ENCODER_PIN_A   GPIO_NUM_4
 #define ENCODER_PIN_B   GPIO_NUM_17
 #define ENCODER_PIN_BTN GPIO_NUM_16
 
-#define ENCODER_FILTER_NS 1000 /*!< 1000ns hardware filter */
+#define ENCODER_FILTER_NS        1000 /*!< 1000ns hardware filter */
+#define ENCODER_EVENT_QUEUE_SIZE 16   /*!< Events the UI task can fall behind */
+
+/**
+ * @brief Encoder event types
+ *
+ */
+typedef enum {
+    ENCODER_EVENT_ROTATE, /*!< One step, value is +1 or -1 */
+    ENCODER_EVENT_BUTTON, /*!< Button press, value is a cosmos_devices_button_event_e */
+} encoder_event_type_t;
+
+/**
+ * @brief Event posted to encoder_config_t::event_queue from the PCNT ISR and the button engine
+ *
+ */
+typedef struct {
+    encoder_event_type_t type; /*!< Event type */
+    int value;                 /*!< Step direction or button event, see encoder_event_type_t */
+} encoder_event_t;
 
 /**
  * @brief Rotary encoder configuration structure
@@ -29,15 +53,20 @@ typedef struct {
     gpio_num_t pin_b;
     gpio_num_t pin_btn;
     pcnt_unit_handle_t pcnt_unit = NULL;
-    QueueHandle_t event_queue;
-    int32_t counter;
+    QueueHandle_t event_queue = NULL; /*!< encoder_event_t queue, created by encoder_init */
+    int32_t counter;                  /*!< Steps since boot, kept by the reader of event_queue */
 } encoder_config_t;
 
 /**
- * @brief Initialize the rotary encoder
+ * @brief Initialize the rotary encoder. Steps are posted to encoder->event_queue
+ *        from the PCNT ISR and presses of the button from the cosmos_devices
+ *        button engine, nothing polls the encoder. The engine is started here,
+ *        so no other button can be added to it.
  *
- * @param encoder
- * @return esp_err_t
+ * @param encoder Encoder configuration. This should last for the lifetime of the driver
+ * @return esp_err_t - ESP_OK on success,
+ *                     ESP_ERR_NO_MEM if the event queue can't be created
+ *                     appropriate error code otherwise
  */
 esp_err_t encoder_init(encoder_config_t *encoder);
 
@@ -0,0 +1,58 @@
+#ifndef MAIN_FLOWMETER_TASK_H_
+#define MAIN_FLOWMETER_TASK_H_
+
+#include <driver/gpio.h>
+#include <esp_err.h>
+
+#include <cosmos_sensor.h>
+#include <pump_task.h>
+
+#define FM_QTY PUMP_QTY /*!< One flowmeter per pump zone */
+
+// Flowmeter 1, 2, 3 and 4 GPIO definitions
+#define FM1_GPIO GPIO_NUM_13 /*!< GPIO pin for flowmeter of pump zone 1 */
+#define FM2_GPIO GPIO_NUM_5  /*!< GPIO pin for flowmeter of pump zone 2 */
+#define FM3_GPIO GPIO_NUM_15 /*!< GPIO pin for flowmeter of pump zone 3 */
+#define FM4_GPIO GPIO_NUM_36 /*!< GPIO pin for flowmeter of pump zone 4 */
+
+#define FM_PULSES_PER_LITRE 450.0f /*!< K-factor of the YF-S201 style flowmeters */
+#define FM_WINDOW_SIZE      5      /*!< Flow rate sliding window, in read periods */
+
+using flowmeter_rate_cb_t = void (*)(uint16_t endpoint_id, float litres_per_min, void *user_data);
+using flowmeter_volume_cb_t = void (*)(uint16_t endpoint_id, float run_litres, float total_litres, void *user_data);
+
+/**
+ * @brief Configuration structure for the flowmeters
+ *
+ */
+typedef struct {
+    flowmeter_rate_cb_t rate_cb = NULL;     /*!< Called when the windowed flow rate of a zone changes */
+    flowmeter_volume_cb_t volume_cb = NULL; /*!< Called at the end of every irrigation run */
+    uint16_t endpoint_id[FM_QTY];           /*!< Pump endpoint associated with each zone */
+    void *user_data = NULL;                 /*!< User data*/
+    uint32_t interval_ms = 1000;            /*!< PCNT readout interval in milliseconds, defaults to 1000 ms */
+} flowmeter_config_t;
+
+/**
+ * @brief Starts the PCNT units and the periodic readout.
+ *
+ * @param pConfig Flowmeter configuration. This should last for the lifetime of the driver
+ * @param pSensor Array of FM_QTY flowmeters, indexed by pump zone
+ *
+ * @return esp_err_t - ESP_OK on success,
+ *                     ESP_ERR_INVALID_ARG if an argument is NULL
+ *                     ESP_ERR_INVALID_STATE if driver is already initialized
+ *                     appropriate error code otherwise
+ */
+esp_err_t flowmeter_task_init(flowmeter_config_t *pConfig, cosmos_sensor_fm_t *pSensor);
+
+/**
+ * @brief Marks the start or the end of an irrigation run of a zone,
+ *        so the delivered volume can be accounted per run.
+ *
+ * @param zone Pump zone (0 .. FM_QTY - 1)
+ * @param running true when the pump is switched on
+ */
+void flowmeter_task_run_update(size_t zone, bool running);
+
+#endif /* MAIN_FLOWMETER_TASK_H_ */
@@ -0,0 +1,78 @@
+#ifndef MAIN_FORECAST_TASK_H_
+#define MAIN_FORECAST_TASK_H_
+
+#include <esp_err.h>
+#include <esp_matter.h>
+
+#include <drying_forecast.h>
+
+#define FORECAST_QTY 4 /*!< One forecast per soil moisture probe (SM1 .. SM4) */
+
+#define FORECAST_REPORT_MS         60000 /*!< Forecasts change slowly, no need to report every reading */
+#define FORECAST_DEFAULT_THRESHOLD 30    /*!< Soil moisture in % considered dry */
+
+// Manufacturer specific soil forecast cluster (test vendor 0xFFF1), on the soil moisture endpoints
+#define FORECAST_CLUSTER_ID          0xFFF1FC01
+#define FORECAST_ATTR_DRYING_RATE    0x0000 /*!< int16, moisture change in 0.01 %/h, negative while drying */
+#define FORECAST_ATTR_MINUTES_TO_DRY 0x0001 /*!< uint32, minutes until the dry threshold, 0xFFFFFFFF if unknown or not drying */
+#define FORECAST_ATTR_DRY_THRESHOLD  0x0002 /*!< uint8, writable, dry threshold in % */
+
+#define FORECAST_MINUTES_UNKNOWN 0xFFFFFFFF
+
+using forecast_cb_t = void (*)(uint16_t endpoint_id, float rate_pct_h, float hours_to_dry, void *user_data);
+
+/**
+ * @brief Configuration structure for the drying forecasts
+ *
+ */
+typedef struct {
+    forecast_cb_t cb = NULL;                   /*!< Called periodically with the rate and the hours to dry (DRYING_FORECAST_NEVER if unknown) */
+    uint16_t endpoint_id[FORECAST_QTY];        /*!< Soil moisture endpoint of each probe */
+    void *user_data = NULL;                    /*!< User data*/
+    uint32_t interval_ms = FORECAST_REPORT_MS; /*!< Reporting interval in milliseconds */
+} forecast_config_t;
+
+/**
+ * @brief Loads the dry thresholds from the Matter attributes and
+ *        starts the periodic reporting of the forecasts
+ *
+ * @param pConfig Forecast configuration. This should last for the lifetime of the driver
+ *
+ * @return esp_err_t - ESP_OK on success,
+ *                     ESP_ERR_INVALID_ARG if pConfig is NULL
+ *                     ESP_ERR_INVALID_STATE if driver is already initialized
+ *                     appropriate error code otherwise
+ */
+esp_err_t forecast_task_init(forecast_config_t *pConfig);
+
+/**
+ * @brief Feeds a soil moisture reading to the forecast of a probe, O(1)
+ *
+ * @param probe Probe index (0 .. FORECAST_QTY - 1)
+ * @param moisture_pct Soil moisture in %
+ */
+void forecast_task_add_sample(size_t probe, float moisture_pct);
+
+/**
+ * @brief Adds the FORECAST_CLUSTER_ID cluster to a soil moisture endpoint
+ *
+ * @param endpoint Soil moisture endpoint
+ *
+ * @return ESP_OK on success
+ */
+esp_err_t forecast_task_add_clusters(esp_matter::endpoint_t *endpoint);
+
+/**
+ * @brief Handles writes to the forecast cluster, called from `app_attribute_update_cb()`
+ *
+ * @param endpoint_id Endpoint ID of the attribute.
+ * @param cluster_id Cluster ID of the attribute.
+ * @param attribute_id Attribute ID of the attribute.
+ * @param val Pointer to `esp_matter_attr_val_t`.
+ *
+ * @return ESP_OK on success
+ */
+esp_err_t forecast_task_attribute_update(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id,
+                                         esp_matter_attr_val_t *val);
+
+#endif /* MAIN_FORECAST_TASK_H_ */
@@ -0,0 +1,55 @@
+#ifndef MAIN_INTERLOCK_TASK_H_
+#define MAIN_INTERLOCK_TASK_H_
+
+#include <esp_err.h>
+
+#include <cosmos_sensor.h>
+#include <dry_run.h>
+#include <pump_task.h>
+
+#define INTERLOCK_INTERVAL_MS 10 /*!< Fast sampling lane period for the water level channel */
+
+using interlock_cb_t = void (*)(uint16_t endpoint_id, bool fault, void *user_data);
+
+/**
+ * @brief Configuration structure for the dry-run interlock
+ *
+ */
+typedef struct {
+    interlock_cb_t cb = NULL;                     /*!< Called for every pump endpoint when the fault is latched or cleared */
+    uint16_t endpoint_id[PUMP_QTY];               /*!< Pump endpoints that show the fault */
+    void *user_data = NULL;                       /*!< User data*/
+    uint32_t interval_ms = INTERLOCK_INTERVAL_MS; /*!< Sampling interval in milliseconds */
+} interlock_config_t;
+
+/**
+ * @brief Starts the fast sampling lane of the water level sensor. When the tank
+ *        runs empty every pump GPIO is forced off from the timer callback itself,
+ *        without waiting for Matter, and the dry-run fault is latched.
+ *
+ * @param pConfig Interlock configuration. This should last for the lifetime of the driver
+ * @param pSensor Water level sensor (SNR_TYPE_WL), already configured by cosmos_sensor_begin
+ *
+ * @return esp_err_t - ESP_OK on success,
+ *                     ESP_ERR_INVALID_ARG if an argument is NULL
+ *                     ESP_ERR_INVALID_STATE if driver is already initialized
+ *                     appropriate error code otherwise
+ */
+esp_err_t interlock_task_init(interlock_config_t *pConfig, cosmos_sensor_t *pSensor);
+
+/**
+ * @brief Checks the dry-run fault latch. While latched no pump can be switched on.
+ *
+ * @return true if the fault is latched
+ */
+bool interlock_task_is_latched(void);
+
+/**
+ * @brief Clears the dry-run fault latch
+ *
+ * @return esp_err_t - ESP_OK on success,
+ *                     ESP_ERR_INVALID_STATE if the tank is still below WL_RECOVER_MV
+ */
+esp_err_t interlock_task_clear(void);
+
+#endif /* MAIN_INTERLOCK_TASK_H_ */
@@ -0,0 +1,44 @@
+#ifndef MAIN_IRRIGATION_MODEL_H_
+#define MAIN_IRRIGATION_MODEL_H_
+
+#include <stdint.h>
+
+#define IRRIGATION_MODEL_FEATURE_QTY 9
+
+/**
+ * @brief Input features of the irrigation model. Order must match
+ *        the FEATURES list used by 2_train_model.py
+ *
+ */
+typedef enum {
+    IRRIGATION_FEATURE_SM1 = 0,     /*!< soil_moisture_1 */
+    IRRIGATION_FEATURE_SM2,         /*!< soil_moisture_2 */
+    IRRIGATION_FEATURE_SM3,         /*!< soil_moisture_3 */
+    IRRIGATION_FEATURE_SM4,         /*!< soil_moisture_4 */
+    IRRIGATION_FEATURE_WL,          /*!< water_level */
+    IRRIGATION_FEATURE_TEMPERATURE, /*!< temperature */
+    IRRIGATION_FEATURE_HUMIDITY,    /*!< humidity */
+    IRRIGATION_FEATURE_PRESSURE,    /*!< pressure */
+    IRRIGATION_FEATURE_AIR_QUALITY, /*!< air_quality */
+} irrigation_model_feature_e;
+
+/**
+ * @brief Checks whether the firmware was built with a compiled forest
+ *        (main/model/irrigation_forest.h, see 5_export_model.py)
+ *
+ * @return true if a model is available
+ */
+bool irrigation_model_available(void);
+
+/**
+ * @brief Scores a feature vector with the compiled RandomForest.
+ *        Thresholds are int16 quantized, so every split is a single
+ *        integer compare and no dynamic memory is used.
+ *
+ * @param pFeatures Array of IRRIGATION_MODEL_FEATURE_QTY values, indexed by irrigation_model_feature_e
+ * @param pScore Optional output, probability of "needs watering" (0..1)
+ * @return int 1 if the pots need watering, 0 if not, -1 if no model is available
+ */
+int irrigation_model_predict(const float *pFeatures, float *pScore);
+
+#endif /* MAIN_IRRIGATION_MODEL_H_ */
@@ -0,0 +1,41 @@
+#ifndef MAIN_IRRIGATION_MODEL_TASK_H_
+#define MAIN_IRRIGATION_MODEL_TASK_H_
+
+#include <esp_err.h>
+
+#include <irrigation_model.h>
+
+using irrigation_model_cb_t = void (*)(int prediction, float score, void *user_data);
+
+/**
+ * @brief Configuration structure for the on-device irrigation model
+ *
+ */
+typedef struct {
+    irrigation_model_cb_t cb = NULL; /*!< This callback function will be called periodically with the latest prediction */
+    void *user_data = NULL;          /*!< User data*/
+    uint32_t interval_ms = 5000;     /*!< Scoring interval in milliseconds, defaults to 5000 ms */
+} irrigation_model_config_t;
+
+/**
+ * @brief Stores the latest value of a model feature. Call it from the
+ *        sensor callbacks, it only writes the cached feature vector.
+ *
+ * @param feature Feature to update
+ * @param value Value in the same units exported to Home Assistant
+ */
+void irrigation_model_task_set_feature(irrigation_model_feature_e feature, float value);
+
+/**
+ * @brief Starts the periodic scoring of the cached feature vector
+ *
+ * @param pConfig Model configuration. This should last for the lifetime of the driver
+ *
+ * @return esp_err_t - ESP_OK on success,
+ *                     ESP_ERR_INVALID_ARG if pConfig is NULL or has no callback
+ *                     ESP_ERR_INVALID_STATE if already initialized
+ *                     ESP_ERR_NOT_SUPPORTED if the firmware was built without a model
+ */
+esp_err_t irrigation_model_task_init(irrigation_model_config_t *pConfig);
+
+#endif /* MAIN_IRRIGATION_MODEL_TASK_H_ */
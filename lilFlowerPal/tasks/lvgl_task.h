@@ -3,6 +3,7 @@
 
 #include <driver/gpio.h>
 #include <driver/spi_master.h>
+#include <lvgl.h>
 
 #include <main_tasks_common.h>
 
@@ -23,6 +24,10 @@
 #define LCD_H_RES          240
 #define LCD_V_RES          240
 
+#define LVGL_TASK_QR_SCREEN LIL_UI_TASK_SCREEN_COUNT /*!< Commissioning screen, after the ones the encoder rotates through */
+
+extern lv_obj_t *screens[LIL_UI_TASK_SCREEN_COUNT + 1]; /*!< Defined by lil_ui_task */
+
 /**
  * @brief Notify LVGL task that device is commissioned
  *
@@ -21,11 +21,19 @@
 #define PUMP_TASK_PRIORITY   4
 #define PUMP_TASK_CORE_ID    1
 
+// Pump counters flush task
+#define PUMP_STATS_TASK_STACK_SIZE 3072
+#define PUMP_STATS_TASK_PRIORITY   1
+
+// Schedule task
+#define SCHEDULE_TASK_STACK_SIZE 4096
+#define SCHEDULE_TASK_PRIORITY   2
+
 // Lil UI task
 #define LIL_UI_TASK_STACK_SIZE   2048
 #define LIL_UI_TASK_PRIORITY     5
 #define LIL_UI_TASK_CORE_ID      -1
 #define LIL_UI_TASK_SCREEN_COUNT 4
-#define CONFIG_ENABLE_LVGL_UI    0
+#define CONFIG_ENABLE_LVGL_UI    0 /*!< Starts the LCD and encoder UI, its sources are built either way */
 
 #endif /* MAIN_TASKS_COMMON_H_ */
\ No newline at end of file
@@ -0,0 +1,67 @@
+#ifndef MAIN_PUMP_BANK_H_
+#define MAIN_PUMP_BANK_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+
+#include <pump_bank_hal.h>
+
+#define PUMP_BANK_MAX_PUMPS 32 /*!< One bit per pump in the on/off masks */
+
+/**
+ * @brief A set of relays switched together. Bit n of every
+ *        mask is pump n, in the order given to pump_bank_init.
+ *
+ */
+typedef struct {
+    pump_bank_regs_t regs;                  /*!< Output registers, real or fake */
+    uint32_t pin_mask[PUMP_BANK_MAX_PUMPS]; /*!< Register bit of each pump */
+    uint8_t pin_reg[PUMP_BANK_MAX_PUMPS];   /*!< Register (0 or 1) of each pump */
+    size_t qty;                             /*!< Number of pumps in the bank */
+    std::atomic<uint32_t> state;            /*!< Last mask written to the relays */
+} pump_bank_t;
+
+/**
+ * @brief Binds the pumps to their output registers. GPIO direction
+ *        must already be configured, nothing is written here.
+ *
+ * @param pBank Bank to initialize
+ * @param pRegs Output registers, PUMP_BANK_HAL_REGS() on target
+ * @param pPins GPIO number of each pump, must be output capable
+ * @param qty Number of pumps (1 .. PUMP_BANK_MAX_PUMPS)
+ * @return int 0 on success, -1 on invalid argument
+ */
+int pump_bank_init(pump_bank_t *pBank, const pump_bank_regs_t *pRegs, const int *pPins, size_t qty);
+
+/**
+ * @brief Switches the pumps selected by zone_mask to the state in on_mask,
+ *        the rest are left as they are. Relays turning off are cleared with a
+ *        single W1TC store and relays turning on with the following W1TS
+ *        store (one more pair only if the bank spans GPIO 32..39).
+ *        Safe to call from any task or timer callback.
+ *
+ * @param pBank Pump bank
+ * @param zone_mask Pumps to update
+ * @param on_mask New state of those pumps, bit set is on
+ */
+void pump_bank_write(pump_bank_t *pBank, uint32_t zone_mask, uint32_t on_mask);
+
+/**
+ * @brief Applies a whole bank state, same as pump_bank_write with every pump selected
+ *
+ * @param pBank Pump bank
+ * @param on_mask New state, bit set is on
+ */
+void pump_bank_apply(pump_bank_t *pBank, uint32_t on_mask);
+
+/**
+ * @brief Returns the last state written to the relays
+ *
+ * @param pBank Pump bank
+ * @return uint32_t Bit set is on
+ */
+uint32_t pump_bank_get(const pump_bank_t *pBank);
+
+#endif /* MAIN_PUMP_BANK_H_ */
@@ -0,0 +1,48 @@
+#ifndef MAIN_PUMP_BANK_HAL_H_
+#define MAIN_PUMP_BANK_HAL_H_
+
+#include <stdint.h>
+
+#define PUMP_BANK_HAL_PINS_PER_REG 32 /*!< GPIO 0..31 live in the first output register, 32..39 in the second */
+
+/**
+ * @brief Write-1-to-set / write-1-to-clear output registers. Writing a mask
+ *        only affects the pins whose bit is set, so no read-modify-write
+ *        is needed and the other GPIOs are never touched.
+ *
+ */
+typedef struct {
+    volatile uint32_t *out_w1ts;  /*!< Sets GPIO 0..31 */
+    volatile uint32_t *out_w1tc;  /*!< Clears GPIO 0..31 */
+    volatile uint32_t *out1_w1ts; /*!< Sets GPIO 32..39 */
+    volatile uint32_t *out1_w1tc; /*!< Clears GPIO 32..39 */
+} pump_bank_regs_t;
+
+#if defined(ESP_PLATFORM)
+#include <driver/gpio.h>
+#include <soc/gpio_struct.h>
+
+#define PUMP_BANK_HAL_IS_OUTPUT(pin) GPIO_IS_VALID_OUTPUT_GPIO(pin)
+
+/**
+ * @brief Real ESP32 GPIO output registers
+ *
+ */
+#define PUMP_BANK_HAL_REGS()              \
+    {                                     \
+        .out_w1ts = &GPIO.out_w1ts,       \
+        .out_w1tc = &GPIO.out_w1tc,       \
+        .out1_w1ts = &GPIO.out1_w1ts.val, \
+        .out1_w1tc = &GPIO.out1_w1tc.val, \
+    }
+#else
+/**
+ * @brief ESP32 output capable GPIOs: 0..33 without the missing 24 and 28..31,
+ *        34..39 are input only
+ *
+ */
+#define PUMP_BANK_HAL_OUTPUT_MASK    (0x3FFFFFFFFULL & ~(0xF0000000ULL | (1ULL << 24)))
+#define PUMP_BANK_HAL_IS_OUTPUT(pin) ((pin) >= 0 && (pin) < 64 && ((PUMP_BANK_HAL_OUTPUT_MASK >> (pin)) & 1))
+#endif
+
+#endif /* MAIN_PUMP_BANK_HAL_H_ */
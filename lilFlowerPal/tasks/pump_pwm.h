@@ -0,0 +1,69 @@
+#ifndef MAIN_PUMP_PWM_H_
+#define MAIN_PUMP_PWM_H_
+
+#include <driver/ledc.h>
+#include <esp_err.h>
+
+#include <pump_task.h>
+
+#define PUMP_PWM_SPEED_MODE    LEDC_HIGH_SPEED_MODE
+#define PUMP_PWM_TIMER         LEDC_TIMER_0
+#define PUMP_PWM_FIRST_CHANNEL LEDC_CHANNEL_0       /*!< Pump n uses channel PUMP_PWM_FIRST_CHANNEL + n */
+#define PUMP_PWM_FREQ_HZ       20000                /*!< Above the audible range, fine for MOSFET low side drivers */
+#define PUMP_PWM_RESOLUTION    LEDC_TIMER_10_BIT    /*!< Highest resolution available at 20 kHz is 11 bits */
+#define PUMP_PWM_MAX_DUTY      ((1 << 10) - 1)
+#define PUMP_PWM_RAMP_MS       1500                 /*!< Default soft-start time, from off to the target level */
+#define PUMP_PWM_STEP_MS       100                  /*!< Fade used for level changes while the pump is running */
+#define PUMP_PWM_MAX_LEVEL     254                  /*!< Matter LevelControl MaxLevel */
+
+/**
+ * @brief Sets up one LEDC channel per pump, all of them off. Ramps are
+ *        generated by the LEDC fade hardware, no task touches the pins.
+ *
+ * @param pPump Array of PUMP_QTY pump GPIOs
+ *
+ * @return ESP_OK on success
+ */
+esp_err_t pump_pwm_init(const gpio_pump_t *pPump);
+
+/**
+ * @brief Switches the pumps selected by zone_mask. Pumps turning on ramp
+ *        from 0 to their level in their ramp time, pumps turning off stop
+ *        right away. Safe to call from any task or timer callback.
+ *
+ * @param zone_mask Pumps to update, bit n is pump n
+ * @param on_mask New state of those pumps, bit set is on
+ *
+ * @return ESP_OK on success
+ */
+esp_err_t pump_pwm_write(uint32_t zone_mask, uint32_t on_mask);
+
+/**
+ * @brief Sets the running duty of a pump, used by the drip zones for low flow.
+ *        If the pump is running the duty fades to the new level in PUMP_PWM_STEP_MS.
+ *
+ * @param pump Pump index
+ * @param level 1 .. PUMP_PWM_MAX_LEVEL, same range as Matter CurrentLevel
+ *
+ * @return ESP_OK on success
+ */
+esp_err_t pump_pwm_set_level(size_t pump, uint8_t level);
+
+/**
+ * @brief Sets the soft-start time of a pump
+ *
+ * @param pump Pump index
+ * @param ramp_ms Time from off to the running level, 0 starts at full duty
+ *
+ * @return ESP_OK on success
+ */
+esp_err_t pump_pwm_set_ramp(size_t pump, uint16_t ramp_ms);
+
+/**
+ * @brief Returns the pumps currently on
+ *
+ * @return uint32_t Bit n set if pump n is on
+ */
+uint32_t pump_pwm_get_mask(void);
+
+#endif /* MAIN_PUMP_PWM_H_ */
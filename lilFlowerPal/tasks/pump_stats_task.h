@@ -0,0 +1,82 @@
+#ifndef MAIN_PUMP_STATS_TASK_H_
+#define MAIN_PUMP_STATS_TASK_H_
+
+#include <esp_err.h>
+#include <stdint.h>
+
+#include <pump_task.h>
+
+#define PUMP_STATS_CHECK_MS      60000     /*!< How often the flush conditions are checked */
+#define PUMP_STATS_FLUSH_S       (60 * 60) /*!< Pending changes are written at least once an hour */
+#define PUMP_STATS_FLUSH_RUNS    10        /*!< ... or after this many finished runs, whatever comes first */
+#define PUMP_STATS_NVS_NAMESPACE "pump_stats"
+
+/**
+ * @brief Lifetime counters of a pump
+ *
+ */
+typedef struct {
+    uint32_t on_time_s;  /*!< Total time on, in seconds */
+    uint32_t cycles;     /*!< Times the pump was switched on */
+    uint32_t last_run_s; /*!< Length of the last finished run, in seconds */
+    float litres;        /*!< Water delivered, from the flowmeter run volumes */
+} pump_stats_t;
+
+using pump_stats_cb_t = void (*)(uint16_t endpoint_id, const pump_stats_t *pStats, void *user_data);
+
+/**
+ * @brief Configuration structure for the pump counters
+ *
+ */
+typedef struct {
+    pump_stats_cb_t cb = NULL;                  /*!< Called when the counters of a pump change */
+    uint16_t endpoint_id[PUMP_QTY];             /*!< Pump endpoints */
+    void *user_data = NULL;                     /*!< User data*/
+    uint32_t interval_ms = PUMP_STATS_CHECK_MS; /*!< Flush check interval in milliseconds */
+} pump_stats_config_t;
+
+/**
+ * @brief Loads the counters from NVS, reports them once and starts
+ *        the batched flush timer. Counters are only updated in RAM
+ *        on each transition, NVS is written once per PUMP_STATS_FLUSH_RUNS
+ *        runs or PUMP_STATS_FLUSH_S seconds to limit flash wear.
+ *
+ * @param pConfig Counters configuration. This should last for the lifetime of the driver
+ *
+ * @return esp_err_t - ESP_OK on success,
+ *                     ESP_ERR_INVALID_ARG if pConfig is NULL
+ *                     ESP_ERR_INVALID_STATE if driver is already initialized
+ *                     appropriate error code otherwise
+ */
+esp_err_t pump_stats_task_init(pump_stats_config_t *pConfig);
+
+/**
+ * @brief Records a pump transition
+ *
+ * @param pump Pump index
+ * @param running true when the pump is switched on
+ */
+void pump_stats_task_run_update(size_t pump, bool running);
+
+/**
+ * @brief Adds the volume measured for a finished run
+ *
+ * @param pump Pump index
+ * @param litres Run volume
+ */
+void pump_stats_task_add_volume(size_t pump, float litres);
+
+/**
+ * @brief Writes the pending changes to NVS now
+ *
+ * @return esp_err_t ESP_OK on success
+ */
+esp_err_t pump_stats_task_flush(void);
+
+/**
+ * @brief Registers the "pumpstats" commands on the CHIP console
+ *
+ */
+void pump_stats_task_register_commands(void);
+
+#endif /* MAIN_PUMP_STATS_TASK_H_ */
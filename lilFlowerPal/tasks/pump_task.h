@@ -16,8 +16,33 @@
 #define PUMP3_GPIO GPIO_NUM_27
 #define PUMP4_GPIO GPIO_NUM_14
 
+#define PUMP_MASK_ALL ((1UL << PUMP_QTY) - 1) /*!< Bit n is pump n, see pump_task_set_mask */
+
 #define DEFAULT_POWER false
 
+// 0: relay outputs switched through the pump bank, 1: MOSFET outputs on LEDC with soft-start (pump_pwm)
+#ifndef PUMP_DRIVE_PWM
+#define PUMP_DRIVE_PWM 0
+#endif
+
+#define PUMP_STATE_KEY "pump_mask" /*!< cosmos_state key of the pump outputs, bit n is pump n */
+
+// 1: pumps running before a reset are switched back on at boot. A run cut by a brownout has no one left to stop it, so off by default
+#ifndef PUMP_RESTORE_RUNNING
+#define PUMP_RESTORE_RUNNING 0
+#endif
+
+// Manufacturer specific pump cluster (test vendor 0xFFF1), holds the irrigation accounting attributes
+#define PUMP_CLUSTER_ID              0xFFF1FC00
+#define PUMP_ATTR_LAST_RUN_VOLUME_ML 0x0000 /*!< uint32, millilitres delivered by the last run */
+#define PUMP_ATTR_TOTAL_VOLUME_ML    0x0001 /*!< uint32, millilitres delivered since boot */
+#define PUMP_ATTR_DRY_RUN_FAULT      0x0002 /*!< bool, latched by the water level interlock. Write false to clear it */
+#define PUMP_ATTR_RAMP_MS            0x0003 /*!< uint16, soft-start time in ms (PUMP_DRIVE_PWM only) */
+#define PUMP_ATTR_ON_TIME_S          0x0004 /*!< uint32, lifetime on-time in seconds */
+#define PUMP_ATTR_CYCLES             0x0005 /*!< uint32, lifetime switch-on count */
+#define PUMP_ATTR_LAST_RUN_S         0x0006 /*!< uint32, length of the last finished run in seconds */
+#define PUMP_ATTR_LIFETIME_VOLUME_L  0x0007 /*!< uint32, lifetime litres delivered */
+
 typedef void *pump_task_handle_t;
 
 typedef struct {
@@ -43,6 +68,46 @@ typedef struct {
  */
 esp_err_t pump_task_init(const gpio_pump_t *pPump);
 
+/**
+ * @brief Switches several pumps at once, all relays change in the same
+ *        register write. Meant for zone changes and scenes, the OnOff
+ *        attributes are not updated here.
+ *
+ * @param zone_mask Pumps to update, bit n is pump n
+ * @param on_mask New state of those pumps, bit set is on
+ *
+ * @return ESP_OK on success
+ *         ESP_ERR_INVALID_STATE if a pump is turned on while the dry-run fault is latched
+ */
+esp_err_t pump_task_set_mask(uint32_t zone_mask, uint32_t on_mask);
+
+/**
+ * @brief Brings the pumps back to the state saved before the last reset, if
+ *        PUMP_RESTORE_RUNNING allows it. Goes through pump_task_set_mask, so
+ *        call it once the interlock, flowmeter and stats tasks are running.
+ *        Only the first call after pump_task_init restores anything.
+ *
+ * @return uint32_t Pumps switched back on, their OnOff attributes are left to the caller
+ */
+uint32_t pump_task_restore(void);
+
+/**
+ * @brief Returns the current pump state
+ *
+ * @return uint32_t Bit n set if pump n is on
+ */
+uint32_t pump_task_get_mask(void);
+
+/**
+ * @brief Adds the pump specific clusters (flow measurement and
+ *        the manufacturer specific PUMP_CLUSTER_ID) to a pump endpoint
+ *
+ * @param endpoint Pump endpoint
+ *
+ * @return ESP_OK on success
+ */
+esp_err_t pump_task_add_clusters(esp_matter::endpoint_t *endpoint);
+
 /** Driver Update
  *
  * @brief This API should be called to update the driver for the attribute being updated.
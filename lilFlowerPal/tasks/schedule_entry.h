@@ -0,0 +1,55 @@
+#ifndef MAIN_SCHEDULE_ENTRY_H_
+#define MAIN_SCHEDULE_ENTRY_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+
+#define SCHEDULE_DOW_ALL 0x7F /*!< Every day of the week, bit 0 is Sunday */
+
+/**
+ * @brief Cron-like schedule entry. Fires at hour:minute (local time)
+ *        on every day set in dow_mask.
+ *
+ */
+typedef struct {
+    uint8_t enabled;     /*!< 0 disables the entry */
+    uint8_t zone;        /*!< Pump zone (0 .. PUMP_QTY - 1) */
+    uint8_t hour;        /*!< 0 .. 23 */
+    uint8_t minute;      /*!< 0 .. 59 */
+    uint8_t dow_mask;    /*!< Days of the week, bit 0 is Sunday */
+    uint8_t sm_skip_pct; /*!< Skip the run if the zone soil moisture is at or above this %, 0 never skips */
+    uint16_t duration_s; /*!< Run length before seasonal scaling */
+} schedule_entry_t;
+
+/**
+ * @brief Computes the first time after 'after' at which an entry fires.
+ *        No ESP-IDF in here, schedule_task keeps the clock and the plant
+ *        simulation runs the same decisions on the host.
+ *
+ * @param pEntry Schedule entry
+ * @param after Epoch to start from (exclusive)
+ * @return time_t Next fire, 0 if the entry never fires
+ */
+time_t schedule_entry_next_fire(const schedule_entry_t *pEntry, time_t after);
+
+/**
+ * @brief Checks the soil moisture skip condition of an entry
+ *
+ * @param pEntry Schedule entry
+ * @param soil_pct Latest soil moisture of the zone, in %
+ * @return true if the soil is already wet enough and the run is skipped
+ */
+bool schedule_entry_skips(const schedule_entry_t *pEntry, float soil_pct);
+
+/**
+ * @brief Run length of an entry fired at 'now', scaled by the season
+ *
+ * @param pEntry Schedule entry
+ * @param pSeason 12 values, one per month (January first), in % of the entry duration
+ * @param now Epoch of the fire
+ * @return uint32_t Run length in seconds, 0 if there is nothing to run
+ */
+uint32_t schedule_entry_run_s(const schedule_entry_t *pEntry, const uint8_t *pSeason, time_t now);
+
+#endif /* MAIN_SCHEDULE_ENTRY_H_ */
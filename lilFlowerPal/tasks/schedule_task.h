@@ -0,0 +1,84 @@
+#ifndef MAIN_SCHEDULE_TASK_H_
+#define MAIN_SCHEDULE_TASK_H_
+
+#include <esp_err.h>
+#include <stdint.h>
+
+#include <pump_task.h>
+#include <schedule_entry.h>
+
+#define SCHEDULE_MAX_ENTRIES   16         /*!< Schedule entries stored in NVS */
+#define SCHEDULE_TICK_MS       5000       /*!< Evaluation period of the schedule timer */
+#define SCHEDULE_CATCHUP_S     (30 * 60)  /*!< Runs missed by less than this (e.g. during a reboot) are still fired */
+#define SCHEDULE_VALID_EPOCH   1704067200 /*!< 2024-01-01, system time below this is considered not set */
+#define SCHEDULE_CLOCK_SAVE_S  (60 * 60)  /*!< The last known time is saved at least this often, the schedule runs from it until the clock is set */
+#define SCHEDULE_NVS_NAMESPACE "schedule"
+#define SCHEDULE_SNTP_SERVER   "pool.ntp.org"
+#define SCHEDULE_TZ            "CET-1CEST,M3.5.0,M10.5.0/3" /*!< POSIX TZ string, entries are in this local time */
+
+using schedule_cb_t = void (*)(size_t zone, bool on, void *user_data);
+
+/**
+ * @brief Configuration structure for the schedule engine
+ *
+ */
+typedef struct {
+    schedule_cb_t cb = NULL;                 /*!< Called to switch a pump zone on and off */
+    void *user_data = NULL;                  /*!< User data*/
+    uint32_t interval_ms = SCHEDULE_TICK_MS; /*!< Evaluation interval in milliseconds */
+} schedule_config_t;
+
+/**
+ * @brief Loads the schedule from NVS, resumes any run interrupted by a reboot
+ *        and starts the evaluation task and timer. Runs on the local clock only, so it
+ *        keeps working through network or hub outages. After a reboot without
+ *        time sync it runs from the last saved time plus the time since boot.
+ *
+ * @param pConfig Schedule configuration. This should last for the lifetime of the driver
+ *
+ * @return esp_err_t - ESP_OK on success,
+ *                     ESP_ERR_INVALID_ARG if pConfig is NULL or has no callback
+ *                     ESP_ERR_INVALID_STATE if driver is already initialized
+ *                     appropriate error code otherwise
+ */
+esp_err_t schedule_task_init(schedule_config_t *pConfig);
+
+/**
+ * @brief Stores an entry in NVS and recomputes the next fire time
+ *
+ * @param idx Entry slot (0 .. SCHEDULE_MAX_ENTRIES - 1)
+ * @param pEntry Entry to store, NULL deletes the slot
+ * @return esp_err_t ESP_OK on success
+ */
+esp_err_t schedule_task_set_entry(size_t idx, const schedule_entry_t *pEntry);
+
+/**
+ * @brief Stores the seasonal scaling table in NVS
+ *
+ * @param pScale 12 values, one per month (January first), in % of the entry duration
+ * @return esp_err_t ESP_OK on success
+ */
+esp_err_t schedule_task_set_season(const uint8_t *pScale);
+
+/**
+ * @brief Starts SNTP, so the schedule runs on the real clock. Called once the
+ *        network is up, later calls do nothing.
+ *
+ */
+void schedule_task_sync_time(void);
+
+/**
+ * @brief Keeps the latest soil moisture of a zone, used by the skip conditions
+ *
+ * @param zone Pump zone
+ * @param pct Soil moisture in %
+ */
+void schedule_task_set_soil_moisture(size_t zone, float pct);
+
+/**
+ * @brief Registers the "schedule" commands on the CHIP console
+ *
+ */
+void schedule_task_register_commands(void);
+
+#endif /* MAIN_SCHEDULE_TASK_H_ */
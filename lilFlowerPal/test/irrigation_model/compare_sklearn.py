@@ -0,0 +1,67 @@
+"""
+Host test for the on-device irrigation model.
+
+Compiles irrigation_model.pkl into main/model/irrigation_forest.h, builds
+irrigation_model_test and checks that every prediction on the exported
+dataset matches sklearn's model.predict() exactly. With --golden the
+sklearn predictions are also written as the golden vectors the test
+checks on its own (golden.csv, next to this script).
+
+    python3 compare_sklearn.py --model irrigation_model.pkl --data irrigation_data.csv --golden
+"""
+import argparse
+import os
+import subprocess
+import sys
+
+import joblib
+import pandas as pd
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+EXPORTER = os.path.join(HERE, "..", "..", "..", "homeAssistant",
+                        "AI-Driven Irrigation with Matter + Home Assistant", "5_export_model.py")
+HEADER = os.path.join(HERE, "..", "..", "main", "model", "irrigation_forest.h")
+BUILD = os.path.join(HERE, "build")
+GOLDEN = os.path.join(HERE, "golden.csv")
+
+sys.path.insert(0, os.path.dirname(EXPORTER))
+FEATURES = __import__("5_export_model").FEATURES
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--model", required=True)
+    parser.add_argument("--data", required=True)
+    parser.add_argument("--golden", action="store_true", help="Write the sklearn predictions to golden.csv")
+    args = parser.parse_args()
+
+    subprocess.check_call([sys.executable, EXPORTER, "--model", args.model, "--out", HEADER])
+    subprocess.check_call(["cmake", "-S", HERE, "-B", BUILD])
+    subprocess.check_call(["cmake", "--build", BUILD])
+
+    out = subprocess.check_output([os.path.join(BUILD, "irrigation_model_test"), args.data], text=True)
+    device = [int(v) for v in out.split()]
+
+    model = joblib.load(args.model)
+    data = pd.read_csv(args.data)[FEATURES]
+    expected = model.predict(data).astype(int).tolist()
+
+    if len(device) != len(expected):
+        print("FAIL: %d device predictions, %d sklearn predictions" % (len(device), len(expected)))
+        return 1
+
+    mismatches = [i for i, (d, e) in enumerate(zip(device, expected)) if d != e]
+    if mismatches:
+        print("FAIL: %d of %d rows differ, first at row %d" % (len(mismatches), len(expected), mismatches[0]))
+        return 1
+
+    print("PASS: %d rows match sklearn" % len(expected))
+
+    if args.golden:
+        data.assign(prediction=expected).to_csv(GOLDEN, index=False)
+        print("Wrote %s" % GOLDEN)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
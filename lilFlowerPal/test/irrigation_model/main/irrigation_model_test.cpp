@@ -0,0 +1,134 @@
+/**
+ * @file irrigation_model_test.cpp
+ * @author Marcel Nahir Samur (mnsamur2014@gmail.com)
+ * @brief Checks the compiled forest against the golden sklearn predictions,
+ *        or prints one prediction per row of a dataset for compare_sklearn.py
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include <cosmos_test.h>
+#include <irrigation_model.h>
+
+static const char *k_feature_names[IRRIGATION_MODEL_FEATURE_QTY] = {
+    "soil_moisture_1", "soil_moisture_2", "soil_moisture_3", "soil_moisture_4",
+    "water_level", "temperature", "humidity", "pressure", "air_quality"};
+
+/**
+ * @brief Reads the feature columns of a CSV, and the prediction column if it has one
+ *
+ * @param pPath CSV file, with a header row
+ * @param rows Feature vectors, IRRIGATION_MODEL_FEATURE_QTY values per row
+ * @param expected sklearn predictions, left empty if the CSV has no prediction column
+ * @return int 0 on success, 2 if the file can't be read
+ */
+static int irrigation_model_test_load(const char *pPath, std::vector<float> &rows, std::vector<int> &expected)
+{
+    FILE *pFile = fopen(pPath, "r");
+    if (!pFile) {
+        perror(pPath);
+        return 2;
+    }
+
+    // Map CSV columns to model features
+    char line[4096];
+    int column_of[IRRIGATION_MODEL_FEATURE_QTY];
+    int prediction_column = -1;
+    if (!fgets(line, sizeof(line), pFile)) {
+        fprintf(stderr, "empty csv\n");
+        fclose(pFile);
+        return 2;
+    }
+    for (int f = 0; f < IRRIGATION_MODEL_FEATURE_QTY; f++)
+        column_of[f] = -1;
+
+    int col = 0;
+    for (char *pTok = strtok(line, ",\r\n"); pTok; pTok = strtok(NULL, ",\r\n"), col++) {
+        for (int f = 0; f < IRRIGATION_MODEL_FEATURE_QTY; f++) {
+            if (strcmp(pTok, k_feature_names[f]) == 0)
+                column_of[f] = col;
+        }
+        if (strcmp(pTok, "prediction") == 0 && col < 64)
+            prediction_column = col;
+    }
+    for (int f = 0; f < IRRIGATION_MODEL_FEATURE_QTY; f++) {
+        if (column_of[f] < 0 || column_of[f] >= 64) {
+            fprintf(stderr, "missing column %s\n", k_feature_names[f]);
+            fclose(pFile);
+            return 2;
+        }
+    }
+
+    while (fgets(line, sizeof(line), pFile)) {
+        float values[64] = {0};
+        col = 0;
+        for (char *pCur = line; pCur && col < 64; col++) {
+            values[col] = strtof(pCur, NULL);
+            pCur = strchr(pCur, ',');
+            if (pCur)
+                pCur++;
+        }
+        for (int f = 0; f < IRRIGATION_MODEL_FEATURE_QTY; f++)
+            rows.push_back(values[column_of[f]]);
+        if (prediction_column >= 0)
+            expected.push_back((int)values[prediction_column]);
+    }
+    fclose(pFile);
+
+    return 0;
+}
+
+/*
+ * Without arguments the golden vectors (sklearn predictions
+ * on the fixture dataset) are checked against the compiled
+ * forest. With a CSV one prediction per row is printed, so
+ * compare_sklearn.py can diff it against model.predict()
+ */
+int main(int argc, char **argv)
+{
+    const char *pPath = argc >= 2 ? argv[1] : IRRIGATION_MODEL_GOLDEN_CSV;
+    std::vector<float> rows;
+    std::vector<int> expected;
+
+    if (!irrigation_model_available()) {
+        fprintf(stderr, "built without main/model/irrigation_forest.h\n");
+        return 2;
+    }
+    if (irrigation_model_test_load(pPath, rows, expected) != 0)
+        return 2;
+
+    size_t row_qty = rows.size() / IRRIGATION_MODEL_FEATURE_QTY;
+    std::vector<int> predictions(row_qty);
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < row_qty; r++)
+        predictions[r] = irrigation_model_predict(&rows[r * IRRIGATION_MODEL_FEATURE_QTY], NULL);
+    auto elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+    fprintf(stderr, "%zu rows, %.3f us per prediction\n", row_qty, row_qty ? elapsed / row_qty : 0.0);
+
+    if (argc >= 2) {
+        for (int p : predictions)
+            printf("%d\n", p);
+        return 0;
+    }
+
+    CHECK(row_qty > 0);
+    CHECK(expected.size() == row_qty);
+    for (size_t r = 0; r < row_qty && r < expected.size(); r++)
+        CHECK(predictions[r] == expected[r]);
+
+    // A missing feature vector is refused instead of read
+    CHECK(irrigation_model_predict(NULL, NULL) == -1);
+
+    return cosmos_test_report();
+}
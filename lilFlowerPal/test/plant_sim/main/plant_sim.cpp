@@ -0,0 +1,254 @@
+/**
+ * @file plant_sim.cpp
+ * @author Marcel Nahir Samur (mnsamur2014@gmail.com)
+ * @brief Soil water and tank model driven by the pump relays
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <math.h>
+#include <string.h>
+
+#include <plant_sim.h>
+
+#define US_PER_S   1000000LL
+#define S_PER_HOUR 3600.0f
+#define S_PER_DAY  86400.0f
+#define PI_F       3.14159265f
+
+#define VPD_REF_KPA 1.584f /*!< Vapour pressure deficit at 25 C and 50 %RH */
+#define NIGHT_ET    0.1f   /*!< Fraction of the ET left at night, stomata mostly closed */
+#define NOISE_TAU_H 6.0f   /*!< Weather noise correlation time */
+
+plant_sim_zone_cfg_t plant_sim_default_zone(void)
+{
+    plant_sim_zone_cfg_t zone = {
+        .soil_litres = 10.0f,
+        .saturation = 0.45f,
+        .field_capacity = 0.35f,
+        .wilting_point = 0.10f,
+        .depletion = 0.5f,
+        .drain_per_h = 0.5f,
+        .et_mm_per_h = 0.4f,
+        .surface_cm2 = 450.0f,
+        .pump_l_per_min = 1.5f,
+    };
+    return zone;
+}
+
+plant_sim_env_cfg_t plant_sim_default_env(void)
+{
+    plant_sim_env_cfg_t env = {
+        .temp_mean_c = 18.0f,
+        .temp_swing_c = 6.0f,
+        .temp_season_c = 10.0f,
+        .rh_mean_pct = 60.0f,
+        .rh_swing_pct = 20.0f,
+        .noise = 0.3f,
+        .tank_litres = 20.0f,
+        .refill_days = 7.0f,
+        .seed = 1,
+    };
+    return env;
+}
+
+/**
+ * @brief xorshift64*, uniform in [-1, 1]
+ *
+ * @param pSim Simulation state
+ * @return float Random value
+ */
+static float plant_sim_rand(plant_sim_t *pSim)
+{
+    pSim->rng ^= pSim->rng >> 12;
+    pSim->rng ^= pSim->rng << 25;
+    pSim->rng ^= pSim->rng >> 27;
+    uint64_t r = pSim->rng * 2685821657736338717ULL;
+    return (float)(r >> 40) / (float)(1 << 23) - 1.0f;
+}
+
+void plant_sim_reset(plant_sim_t *pSim)
+{
+    memset((void *)&pSim->gpio, 0, sizeof(pSim->gpio));
+    pSim->now_us = 0;
+    pSim->tank = pSim->env.tank_litres;
+    pSim->refills = 0;
+    pSim->rng = 0x9E3779B97F4A7C15ULL ^ pSim->env.seed;
+    pSim->noise_state = 0.0f;
+
+    for (size_t i = 0; i < PLANT_SIM_ZONES; i++) {
+        pSim->theta[i] = pSim->zone[i].field_capacity;
+        pSim->delivered_l[i] = 0.0;
+        pSim->dry_run_s[i] = 0.0;
+        pSim->drained_l[i] = 0.0;
+        pSim->stress_s[i] = 0.0;
+        pSim->soggy_s[i] = 0.0;
+    }
+
+    pSim->temp_c = pSim->env.temp_mean_c;
+    pSim->rh_pct = pSim->env.rh_mean_pct;
+}
+
+pump_bank_regs_t plant_sim_regs(plant_sim_t *pSim)
+{
+    pump_bank_regs_t regs = {
+        .out_w1ts = &pSim->gpio.out_w1ts,
+        .out_w1tc = &pSim->gpio.out_w1tc,
+        .out1_w1ts = &pSim->gpio.out1_w1ts,
+        .out1_w1tc = &pSim->gpio.out1_w1tc,
+    };
+    return regs;
+}
+
+void plant_sim_latch(plant_sim_t *pSim)
+{
+    plant_sim_gpio_t *pGpio = &pSim->gpio;
+    pGpio->out = (pGpio->out & ~pGpio->out_w1tc) | pGpio->out_w1ts;
+    pGpio->out1 = (pGpio->out1 & ~pGpio->out1_w1tc) | pGpio->out1_w1ts;
+    pGpio->out_w1ts = 0;
+    pGpio->out_w1tc = 0;
+    pGpio->out1_w1ts = 0;
+    pGpio->out1_w1tc = 0;
+}
+
+bool plant_sim_pump_on(const plant_sim_t *pSim, size_t zone)
+{
+    int pin = pSim->pin[zone];
+    if (pin < PUMP_BANK_HAL_PINS_PER_REG) {
+        return pSim->gpio.out & (1UL << pin);
+    }
+    return pSim->gpio.out1 & (1UL << (pin - PUMP_BANK_HAL_PINS_PER_REG));
+}
+
+/**
+ * @brief Diurnal and seasonal climate plus slowly varying noise
+ *
+ * @param pSim Simulation state
+ * @param dt_s Step in seconds
+ */
+static void plant_sim_weather(plant_sim_t *pSim, float dt_s)
+{
+    const plant_sim_env_cfg_t *pEnv = &pSim->env;
+    float t_s = (float)(pSim->now_us / US_PER_S);
+    float day = t_s / S_PER_DAY;
+    float hour = fmodf(t_s, S_PER_DAY) / S_PER_HOUR;
+
+    // Ornstein-Uhlenbeck noise with unit variance, the uniform sample is scaled to unit variance too
+    float a = dt_s / (NOISE_TAU_H * S_PER_HOUR);
+    pSim->noise_state += -a * pSim->noise_state + sqrtf(2.0f * a) * 1.7320508f * plant_sim_rand(pSim);
+    float noise = pEnv->noise * pSim->noise_state;
+
+    // Warmest at 15:00, the season peaks half a year after day 0
+    float diurnal = sinf(2.0f * PI_F * (hour - 9.0f) / 24.0f);
+    float season = 0.5f * (1.0f - cosf(2.0f * PI_F * day / 365.0f));
+
+    pSim->temp_c = pEnv->temp_mean_c + pEnv->temp_season_c * season + pEnv->temp_swing_c * (diurnal + noise);
+    pSim->rh_pct = pEnv->rh_mean_pct - pEnv->rh_swing_pct * (diurnal + noise);
+    if (pSim->rh_pct < 10.0f) {
+        pSim->rh_pct = 10.0f;
+    } else if (pSim->rh_pct > 100.0f) {
+        pSim->rh_pct = 100.0f;
+    }
+}
+
+/**
+ * @brief Evapotranspiration scale, vapour pressure deficit over the 25 C / 50 %RH reference,
+ *        weighted by daylight so that the daily mean is close to 1 at the reference climate
+ *
+ * @param pSim Simulation state
+ * @return float Scale factor of et_mm_per_h
+ */
+static float plant_sim_et_scale(const plant_sim_t *pSim)
+{
+    float t_s = (float)(pSim->now_us / US_PER_S);
+    float hour = fmodf(t_s, S_PER_DAY) / S_PER_HOUR;
+
+    float es = 0.6108f * expf(17.27f * pSim->temp_c / (pSim->temp_c + 237.3f));
+    float vpd = es * (1.0f - pSim->rh_pct / 100.0f);
+
+    float sun = sinf(2.0f * PI_F * (hour - 6.0f) / 24.0f);
+    float light = NIGHT_ET + (1.0f - NIGHT_ET) * PI_F * (sun > 0.0f ? sun : 0.0f);
+
+    return light * vpd / VPD_REF_KPA;
+}
+
+void plant_sim_step(plant_sim_t *pSim, float dt_s)
+{
+    plant_sim_latch(pSim);
+    plant_sim_weather(pSim, dt_s);
+
+    float dt_h = dt_s / S_PER_HOUR;
+    float et_scale = plant_sim_et_scale(pSim);
+
+    for (size_t i = 0; i < PLANT_SIM_ZONES; i++) {
+        const plant_sim_zone_cfg_t *pZone = &pSim->zone[i];
+        float water_l = pSim->theta[i] * pZone->soil_litres;
+
+        // Pump, water is taken from the tank until it runs dry
+        if (plant_sim_pump_on(pSim, i)) {
+            float want = pZone->pump_l_per_min * dt_s / 60.0f;
+            float got = want < pSim->tank ? want : pSim->tank;
+            pSim->tank -= got;
+            pSim->delivered_l[i] += got;
+            pSim->dry_run_s[i] += dt_s * (1.0f - got / want);
+            water_l += got;
+        }
+
+        // Evapotranspiration, full rate until the readily available water is used,
+        // then falling linearly to zero at the wilting point (FAO-56 Ks)
+        float available = pZone->field_capacity - pZone->wilting_point;
+        float stressed = pZone->field_capacity - pZone->depletion * available;
+        float ks = (pSim->theta[i] - pZone->wilting_point) / (stressed - pZone->wilting_point);
+        ks = ks < 0.0f ? 0.0f : (ks > 1.0f ? 1.0f : ks);
+        water_l -= pZone->et_mm_per_h * et_scale * dt_h * 0.01f * (pZone->surface_cm2 / 100.0f) * ks;
+
+        // Free drainage above field capacity, overflow above saturation
+        float excess = water_l - pZone->field_capacity * pZone->soil_litres;
+        if (excess > 0.0f) {
+            float drained = excess * (1.0f - expf(-pZone->drain_per_h * dt_h));
+            float overflow = water_l - drained - pZone->saturation * pZone->soil_litres;
+            if (overflow > 0.0f) {
+                drained += overflow;
+            }
+            water_l -= drained;
+            pSim->drained_l[i] += drained;
+        }
+
+        pSim->theta[i] = water_l / pZone->soil_litres;
+        if (pSim->theta[i] < stressed) {
+            pSim->stress_s[i] += dt_s;
+        } else if (pSim->theta[i] > pZone->field_capacity) {
+            pSim->soggy_s[i] += dt_s;
+        }
+    }
+
+    // Weekly tank refill by the user
+    int64_t next_us = pSim->now_us + (int64_t)(dt_s * US_PER_S);
+    if (pSim->env.refill_days > 0.0f) {
+        int64_t period_us = (int64_t)(pSim->env.refill_days * S_PER_DAY) * US_PER_S;
+        if (next_us / period_us != pSim->now_us / period_us) {
+            pSim->tank = pSim->env.tank_litres;
+            pSim->refills++;
+        }
+    }
+    pSim->now_us = next_us;
+}
+
+float plant_sim_sm_pct(const plant_sim_t *pSim, size_t zone)
+{
+    return 100.0f * pSim->theta[zone] / pSim->zone[zone].saturation;
+}
+
+int plant_sim_sm_mv(const plant_sim_t *pSim, size_t zone)
+{
+    float pct = plant_sim_sm_pct(pSim, zone);
+    return PLANT_SIM_SM_DRY_MV - (int)(pct * (PLANT_SIM_SM_DRY_MV - PLANT_SIM_SM_WET_MV) / 100.0f);
+}
+
+int plant_sim_wl_mv(const plant_sim_t *pSim)
+{
+    return (int)(PLANT_SIM_WL_FULL_MV * pSim->tank / pSim->env.tank_litres);
+}
@@ -0,0 +1,168 @@
+#ifndef PLANT_SIM_H_
+#define PLANT_SIM_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <pump_bank_hal.h>
+
+#define PLANT_SIM_ZONES 4 /*!< Same as PUMP_QTY on the device */
+
+#define PLANT_SIM_SM_DRY_MV  3000 /*!< Soil probe reading in dry soil, see soil_sensor_notification */
+#define PLANT_SIM_SM_WET_MV  1500 /*!< Soil probe reading in saturated soil */
+#define PLANT_SIM_WL_FULL_MV 2800 /*!< Water level reading with a full tank */
+
+/**
+ * @brief Fake ESP32 GPIO output block. Controllers write the W1TS/W1TC
+ *        registers through pump_bank, plant_sim_latch() applies them to
+ *        out/out1 and the model reads the relay state back from there.
+ *
+ */
+typedef struct {
+    volatile uint32_t out;
+    volatile uint32_t out_w1ts;
+    volatile uint32_t out_w1tc;
+    volatile uint32_t out1;
+    volatile uint32_t out1_w1ts;
+    volatile uint32_t out1_w1tc;
+} plant_sim_gpio_t;
+
+/**
+ * @brief Physical parameters of a pot. Water content is volumetric (m3/m3).
+ *
+ */
+typedef struct {
+    float soil_litres;    /*!< Soil volume of the pot */
+    float saturation;     /*!< Water content of saturated soil */
+    float field_capacity; /*!< Above this the pot drains */
+    float wilting_point;  /*!< Below this the plant stops drinking */
+    float depletion;      /*!< Fraction of the available water used before the plant is stressed */
+    float drain_per_h;    /*!< Fraction of the excess over field capacity drained per hour */
+    float et_mm_per_h;    /*!< Evapotranspiration at 25 C, 50 %RH and no water stress */
+    float surface_cm2;    /*!< Evaporating surface of the pot */
+    float pump_l_per_min; /*!< Flow of the zone pump */
+} plant_sim_zone_cfg_t;
+
+/**
+ * @brief Climate and tank parameters
+ *
+ */
+typedef struct {
+    float temp_mean_c;   /*!< Daily mean temperature at day 0 */
+    float temp_swing_c;  /*!< Day/night amplitude */
+    float temp_season_c; /*!< Mean temperature change over half a year */
+    float rh_mean_pct;   /*!< Daily mean relative humidity */
+    float rh_swing_pct;  /*!< Day/night amplitude, opposite to the temperature */
+    float noise;         /*!< Standard deviation of the weather noise, fraction of the swing */
+    float tank_litres;   /*!< Tank capacity */
+    float refill_days;   /*!< The tank is refilled every this many days, 0 never */
+    uint32_t seed;       /*!< Weather noise seed, same seed same run */
+} plant_sim_env_cfg_t;
+
+/**
+ * @brief Simulation state
+ *
+ */
+typedef struct {
+    plant_sim_zone_cfg_t zone[PLANT_SIM_ZONES]; /*!< Pot of each zone */
+    plant_sim_env_cfg_t env;                    /*!< Climate and tank */
+    plant_sim_gpio_t gpio;                      /*!< Relays, written by pump_bank */
+    int pin[PLANT_SIM_ZONES];                   /*!< Relay GPIO of each zone */
+    int64_t now_us;                             /*!< Virtual time since the start */
+    float theta[PLANT_SIM_ZONES];               /*!< Water content of each pot */
+    float tank;                                 /*!< Litres left in the tank */
+    float temp_c;                               /*!< Current air temperature */
+    float rh_pct;                               /*!< Current relative humidity */
+    double delivered_l[PLANT_SIM_ZONES];        /*!< Water reaching each pot since the start */
+    double dry_run_s[PLANT_SIM_ZONES];          /*!< Seconds each pump ran with an empty tank */
+    double drained_l[PLANT_SIM_ZONES];          /*!< Water lost through the drainage holes */
+    double stress_s[PLANT_SIM_ZONES];           /*!< Seconds spent water stressed, see plant_sim_zone_cfg_t::depletion */
+    double soggy_s[PLANT_SIM_ZONES];            /*!< Seconds spent above field capacity */
+    uint32_t refills;                           /*!< Tank refills so far */
+    uint64_t rng;                               /*!< Random generator state */
+    float noise_state;                          /*!< Low-passed weather noise */
+} plant_sim_t;
+
+/**
+ * @brief Default pot, a 10 l basil/tomato container on a balcony
+ *
+ * @return plant_sim_zone_cfg_t Zone parameters
+ */
+plant_sim_zone_cfg_t plant_sim_default_zone(void);
+
+/**
+ * @brief Default climate, mild spring warming into summer, 20 l tank refilled weekly
+ *
+ * @return plant_sim_env_cfg_t Climate parameters
+ */
+plant_sim_env_cfg_t plant_sim_default_env(void);
+
+/**
+ * @brief Starts a simulation with every pot at field capacity and a full tank
+ *
+ * @param pSim Simulation state, zone and env must be filled in
+ */
+void plant_sim_reset(plant_sim_t *pSim);
+
+/**
+ * @brief Output registers of the fake GPIO block, to be given to pump_bank_init
+ *
+ * @param pSim Simulation state
+ * @return pump_bank_regs_t Registers
+ */
+pump_bank_regs_t plant_sim_regs(plant_sim_t *pSim);
+
+/**
+ * @brief Applies the W1TC/W1TS stores to the output registers and clears them.
+ *        The hardware does it on every store, so call it after each pump_bank
+ *        call, before the next one can overwrite the registers.
+ *
+ * @param pSim Simulation state
+ */
+void plant_sim_latch(plant_sim_t *pSim);
+
+/**
+ * @brief Advances virtual time. Relay stores not latched yet take effect
+ *        at the start of the step.
+ *
+ * @param pSim Simulation state
+ * @param dt_s Step in seconds, a few seconds keeps pump runs accurate
+ */
+void plant_sim_step(plant_sim_t *pSim, float dt_s);
+
+/**
+ * @brief Soil probe reading, same scale as the SM channels of the ADC
+ *
+ * @param pSim Simulation state
+ * @param zone Zone index
+ * @return int Reading in mV
+ */
+int plant_sim_sm_mv(const plant_sim_t *pSim, size_t zone);
+
+/**
+ * @brief Soil moisture in %, the same mapping done on the device
+ *
+ * @param pSim Simulation state
+ * @param zone Zone index
+ * @return float Moisture in %
+ */
+float plant_sim_sm_pct(const plant_sim_t *pSim, size_t zone);
+
+/**
+ * @brief Water level reading, same scale as the WL channel of the ADC
+ *
+ * @param pSim Simulation state
+ * @return int Reading in mV
+ */
+int plant_sim_wl_mv(const plant_sim_t *pSim);
+
+/**
+ * @brief Relay state read back from the fake output registers
+ *
+ * @param pSim Simulation state
+ * @param zone Zone index
+ * @return true if the zone pump is powered
+ */
+bool plant_sim_pump_on(const plant_sim_t *pSim, size_t zone);
+
+#endif /* PLANT_SIM_H_ */
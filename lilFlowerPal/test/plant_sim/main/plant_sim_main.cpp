@@ -0,0 +1,328 @@
+/**
+ * @file plant_sim_main.cpp
+ * @author Marcel Nahir Samur (mnsamur2014@gmail.com)
+ * @brief Closed-loop benchmark of the irrigation controllers. Pumps are switched
+ *        through pump_bank against the simulated relays, the soil and tank answer
+ *        on the next step, and months of virtual time run in seconds.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+#include <dry_run.h>
+#include <drying_forecast.h>
+#include <plant_sim.h>
+#include <pump_bank.h>
+#include <schedule_entry.h>
+
+#define SIM_STEP_S       1.0f /*!< Physics step, pump runs are accurate to one step */
+#define SIM_CONTROL_S    10   /*!< Controllers read the sensors this often */
+#define SIM_DEFAULT_DAYS 90
+
+#define SIM_US_PER_S   1000000LL
+#define SIM_US_PER_DAY (86400LL * SIM_US_PER_S)
+
+#define SIM_EPOCH 1735689600 /*!< 2025-01-01 00:00 UTC, virtual time 0 for the schedule entries */
+
+#define SIM_LOW_PCT   55        /*!< Controllers water below this, the plant is stressed below ~50 % */
+#define SIM_HIGH_PCT  75        /*!< and stop above this, field capacity is ~78 % */
+#define SIM_SKIP_PCT  65        /*!< Schedule skip, schedule_entry_t::sm_skip_pct */
+#define SIM_RUN_HOUR  7         /*!< Schedule and forecast controllers water at 07:00 */
+#define SIM_RUN_S     60        /*!< Fixed schedule run length */
+#define SIM_RUN_MAX_S (10 * 60) /*!< Safety cap of the forecast controller runs */
+#define SIM_HORIZON_H 24.0f     /*!< Forecast controller waters if the pot dries out before this */
+
+// Same wiring as lilFlowerPal: GPIO 25, 26, 27 and 14
+static const int k_pump_pins[PLANT_SIM_ZONES] = {25, 26, 27, 14};
+
+/**
+ * @brief One closed-loop run: plant, relays, interlock and controller state
+ *
+ */
+typedef struct {
+    plant_sim_t sim;                             /*!< Soil and tank */
+    pump_bank_t bank;                            /*!< Relays, the same driver pump_task uses */
+    bool interlock;                              /*!< Dry-run interlock enabled */
+    dry_run_t dry_run;                           /*!< Dry-run fault, the same decisions interlock_task makes */
+    uint32_t trips;                              /*!< Times the interlock tripped */
+    uint32_t cycles;                             /*!< Pump switch-ons */
+    int64_t last_run_day;                        /*!< Last day the daily controllers ran */
+    int64_t run_until_us[PLANT_SIM_ZONES];       /*!< End of the current timed run, 0 if none */
+    time_t next_fire[PLANT_SIM_ZONES];           /*!< Next fire of the schedule entry of each zone */
+    drying_forecast_t forecast[PLANT_SIM_ZONES]; /*!< Forecast controller state */
+} sim_run_t;
+
+using sim_controller_fn_t = void (*)(sim_run_t *pRun);
+
+/**
+ * @brief Controller under test
+ *
+ */
+typedef struct {
+    const char *name;       /*!< Name given on the command line */
+    sim_controller_fn_t fn; /*!< Called every SIM_CONTROL_S */
+} sim_controller_t;
+
+/**
+ * @brief pump_task_output_write on the simulated relays: dry_run_switch refuses
+ *        to switch anything on while the fault is latched, switch-ons are counted
+ *        like pump_stats_task does
+ *
+ * @param pRun Run state
+ * @param zone_mask Pumps to update
+ * @param on_mask New state of those pumps
+ * @return int 0 on success, -1 if refused
+ */
+static int sim_set_mask(sim_run_t *pRun, uint32_t zone_mask, uint32_t on_mask)
+{
+    uint32_t changed = 0;
+
+    if (!dry_run_switch(pRun->dry_run.latched, pump_bank_get(&pRun->bank), zone_mask, on_mask, &changed)) {
+        return -1;
+    }
+
+    pRun->cycles += __builtin_popcount(changed & on_mask);
+    pump_bank_write(&pRun->bank, zone_mask, on_mask);
+    plant_sim_latch(&pRun->sim);
+    return 0;
+}
+
+static bool sim_is_on(sim_run_t *pRun, size_t zone)
+{
+    return pump_bank_get(&pRun->bank) & (1UL << zone);
+}
+
+/**
+ * @brief Dry-run interlock, the decisions of interlock_task. The device samples every
+ *        10 ms, here the water level is checked once per physics step. On the device
+ *        the fault is cleared from Matter, here as soon as dry_run_clear allows it.
+ *
+ * @param pRun Run state
+ */
+static void sim_interlock(sim_run_t *pRun)
+{
+    if (dry_run_sample(&pRun->dry_run, plant_sim_wl_mv(&pRun->sim))) {
+        sim_set_mask(pRun, UINT32_MAX, 0);
+        pRun->trips++;
+    } else if (pRun->dry_run.latched) {
+        dry_run_clear(&pRun->dry_run);
+    }
+}
+
+/**
+ * @brief Virtual time as an epoch, for the schedule entries
+ *
+ * @param pRun Run state
+ */
+static time_t sim_epoch(sim_run_t *pRun)
+{
+    return SIM_EPOCH + (time_t)(pRun->sim.now_us / SIM_US_PER_S);
+}
+
+/**
+ * @brief True once a day at SIM_RUN_HOUR
+ *
+ * @param pRun Run state
+ */
+static bool sim_daily_slot(sim_run_t *pRun)
+{
+    int64_t day = pRun->sim.now_us / SIM_US_PER_DAY;
+    int64_t hour = (pRun->sim.now_us % SIM_US_PER_DAY) / (3600 * SIM_US_PER_S);
+
+    if (day == pRun->last_run_day || hour < SIM_RUN_HOUR) {
+        return false;
+    }
+    pRun->last_run_day = day;
+    return true;
+}
+
+// Never waters, baseline for the plant stress
+static void sim_controller_none(sim_run_t *pRun)
+{
+}
+
+// Hysteresis on the soil moisture, the classic cosmos_pump style controller
+static void sim_controller_threshold(sim_run_t *pRun)
+{
+    for (size_t i = 0; i < PLANT_SIM_ZONES; i++) {
+        float pct = plant_sim_sm_pct(&pRun->sim, i);
+        if (pct < SIM_LOW_PCT && !sim_is_on(pRun, i)) {
+            sim_set_mask(pRun, 1UL << i, 1UL << i);
+        } else if (pct >= SIM_HIGH_PCT && sim_is_on(pRun, i)) {
+            sim_set_mask(pRun, 1UL << i, 0);
+        }
+    }
+}
+
+// Fixed daily run with a soil moisture skip, fired through the schedule_task entry decisions
+static void sim_controller_schedule(sim_run_t *pRun)
+{
+    static const uint8_t k_season[12] = {100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100};
+    time_t now = sim_epoch(pRun);
+
+    for (size_t i = 0; i < PLANT_SIM_ZONES; i++) {
+        const schedule_entry_t entry = {
+            .enabled = 1,
+            .zone = (uint8_t)i,
+            .hour = SIM_RUN_HOUR,
+            .minute = 0,
+            .dow_mask = SCHEDULE_DOW_ALL,
+            .sm_skip_pct = SIM_SKIP_PCT,
+            .duration_s = SIM_RUN_S,
+        };
+
+        if (pRun->next_fire[i] == 0) {
+            pRun->next_fire[i] = schedule_entry_next_fire(&entry, now);
+        }
+        if (now >= pRun->next_fire[i]) {
+            uint32_t run_s = schedule_entry_run_s(&entry, k_season, now);
+            if (!schedule_entry_skips(&entry, plant_sim_sm_pct(&pRun->sim, i)) && run_s &&
+                sim_set_mask(pRun, 1UL << i, 1UL << i) == 0) {
+                pRun->run_until_us[i] = pRun->sim.now_us + run_s * SIM_US_PER_S;
+            }
+            pRun->next_fire[i] = schedule_entry_next_fire(&entry, now);
+        }
+        if (pRun->run_until_us[i] && pRun->sim.now_us >= pRun->run_until_us[i]) {
+            sim_set_mask(pRun, 1UL << i, 0);
+            pRun->run_until_us[i] = 0;
+        }
+    }
+}
+
+// Waters in the morning only the pots that drying_forecast expects to dry out before tomorrow
+static void sim_controller_forecast(sim_run_t *pRun)
+{
+    bool slot = sim_daily_slot(pRun);
+
+    for (size_t i = 0; i < PLANT_SIM_ZONES; i++) {
+        float pct = plant_sim_sm_pct(&pRun->sim, i);
+        drying_forecast_update(&pRun->forecast[i], pRun->sim.now_us, pct);
+
+        if (slot) {
+            float hours = drying_forecast_hours_to(&pRun->forecast[i], SIM_LOW_PCT);
+            bool dries = hours != DRYING_FORECAST_NEVER && hours < SIM_HORIZON_H;
+            if ((pct < SIM_LOW_PCT || dries) && sim_set_mask(pRun, 1UL << i, 1UL << i) == 0) {
+                pRun->run_until_us[i] = pRun->sim.now_us + SIM_RUN_MAX_S * SIM_US_PER_S;
+            }
+        }
+        if (pRun->run_until_us[i] && (pct >= SIM_HIGH_PCT || pRun->sim.now_us >= pRun->run_until_us[i])) {
+            sim_set_mask(pRun, 1UL << i, 0);
+            pRun->run_until_us[i] = 0;
+        }
+    }
+}
+
+static const sim_controller_t k_controllers[] = {
+    {"none", sim_controller_none},
+    {"threshold", sim_controller_threshold},
+    {"schedule", sim_controller_schedule},
+    {"forecast", sim_controller_forecast},
+};
+
+static void sim_run(const sim_controller_t *pController, int days, bool interlock, uint32_t seed)
+{
+    static sim_run_t run;
+    memset((void *)&run, 0, sizeof(run));
+
+    for (size_t i = 0; i < PLANT_SIM_ZONES; i++) {
+        run.sim.zone[i] = plant_sim_default_zone();
+        run.sim.pin[i] = k_pump_pins[i];
+        drying_forecast_reset(&run.forecast[i]);
+    }
+    run.sim.env = plant_sim_default_env();
+    run.sim.env.seed = seed;
+    run.interlock = interlock;
+    dry_run_reset(&run.dry_run);
+    run.last_run_day = -1;
+    plant_sim_reset(&run.sim);
+
+    pump_bank_regs_t regs = plant_sim_regs(&run.sim);
+    if (pump_bank_init(&run.bank, &regs, k_pump_pins, PLANT_SIM_ZONES) != 0) {
+        fprintf(stderr, "pump_bank_init failed\n");
+        exit(1);
+    }
+
+    int64_t steps = (int64_t)days * 86400 / (int64_t)SIM_STEP_S;
+    int64_t control_every = (int64_t)(SIM_CONTROL_S / SIM_STEP_S);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int64_t n = 0; n < steps; n++) {
+        if (run.interlock) {
+            sim_interlock(&run);
+        }
+        if (n % control_every == 0) {
+            pController->fn(&run);
+        }
+        plant_sim_step(&run.sim, SIM_STEP_S);
+    }
+    double wall_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    double water = 0, drained = 0, dry_run = 0, stress = 0, soggy = 0;
+    for (size_t i = 0; i < PLANT_SIM_ZONES; i++) {
+        water += run.sim.delivered_l[i];
+        drained += run.sim.drained_l[i];
+        dry_run += run.sim.dry_run_s[i];
+        stress += run.sim.stress_s[i];
+        soggy += run.sim.soggy_s[i];
+    }
+
+    printf("%-10s %9.1f %9.1f %9.1f %9.1f %9.0f %7u %6u %8.1f %10.0fx\n", pController->name, water, drained,
+           stress / 3600, soggy / 3600, dry_run, run.cycles, run.trips, wall_s * 1000,
+           (double)days * 86400 / wall_s);
+}
+
+int main(int argc, char **argv)
+{
+    int days = SIM_DEFAULT_DAYS;
+    const char *pName = "all";
+    bool interlock = true;
+    uint32_t seed = 1;
+
+    // Schedule entries fire on local time, the virtual clock is UTC
+    setenv("TZ", "UTC0", 1);
+    tzset();
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--days") == 0 && i + 1 < argc) {
+            days = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(argv[i], "--no-interlock") == 0) {
+            interlock = false;
+        } else if (argv[i][0] != '-') {
+            pName = argv[i];
+        } else {
+            fprintf(stderr, "usage: %s [all|none|threshold|schedule|forecast] [--days N] [--seed N] [--no-interlock]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (days <= 0) {
+        fprintf(stderr, "days must be positive\n");
+        return 2;
+    }
+
+    printf("%d days, %d zones, interlock %s, seed %u\n\n", days, PLANT_SIM_ZONES, interlock ? "on" : "off", seed);
+    printf("%-10s %9s %9s %9s %9s %9s %7s %6s %8s %11s\n", "controller", "water l", "drained l", "stress h",
+           "soggy h", "dry-run s", "cycles", "trips", "wall ms", "speed-up");
+
+    bool found = false;
+    for (size_t i = 0; i < sizeof(k_controllers) / sizeof(k_controllers[0]); i++) {
+        if (strcmp(pName, "all") == 0 || strcmp(pName, k_controllers[i].name) == 0) {
+            sim_run(&k_controllers[i], days, interlock, seed);
+            found = true;
+        }
+    }
+    if (!found) {
+        fprintf(stderr, "unknown controller %s\n", pName);
+        return 2;
+    }
+    return 0;
+}
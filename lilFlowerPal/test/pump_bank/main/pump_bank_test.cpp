@@ -0,0 +1,195 @@
+/**
+ * @file pump_bank_test.cpp
+ * @author Marcel Nahir Samur (mnsamur2014@gmail.com)
+ * @brief Runs the pump bank against a fake GPIO register file and checks
+ *        that every bank change is a single W1TS and a single W1TC store
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <cstdio>
+#include <thread>
+
+#include <cosmos_test.h>
+#include <pump_bank.h>
+
+#define UNTOUCHED 0xA5A5A5A5 /*!< Written to the W1TS/W1TC registers before each step, to spot stores */
+
+/**
+ * @brief Fake ESP32 GPIO output block. The W1TS/W1TC registers hold the
+ *        last value stored, latch() applies them to the output registers.
+ *
+ */
+typedef struct {
+    volatile uint32_t out;
+    volatile uint32_t out_w1ts;
+    volatile uint32_t out_w1tc;
+    volatile uint32_t out1;
+    volatile uint32_t out1_w1ts;
+    volatile uint32_t out1_w1tc;
+} fake_gpio_t;
+
+static void fake_gpio_arm(fake_gpio_t *pGpio)
+{
+    pGpio->out_w1ts = UNTOUCHED;
+    pGpio->out_w1tc = UNTOUCHED;
+    pGpio->out1_w1ts = UNTOUCHED;
+    pGpio->out1_w1tc = UNTOUCHED;
+}
+
+static void fake_gpio_latch(fake_gpio_t *pGpio)
+{
+    if (pGpio->out_w1tc != UNTOUCHED) {
+        pGpio->out = pGpio->out & ~pGpio->out_w1tc;
+    }
+    if (pGpio->out_w1ts != UNTOUCHED) {
+        pGpio->out = pGpio->out | pGpio->out_w1ts;
+    }
+    if (pGpio->out1_w1tc != UNTOUCHED) {
+        pGpio->out1 = pGpio->out1 & ~pGpio->out1_w1tc;
+    }
+    if (pGpio->out1_w1ts != UNTOUCHED) {
+        pGpio->out1 = pGpio->out1 | pGpio->out1_w1ts;
+    }
+}
+
+static pump_bank_regs_t fake_gpio_regs(fake_gpio_t *pGpio)
+{
+    pump_bank_regs_t regs = {
+        .out_w1ts = &pGpio->out_w1ts,
+        .out_w1tc = &pGpio->out_w1tc,
+        .out1_w1ts = &pGpio->out1_w1ts,
+        .out1_w1tc = &pGpio->out1_w1tc,
+    };
+    return regs;
+}
+
+// Same wiring as lilFlowerPal: GPIO 25, 26, 27 and 14
+static void test_lilflowerpal_bank(void)
+{
+    const int pins[] = {25, 26, 27, 14};
+    const uint32_t all_pins = (1UL << 25) | (1UL << 26) | (1UL << 27) | (1UL << 14);
+    fake_gpio_t gpio = {};
+    pump_bank_t bank;
+
+    pump_bank_regs_t regs = fake_gpio_regs(&gpio);
+    CHECK(pump_bank_init(&bank, &regs, pins, 4) == 0);
+
+    // Other outputs (e.g. a status LED on GPIO 2) must survive every bank change
+    gpio.out = 1UL << 2;
+
+    // Every pump on: one W1TS store, no W1TC store
+    fake_gpio_arm(&gpio);
+    pump_bank_apply(&bank, 0xF);
+    CHECK(gpio.out_w1ts == all_pins);
+    CHECK(gpio.out_w1tc == UNTOUCHED);
+    CHECK(gpio.out1_w1ts == UNTOUCHED && gpio.out1_w1tc == UNTOUCHED);
+    fake_gpio_latch(&gpio);
+    CHECK(gpio.out == (all_pins | (1UL << 2)));
+    CHECK(pump_bank_get(&bank) == 0xF);
+
+    // Zone swap 1,2 -> 3,4: both halves in one store each
+    pump_bank_apply(&bank, 0x3);
+    fake_gpio_latch(&gpio);
+    fake_gpio_arm(&gpio);
+    pump_bank_apply(&bank, 0xC);
+    CHECK(gpio.out_w1tc == ((1UL << 25) | (1UL << 26)));
+    CHECK(gpio.out_w1ts == ((1UL << 27) | (1UL << 14)));
+    fake_gpio_latch(&gpio);
+    CHECK(gpio.out == ((1UL << 27) | (1UL << 14) | (1UL << 2)));
+
+    // Partial update leaves the other pumps alone
+    fake_gpio_arm(&gpio);
+    pump_bank_write(&bank, 0x1, 0x1);
+    CHECK(gpio.out_w1ts == (1UL << 25));
+    CHECK(gpio.out_w1tc == UNTOUCHED);
+    fake_gpio_latch(&gpio);
+    CHECK(pump_bank_get(&bank) == 0xD);
+
+    // Everything off
+    fake_gpio_arm(&gpio);
+    pump_bank_apply(&bank, 0);
+    CHECK(gpio.out_w1tc == all_pins);
+    CHECK(gpio.out_w1ts == UNTOUCHED);
+    fake_gpio_latch(&gpio);
+    CHECK(gpio.out == (1UL << 2));
+    CHECK(pump_bank_get(&bank) == 0);
+}
+
+// A bank spanning both output registers
+static void test_high_pins(void)
+{
+    const int pins[] = {4, 32, 33};
+    fake_gpio_t gpio = {};
+    pump_bank_t bank;
+
+    pump_bank_regs_t regs = fake_gpio_regs(&gpio);
+    CHECK(pump_bank_init(&bank, &regs, pins, 3) == 0);
+
+    fake_gpio_arm(&gpio);
+    pump_bank_apply(&bank, 0x5); // GPIO 4 and 33 on, 32 off
+    CHECK(gpio.out_w1ts == (1UL << 4));
+    CHECK(gpio.out1_w1ts == (1UL << 1));
+    CHECK(gpio.out1_w1tc == (1UL << 0));
+    CHECK(gpio.out_w1tc == UNTOUCHED);
+}
+
+static void test_invalid_args(void)
+{
+    const int bad_pins[] = {25, 64};
+    const int pins[] = {25};
+    fake_gpio_t gpio = {};
+    pump_bank_t bank;
+
+    pump_bank_regs_t regs = fake_gpio_regs(&gpio);
+    CHECK(pump_bank_init(&bank, &regs, bad_pins, 2) == -1);
+
+    // Input only, missing and out of range pins
+    const int input_pins[] = {-1, 24, 30, 34, 39, 40};
+    for (int pin : input_pins) {
+        CHECK(pump_bank_init(&bank, &regs, &pin, 1) == -1);
+    }
+    CHECK(pump_bank_init(&bank, &regs, pins, 0) == -1);
+    CHECK(pump_bank_init(&bank, NULL, pins, 1) == -1);
+    CHECK(pump_bank_init(&bank, &regs, pins, PUMP_BANK_MAX_PUMPS + 1) == -1);
+}
+
+// The interlock timer and the Matter thread update different zones concurrently
+static void test_concurrent_state(void)
+{
+    const int pins[] = {25, 26, 27, 14};
+    fake_gpio_t gpio = {};
+    pump_bank_t bank;
+
+    pump_bank_regs_t regs = fake_gpio_regs(&gpio);
+    CHECK(pump_bank_init(&bank, &regs, pins, 4) == 0);
+
+    std::thread first([&bank]() {
+        for (int i = 0; i < 100000; i++) {
+            pump_bank_write(&bank, 0x3, (i & 1) ? 0x3 : 0);
+        }
+    });
+    std::thread second([&bank]() {
+        for (int i = 0; i < 100000; i++) {
+            pump_bank_write(&bank, 0xC, (i & 1) ? 0 : 0xC);
+        }
+    });
+    first.join();
+    second.join();
+
+    // Last writes: zones 1,2 on (i = 99999 odd), zones 3,4 off
+    CHECK(pump_bank_get(&bank) == 0x3);
+}
+
+int main(void)
+{
+    test_lilflowerpal_bank();
+    test_high_pins();
+    test_invalid_args();
+    test_concurrent_state();
+
+    return cosmos_test_report();
+}